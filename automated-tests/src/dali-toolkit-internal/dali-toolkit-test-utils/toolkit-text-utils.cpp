@@ -106,36 +106,34 @@ void CreateTextModel( const std::string& text,
   LogicalModelPtr logicalModel = textModel->mLogicalModel;
   VisualModelPtr visualModel = textModel->mVisualModel;
 
-  MarkupProcessData markupProcessData( logicalModel->mColorRuns,
-                                       logicalModel->mFontDescriptionRuns,
-                                       logicalModel->mEmbeddedItems );
+  // 1) Convert to utf32
+  Vector<Character>& utf32Characters = logicalModel->mText;
 
-  Length textSize = 0u;
-  const uint8_t* utf8 = NULL;
+  Length characterCount = 0u;
   if( markupProcessorEnabled )
   {
-    ProcessMarkupString( text, markupProcessData );
-    textSize = markupProcessData.markupProcessedText.size();
+    MarkupProcessData markupProcessData( logicalModel->mColorRuns,
+                                         logicalModel->mFontDescriptionRuns,
+                                         logicalModel->mEmbeddedItems,
+                                         utf32Characters );
 
-    // This is a bit horrible but std::string returns a (signed) char*
-    utf8 = reinterpret_cast<const uint8_t*>( markupProcessData.markupProcessedText.c_str() );
+    ProcessMarkupString( text, markupProcessData );
+    characterCount = utf32Characters.Count();
   }
   else
   {
-    textSize = text.size();
+    const Length textSize = text.size();
 
     // This is a bit horrible but std::string returns a (signed) char*
-    utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
-  }
+    const uint8_t* utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
 
-  // 1) Convert to utf32
-  Vector<Character>& utf32Characters = logicalModel->mText;
-  utf32Characters.Resize( textSize );
+    utf32Characters.Resize( textSize );
 
-  // Transform a text array encoded in utf8 into an array encoded in utf32.
-  // It returns the actual number of characters.
-  Length characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
-  utf32Characters.Resize( characterCount );
+    // Transform a text array encoded in utf8 into an array encoded in utf32.
+    // It returns the actual number of characters.
+    characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
+    utf32Characters.Resize( characterCount );
+  }
 
   // 2) Set the break and paragraph info.
   Vector<LineBreakInfo>& lineBreakInfo = logicalModel->mLineBreakInfo;
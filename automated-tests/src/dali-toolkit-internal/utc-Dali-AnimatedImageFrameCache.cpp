@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/visuals/animated-image/animated-image-frame-cache.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_animated_image_frame_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_animated_image_frame_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* TEST_GIF_URL = "animated.gif";
+
+/**
+ * Creates a frame filled with one color, except one pixel per row when noisy.
+ */
+Devel::PixelBuffer CreateFrame( uint32_t width, uint32_t height, bool noisy )
+{
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New( width, height, Pixel::RGBA8888 );
+  unsigned char* pixels = pixelBuffer.GetBuffer();
+  for( uint32_t index = 0u; index < width * height; ++index )
+  {
+    unsigned char value = noisy ? static_cast<unsigned char>( index * 7u ) : 0x80;
+    pixels[index * 4u] = value;
+    pixels[index * 4u + 1u] = value;
+    pixels[index * 4u + 2u] = 0x00;
+    pixels[index * 4u + 3u] = 0xff;
+  }
+  return pixelBuffer;
+}
+
+/**
+ * Creates a frame mixing the runs longer than an encoded run, the literal stretches longer than
+ * an encoded literal, and the short runs interleaved with single pixels.
+ */
+Devel::PixelBuffer CreateMixedFrame( uint32_t width, uint32_t height )
+{
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New( width, height, Pixel::RGBA8888 );
+  unsigned char* pixels = pixelBuffer.GetBuffer();
+  const uint32_t flatPixels = width * height / 4u;
+  const uint32_t noisyPixels = width * height / 8u;
+  for( uint32_t index = 0u; index < width * height; ++index )
+  {
+    unsigned char* pixel = pixels + index * 4u;
+    if( index < flatPixels )
+    {
+      pixel[0u] = 0x80;
+      pixel[1u] = 0x80;
+    }
+    else if( index < flatPixels + noisyPixels )
+    {
+      pixel[0u] = static_cast<unsigned char>( index * 7u );
+      pixel[1u] = static_cast<unsigned char>( index * 13u );
+    }
+    else
+    {
+      // Three repeated pixels, then a single one.
+      const uint32_t position = index - flatPixels - noisyPixels;
+      pixel[0u] = static_cast<unsigned char>( ( position / 4u ) * 5u );
+      pixel[1u] = ( position % 4u < 3u ) ? 0x40 : 0xc0;
+    }
+    pixel[2u] = 0x00;
+    pixel[3u] = 0xff;
+  }
+  return pixelBuffer;
+}
+
+} // namespace
+
+int UtcDaliAnimatedImageFrameCacheShareFrames(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageFrameCacheShareFrames: The frames are decoded once and shared" );
+
+  AnimatedImageFrameCache cache;
+  const std::string key = AnimatedImageFrameCache::GetFrameKey( TEST_GIF_URL, 0u, ImageDimensions( 32u, 32u ) );
+  DALI_TEST_CHECK( key != AnimatedImageFrameCache::GetFrameKey( TEST_GIF_URL, 1u, ImageDimensions( 32u, 32u ) ) );
+
+  DALI_TEST_CHECK( !cache.Request( key ) );
+  DALI_TEST_EQUALS( cache.GetMetrics().misses, 1u, TEST_LOCATION );
+
+  Texture texture = cache.Add( key, CreateFrame( 32u, 32u, false ) );
+  DALI_TEST_CHECK( texture );
+  DALI_TEST_EQUALS( texture.GetWidth(), 32u, TEST_LOCATION );
+
+  // Another visual showing the same frame gets the same texture.
+  DALI_TEST_CHECK( cache.Request( key ) == texture );
+  DALI_TEST_EQUALS( cache.GetMetrics().hits, 1u, TEST_LOCATION );
+
+  // A flat frame is compressed.
+  const AnimatedImageFrameCache::Metrics& metrics = cache.GetMetrics();
+  DALI_TEST_EQUALS( metrics.decodedMemory, 32u * 32u * 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( metrics.memory < metrics.decodedMemory / 10u );
+  tet_printf( "A flat frame of %zu bytes uses %zu bytes\n", metrics.decodedMemory, metrics.memory );
+
+  // The unused frame stays in the cache and is uploaded again when requested.
+  cache.Release( key );
+  cache.Release( key );
+  DALI_TEST_EQUALS( metrics.unusedMemory, metrics.memory, TEST_LOCATION );
+
+  Texture uploaded = cache.Request( key );
+  DALI_TEST_CHECK( uploaded );
+  DALI_TEST_CHECK( uploaded != texture );
+  DALI_TEST_EQUALS( uploaded.GetWidth(), 32u, TEST_LOCATION );
+  DALI_TEST_EQUALS( uploaded.GetHeight(), 32u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.unusedMemory, 0u, TEST_LOCATION );
+  cache.Release( key );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageFrameCacheBudget(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageFrameCacheBudget: The unused frames are evicted beyond the budget" );
+
+  AnimatedImageFrameCache cache;
+  const AnimatedImageFrameCache::Metrics& metrics = cache.GetMetrics();
+
+  // A noisy frame isn't compressed.
+  const std::string noisyKey = AnimatedImageFrameCache::GetFrameKey( TEST_GIF_URL, 0u, ImageDimensions( 16u, 16u ) );
+  cache.Add( noisyKey, CreateFrame( 16u, 16u, true ) );
+  DALI_TEST_EQUALS( metrics.memory, 16u * 16u * 4u, TEST_LOCATION );
+
+  // Nor any frame once the compression is disabled.
+  cache.SetCompressionEnabled( false );
+  const std::string flatKey = AnimatedImageFrameCache::GetFrameKey( TEST_GIF_URL, 1u, ImageDimensions( 16u, 16u ) );
+  cache.Add( flatKey, CreateFrame( 16u, 16u, false ) );
+  DALI_TEST_EQUALS( metrics.memory, 2u * 16u * 16u * 4u, TEST_LOCATION );
+
+  cache.SetMemoryBudget( 16u * 16u * 4u );
+
+  // The least recently used frame is evicted.
+  cache.Release( noisyKey );
+  cache.Release( flatKey );
+  DALI_TEST_EQUALS( metrics.evictions, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.memory, 16u * 16u * 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Request( noisyKey ) );
+  DALI_TEST_CHECK( cache.Request( flatKey ) );
+
+  // A used frame isn't evicted.
+  cache.SetMemoryBudget( 0u );
+  DALI_TEST_EQUALS( metrics.evictions, 1u, TEST_LOCATION );
+
+  cache.Release( flatKey );
+  DALI_TEST_EQUALS( metrics.evictions, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.memory, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.decodedMemory, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageFrameCacheRoundTrip(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedImageFrameCacheRoundTrip: The texels uploaded from a compressed frame are the decoded ones" );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  AnimatedImageFrameCache cache;
+  const AnimatedImageFrameCache::Metrics& metrics = cache.GetMetrics();
+
+  const uint32_t width = 64u;
+  const uint32_t height = 64u;
+  Devel::PixelBuffer pixelBuffer = CreateMixedFrame( width, height );
+  const std::vector<uint8_t> expected( pixelBuffer.GetBuffer(), pixelBuffer.GetBuffer() + width * height * 4u );
+
+  const std::string key = AnimatedImageFrameCache::GetFrameKey( TEST_GIF_URL, 0u, ImageDimensions( width, height ) );
+  cache.Add( key, pixelBuffer );
+
+  // The frame is compressed.
+  DALI_TEST_EQUALS( metrics.decodedMemory, expected.size(), TEST_LOCATION );
+  DALI_TEST_CHECK( metrics.memory < metrics.decodedMemory );
+  tet_printf( "A mixed frame of %zu bytes uses %zu bytes\n", metrics.decodedMemory, metrics.memory );
+
+  // Once unused, the texture is released and a new one is uploaded from the encoded pixels.
+  cache.Release( key );
+  Texture texture = cache.Request( key );
+  DALI_TEST_CHECK( texture );
+
+  application.SendNotification();
+  application.Render();
+
+  const TestGlAbstraction::TextureData* textureData = gl.GetTextureData( gl.GetLastGenTextureId() );
+  DALI_TEST_CHECK( textureData );
+  DALI_TEST_EQUALS( textureData->width, static_cast<GLsizei>( width ), TEST_LOCATION );
+  DALI_TEST_EQUALS( textureData->height, static_cast<GLsizei>( height ), TEST_LOCATION );
+  DALI_TEST_EQUALS( textureData->buffer.size(), expected.size(), TEST_LOCATION );
+  DALI_TEST_CHECK( textureData->buffer == expected );
+
+  cache.Release( key );
+
+  END_TEST;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/image-loader/compressed-image.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_compressed_image_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_compressed_image_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const uint32_t GL_COMPRESSED_RGB8_ETC2 = 0x9274;
+const uint32_t GL_RGBA = 0x1908;
+const uint32_t GL_UNSIGNED_BYTE = 0x1401;
+
+void Append( Dali::Vector< char >& buffer, const void* data, uint32_t size )
+{
+  const char* bytes = static_cast< const char* >( data );
+  for( uint32_t i = 0u; i < size; ++i )
+  {
+    buffer.PushBack( bytes[ i ] );
+  }
+}
+
+void Append( Dali::Vector< char >& buffer, uint32_t value )
+{
+  Append( buffer, &value, sizeof( value ) );
+}
+
+/**
+ * Creates a KTX container whose mip levels are filled with 8 bytes per 4x4 block.
+ */
+Dali::Vector< char > CreateKtx( uint32_t glType, uint32_t glFormat, uint32_t glInternalFormat, uint32_t size, uint32_t levelCount )
+{
+  const unsigned char identifier[] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+  Dali::Vector< char > buffer;
+  Append( buffer, identifier, sizeof( identifier ) );
+  Append( buffer, 0x04030201 );       // endianness
+  Append( buffer, glType );
+  Append( buffer, glType ? 1u : 0u ); // glTypeSize
+  Append( buffer, glFormat );
+  Append( buffer, glInternalFormat );
+  Append( buffer, glFormat );         // glBaseInternalFormat
+  Append( buffer, size );             // pixelWidth
+  Append( buffer, size );             // pixelHeight
+  Append( buffer, 0u );               // pixelDepth
+  Append( buffer, 0u );               // numberOfArrayElements
+  Append( buffer, 1u );               // numberOfFaces
+  Append( buffer, levelCount );
+  Append( buffer, 4u );               // bytesOfKeyValueData
+  Append( buffer, 0u );
+
+  for( uint32_t level = 0u; level < levelCount; ++level )
+  {
+    const uint32_t blocks = std::max( ( size >> level ) / 4u, 1u );
+    const uint32_t imageSize = blocks * blocks * 8u;
+    Append( buffer, imageSize );
+    for( uint32_t i = 0u; i < imageSize; ++i )
+    {
+      buffer.PushBack( static_cast< char >( level ) );
+    }
+  }
+  return buffer;
+}
+
+} // namespace
+
+int UtcDaliCompressedImageMipLevels(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliCompressedImageMipLevels: The mip levels of a KTX container are uploaded" );
+
+  Dali::Vector< char > buffer = CreateKtx( 0u, 0u, GL_COMPRESSED_RGB8_ETC2, 8u, 4u );
+  CompressedImagePtr image = CompressedImage::New( buffer, ImageDimensions() );
+  DALI_TEST_CHECK( image );
+  DALI_TEST_EQUALS( image->GetPixelFormat(), Pixel::COMPRESSED_RGB8_ETC2, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetWidth(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetHeight(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetLevelCount(), 4u, TEST_LOCATION );
+
+  Texture texture = image->CreateTexture();
+  DALI_TEST_CHECK( texture );
+  DALI_TEST_EQUALS( texture.GetWidth(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( texture.GetHeight(), 8u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliCompressedImageDesiredSize(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliCompressedImageDesiredSize: The mip levels bigger than needed are skipped" );
+
+  Dali::Vector< char > buffer = CreateKtx( 0u, 0u, GL_COMPRESSED_RGB8_ETC2, 8u, 4u );
+  CompressedImagePtr image = CompressedImage::New( buffer, ImageDimensions( 3u, 4u ) );
+  DALI_TEST_CHECK( image );
+  DALI_TEST_EQUALS( image->GetWidth(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetHeight(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetLevelCount(), 3u, TEST_LOCATION );
+
+  // A single level is kept even if it's bigger.
+  buffer = CreateKtx( 0u, 0u, GL_COMPRESSED_RGB8_ETC2, 8u, 1u );
+  image = CompressedImage::New( buffer, ImageDimensions( 2u, 2u ) );
+  DALI_TEST_CHECK( image );
+  DALI_TEST_EQUALS( image->GetWidth(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image->GetLevelCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliCompressedImageUnsupported(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliCompressedImageUnsupported: The containers which can't be passed through are left to the decoder" );
+
+  // Uncompressed pixels.
+  Dali::Vector< char > buffer = CreateKtx( GL_UNSIGNED_BYTE, GL_RGBA, GL_RGBA, 8u, 1u );
+  const uint32_t size = buffer.Count();
+  DALI_TEST_CHECK( !CompressedImage::New( buffer, ImageDimensions() ) );
+  DALI_TEST_EQUALS( buffer.Count(), size, TEST_LOCATION );
+
+  // Truncated mip levels.
+  buffer = CreateKtx( 0u, 0u, GL_COMPRESSED_RGB8_ETC2, 8u, 4u );
+  buffer.Resize( buffer.Count() - 1u );
+  DALI_TEST_CHECK( !CompressedImage::New( buffer, ImageDimensions() ) );
+
+  // Not a KTX container.
+  const char text[] = "not a ktx file, not a ktx file, not a ktx file, not a ktx file, not a ktx file";
+  buffer.Clear();
+  Append( buffer, text, sizeof( text ) );
+  DALI_TEST_CHECK( !CompressedImage::New( buffer, ImageDimensions() ) );
+
+  END_TEST;
+}
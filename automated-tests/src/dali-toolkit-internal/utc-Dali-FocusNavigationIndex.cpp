@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/focus-manager/focus-navigation-index.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_focus_navigation_index_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_focus_navigation_index_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const int GRID_SIZE = 30;
+const float TILE_SIZE = 20.0f;
+
+Rect< float > GetTileRect( int row, int column )
+{
+  return Rect< float >( column * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE );
+}
+
+} // namespace
+
+int UtcDaliFocusNavigationIndexFindNext(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliFocusNavigationIndexFindNext: The closest actor in each direction is found" );
+
+  FocusNavigationIndex index;
+  Actor center = Actor::New();
+  Actor left = Actor::New();
+  Actor right = Actor::New();
+  Actor nearAbove = Actor::New();
+  Actor farBelow = Actor::New();
+  Actor offLineBelow = Actor::New();
+
+  index.Add( center, Rect< float >( 100.0f, 100.0f, 20.0f, 20.0f ) );
+  index.Add( left, Rect< float >( 40.0f, 100.0f, 20.0f, 20.0f ) );
+  index.Add( right, Rect< float >( 160.0f, 100.0f, 20.0f, 20.0f ) );
+  index.Add( nearAbove, Rect< float >( 100.0f, 70.0f, 20.0f, 20.0f ) );
+  index.Add( farBelow, Rect< float >( 100.0f, 200.0f, 20.0f, 20.0f ) );
+  index.Add( offLineBelow, Rect< float >( 160.0f, 140.0f, 20.0f, 20.0f ) );
+  DALI_TEST_EQUALS( index.GetCount(), 6u, TEST_LOCATION );
+
+  const Rect< float > current( 100.0f, 100.0f, 20.0f, 20.0f );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::LEFT ) == left );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::RIGHT ) == right );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::UP ) == nearAbove );
+
+  // The actor in line is preferred to the closer one which is not
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::DOWN ) == farBelow );
+
+  // Nothing beyond the edges
+  DALI_TEST_CHECK( !index.FindNext( Rect< float >( 40.0f, 100.0f, 20.0f, 20.0f ), Control::KeyboardFocus::LEFT ) );
+  DALI_TEST_CHECK( !index.FindNext( current, Control::KeyboardFocus::PAGE_UP ) );
+
+  // Destroyed actors are skipped
+  left.Reset();
+  DALI_TEST_CHECK( !index.FindNext( current, Control::KeyboardFocus::LEFT ) );
+
+  index.Clear();
+  DALI_TEST_EQUALS( index.GetCount(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !index.FindNext( current, Control::KeyboardFocus::RIGHT ) );
+
+  END_TEST;
+}
+
+int UtcDaliFocusNavigationIndexUpdate(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliFocusNavigationIndexUpdate: A moved actor is found at its new position" );
+
+  FocusNavigationIndex index;
+  Actor center = Actor::New();
+  Actor right = Actor::New();
+  Actor farRight = Actor::New();
+  Actor notIndexed = Actor::New();
+
+  index.Add( center, Rect< float >( 100.0f, 100.0f, 20.0f, 20.0f ) );
+  index.Add( right, Rect< float >( 160.0f, 100.0f, 20.0f, 20.0f ) );
+  index.Add( farRight, Rect< float >( 300.0f, 100.0f, 20.0f, 20.0f ) );
+
+  const Rect< float > current( 100.0f, 100.0f, 20.0f, 20.0f );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::RIGHT ) == right );
+
+  // Moved past the other one, and back to the left
+  index.Update( right, Rect< float >( 400.0f, 100.0f, 20.0f, 20.0f ) );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::RIGHT ) == farRight );
+  DALI_TEST_CHECK( index.FindNext( Rect< float >( 300.0f, 100.0f, 20.0f, 20.0f ), Control::KeyboardFocus::RIGHT ) == right );
+
+  index.Update( right, Rect< float >( 40.0f, 100.0f, 20.0f, 20.0f ) );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::RIGHT ) == farRight );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::LEFT ) == right );
+
+  // Moved across the direction
+  index.Update( farRight, Rect< float >( 300.0f, 400.0f, 20.0f, 20.0f ) );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::DOWN ) == farRight );
+
+  // The actors which are not indexed are ignored
+  index.Update( notIndexed, Rect< float >( 200.0f, 100.0f, 20.0f, 20.0f ) );
+  DALI_TEST_EQUALS( index.GetCount(), 3u, TEST_LOCATION );
+  DALI_TEST_CHECK( index.FindNext( current, Control::KeyboardFocus::RIGHT ) == farRight );
+
+  END_TEST;
+}
+
+int UtcDaliFocusNavigationIndexGridBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliFocusNavigationIndexGridBenchmark: Navigation in a 30x30 grid matches a search of every tile" );
+
+  FocusNavigationIndex index;
+  std::vector< Actor > tiles;
+  for( int row = 0; row < GRID_SIZE; ++row )
+  {
+    for( int column = 0; column < GRID_SIZE; ++column )
+    {
+      tiles.push_back( Actor::New() );
+      index.Add( tiles.back(), GetTileRect( row, column ) );
+    }
+  }
+
+  const Control::KeyboardFocus::Direction directions[] = { Control::KeyboardFocus::LEFT, Control::KeyboardFocus::RIGHT,
+                                                           Control::KeyboardFocus::UP, Control::KeyboardFocus::DOWN };
+  const int offsets[][2] = { { 0, -1 }, { 0, 1 }, { -1, 0 }, { 1, 0 } };
+
+  // Every tile moves to its neighbour, or nowhere on the edges
+  unsigned int found = 0u;
+  unsigned int expected = 0u;
+  auto begin = std::chrono::steady_clock::now();
+  for( int row = 0; row < GRID_SIZE; ++row )
+  {
+    for( int column = 0; column < GRID_SIZE; ++column )
+    {
+      for( int i = 0; i < 4; ++i )
+      {
+        const int nextRow = row + offsets[ i ][ 0 ];
+        const int nextColumn = column + offsets[ i ][ 1 ];
+        const bool inside = nextRow >= 0 && nextRow < GRID_SIZE && nextColumn >= 0 && nextColumn < GRID_SIZE;
+        Actor next = index.FindNext( GetTileRect( row, column ), directions[ i ] );
+        if( inside ? ( next == tiles[ nextRow * GRID_SIZE + nextColumn ] ) : !next )
+        {
+          ++found;
+        }
+        ++expected;
+      }
+    }
+  }
+  const long long indexDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+  DALI_TEST_EQUALS( found, expected, TEST_LOCATION );
+
+  // Compare with checking every tile for each movement
+  begin = std::chrono::steady_clock::now();
+  found = 0u;
+  for( int row = 0; row < GRID_SIZE; ++row )
+  {
+    for( int column = 0; column < GRID_SIZE; ++column )
+    {
+      for( int i = 0; i < 4; ++i )
+      {
+        int closest = -1;
+        float closestDistance2 = 0.0f;
+        for( int tile = 0; tile < GRID_SIZE * GRID_SIZE; ++tile )
+        {
+          const float major = ( offsets[ i ][ 0 ] != 0 ) ? ( tile / GRID_SIZE - row ) * offsets[ i ][ 0 ] : ( tile % GRID_SIZE - column ) * offsets[ i ][ 1 ];
+          const float minor = ( offsets[ i ][ 0 ] != 0 ) ? ( tile % GRID_SIZE - column ) : ( tile / GRID_SIZE - row );
+          const float distance2 = major * major + 4.0f * minor * minor;
+          if( major > 0.0f && ( closest < 0 || distance2 < closestDistance2 ) )
+          {
+            closest = tile;
+            closestDistance2 = distance2;
+          }
+        }
+        found += ( closest >= 0 ) ? 1u : 0u;
+      }
+    }
+  }
+  const long long searchDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  tet_printf( "%u movements in a %dx%d grid: %lld us with the index, %lld us checking every tile\n", expected, GRID_SIZE, GRID_SIZE, indexDuration, searchDuration );
+  DALI_TEST_EQUALS( found, static_cast< unsigned int >( expected - GRID_SIZE * 4 ), TEST_LOCATION );
+
+  END_TEST;
+}
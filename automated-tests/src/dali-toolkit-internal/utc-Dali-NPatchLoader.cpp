@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/visuals/npatch-loader.h>
+#include <dali-toolkit/internal/visuals/texture-manager-impl.h>
+#include <dali-toolkit/internal/visuals/texture-upload-observer.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_npatch_loader_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_npatch_loader_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+
+class TestObserver : public Dali::Toolkit::TextureUploadObserver
+{
+public:
+
+  void UploadComplete( bool loadSuccess, int32_t textureId, TextureSet textureSet,
+                       bool useAtlasing, const Vector4& atlasRect, bool preMultiplied ) override
+  {
+  }
+
+  void LoadComplete( bool loadSuccess, Devel::PixelBuffer pixelBuffer, const VisualUrl& url, bool preMultiplied ) override
+  {
+  }
+};
+
+} // namespace
+
+int UtcDaliNPatchLoaderShareAndRelease(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliNPatchLoaderShareAndRelease: The n-patches are shared and released when unused" );
+
+  TextureManager textureManager;
+  TestObserver observer;
+  NPatchLoader loader;
+  const NPatchLoader::Metrics& metrics = loader.GetMetrics();
+  const Rect< int > border( 2, 2, 2, 2 );
+  bool preMultiplyOnLoad = false;
+
+  std::size_t id = loader.Load( textureManager, &observer, TEST_IMAGE_FILE_NAME, border, preMultiplyOnLoad, true );
+  const NPatchLoader::Data* data = nullptr;
+  DALI_TEST_CHECK( loader.GetNPatchData( id, data ) );
+  DALI_TEST_CHECK( data->loadCompleted );
+  DALI_TEST_EQUALS( metrics.misses, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( metrics.memory > 0u );
+
+  // The same n-patch is found without loading it again.
+  DALI_TEST_EQUALS( loader.Load( textureManager, &observer, TEST_IMAGE_FILE_NAME, border, preMultiplyOnLoad, true ), id, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.hits, 1u, TEST_LOCATION );
+
+  // Another border shares the texture.
+  std::size_t otherId = loader.Load( textureManager, &observer, TEST_IMAGE_FILE_NAME, Rect< int >( 4, 4, 4, 4 ), preMultiplyOnLoad, true );
+  DALI_TEST_CHECK( otherId != id );
+  const NPatchLoader::Data* otherData = nullptr;
+  DALI_TEST_CHECK( loader.GetNPatchData( otherId, otherData ) );
+  DALI_TEST_CHECK( otherData->textureSet == data->textureSet );
+  DALI_TEST_EQUALS( metrics.hits, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.misses, 1u, TEST_LOCATION );
+
+  // Which is removed once unused.
+  loader.Release( otherId );
+  DALI_TEST_CHECK( !loader.GetNPatchData( otherId, otherData ) );
+
+  // The unused n-patch is kept within the budget.
+  loader.Release( id );
+  loader.Release( id );
+  DALI_TEST_CHECK( loader.GetNPatchData( id, data ) );
+  DALI_TEST_EQUALS( metrics.unusedMemory, metrics.memory, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( loader.Load( textureManager, &observer, TEST_IMAGE_FILE_NAME, border, preMultiplyOnLoad, true ), id, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.unusedMemory, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.misses, 1u, TEST_LOCATION );
+
+  // And evicted beyond it.
+  loader.Release( id );
+  loader.SetMemoryBudget( 0u );
+  DALI_TEST_CHECK( !loader.GetNPatchData( id, data ) );
+  DALI_TEST_EQUALS( metrics.evictions, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.memory, 0u, TEST_LOCATION );
+
+  // A new id is given when it's loaded again.
+  std::size_t newId = loader.Load( textureManager, &observer, TEST_IMAGE_FILE_NAME, border, preMultiplyOnLoad, true );
+  DALI_TEST_CHECK( newId != id );
+  DALI_TEST_EQUALS( metrics.misses, 2u, TEST_LOCATION );
+  loader.Release( newId );
+
+  END_TEST;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/visuals/opacity-map.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_opacity_map_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_opacity_map_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Creates an image whose columns are opaque left of opaqueEnd, translucent until translucentEnd
+ * and transparent after.
+ */
+Devel::PixelBuffer CreateImage( uint32_t width, uint32_t height, uint32_t opaqueEnd, uint32_t translucentEnd )
+{
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New( width, height, Pixel::RGBA8888 );
+  unsigned char* pixels = pixelBuffer.GetBuffer();
+  for( uint32_t y = 0u; y < height; ++y )
+  {
+    for( uint32_t x = 0u; x < width; ++x )
+    {
+      unsigned char* pixel = pixels + ( y * width + x ) * 4u;
+      pixel[0] = pixel[1] = pixel[2] = 0x80;
+      pixel[3] = x < opaqueEnd ? 0xff : ( x < translucentEnd ? 0x80 : 0x00 );
+    }
+  }
+  return pixelBuffer;
+}
+
+} // namespace
+
+int UtcDaliOpacityMapTiles(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliOpacityMapTiles: The opaque and transparent tiles are found" );
+
+  // 4 columns of 16 pixels: opaque, opaque next to the translucent pixels, translucent, transparent.
+  OpacityMapPtr opacityMap = OpacityMap::New( CreateImage( 64u, 32u, 32u, 40u ), 16u );
+  DALI_TEST_CHECK( opacityMap );
+  DALI_TEST_EQUALS( opacityMap->GetColumnCount(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetRowCount(), 2u, TEST_LOCATION );
+
+  for( uint32_t row = 0u; row < 2u; ++row )
+  {
+    DALI_TEST_EQUALS( opacityMap->GetOpacity( 0u, row ), OpacityMap::OPAQUE, TEST_LOCATION );
+    // The first pixel of the next tile is blended in by the filtering.
+    DALI_TEST_EQUALS( opacityMap->GetOpacity( 1u, row ), OpacityMap::TRANSLUCENT, TEST_LOCATION );
+    DALI_TEST_EQUALS( opacityMap->GetOpacity( 2u, row ), OpacityMap::TRANSLUCENT, TEST_LOCATION );
+    DALI_TEST_EQUALS( opacityMap->GetOpacity( 3u, row ), OpacityMap::TRANSPARENT, TEST_LOCATION );
+  }
+
+  uint32_t opaqueElements = 0u;
+  uint32_t translucentElements = 0u;
+  Geometry geometry = opacityMap->CreateGeometry( opaqueElements, translucentElements );
+  DALI_TEST_CHECK( geometry );
+  DALI_TEST_EQUALS( opaqueElements, 2u * 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( translucentElements, 4u * 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( geometry.GetType(), Geometry::TRIANGLES, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliOpacityMapNoSaving(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliOpacityMapNoSaving: No map is created when no blending is saved" );
+
+  // No alpha channel.
+  DALI_TEST_CHECK( !OpacityMap::New( Devel::PixelBuffer::New( 32u, 32u, Pixel::RGB888 ), 16u ) );
+
+  // Fully translucent.
+  DALI_TEST_CHECK( !OpacityMap::New( CreateImage( 32u, 32u, 0u, 32u ), 16u ) );
+
+  // Fully transparent.
+  DALI_TEST_CHECK( !OpacityMap::New( CreateImage( 32u, 32u, 0u, 0u ), 16u ) );
+
+  // A fully opaque image is a single tile.
+  OpacityMapPtr opacityMap = OpacityMap::New( CreateImage( 32u, 32u, 32u, 32u ), 16u );
+  DALI_TEST_CHECK( opacityMap );
+  DALI_TEST_EQUALS( opacityMap->GetColumnCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetRowCount(), 1u, TEST_LOCATION );
+
+  uint32_t opaqueElements = 0u;
+  uint32_t translucentElements = 0u;
+  opacityMap->CreateGeometry( opaqueElements, translucentElements );
+  DALI_TEST_EQUALS( opaqueElements, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( translucentElements, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliOpacityMapNPatchCells(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliOpacityMapNPatchCells: The cells of a n-patch are analysed" );
+
+  // The left and stretched columns are opaque, the right column is partly transparent.
+  Dali::Vector< uint32_t > columns;
+  columns.PushBack( 0u );
+  columns.PushBack( 4u );
+  columns.PushBack( 28u );
+  Dali::Vector< uint32_t > rows;
+  rows.PushBack( 0u );
+
+  OpacityMapPtr opacityMap = OpacityMap::New( CreateImage( 32u, 32u, 29u, 0u ), columns, rows );
+  DALI_TEST_CHECK( opacityMap );
+  DALI_TEST_EQUALS( opacityMap->GetColumnCount(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetRowCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetOpacity( 0u, 0u ), OpacityMap::OPAQUE, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetOpacity( 1u, 0u ), OpacityMap::OPAQUE, TEST_LOCATION );
+  DALI_TEST_EQUALS( opacityMap->GetOpacity( 2u, 0u ), OpacityMap::TRANSLUCENT, TEST_LOCATION );
+
+  uint32_t opaqueElements = 0u;
+  uint32_t translucentElements = 0u;
+  DALI_TEST_CHECK( opacityMap->CreateGridGeometry( opaqueElements, translucentElements ) );
+  DALI_TEST_EQUALS( opaqueElements, 2u * 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( translucentElements, 6u, TEST_LOCATION );
+
+  // Malformed cells are not analysed.
+  columns[1] = 30u;
+  DALI_TEST_CHECK( !OpacityMap::New( CreateImage( 32u, 32u, 29u, 0u ), columns, rows ) );
+
+  END_TEST;
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/transition-effects/cube-transition-fold-effect.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+#include "dummy-control.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_shader_registry_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_shader_registry_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* VERTEX_SHADER = "void main() { gl_Position = vec4( 0.0 ); }\n";
+const char* FRAGMENT_SHADER_RED = "void main() { gl_FragColor = vec4( 1.0, 0.0, 0.0, 1.0 ); }\n";
+const char* FRAGMENT_SHADER_GREEN = "void main() { gl_FragColor = vec4( 0.0, 1.0, 0.0, 1.0 ); }\n";
+const char* FRAGMENT_SHADER_BLUE = "void main() { gl_FragColor = vec4( 0.0, 0.0, 1.0, 1.0 ); }\n";
+
+} // namespace
+
+int UtcDaliShaderRegistryGetShader(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryGetShader: The shaders with the same source are shared, whoever requests them" );
+
+  ShaderRegistry registry = ShaderRegistry::Get();
+  DALI_TEST_CHECK( registry );
+  const ShaderRegistry::Metrics before = registry.GetMetrics();
+
+  Shader red = registry.GetShader( "FirstUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  Shader sameRed = registry.GetShader( "SecondUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  Shader green = registry.GetShader( "FirstUser", VERTEX_SHADER, FRAGMENT_SHADER_GREEN );
+  Shader transparentRed = registry.GetShader( "FirstUser", VERTEX_SHADER, FRAGMENT_SHADER_RED, Shader::Hint::OUTPUT_IS_TRANSPARENT );
+
+  DALI_TEST_CHECK( red );
+  DALI_TEST_CHECK( red == sameRed );
+  DALI_TEST_CHECK( red != green );
+  DALI_TEST_CHECK( red != transparentRed );
+
+  // The shaders which are not shared are new every time
+  Shader uniqueRed = registry.NewShader( "ThirdUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  Shader otherUniqueRed = registry.NewShader( "ThirdUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  DALI_TEST_CHECK( uniqueRed );
+  DALI_TEST_CHECK( uniqueRed != red );
+  DALI_TEST_CHECK( uniqueRed != otherUniqueRed );
+
+  const ShaderRegistry::Metrics& after = registry.GetMetrics();
+  DALI_TEST_EQUALS( after.variants - before.variants, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( after.requests - before.requests, 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( after.creations - before.creations, 5u, TEST_LOCATION );
+
+  // The creations are counted per frame
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( registry.GetMetrics().lastFrameCreations, 5u, TEST_LOCATION );
+  DALI_TEST_CHECK( registry.GetMetrics().maxFrameCreations >= 5u );
+
+  registry.NewShader( "ThirdUser", VERTEX_SHADER, FRAGMENT_SHADER_GREEN );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( registry.GetMetrics().lastFrameCreations, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( registry.GetMetrics().maxFrameCreations >= 5u );
+
+  END_TEST;
+}
+
+int UtcDaliShaderRegistryWarmUp(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryWarmUp: The variants recorded are created by name ahead of their first use" );
+
+  ShaderRegistry registry = ShaderRegistry::Get();
+  registry.AddVariant( "WarmUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  registry.AddVariant( "WarmUser", VERTEX_SHADER, FRAGMENT_SHADER_GREEN );
+  registry.AddVariant( "ColdUser", VERTEX_SHADER, FRAGMENT_SHADER_BLUE );
+
+  std::vector< std::string > names;
+  registry.GetVariantNames( names );
+  DALI_TEST_EQUALS( static_cast< int >( std::count( names.begin(), names.end(), "WarmUser" ) ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast< int >( std::count( names.begin(), names.end(), "ColdUser" ) ), 1, TEST_LOCATION );
+
+  const uint32_t creations = registry.GetMetrics().creations;
+  DALI_TEST_EQUALS( registry.WarmUp( std::vector< std::string >{ "WarmUser" } ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( registry.WarmUp( std::vector< std::string >{ "WarmUser" } ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations - creations, 2u, TEST_LOCATION );
+
+  // The shader warmed up is the one shared afterwards
+  registry.GetShader( "WarmUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations - creations, 2u, TEST_LOCATION );
+
+  registry.GetShader( "ColdUser", VERTEX_SHADER, FRAGMENT_SHADER_BLUE );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations - creations, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderRegistryGeneratedAndCustomShaders(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryGeneratedAndCustomShaders: Only the shaders of the fixed sources and of the variants warmed up are kept" );
+
+  ShaderRegistry registry = ShaderRegistry::Get();
+  const uint32_t variants = registry.GetMetrics().variants;
+
+  {
+    Shader generated = registry.GetGeneratedShader( "GeneratedUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+    DALI_TEST_CHECK( generated );
+    DALI_TEST_CHECK( generated == registry.GetGeneratedShader( "GeneratedUser", VERTEX_SHADER, FRAGMENT_SHADER_RED ) );
+
+    Shader custom = registry.NewShader( "CustomUser", VERTEX_SHADER, FRAGMENT_SHADER_GREEN );
+    DALI_TEST_CHECK( custom );
+
+    registry.GetShader( "FixedUser", VERTEX_SHADER, FRAGMENT_SHADER_BLUE );
+    DALI_TEST_EQUALS( registry.GetMetrics().variants - variants, 3u, TEST_LOCATION );
+  }
+
+  // The shader of a fixed source is kept
+  uint32_t creations = registry.GetMetrics().creations;
+  DALI_TEST_CHECK( registry.GetShader( "FixedUser", VERTEX_SHADER, FRAGMENT_SHADER_BLUE ) );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations, creations, TEST_LOCATION );
+
+  // The variants whose shaders were destroyed are forgotten when a new variant is recorded
+  Shader other = registry.GetGeneratedShader( "OtherUser", VERTEX_SHADER, FRAGMENT_SHADER_RED, Shader::Hint::OUTPUT_IS_TRANSPARENT );
+  DALI_TEST_EQUALS( registry.GetMetrics().variants - variants, 2u, TEST_LOCATION );
+
+  std::vector< std::string > names;
+  registry.GetVariantNames( names );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "GeneratedUser" ) == names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "CustomUser" ) == names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "FixedUser" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "OtherUser" ) != names.end() );
+
+  // A generated shader still used is kept once its variant is warmed up
+  DALI_TEST_EQUALS( registry.WarmUp( std::vector< std::string >{ "OtherUser" } ), 0u, TEST_LOCATION );
+  other.Reset();
+
+  creations = registry.GetMetrics().creations;
+  registry.GetGeneratedShader( "OtherUser", VERTEX_SHADER, FRAGMENT_SHADER_RED, Shader::Hint::OUTPUT_IS_TRANSPARENT );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations, creations, TEST_LOCATION );
+
+  // A generated shader no longer used is created again
+  registry.GetGeneratedShader( "GeneratedUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  registry.GetGeneratedShader( "GeneratedUser", VERTEX_SHADER, FRAGMENT_SHADER_RED );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations - creations, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderRegistryVisualFactoryWarmUp(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryVisualFactoryWarmUp: The shader variants of the visuals are listed before any visual is created" );
+
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+
+  std::vector< std::string > names;
+  factory.GetShaderVariantNames( names );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "ColorVisual" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "ImageVisual" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "TextVisual" ) != names.end() );
+
+  DALI_TEST_EQUALS( factory.WarmUpShaders( std::vector< std::string >{ "ColorVisual" } ), 3u, TEST_LOCATION );
+
+  // A color visual uses the shader warmed up
+  ShaderRegistry registry = ShaderRegistry::Get();
+  const uint32_t creations = registry.GetMetrics().creations;
+
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Toolkit::Visual::COLOR );
+  propertyMap.Insert( Toolkit::ColorVisual::Property::MIX_COLOR, Color::BLUE );
+  Toolkit::Visual::Base visual = factory.CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  DummyControl actor = DummyControl::New();
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( Toolkit::Control::CONTROL_PROPERTY_END_INDEX + 1, visual );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 200.0f, 200.0f ) );
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations, creations, TEST_LOCATION );
+
+  // Every other variant is created by an empty list
+  DALI_TEST_CHECK( factory.WarmUpShaders( std::vector< std::string >() ) > 0u );
+  DALI_TEST_EQUALS( factory.WarmUpShaders( std::vector< std::string >() ), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderRegistryVisualFactoryControlVariants(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryVisualFactoryControlVariants: The fixed shader variants of the controls and effects are listed" );
+
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+
+  std::vector< std::string > names;
+  factory.GetShaderVariantNames( names );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "BouncingEffect" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "BubbleEmitter" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "ControlRenderers" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "CubeTransitionEffect" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "PageTurnView" ) != names.end() );
+  DALI_TEST_CHECK( std::find( names.begin(), names.end(), "TextAtlasRenderer" ) != names.end() );
+
+  // Both the L8 and RGBA sources of the text atlas renderer are recorded
+  DALI_TEST_EQUALS( factory.WarmUpShaders( std::vector< std::string >{ "TextAtlasRenderer" } ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( factory.WarmUpShaders( std::vector< std::string >{ "CubeTransitionEffect" } ), 1u, TEST_LOCATION );
+
+  // The cube transition effect uses the shader warmed up
+  ShaderRegistry registry = ShaderRegistry::Get();
+  const uint32_t creations = registry.GetMetrics().creations;
+
+  Toolkit::CubeTransitionEffect effect = Toolkit::CubeTransitionFoldEffect::New( 4, 4 );
+  effect.SetProperty( Actor::Property::SIZE, Vector2( 200.0f, 200.0f ) );
+  application.GetScene().Add( effect );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( effect.GetRendererCount() > 0u );
+  DALI_TEST_EQUALS( registry.GetMetrics().creations, creations, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderRegistryVisualFactoryShaderMetrics(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliShaderRegistryVisualFactoryShaderMetrics: The visual factory returns the metrics of the registry" );
+
+  Toolkit::VisualFactory factory = Toolkit::VisualFactory::Get();
+
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Toolkit::Visual::COLOR );
+  propertyMap.Insert( Toolkit::ColorVisual::Property::MIX_COLOR, Color::BLUE );
+  Toolkit::Visual::Base visual = factory.CreateVisual( propertyMap );
+
+  DummyControl actor = DummyControl::New();
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( Toolkit::Control::CONTROL_PROPERTY_END_INDEX + 1, visual );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 200.0f, 200.0f ) );
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  const ShaderRegistry::Metrics& metrics = ShaderRegistry::Get().GetMetrics();
+  Property::Map metricsMap = factory.GetShaderMetrics();
+  DALI_TEST_EQUALS( metricsMap.Count(), 5u, TEST_LOCATION );
+
+  const char* const KEYS[] = { "variants", "requests", "creations", "lastFrameCreations", "maxFrameCreations" };
+  const uint32_t VALUES[] = { metrics.variants, metrics.requests, metrics.creations, metrics.lastFrameCreations, metrics.maxFrameCreations };
+  for( uint32_t i = 0u; i < 5u; ++i )
+  {
+    Property::Value* value = metricsMap.Find( KEYS[i], Property::INTEGER );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( VALUES[i] ), TEST_LOCATION );
+  }
+  DALI_TEST_CHECK( metrics.requests > 0u );
+
+  END_TEST;
+}
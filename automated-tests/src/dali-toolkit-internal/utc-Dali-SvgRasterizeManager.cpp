@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-environment-variable.h>
+#include <toolkit-event-thread-callback.h>
+#include <toolkit-vector-image-renderer.h>
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+void utc_dali_toolkit_svg_rasterize_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_toolkit_svg_rasterize_manager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* TEST_SVG_FILE_NAME = TEST_RESOURCE_DIR "/svg1.svg";
+
+void OnRasterized()
+{
+}
+
+RasterizingTaskPtr NewTask( SvgDocumentPtr document, const std::string& key )
+{
+  return new RasterizingTask( document, key, 100u, 100u );
+}
+
+std::vector< std::string > RasterizeTasks( SvgRasterizeManager& manager, int numberOfTasks )
+{
+  std::vector< std::string > keys;
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( numberOfTasks ), true, TEST_LOCATION );
+
+  while( RasterizingTaskPtr task = manager.NextCompletedTask() )
+  {
+    keys.push_back( task->GetKey() );
+  }
+  return keys;
+}
+
+size_t GetPosition( const std::vector< std::string >& keys, const std::string& key )
+{
+  return std::distance( keys.begin(), std::find( keys.begin(), keys.end(), key ) );
+}
+
+} // unnamed namespace
+
+int UtcDaliSvgRasterizeManagerPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test the high priority tasks are rasterized before the low priority tasks queued earlier" );
+
+  // Use a single worker, kept busy by the first task while the others are queued.
+  EnvironmentVariable::SetTestingEnvironmentVariable( true );
+  SvgRasterizeManager manager( new EventThreadCallback( MakeCallback( &OnRasterized ) ) );
+  EnvironmentVariable::SetTestingEnvironmentVariable( false );
+
+  Test::VectorImageRenderer::SetRasterizeDelay( 200u );
+
+  SvgDocumentPtr document = new SvgDocument( VisualUrl( TEST_SVG_FILE_NAME ), 0.0f );
+
+  manager.AddTask( NewTask( document, "busy" ), SvgRasterizeManager::LOW );
+  manager.AddTask( NewTask( document, "low" ), SvgRasterizeManager::LOW );
+  manager.AddTask( NewTask( document, "high" ), SvgRasterizeManager::HIGH );
+
+  // A queued task is raised when its visual becomes visible.
+  manager.AddTask( NewTask( document, "raised" ), SvgRasterizeManager::LOW );
+  manager.SetTaskPriority( "raised", SvgRasterizeManager::HIGH );
+
+  std::vector< std::string > keys = RasterizeTasks( manager, 4 );
+  DALI_TEST_EQUALS( keys.size(), 4u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( GetPosition( keys, "high" ) < GetPosition( keys, "low" ) );
+  DALI_TEST_CHECK( GetPosition( keys, "raised" ) < GetPosition( keys, "low" ) );
+  DALI_TEST_CHECK( GetPosition( keys, "high" ) < GetPosition( keys, "raised" ) );
+
+  Test::VectorImageRenderer::SetRasterizeDelay( 0u );
+
+  END_TEST;
+}
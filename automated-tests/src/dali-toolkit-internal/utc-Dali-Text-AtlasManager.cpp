@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ctime>
+#include <iostream>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/text/rendering/atlas/atlas-manager.h>
+
+using namespace Dali;
+using namespace Toolkit;
+
+namespace
+{
+
+const uint32_t ATLAS_SIZE = 512u;
+
+PixelData CreateGlyphBitmap( uint32_t width, uint32_t height )
+{
+  const uint32_t bufferSize = width * height;
+  unsigned char* buffer = new unsigned char[bufferSize];
+  memset( buffer, 0xFF, bufferSize );
+  return PixelData::New( buffer, bufferSize, width, height, Pixel::L8, PixelData::DELETE_ARRAY );
+}
+
+AtlasManager CreateAtlasManager()
+{
+  AtlasManager atlasManager = AtlasManager::New();
+
+  AtlasManager::AtlasSize size;
+  size.mWidth = ATLAS_SIZE;
+  size.mHeight = ATLAS_SIZE;
+  atlasManager.SetNewAtlasSize( size );
+
+  return atlasManager;
+}
+
+/**
+ * @brief Creates a bitmap whose pixels depend on the glyph index, so glyphs uploaded to the wrong area are detected.
+ */
+PixelData CreatePatternBitmap( uint32_t index, uint32_t width, uint32_t height )
+{
+  const uint32_t bufferSize = width * height;
+  unsigned char* buffer = new unsigned char[bufferSize];
+  for( uint32_t pixel = 0u; pixel < bufferSize; ++pixel )
+  {
+    buffer[pixel] = static_cast<unsigned char>( 1u + ( index * 13u + pixel ) % 255u );
+  }
+  return PixelData::New( buffer, bufferSize, width, height, Pixel::L8, PixelData::DELETE_ARRAY );
+}
+
+/**
+ * @brief Writes a glyph into a copy of the atlas the way it was uploaded one glyph at a time, surrounded by one transparent pixel.
+ */
+void UploadGlyph( AtlasManager& atlasManager, AtlasManager::ImageId imageId, uint32_t index, uint32_t width, uint32_t height, Vector<uint8_t>& atlas )
+{
+  AtlasManager::Mesh2D mesh;
+  atlasManager.GenerateMeshData( imageId, Vector2::ZERO, mesh, false );
+
+  // The texture coordinates start half a pixel before the image.
+  const uint32_t imageX = static_cast<uint32_t>( mesh.mVertices[0u].mTexCoords.x * static_cast<float>( ATLAS_SIZE ) + 0.5f );
+  const uint32_t imageY = static_cast<uint32_t>( mesh.mVertices[0u].mTexCoords.y * static_cast<float>( ATLAS_SIZE ) + 0.5f );
+
+  for( uint32_t y = 0u; y < height + 2u; ++y )
+  {
+    for( uint32_t x = 0u; x < width + 2u; ++x )
+    {
+      const bool isPadding = ( 0u == x ) || ( 0u == y ) || ( x > width ) || ( y > height );
+      const uint32_t pixel = ( y - 1u ) * width + ( x - 1u );
+      atlas[( imageY - 1u + y ) * ATLAS_SIZE + imageX - 1u + x] = isPadding ? 0u : static_cast<uint8_t>( 1u + ( index * 13u + pixel ) % 255u );
+    }
+  }
+}
+
+/**
+ * @brief Checks the areas of the images don't overlap and are within the atlases.
+ */
+bool CheckImageAreas( AtlasManager& atlasManager, const Vector<AtlasManager::ImageId>& imageIds, const Vector<uint32_t>& widths, const Vector<uint32_t>& heights )
+{
+  const uint32_t numberOfImages = imageIds.Count();
+  Vector<Vector2> topLeft;
+  Vector<Vector2> bottomRight;
+  Vector<uint32_t> atlasIds;
+
+  for( uint32_t index = 0u; index < numberOfImages; ++index )
+  {
+    AtlasManager::Mesh2D mesh;
+    atlasManager.GenerateMeshData( imageIds[index], Vector2::ZERO, mesh, false );
+
+    // The texture coordinates of the image, in pixels.
+    const Vector2 start = mesh.mVertices[0u].mTexCoords * static_cast<float>( ATLAS_SIZE );
+    const Vector2 end = mesh.mVertices[3u].mTexCoords * static_cast<float>( ATLAS_SIZE );
+
+    if( ( start.x < 0.f ) || ( start.y < 0.f ) || ( end.x > static_cast<float>( ATLAS_SIZE ) ) || ( end.y > static_cast<float>( ATLAS_SIZE ) ) )
+    {
+      return false;
+    }
+
+    if( ( fabsf( end.x - start.x - static_cast<float>( widths[index] + 1u ) ) > Math::MACHINE_EPSILON_1000 ) ||
+        ( fabsf( end.y - start.y - static_cast<float>( heights[index] + 1u ) ) > Math::MACHINE_EPSILON_1000 ) )
+    {
+      return false;
+    }
+
+    topLeft.PushBack( start );
+    bottomRight.PushBack( end );
+    atlasIds.PushBack( atlasManager.GetAtlas( imageIds[index] ) );
+  }
+
+  for( uint32_t index = 0u; index < numberOfImages; ++index )
+  {
+    for( uint32_t other = index + 1u; other < numberOfImages; ++other )
+    {
+      // The texture coordinates include half a pixel of padding on each side.
+      if( ( atlasIds[index] == atlasIds[other] ) &&
+          ( topLeft[index].x + 1.f < bottomRight[other].x ) && ( topLeft[other].x + 1.f < bottomRight[index].x ) &&
+          ( topLeft[index].y + 1.f < bottomRight[other].y ) && ( topLeft[other].y + 1.f < bottomRight[index].y ) )
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+int UtcDaliTextAtlasManagerMixedGlyphSizes(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerMixedGlyphSizes");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  // Body text glyphs mixed with heading glyphs.
+  const uint32_t NUMBER_OF_GLYPHS = 400u;
+  Vector<AtlasManager::ImageId> imageIds;
+  Vector<uint32_t> widths;
+  Vector<uint32_t> heights;
+  uint32_t glyphPixels = 0u;
+
+  clock_t start = clock();
+  for( uint32_t index = 0u; index < NUMBER_OF_GLYPHS; ++index )
+  {
+    const bool isHeading = ( 0u == index % 20u );
+    const uint32_t width = isHeading ? 60u + index % 12u : 8u + index % 6u;
+    const uint32_t height = isHeading ? 72u : 14u + index % 4u;
+
+    AtlasManager::AtlasSlot slot;
+    atlasManager.Add( CreateGlyphBitmap( width, height ), slot );
+    DALI_TEST_CHECK( 0u != slot.mImageId );
+
+    imageIds.PushBack( slot.mImageId );
+    widths.PushBack( width );
+    heights.PushBack( height );
+    glyphPixels += width * height;
+  }
+  const double time = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  AtlasManager::Metrics metrics;
+  atlasManager.GetMetrics( metrics );
+
+  tet_printf( "%d glyphs packed in %d atlases, %d bytes of texture, in %f seconds\n", NUMBER_OF_GLYPHS, metrics.mAtlasCount, metrics.mTextureMemoryUsed, time );
+
+  // A fixed block per glyph sized to the headings would need twelve atlases.
+  DALI_TEST_EQUALS( metrics.mAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mTextureMemoryUsed, ATLAS_SIZE * ATLAS_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mImageCount, NUMBER_OF_GLYPHS, TEST_LOCATION );
+  DALI_TEST_CHECK( metrics.mAtlasMetrics[0u].mPixelsUsed > glyphPixels );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mTotalPixels, ATLAS_SIZE * ATLAS_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlasManager.GetFreePixels( 1u ), metrics.mAtlasMetrics[0u].mTotalPixels - metrics.mAtlasMetrics[0u].mPixelsUsed, TEST_LOCATION );
+
+  DALI_TEST_CHECK( CheckImageAreas( atlasManager, imageIds, widths, heights ) );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerReuseRemovedArea(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerReuseRemovedArea");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  AtlasManager::AtlasSlot first;
+  AtlasManager::AtlasSlot second;
+  atlasManager.Add( CreateGlyphBitmap( 40u, 40u ), first );
+  atlasManager.Add( CreateGlyphBitmap( 20u, 20u ), second );
+
+  AtlasManager::Metrics metrics;
+  atlasManager.GetMetrics( metrics );
+  const uint32_t usedPixels = metrics.mAtlasMetrics[0u].mPixelsUsed;
+
+  DALI_TEST_CHECK( atlasManager.Remove( first.mImageId ) );
+
+  atlasManager.GetMetrics( metrics );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mImageCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mPixelsUsed, usedPixels - 42u * 42u, TEST_LOCATION );
+
+  // The image id and the area of the removed image are reused.
+  AtlasManager::AtlasSlot third;
+  atlasManager.Add( CreateGlyphBitmap( 30u, 30u ), third );
+  DALI_TEST_EQUALS( third.mImageId, first.mImageId, TEST_LOCATION );
+
+  AtlasManager::Mesh2D thirdMesh;
+  atlasManager.GenerateMeshData( third.mImageId, Vector2::ZERO, thirdMesh, false );
+  DALI_TEST_EQUALS( thirdMesh.mVertices[0u].mTexCoords.x * static_cast<float>( ATLAS_SIZE ), 1.5f, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerCompaction(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerCompaction");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  // Fill the first atlas with headings.
+  Vector<AtlasManager::ImageId> imageIds;
+  AtlasManager::Metrics metrics;
+  do
+  {
+    AtlasManager::AtlasSlot slot;
+    atlasManager.Add( CreateGlyphBitmap( 70u, 70u ), slot );
+    imageIds.PushBack( slot.mImageId );
+    atlasManager.GetMetrics( metrics );
+  } while( 1u == metrics.mAtlasCount );
+
+  DALI_TEST_EQUALS( metrics.mAtlasCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlasManager.GetAtlas( imageIds[0u] ), 1u, TEST_LOCATION );
+
+  // Remove most of the headings of the first atlas. It becomes too fragmented to receive new glyphs.
+  const uint32_t numberOfImagesInFirstAtlas = imageIds.Count() - 1u;
+  for( uint32_t index = 1u; index < numberOfImagesInFirstAtlas; ++index )
+  {
+    atlasManager.Remove( imageIds[index] );
+  }
+
+  AtlasManager::AtlasSlot slot;
+  atlasManager.Add( CreateGlyphBitmap( 10u, 16u ), slot );
+  DALI_TEST_EQUALS( slot.mAtlasId, 2u, TEST_LOCATION );
+  atlasManager.Remove( slot.mImageId );
+
+  // Once its last glyph is removed the atlas is repacked from scratch.
+  atlasManager.Remove( imageIds[0u] );
+
+  atlasManager.GetMetrics( metrics );
+  DALI_TEST_EQUALS( metrics.mCompactionCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mImageCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0u].mPixelsUsed, 0u, TEST_LOCATION );
+
+  atlasManager.Add( CreateGlyphBitmap( 10u, 16u ), slot );
+  DALI_TEST_EQUALS( slot.mAtlasId, 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerBatchedUploads(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerBatchedUploads");
+  ToolkitTestApplication application;
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  textureTrace.Enable( true );
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  // The expected contents of the atlas. The first pixel is used to draw the underlines.
+  Vector<uint8_t> expected;
+  expected.Resize( ATLAS_SIZE * ATLAS_SIZE, 0u );
+  expected[0u] = 0xFF;
+
+  // A page of glyphs, some of them removed and replaced by others.
+  const uint32_t NUMBER_OF_GLYPHS = 300u;
+  Vector<AtlasManager::ImageId> imageIds;
+  clock_t start = clock();
+  for( uint32_t index = 0u; index < NUMBER_OF_GLYPHS; ++index )
+  {
+    const uint32_t width = 8u + index % 7u;
+    const uint32_t height = 14u + index % 5u;
+
+    AtlasManager::AtlasSlot slot;
+    atlasManager.Add( CreatePatternBitmap( index, width, height ), slot );
+    UploadGlyph( atlasManager, slot.mImageId, index, width, height, expected );
+    imageIds.PushBack( slot.mImageId );
+
+    if( 0u == index % 10u )
+    {
+      atlasManager.Remove( imageIds[index / 2u] );
+    }
+  }
+  atlasManager.FlushUploads();
+  const double time = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  AtlasManager::Metrics metrics;
+  atlasManager.GetMetrics( metrics );
+
+  tet_printf( "%d glyphs added in %f seconds with %d uploads of %d bytes\n", NUMBER_OF_GLYPHS, time, metrics.mUploadCount, metrics.mUploadedBytes );
+
+  // The glyphs are added to a new atlas, which is uploaded at once.
+  DALI_TEST_EQUALS( metrics.mAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mUploadCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mUploadedBytes, ATLAS_SIZE * ATLAS_SIZE, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  const TestGlAbstraction::TextureData* textureData = gl.GetTextureData( gl.GetLastGenTextureId() );
+  DALI_TEST_CHECK( textureData );
+  DALI_TEST_EQUALS( textureData->buffer.size(), static_cast<size_t>( ATLAS_SIZE * ATLAS_SIZE ), TEST_LOCATION );
+  DALI_TEST_CHECK( 0 == memcmp( &textureData->buffer[0u], expected.Begin(), expected.Count() ) );
+
+  // More glyphs added to the existing atlas are uploaded in a few areas.
+  textureTrace.Reset();
+  start = clock();
+  for( uint32_t index = NUMBER_OF_GLYPHS; index < 2u * NUMBER_OF_GLYPHS; ++index )
+  {
+    const uint32_t width = 8u + index % 7u;
+    const uint32_t height = 14u + index % 5u;
+
+    AtlasManager::AtlasSlot slot;
+    atlasManager.Add( CreatePatternBitmap( index, width, height ), slot );
+    UploadGlyph( atlasManager, slot.mImageId, index, width, height, expected );
+  }
+  atlasManager.FlushUploads();
+  const double secondTime = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  atlasManager.GetMetrics( metrics );
+
+  tet_printf( "%d glyphs added in %f seconds with %d uploads of %d bytes, instead of %d uploads\n", NUMBER_OF_GLYPHS, secondTime, metrics.mUploadCount, metrics.mUploadedBytes, 5u * NUMBER_OF_GLYPHS );
+
+  DALI_TEST_EQUALS( metrics.mAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( 0u < metrics.mUploadCount );
+  DALI_TEST_CHECK( 4u >= metrics.mUploadCount );
+  DALI_TEST_CHECK( ATLAS_SIZE * ATLAS_SIZE > metrics.mUploadedBytes );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ) + textureTrace.CountMethod( "TexImage2D" ), static_cast<int>( metrics.mUploadCount ), TEST_LOCATION );
+
+  textureData = gl.GetTextureData( gl.GetLastGenTextureId() );
+  DALI_TEST_CHECK( textureData );
+  DALI_TEST_CHECK( 0 == memcmp( &textureData->buffer[0u], expected.Begin(), expected.Count() ) );
+
+  // Nothing is uploaded when no glyph is added.
+  atlasManager.FlushUploads();
+  atlasManager.GetMetrics( metrics );
+  DALI_TEST_EQUALS( metrics.mUploadCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mUploadedBytes, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
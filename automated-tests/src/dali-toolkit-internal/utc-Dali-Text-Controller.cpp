@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <limits>
+#include <ctime>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
@@ -62,6 +63,76 @@ Dali::KeyEvent GenerateKey( const std::string& keyName,
   return DevelKeyEvent::New( keyName, "", keyString, keyCode, keyModifier, timeStamp, keyState, "", "", Device::Class::NONE, Device::Subclass::NONE );
 }
 
+// Checks the highlight quads of the current selection against the highlight box of each selected glyph.
+// The glyphs of a partly selected line have a quad each, a fully selected line has a single quad covering all its glyphs.
+void CheckSelectionHighlight( Controller::Impl& impl, const char* location )
+{
+  // The quads are cleared once the decorator updates the highlight.
+  impl.RepositionSelectionHandles();
+
+  const VisualModelPtr& visualModel = impl.mModel->mVisualModel;
+  CharacterIndex selectionStart = impl.mEventData->mLeftSelectionPosition;
+  CharacterIndex selectionEnd = impl.mEventData->mRightSelectionPosition;
+  if( selectionStart > selectionEnd )
+  {
+    std::swap( selectionStart, selectionEnd );
+  }
+
+  const Length numberOfGlyphs = *( visualModel->mGlyphsPerCharacter.Begin() + selectionEnd - 1u );
+  const GlyphIndex glyphStart = *( visualModel->mCharactersToGlyph.Begin() + selectionStart );
+  const GlyphIndex glyphEnd = *( visualModel->mCharactersToGlyph.Begin() + selectionEnd - 1u ) + ( ( numberOfGlyphs > 0u ) ? numberOfGlyphs - 1u : 0u );
+
+  std::vector< Vector4 > expectedQuads;
+  for( LineIndex lineIndex = 0u; lineIndex < visualModel->mLines.Count(); ++lineIndex )
+  {
+    const LineRun& line = *( visualModel->mLines.Begin() + lineIndex );
+    const GlyphIndex firstGlyphOfLine = line.glyphRun.glyphIndex;
+    const GlyphIndex lastGlyphOfLine = firstGlyphOfLine + line.glyphRun.numberOfGlyphs - 1u;
+    if( ( lastGlyphOfLine < glyphStart ) || ( firstGlyphOfLine > glyphEnd ) )
+    {
+      continue;
+    }
+
+    const float lineOffset = visualModel->GetLineOffset( lineIndex ) + impl.mModel->mScrollPosition.y;
+    const float lineHeight = line.ascender - line.descender;
+    const GlyphIndex first = std::max( glyphStart, firstGlyphOfLine );
+    const GlyphIndex last = std::min( glyphEnd, lastGlyphOfLine );
+    const bool wholeLine = ( first == firstGlyphOfLine ) && ( last == lastGlyphOfLine ) && ( first < last );
+
+    Vector4 lineQuad( std::numeric_limits<float>::max(), lineOffset, std::numeric_limits<float>::lowest(), lineOffset + lineHeight );
+    for( GlyphIndex index = first; index <= last; ++index )
+    {
+      const GlyphInfo& glyph = *( visualModel->mGlyphs.Begin() + index );
+      const Vector2& position = *( visualModel->mGlyphPositions.Begin() + index );
+
+      const float left = line.alignmentOffset + position.x - glyph.xBearing + impl.mModel->mScrollPosition.x;
+      const Vector4 glyphQuad( left, lineOffset, left + glyph.advance, lineOffset + lineHeight );
+      if( wholeLine )
+      {
+        lineQuad.x = std::min( lineQuad.x, glyphQuad.x );
+        lineQuad.z = std::max( lineQuad.z, glyphQuad.z );
+      }
+      else
+      {
+        expectedQuads.push_back( glyphQuad );
+      }
+    }
+
+    if( wholeLine )
+    {
+      expectedQuads.push_back( lineQuad );
+    }
+  }
+
+  // The quads which 'boxify' the selection follow the quads of the glyphs.
+  const Vector<Vector4>& quads = impl.mEventData->mDecorator->GetHighlightQuads();
+  DALI_TEST_CHECK( quads.Count() >= expectedQuads.size() );
+  for( std::size_t index = 0u; ( index < expectedQuads.size() ) && ( index < quads.Count() ); ++index )
+  {
+    DALI_TEST_EQUALS( *( quads.Begin() + index ), expectedQuads[index], 0.01f, location );
+  }
+}
+
 } // namespace
 
 int UtcDaliTextController(void)
@@ -1287,3 +1358,89 @@ int UtcDaliTextControllerDeleteSurroundings(void)
 
   END_TEST;
 }
+
+int UtcDaliTextControllerDragSelectionLongText(void)
+{
+  tet_infoline(" UtcDaliTextControllerDragSelectionLongText");
+  ToolkitTestApplication application;
+
+  // Creates a text controller.
+  ControllerPtr controller = Controller::New();
+
+  // Configures the text controller similarly to the text-editor.
+  ConfigureTextEditor( controller );
+
+  // Set a text with many lines.
+  const unsigned int NUMBER_OF_PARAGRAPHS = 500u;
+  std::string text;
+  for( unsigned int index = 0u; index < NUMBER_OF_PARAGRAPHS; ++index )
+  {
+    text += "Lorem ipsum dolor sit amet, aeque definiebas ea mei, posse iracundia ne cum.\n";
+  }
+  controller->SetText( text );
+
+  // Perform a relayout
+  const Size size( application.GetScene().GetSize() );
+  controller->Relayout( size );
+
+  // Get the implementation of the text controller
+  Controller::Impl& mImpl = Controller::Impl::GetImplementation( *controller.Get() );
+  const uint32_t numberOfCharacters = mImpl.mModel->mLogicalModel->mText.Count();
+
+  // Simulates the drag of the right selection handle through the whole text, one frame every 7 characters.
+  const uint32_t start = 3u;
+  uint32_t end = start + 1u;
+
+  // Part of the first line.
+  uint32_t partEnd = start + 20u;
+  controller->SetTextSelectionRange( &start, &partEnd );
+  controller->Relayout( size );
+  CheckSelectionHighlight( mImpl, TEST_LOCATION );
+
+  const clock_t dragStart = clock();
+  unsigned int numberOfFrames = 0u;
+  for( ; end < numberOfCharacters; end += 7u, ++numberOfFrames )
+  {
+    controller->SetTextSelectionRange( &start, &end );
+    controller->Relayout( size );
+  }
+  const double dragSeconds = static_cast<double>( clock() - dragStart ) / CLOCKS_PER_SEC;
+
+  DALI_TEST_EQUALS( EventData::SELECTING, mImpl.mEventData->mState, TEST_LOCATION );
+  DALI_TEST_CHECK( mImpl.mEventData->mDecorator->IsHighlightActive() );
+
+  // Many fully selected lines between two partly selected ones.
+  CheckSelectionHighlight( mImpl, TEST_LOCATION );
+
+  // Drags the handle back.
+  for( end = numberOfCharacters; end > start + 7u; )
+  {
+    end -= 7u;
+    controller->SetTextSelectionRange( &start, &end );
+    controller->Relayout( size );
+  }
+
+  const Uint32Pair range = controller->GetTextSelectionRange();
+  DALI_TEST_EQUALS( range.first, start, TEST_LOCATION );
+  DALI_TEST_EQUALS( range.second, end, TEST_LOCATION );
+
+  std::string retrievedText;
+  mImpl.RetrieveSelection( retrievedText, false );
+  DALI_TEST_EQUALS( text.substr( start, end - start ), retrievedText, TEST_LOCATION );
+
+  // The selection shrunk back.
+  CheckSelectionHighlight( mImpl, TEST_LOCATION );
+
+  // The selection grows again over a few lines.
+  end = start + 200u;
+  controller->SetTextSelectionRange( &start, &end );
+  controller->Relayout( size );
+  CheckSelectionHighlight( mImpl, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  tet_printf( "Drag selection of %u frames in %f seconds\n", numberOfFrames, dragSeconds );
+
+  END_TEST;
+}
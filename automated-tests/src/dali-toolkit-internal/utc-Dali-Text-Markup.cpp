@@ -18,11 +18,13 @@
 #include <iostream>
 
 #include <stdlib.h>
+#include <ctime>
 #include <limits>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
+#include <dali-toolkit/internal/text/character-set-conversion.h>
 #include <dali-toolkit/internal/text/markup-processor.h>
 #include <dali-toolkit/internal/text/markup-processor-helper-functions.h>
 #include <dali-toolkit/internal/text/color-run.h>
@@ -184,7 +186,8 @@ namespace
     Vector<ColorRun> colorRuns;
     Vector<FontDescriptionRun> fontRuns;
     Vector<EmbeddedItem> items;
-    MarkupProcessData markupProcessData( colorRuns, fontRuns, items );
+    Vector<Character> characters;
+    MarkupProcessData markupProcessData( colorRuns, fontRuns, items, characters );
     ProcessMarkupString( data.xHTMLEntityString, markupProcessData );
 
     for( Vector<EmbeddedItem>::Iterator it = items.Begin(),
@@ -197,9 +200,80 @@ namespace
     }
     items.Clear();
 
-    if( markupProcessData.markupProcessedText != data.expectedString )
+    std::string markupProcessedText;
+    Utf32ToUtf8( characters.Begin(), characters.Count(), markupProcessedText );
+
+    if( markupProcessedText != data.expectedString )
+    {
+      std::cout << "  different output string : " << markupProcessedText << ", expected : " << data.expectedString << " " << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  ///////////////////////////////////////////////////////////
+
+  struct ProcessMarkupStringData
+  {
+    std::string description;
+    std::string markupString;
+    std::string expectedString;
+    unsigned int expectedNumberOfColorRuns;
+    unsigned int expectedNumberOfFontRuns;
+  };
+
+  bool ProcessMarkupStringTest( const ProcessMarkupStringData& data )
+  {
+    std::cout << "  testing " << data.description << std::endl;
+
+    Vector<ColorRun> colorRuns;
+    Vector<FontDescriptionRun> fontRuns;
+    Vector<EmbeddedItem> items;
+    Vector<Character> characters;
+    MarkupProcessData markupProcessData( colorRuns, fontRuns, items, characters );
+    ProcessMarkupString( data.markupString, markupProcessData );
+
+    for( Vector<FontDescriptionRun>::Iterator it = fontRuns.Begin(),
+           endIt = fontRuns.End();
+         it != endIt;
+         ++it )
+    {
+      delete[] ( *it ).familyName;
+    }
+
+    // The characters must be the same than the ones converted from the expected utf8 string.
+    Vector<Character> expectedCharacters;
+    expectedCharacters.Resize( data.expectedString.size() );
+    const Length numberOfCharacters = Utf8ToUtf32( reinterpret_cast<const uint8_t*>( data.expectedString.c_str() ),
+                                                   data.expectedString.size(),
+                                                   expectedCharacters.Begin() );
+    expectedCharacters.Resize( numberOfCharacters );
+
+    if( characters.Count() != expectedCharacters.Count() )
+    {
+      std::cout << "  different number of characters : " << characters.Count() << ", expected : " << expectedCharacters.Count() << std::endl;
+      return false;
+    }
+
+    for( unsigned int index = 0u; index < numberOfCharacters; ++index )
+    {
+      if( characters[index] != expectedCharacters[index] )
+      {
+        std::cout << "  different character at index " << index << " : " << characters[index] << ", expected : " << expectedCharacters[index] << std::endl;
+        return false;
+      }
+    }
+
+    if( colorRuns.Count() != data.expectedNumberOfColorRuns )
+    {
+      std::cout << "  different number of color runs : " << colorRuns.Count() << ", expected : " << data.expectedNumberOfColorRuns << std::endl;
+      return false;
+    }
+
+    if( fontRuns.Count() != data.expectedNumberOfFontRuns )
     {
-      std::cout << "  different output string : " << markupProcessData.markupProcessedText << ", expected : " << data.expectedString << " " << std::endl;
+      std::cout << "  different number of font runs : " << fontRuns.Count() << ", expected : " << data.expectedNumberOfFontRuns << std::endl;
       return false;
     }
 
@@ -542,3 +616,122 @@ int UtcDaliTextXHTMLEntityToUTF8(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextProcessMarkupString(void)
+{
+  tet_infoline(" UtcDaliTextProcessMarkupString");
+
+  const ProcessMarkupStringData data[] =
+  {
+    {
+      "Plain text",
+      "Hello world",
+      "Hello world",
+      0u,
+      0u
+    },
+    {
+      "Upper case tags",
+      "<COLOR value='red'>Hello</Color> <B>world</b>",
+      "Hello world",
+      1u,
+      1u
+    },
+    {
+      "Nested tags",
+      "<font family='TizenSans' size='12'><color value='#F00'>Hel<i>lo</i></color> <b>wor<color value='blue'>ld</color></b></font>",
+      "Hello world",
+      2u,
+      3u
+    },
+    {
+      "Unknown and not supported tags",
+      "<u>Hello</u> <unknown>world</unknown><shadow>!</shadow>",
+      "Hello world!",
+      0u,
+      0u
+    },
+    {
+      "Multi-byte characters and entities",
+      "<b>\xD8\xA7\xD9\x84\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A\xD8\xA9</b> &amp; &#x3B1;\\<",
+      "\xD8\xA7\xD9\x84\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A\xD8\xA9 & \xCE\xB1<",
+      0u,
+      1u
+    },
+    {
+      "New paragraph characters",
+      "Hello\r\n<b>world</b>\r!\n",
+      "Hello\nworld\n!\n",
+      0u,
+      1u
+    }
+  };
+  const unsigned int numberOfTests = 6u;
+
+  for( unsigned int index = 0u; index < numberOfTests; ++index )
+  {
+    ToolkitTestApplication application;
+    if( !ProcessMarkupStringTest( data[index] ) )
+    {
+      tet_result(TET_FAIL);
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextProcessMarkupStringHeavyMarkup(void)
+{
+  tet_infoline(" UtcDaliTextProcessMarkupStringHeavyMarkup");
+
+  ToolkitTestApplication application;
+
+  // Builds a chat like mark-up string with a color and a bold run per word.
+  const unsigned int NUMBER_OF_WORDS = 1000u;
+  std::string markupString;
+  std::string expectedString;
+  for( unsigned int index = 0u; index < NUMBER_OF_WORDS; ++index )
+  {
+    markupString += "<color value='#FF0000'><b>word</b></color> ";
+    expectedString += "word ";
+  }
+
+  Vector<ColorRun> colorRuns;
+  Vector<FontDescriptionRun> fontRuns;
+  Vector<EmbeddedItem> items;
+  Vector<Character> characters;
+
+  const unsigned int NUMBER_OF_ITERATIONS = 100u;
+
+  const clock_t start = clock();
+  for( unsigned int iteration = 0u; iteration < NUMBER_OF_ITERATIONS; ++iteration )
+  {
+    colorRuns.Clear();
+    fontRuns.Clear();
+    MarkupProcessData markupProcessData( colorRuns, fontRuns, items, characters );
+    ProcessMarkupString( markupString, markupProcessData );
+  }
+  const double seconds = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  tet_printf( "Processed %u bytes of mark-up %u times in %f seconds\n", static_cast<unsigned int>( markupString.size() ), NUMBER_OF_ITERATIONS, seconds );
+
+  DALI_TEST_EQUALS( colorRuns.Count(), NUMBER_OF_WORDS, TEST_LOCATION );
+  DALI_TEST_EQUALS( fontRuns.Count(), NUMBER_OF_WORDS, TEST_LOCATION );
+  DALI_TEST_EQUALS( characters.Count(), expectedString.size(), TEST_LOCATION );
+
+  for( unsigned int index = 0u; index < NUMBER_OF_WORDS; ++index )
+  {
+    const ColorRun& colorRun = colorRuns[index];
+    DALI_TEST_EQUALS( colorRun.characterRun.characterIndex, 5u * index, TEST_LOCATION );
+    DALI_TEST_EQUALS( colorRun.characterRun.numberOfCharacters, 4u, TEST_LOCATION );
+    DALI_TEST_EQUALS( colorRun.color, Color::RED, TEST_LOCATION );
+
+    const FontDescriptionRun& fontRun = fontRuns[index];
+    DALI_TEST_EQUALS( fontRun.characterRun.characterIndex, 5u * index, TEST_LOCATION );
+    DALI_TEST_EQUALS( fontRun.characterRun.numberOfCharacters, 4u, TEST_LOCATION );
+    DALI_TEST_CHECK( fontRun.weightDefined );
+  }
+
+  END_TEST;
+}
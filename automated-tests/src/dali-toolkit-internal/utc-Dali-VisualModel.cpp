@@ -18,10 +18,13 @@
 #include <iostream>
 
 #include <stdlib.h>
+#include <ctime>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
+#include <dali-toolkit/internal/text/cursor-helper-functions.h>
+#include <dali-toolkit/internal/text/color-segmentation.h>
 
 
 using namespace Dali;
@@ -35,6 +38,22 @@ using namespace Text;
 //
 // void CreateGlyphsPerCharacterTable( CharacterIndex startIndex,
 //                                     Length numberOfCharacters )
+//
+// LineIndex GetLineOfCharacter( CharacterIndex characterIndex )
+//
+// float GetLineOffset( LineIndex lineIndex )
+//
+// LineIndex GetLineOfPosition( float visualY, bool& matchedLine )
+//
+// void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
+//                                const Vector<GlyphIndex>& charactersToGlyph,
+//                                const Vector<Length>& glyphsPerCharacter,
+//                                CharacterIndex startCharacterIndex,
+//                                GlyphIndex startGlyphIndex,
+//                                Length numberOfCharacters,
+//                                Vector<Vector4>& colors,
+//                                ColorLookupTable& colorLookupTable,
+//                                Vector<ColorIndex>& colorIndices )
 
 
 //////////////////////////////////////////////////////////
@@ -228,6 +247,59 @@ bool SetCharacterToGlyphTest( const SetCharacterToGlyphData& data )
   return true;
 }
 
+/**
+ * Sets the color indices of the glyphs searching the colors linearly, one glyph per character.
+ */
+void SetColorIndicesLinearSearch( const Vector<ColorRun>& colorRuns,
+                                  Vector<Vector4>& colors,
+                                  Vector<ColorIndex>& colorIndices )
+{
+  for( Vector<ColorRun>::ConstIterator it = colorRuns.Begin(),
+         endIt = colorRuns.End();
+       it != endIt;
+       ++it )
+  {
+    const ColorRun& colorRun = *it;
+
+    ColorIndex colorIndex = 1u;
+    Vector<Vector4>::ConstIterator colorIt = colors.Begin();
+    for( Vector<Vector4>::ConstIterator colorEndIt = colors.End(); ( colorIt != colorEndIt ) && ( colorRun.color != *colorIt ); ++colorIt )
+    {
+      ++colorIndex;
+    }
+
+    if( colorIt == colors.End() )
+    {
+      colors.PushBack( colorRun.color );
+    }
+
+    for( CharacterIndex index = colorRun.characterRun.characterIndex; index < colorRun.characterRun.characterIndex + colorRun.characterRun.numberOfCharacters; ++index )
+    {
+      colorIndices[index] = colorIndex;
+    }
+  }
+}
+
+bool CompareColorIndices( const Vector<ColorIndex>& colorIndices,
+                          const Vector<ColorIndex>& expectedColorIndices )
+{
+  if( colorIndices.Count() != expectedColorIndices.Count() )
+  {
+    return false;
+  }
+
+  for( unsigned int index = 0u; index < colorIndices.Count(); ++index )
+  {
+    if( colorIndices[index] != expectedColorIndices[index] )
+    {
+      std::cout << "  Different color index at " << index << ", " << colorIndices[index] << ", expected : " << expectedColorIndices[index] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////
@@ -387,3 +459,177 @@ int UtcDaliSetCharacterToGlyph(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliVisualModelLinesOfLargeDocument(void)
+{
+  tet_infoline(" UtcDaliVisualModelLinesOfLargeDocument");
+
+  ToolkitTestApplication application;
+
+  // Builds a document with 100k lines of different heights and number of characters.
+  const Length NUMBER_OF_LINES = 100000u;
+
+  VisualModelPtr visualModel = VisualModel::New();
+  Vector<LineRun>& lines = visualModel->mLines;
+  lines.Resize( NUMBER_OF_LINES );
+
+  CharacterIndex characterIndex = 0u;
+  for( LineIndex index = 0u; index < NUMBER_OF_LINES; ++index )
+  {
+    LineRun& line = lines[index];
+    line.characterRun.characterIndex = characterIndex;
+    line.characterRun.numberOfCharacters = 1u + index % 80u;
+    line.glyphRun.glyphIndex = characterIndex;
+    line.glyphRun.numberOfGlyphs = line.characterRun.numberOfCharacters;
+    line.ascender = 10.f + static_cast<float>( index % 3u );
+    line.descender = -4.f;
+
+    characterIndex += line.characterRun.numberOfCharacters;
+  }
+  visualModel->ClearCaches();
+
+  // Moves the cursor through the document, one character every 37.
+  const clock_t cursorStart = clock();
+  LineIndex expectedLineIndex = 0u;
+  bool lineOfCharacterOk = true;
+  for( CharacterIndex index = 0u; index < characterIndex; index += 37u )
+  {
+    while( index >= lines[expectedLineIndex].characterRun.characterIndex + lines[expectedLineIndex].characterRun.numberOfCharacters )
+    {
+      ++expectedLineIndex;
+    }
+
+    // Jumps from the beginning to the end of the document to avoid the cached line.
+    lineOfCharacterOk = lineOfCharacterOk && ( expectedLineIndex == visualModel->GetLineOfCharacter( index ) );
+    lineOfCharacterOk = lineOfCharacterOk && ( NUMBER_OF_LINES - 1u == visualModel->GetLineOfCharacter( characterIndex - 1u ) );
+  }
+  const double cursorSeconds = static_cast<double>( clock() - cursorStart ) / CLOCKS_PER_SEC;
+  DALI_TEST_CHECK( lineOfCharacterOk );
+
+  // A character after the last one is not in any line.
+  DALI_TEST_EQUALS( visualModel->GetLineOfCharacter( characterIndex ), NUMBER_OF_LINES, TEST_LOCATION );
+
+  // Hit tests every line.
+  const clock_t hitTestStart = clock();
+  float lineOffset = 0.f;
+  bool lineOfPositionOk = true;
+  for( LineIndex index = 0u; index < NUMBER_OF_LINES; ++index )
+  {
+    const LineRun& line = lines[index];
+    const float lineHeight = line.ascender - line.descender;
+
+    lineOfPositionOk = lineOfPositionOk && ( lineOffset == visualModel->GetLineOffset( index ) );
+
+    bool matchedLine = false;
+    lineOfPositionOk = lineOfPositionOk && ( index == GetClosestLine( visualModel, lineOffset + 0.5f * lineHeight, matchedLine ) ) && matchedLine;
+
+    lineOffset += lineHeight;
+  }
+  const double hitTestSeconds = static_cast<double>( clock() - hitTestStart ) / CLOCKS_PER_SEC;
+  DALI_TEST_CHECK( lineOfPositionOk );
+
+  // Above and below the text.
+  bool matchedLine = true;
+  DALI_TEST_EQUALS( GetClosestLine( visualModel, -1.f, matchedLine ), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !matchedLine );
+  DALI_TEST_EQUALS( GetClosestLine( visualModel, lineOffset + 1.f, matchedLine ), NUMBER_OF_LINES - 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( !matchedLine );
+
+  tet_printf( "Cursor moves in %f seconds. Hit tests in %f seconds\n", cursorSeconds, hitTestSeconds );
+
+  END_TEST;
+}
+
+int UtcDaliVisualModelColorSegmentationManyColorRuns(void)
+{
+  tet_infoline(" UtcDaliVisualModelColorSegmentationManyColorRuns");
+
+  ToolkitTestApplication application;
+
+  // Builds a syntax highlighted like text with 20k color runs of 4 characters and one glyph per character.
+  const Length NUMBER_OF_RUNS = 20000u;
+  const Length CHARACTERS_PER_RUN = 4u;
+  const Length NUMBER_OF_CHARACTERS = NUMBER_OF_RUNS * CHARACTERS_PER_RUN;
+
+  Vector<GlyphIndex> charactersToGlyph;
+  Vector<Length> glyphsPerCharacter;
+  charactersToGlyph.Resize( NUMBER_OF_CHARACTERS );
+  glyphsPerCharacter.Resize( NUMBER_OF_CHARACTERS, 1u );
+  for( CharacterIndex index = 0u; index < NUMBER_OF_CHARACTERS; ++index )
+  {
+    charactersToGlyph[index] = index;
+  }
+
+  Vector<ColorRun> colorRuns;
+  colorRuns.Resize( NUMBER_OF_RUNS );
+  for( Length index = 0u; index < NUMBER_OF_RUNS; ++index )
+  {
+    ColorRun& colorRun = colorRuns[index];
+    colorRun.characterRun.characterIndex = index * CHARACTERS_PER_RUN;
+    colorRun.characterRun.numberOfCharacters = CHARACTERS_PER_RUN;
+
+    // Thousands of different colors, some of them repeated and a few close to a rounding boundary.
+    const unsigned int value = ( index * 7919u ) % 5000u;
+    colorRun.color = Vector4( static_cast<float>( value % 17u ) / 255.f,
+                              static_cast<float>( value % 251u ) / 255.f,
+                              ( static_cast<float>( value / 251u ) + ( ( 0u == index % 5u ) ? 0.5f : 0.f ) ) / 255.f,
+                              1.f );
+  }
+
+  Vector<Vector4> expectedColors;
+  Vector<ColorIndex> expectedColorIndices;
+  expectedColorIndices.Resize( NUMBER_OF_CHARACTERS );
+
+  const clock_t linearStart = clock();
+  SetColorIndicesLinearSearch( colorRuns, expectedColors, expectedColorIndices );
+  const double linearSeconds = static_cast<double>( clock() - linearStart ) / CLOCKS_PER_SEC;
+
+  Vector<Vector4> colors;
+  ColorLookupTable colorLookupTable;
+  Vector<ColorIndex> colorIndices;
+
+  const clock_t hashedStart = clock();
+  SetColorSegmentationInfo( colorRuns,
+                            charactersToGlyph,
+                            glyphsPerCharacter,
+                            0u,
+                            0u,
+                            NUMBER_OF_CHARACTERS,
+                            colors,
+                            colorLookupTable,
+                            colorIndices );
+  const double hashedSeconds = static_cast<double>( clock() - hashedStart ) / CLOCKS_PER_SEC;
+
+  DALI_TEST_EQUALS( colors.Count(), expectedColors.Count(), TEST_LOCATION );
+  DALI_TEST_EQUALS( colorIndices.Count(), expectedColorIndices.Count(), TEST_LOCATION );
+  DALI_TEST_CHECK( CompareColorIndices( colorIndices, expectedColorIndices ) );
+
+  // Updates the colors of a paragraph in the middle of the text, as the text controller does. The lookup table is kept.
+  const CharacterIndex startIndex = NUMBER_OF_CHARACTERS / 2u;
+  const Length numberOfCharacters = 1000u * CHARACTERS_PER_RUN;
+  for( Length index = startIndex / CHARACTERS_PER_RUN; index < ( startIndex + numberOfCharacters ) / CHARACTERS_PER_RUN; ++index )
+  {
+    colorRuns[index].color = Vector4( 1.f, static_cast<float>( index % 100u ) / 100.f, 0.f, 1.f );
+  }
+
+  SetColorIndicesLinearSearch( colorRuns, expectedColors, expectedColorIndices );
+
+  colorIndices.Erase( colorIndices.Begin() + startIndex, colorIndices.Begin() + startIndex + numberOfCharacters );
+  SetColorSegmentationInfo( colorRuns,
+                            charactersToGlyph,
+                            glyphsPerCharacter,
+                            startIndex,
+                            startIndex,
+                            numberOfCharacters,
+                            colors,
+                            colorLookupTable,
+                            colorIndices );
+
+  DALI_TEST_EQUALS( colors.Count(), expectedColors.Count(), TEST_LOCATION );
+  DALI_TEST_EQUALS( colorIndices.Count(), expectedColorIndices.Count(), TEST_LOCATION );
+  DALI_TEST_CHECK( CompareColorIndices( colorIndices, expectedColorIndices ) );
+
+  tet_printf( "Linear search in %f seconds. Hashed search in %f seconds\n", linearSeconds, hashedSeconds );
+
+  END_TEST;
+}
@@ -139,6 +139,23 @@ int UtcDaliVisualUrlGif(void)
   END_TEST;
 }
 
+int UtcDaliVisualUrlKtx(void)
+{
+  tet_infoline( "UtcDaliVisualUrl KTX" );
+
+  DALI_TEST_EQUALS( VisualUrl::KTX, VisualUrl("foobar.ktx").GetType(), TEST_LOCATION );
+
+  DALI_TEST_EQUALS( VisualUrl::KTX, VisualUrl("foobar.KTX").GetType(), TEST_LOCATION );
+
+  // KTXs aren't N-patch
+  DALI_TEST_EQUALS( VisualUrl::KTX, VisualUrl("foobar.9.ktx").GetType(), TEST_LOCATION );
+
+  DALI_TEST_EQUALS( VisualUrl::REGULAR_IMAGE, VisualUrl("ktx.png").GetType(), TEST_LOCATION );
+  DALI_TEST_EQUALS( VisualUrl::REGULAR_IMAGE, VisualUrl("ktx.ktx2").GetType(), TEST_LOCATION );
+
+  END_TEST;
+}
+
 
 int UtcDaliVisualUrlLocationP(void)
 {
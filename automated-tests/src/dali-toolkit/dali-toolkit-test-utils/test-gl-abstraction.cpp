@@ -75,6 +75,13 @@ void TestGlAbstraction::Initialize()
   mLastProgramIdUsed      = 0;
   mLastUniformIdUsed      = 0;
   mLastDepthMask          = false;
+  mUnpackAlignment        = 4;
+
+  for(unsigned int i = 0; i < MIN_TEXTURE_UNIT_LIMIT; ++i)
+  {
+    mActiveTextures[i].mCurrentTexture = 0;
+  }
+  mTextureData.clear();
 
   mUniforms.clear();
   mProgramUniforms1i.clear();
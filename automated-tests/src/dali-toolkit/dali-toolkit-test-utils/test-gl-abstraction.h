@@ -149,6 +149,11 @@ public:
       }
     }
 
+    if(mActiveTextureUnit < MIN_TEXTURE_UNIT_LIMIT)
+    {
+      mActiveTextures[mActiveTextureUnit].mCurrentTexture = texture;
+    }
+
     std::stringstream out;
     out << target << ", " << texture;
 
@@ -693,6 +698,28 @@ public:
     return mNumGeneratedTextures;
   }
 
+  /**
+   * The pixels uploaded to the level 0 of a 2D texture by TexImage2D and TexSubImage2D.
+   */
+  struct TextureData
+  {
+    GLsizei              width;
+    GLsizei              height;
+    GLuint               bytesPerPixel;
+    std::vector<uint8_t> buffer; ///< Tightly packed rows
+  };
+
+  /**
+   * This method can be used by test cases, to check the pixels uploaded to a texture.
+   * @param[in] texture The texture ID
+   * @return The uploaded pixels or NULL if nothing has been uploaded to the texture
+   */
+  inline const TextureData* GetTextureData(GLuint texture) const
+  {
+    TextureDataContainer::const_iterator it = mTextureData.find(texture);
+    return (it != mTextureData.end()) ? &it->second : NULL;
+  }
+
   inline void GetActiveAttrib(GLuint program, GLuint index, GLsizei bufsize, GLsizei* length, GLint* size, GLenum* type, char* name) override
   {
   }
@@ -941,6 +968,10 @@ public:
 
   inline void PixelStorei(GLenum pname, GLint param) override
   {
+    if(pname == GL_UNPACK_ALIGNMENT)
+    {
+      mUnpackAlignment = param;
+    }
   }
 
   inline void PolygonOffset(GLfloat factor, GLfloat units) override
@@ -1110,6 +1141,17 @@ public:
     namedParams["type"]           = ToString(type);
 
     mTextureTrace.PushCall("TexImage2D", out.str(), namedParams);
+
+    if((target == GL_TEXTURE_2D) && (level == 0) && (mActiveTextureUnit < MIN_TEXTURE_UNIT_LIMIT))
+    {
+      TextureData& data  = mTextureData[mActiveTextures[mActiveTextureUnit].mCurrentTexture];
+      data.width         = width;
+      data.height        = height;
+      data.bytesPerPixel = GetBytesPerPixel(format);
+      data.buffer.assign(width * height * data.bytesPerPixel, 0u);
+
+      WriteTextureData(data, 0, 0, width, height, pixels);
+    }
   }
 
   inline void TexParameterf(GLenum target, GLenum pname, GLfloat param) override
@@ -1173,6 +1215,15 @@ public:
     namedParams["width"]   = ToString(width);
     namedParams["height"]  = ToString(height);
     mTextureTrace.PushCall("TexSubImage2D", out.str(), namedParams);
+
+    if((target == GL_TEXTURE_2D) && (level == 0) && (mActiveTextureUnit < MIN_TEXTURE_UNIT_LIMIT))
+    {
+      TextureDataContainer::iterator it = mTextureData.find(mActiveTextures[mActiveTextureUnit].mCurrentTexture);
+      if(it != mTextureData.end())
+      {
+        WriteTextureData(it->second, xoffset, yoffset, width, height, pixels);
+      }
+    }
   }
 
   inline void Uniform1f(GLint location, GLfloat value) override
@@ -2351,6 +2402,47 @@ public: // TEST FUNCTIONS
     mBufferSubDataCalls.clear();
   }
 
+private:
+  inline static GLuint GetBytesPerPixel(GLenum format)
+  {
+    switch(format)
+    {
+      case GL_ALPHA:
+      case GL_LUMINANCE:
+      {
+        return 1u;
+      }
+      case GL_LUMINANCE_ALPHA:
+      {
+        return 2u;
+      }
+      case GL_RGB:
+      {
+        return 3u;
+      }
+      default:
+      {
+        return 4u;
+      }
+    }
+  }
+
+  inline void WriteTextureData(TextureData& data, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, const void* pixels)
+  {
+    if(!pixels || (xoffset < 0) || (yoffset < 0) || (xoffset + width > data.width) || (yoffset + height > data.height))
+    {
+      return;
+    }
+
+    const GLuint   rowSize   = width * data.bytesPerPixel;
+    const GLuint   rowStride = ((rowSize + mUnpackAlignment - 1u) / mUnpackAlignment) * mUnpackAlignment;
+    const uint8_t* source    = static_cast<const uint8_t*>(pixels);
+    for(GLsizei y = 0; y < height; ++y)
+    {
+      memcpy(&data.buffer[((yoffset + y) * data.width + xoffset) * data.bytesPerPixel], source + y * rowStride, rowSize);
+    }
+  }
+
 private:
   GLuint                                mCurrentProgram;
   GLuint                                mCompileStatus;
@@ -2408,10 +2500,16 @@ private:
   struct ActiveTextureType
   {
     std::vector<GLuint> mBoundTextures;
+    GLuint              mCurrentTexture;
   };
 
   ActiveTextureType mActiveTextures[MIN_TEXTURE_UNIT_LIMIT];
 
+  // Data for checking the uploaded pixels
+  typedef std::map<GLuint, TextureData> TextureDataContainer;
+  TextureDataContainer                  mTextureData;
+  GLuint                                mUnpackAlignment;
+
   TraceCallStack mCullFaceTrace;
   TraceCallStack mEnableDisableTrace;
   TraceCallStack mShaderTrace;
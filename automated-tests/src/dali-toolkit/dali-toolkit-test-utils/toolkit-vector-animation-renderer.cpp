@@ -21,6 +21,9 @@
 #include <toolkit-vector-animation-renderer.h>
 #include <toolkit-event-thread-callback.h>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 namespace Dali
 {
@@ -86,6 +89,13 @@ public:
 
   bool Render( uint32_t frameNumber )
   {
+    if( mRenderDelay > 0 )
+    {
+      // Stall the rasterization, so the next frames are late
+      std::this_thread::sleep_for( std::chrono::milliseconds( mRenderDelay ) );
+    }
+    mRenderCount++;
+
     if( mNeedTrigger )
     {
       mEventThreadCallback->Trigger();
@@ -150,6 +160,8 @@ public:
 
   static uint32_t mCount;
   static bool mNeedTrigger;
+  static uint32_t mRenderDelay;
+  static std::atomic< uint32_t > mRenderCount;
 
   std::string mUrl;
   Dali::Renderer mRenderer;
@@ -163,6 +175,8 @@ public:
 
 uint32_t VectorAnimationRenderer::mCount = 0;
 bool VectorAnimationRenderer::mNeedTrigger = true;
+uint32_t VectorAnimationRenderer::mRenderDelay = 0;
+std::atomic< uint32_t > VectorAnimationRenderer::mRenderCount( 0 );
 
 inline VectorAnimationRenderer& GetImplementation( Dali::VectorAnimationRenderer& renderer )
 {
@@ -278,6 +292,17 @@ void RequestTrigger()
   Dali::Internal::Adaptor::VectorAnimationRenderer::mNeedTrigger = true;
 }
 
+void SetRenderDelay( uint32_t milliseconds )
+{
+  Dali::Internal::Adaptor::VectorAnimationRenderer::mRenderDelay = milliseconds;
+  Dali::Internal::Adaptor::VectorAnimationRenderer::mRenderCount = 0;
+}
+
+uint32_t GetRenderCount()
+{
+  return Dali::Internal::Adaptor::VectorAnimationRenderer::mRenderCount;
+}
+
 } // VectorAnimationRenderer
 } // Test
 
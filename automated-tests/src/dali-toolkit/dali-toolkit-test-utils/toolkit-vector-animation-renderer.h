@@ -18,6 +18,8 @@
  *
  */
 
+#include <cstdint>
+
 namespace Test
 {
 namespace VectorAnimationRenderer
@@ -33,6 +35,16 @@ namespace VectorAnimationRenderer
 
 void RequestTrigger();
 
+/**
+ * Makes every rendering take the given time, and restarts counting the renderings.
+ */
+void SetRenderDelay( uint32_t milliseconds );
+
+/**
+ * Retrieves the number of renderings since the last call to SetRenderDelay().
+ */
+uint32_t GetRenderCount();
+
 } // VectorAnimationRenderer
 } // Test
 
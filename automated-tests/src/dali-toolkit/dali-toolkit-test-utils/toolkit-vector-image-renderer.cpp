@@ -20,8 +20,11 @@
 #include <dali/public-api/rendering/renderer.h>
 #include <toolkit-application.h>
 #include <toolkit-event-thread-callback.h>
+#include <toolkit-vector-image-renderer.h>
 #include <memory>
+#include <chrono>
 #include <cstring>
+#include <thread>
 #include <sys/stat.h>
 
 namespace Dali
@@ -63,7 +66,12 @@ public:
 
   bool Rasterize(Dali::Devel::PixelBuffer& buffer, float scale)
   {
-     return mRasterizeSuccess;
+    if( mRasterizeDelay > 0 )
+    {
+      // Keep the rasterize thread busy, so the next tasks wait in the queue
+      std::this_thread::sleep_for( std::chrono::milliseconds( mRasterizeDelay ) );
+    }
+    return mRasterizeSuccess;
   }
 
   void GetDefaultSize(uint32_t& width, uint32_t& height) const
@@ -74,11 +82,15 @@ public:
 
 public:
 
+  static uint32_t mRasterizeDelay;
+
   uint32_t mWidth;
   uint32_t mHeight;
   bool     mRasterizeSuccess;
 };
 
+uint32_t VectorImageRenderer::mRasterizeDelay = 0;
+
 inline VectorImageRenderer& GetImplementation( Dali::VectorImageRenderer& renderer )
 {
   DALI_ASSERT_ALWAYS( renderer && "VectorImageRenderer handle is empty." );
@@ -138,3 +150,16 @@ void VectorImageRenderer::GetDefaultSize( uint32_t& width, uint32_t& height ) co
 }
 
 } // namespace Dali
+
+namespace Test
+{
+namespace VectorImageRenderer
+{
+
+void SetRasterizeDelay( uint32_t milliseconds )
+{
+  Dali::Internal::Adaptor::VectorImageRenderer::mRasterizeDelay = milliseconds;
+}
+
+} // VectorImageRenderer
+} // Test
@@ -0,0 +1,37 @@
+#ifndef DALI_TOOLKIT_TEST_VECTOR_IMAGE_RENDERER_H
+#define DALI_TOOLKIT_TEST_VECTOR_IMAGE_RENDERER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+
+namespace Test
+{
+namespace VectorImageRenderer
+{
+
+/**
+ * Makes every rasterization take the given time.
+ */
+void SetRasterizeDelay( uint32_t milliseconds );
+
+} // VectorImageRenderer
+} // Test
+
+
+#endif // DALI_TOOLKIT_TEST_VECTOR_IMAGE_RENDERER_H
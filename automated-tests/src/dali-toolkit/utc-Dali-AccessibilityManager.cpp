@@ -16,6 +16,8 @@
  */
 
 #include <iostream>
+#include <chrono>
+#include <vector>
 #include <stdlib.h>
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -228,6 +230,81 @@ int UtcDaliAccessibilityManagerSetAndGetFocusOrder(void)
   END_TEST;
 }
 
+int UtcDaliAccessibilityManagerSetFocusOrders(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliAccessibilityManagerSetFocusOrders");
+
+  AccessibilityManager manager = AccessibilityManager::Get();
+  DALI_TEST_CHECK(manager);
+
+  Dali::AccessibilityAdaptor accAdaptor = Dali::AccessibilityAdaptor::Get();
+  Test::AccessibilityAdaptor::SetEnabled( accAdaptor, true );
+  accAdaptor.HandleActionEnableEvent();
+
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < 6u; ++i )
+  {
+    actors.push_back( Actor::New() );
+    application.GetScene().Add( actors.back() );
+  }
+  Actor a = actors[0], b = actors[1], c = actors[2], d = actors[3], e = actors[4], f = actors[5];
+
+  manager.SetFocusOrder( a, 1 );
+  manager.SetFocusOrder( b, 2 );
+  manager.SetFocusOrder( c, 5 );
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( b ) );
+
+  // An empty list changes nothing
+  manager.SetFocusOrders( std::vector< std::pair< Actor, unsigned int > >() );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( b ), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == b );
+
+  std::vector< std::pair< Actor, unsigned int > > orders;
+  orders.push_back( std::make_pair( a, 1u ) );
+  orders.push_back( std::make_pair( d, 2u ) );
+  orders.push_back( std::make_pair( e, 2u ) );
+  orders.push_back( std::make_pair( b, 0u ) );
+  orders.push_back( std::make_pair( Actor(), 4u ) );
+  orders.push_back( std::make_pair( f, 5u ) );
+  orders.push_back( std::make_pair( a, 3u ) );
+  manager.SetFocusOrders( orders );
+
+  // The actors given the same focus order keep the order they are given in, and those given a focus order
+  // which is taken go before the actor that has it. The last focus order given to an actor is used.
+  DALI_TEST_EQUALS( manager.GetFocusOrder( d ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( e ), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( a ), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( f ), 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( c ), 7u, TEST_LOCATION );
+  DALI_TEST_CHECK( manager.GetActorByFocusOrder( 2 ) == d );
+  DALI_TEST_CHECK( manager.GetActorByFocusOrder( 3 ) == e );
+  DALI_TEST_CHECK( manager.GetActorByFocusOrder( 5 ) == a );
+  DALI_TEST_CHECK( manager.GetActorByFocusOrder( 6 ) == f );
+  DALI_TEST_CHECK( manager.GetActorByFocusOrder( 7 ) == c );
+  DALI_TEST_CHECK( !manager.GetActorByFocusOrder( 1 ) );
+  DALI_TEST_CHECK( !manager.GetActorByFocusOrder( 4 ) );
+  DALI_TEST_EQUALS( manager.GenerateNewFocusOrder(), 8u, TEST_LOCATION );
+
+  // The actor given the focus order 0 is removed from the focus chain and loses the focus
+  DALI_TEST_EQUALS( manager.GetFocusOrder( b ), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !manager.GetCurrentFocusActor() );
+  DALI_TEST_CHECK( !manager.SetCurrentFocusActor( b ) );
+
+  // A single actor is put in the focus chain as SetFocusOrder does
+  orders.clear();
+  orders.push_back( std::make_pair( b, 5u ) );
+  manager.SetFocusOrders( orders );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( b ), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( a ), 6u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( f ), 7u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( c ), 8u, TEST_LOCATION );
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( b ) );
+
+  END_TEST;
+}
+
 int UtcDaliAccessibilityManagerGenerateNewFocusOrder(void)
 {
   ToolkitTestApplication application;
@@ -2326,6 +2403,179 @@ int UtcDaliAccessibilityManagerHandlePanGesture(void)
   END_TEST;
 }
 
+int UtcDaliAccessibilityManagerFocusOrderBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAccessibilityManagerFocusOrderBenchmark: The focus chain of 5000 actors is traversed and reordered" );
+
+  const unsigned int actorCount = 5000u;
+  const unsigned int insertedCount = 100u;
+
+  AccessibilityManager manager = AccessibilityManager::Get();
+  DALI_TEST_CHECK( manager );
+
+  Dali::AccessibilityAdaptor accAdaptor = Dali::AccessibilityAdaptor::Get();
+  Test::AccessibilityAdaptor::SetEnabled( accAdaptor, true );
+  accAdaptor.HandleActionEnableEvent();
+
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    actors.push_back( Actor::New() );
+    application.GetScene().Add( actors.back() );
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    manager.SetFocusOrder( actors[ i ], i + 1u );
+  }
+  const long long setDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // Traverse the whole focus chain
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( actors[ 0 ] ) );
+  manager.SetWrapMode( false );
+  unsigned int inOrder = 1u;
+  begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 1u; i < actorCount; ++i )
+  {
+    manager.MoveFocusForward();
+    if( manager.GetCurrentFocusActor() == actors[ i ] )
+    {
+      ++inOrder;
+    }
+  }
+  const long long traverseDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+  DALI_TEST_EQUALS( inOrder, actorCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetCurrentFocusOrder(), actorCount, TEST_LOCATION );
+
+  // Insert actors at the front, each one moving the whole focus chain
+  std::vector< Actor > inserted;
+  begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    inserted.push_back( Actor::New() );
+    application.GetScene().Add( inserted.back() );
+    manager.SetFocusOrder( inserted.back(), 1u );
+  }
+  const long long reorderDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  unsigned int reordered = 0u;
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    if( manager.GetFocusOrder( inserted[ i ] ) == insertedCount - i &&
+        manager.GetActorByFocusOrder( insertedCount - i ) == inserted[ i ] )
+    {
+      ++reordered;
+    }
+  }
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    if( manager.GetFocusOrder( actors[ i ] ) == insertedCount + i + 1u &&
+        manager.GetActorByFocusOrder( insertedCount + i + 1u ) == actors[ i ] )
+    {
+      ++reordered;
+    }
+  }
+  DALI_TEST_EQUALS( reordered, actorCount + insertedCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GenerateNewFocusOrder(), actorCount + insertedCount + 1u, TEST_LOCATION );
+
+  // Moving an actor to the front shifts the focus chain by one slot, so the focus order it had is left unused
+  manager.SetFocusOrder( actors[ 0 ], 1u );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( actors[ 0 ] ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( inserted.back() ), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( inserted[ 0 ] ), insertedCount + 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( !manager.GetActorByFocusOrder( insertedCount + 1u ) );
+  DALI_TEST_EQUALS( manager.GetFocusOrder( actors[ 1 ] ), insertedCount + 3u, TEST_LOCATION );
+
+  tet_printf( "%u actors: %lld us to set the focus orders, %lld us to traverse, %lld us to insert %u actors at the front\n",
+              actorCount, setDuration, traverseDuration, reorderDuration, insertedCount );
+
+  END_TEST;
+}
+
+int UtcDaliAccessibilityManagerSetFocusOrdersBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAccessibilityManagerSetFocusOrdersBenchmark: The focus chain of 5000 actors is set and reordered in batches" );
+
+  const unsigned int actorCount = 5000u;
+  const unsigned int insertedCount = 100u;
+
+  AccessibilityManager manager = AccessibilityManager::Get();
+  DALI_TEST_CHECK( manager );
+
+  std::vector< Actor > actors;
+  std::vector< std::pair< Actor, unsigned int > > orders;
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    actors.push_back( Actor::New() );
+    application.GetScene().Add( actors.back() );
+    orders.push_back( std::make_pair( actors.back(), i + 1u ) );
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  manager.SetFocusOrders( orders );
+  const long long setDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // Insert actors at the front one by one, each one moving the whole focus chain
+  std::vector< Actor > inserted;
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    inserted.push_back( Actor::New() );
+    application.GetScene().Add( inserted.back() );
+  }
+  begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    manager.SetFocusOrder( inserted[ i ], 1u );
+  }
+  const long long reorderDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // Insert as many actors at the front in one batch
+  std::vector< Actor > batched;
+  orders.clear();
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    batched.push_back( Actor::New() );
+    application.GetScene().Add( batched.back() );
+    orders.push_back( std::make_pair( batched.back(), 1u ) );
+  }
+  begin = std::chrono::steady_clock::now();
+  manager.SetFocusOrders( orders );
+  const long long batchDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  unsigned int reordered = 0u;
+  for( unsigned int i = 0u; i < insertedCount; ++i )
+  {
+    if( manager.GetFocusOrder( batched[ i ] ) == i + 1u &&
+        manager.GetActorByFocusOrder( i + 1u ) == batched[ i ] )
+    {
+      ++reordered;
+    }
+    if( manager.GetFocusOrder( inserted[ i ] ) == 2u * insertedCount - i &&
+        manager.GetActorByFocusOrder( 2u * insertedCount - i ) == inserted[ i ] )
+    {
+      ++reordered;
+    }
+  }
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    if( manager.GetFocusOrder( actors[ i ] ) == 2u * insertedCount + i + 1u &&
+        manager.GetActorByFocusOrder( 2u * insertedCount + i + 1u ) == actors[ i ] )
+    {
+      ++reordered;
+    }
+  }
+  DALI_TEST_EQUALS( reordered, actorCount + 2u * insertedCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GenerateNewFocusOrder(), actorCount + 2u * insertedCount + 1u, TEST_LOCATION );
+
+  tet_printf( "%u actors: %lld us to set the focus orders in one batch, %lld us to insert %u actors at the front one by one, %lld us in one batch\n",
+              actorCount, setDuration, reorderDuration, insertedCount, batchDuration );
+
+  END_TEST;
+}
+
 // Methods missing coverage:
 // IsActorFocusableFunction
 // DoActivate
@@ -17,7 +17,9 @@
 #include <iostream>
 #include <stdlib.h>
 #include <chrono>
+#include <ctime>
 #include <thread>
+#include <vector>
 #include <dali-toolkit-test-suite-utils.h>
 #include <toolkit-timer.h>
 #include <toolkit-event-thread-callback.h>
@@ -1460,3 +1462,248 @@ int UtcDaliAnimatedVectorImageVisualWindowVisibilityChanged(void)
 
   END_TEST;
 }
+
+int UtcDaliAnimatedVectorImageVisualShareAnimation(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualShareAnimation: Play identical animations with one rasterization" );
+
+  // A list of rows playing the same spinner.
+  const unsigned int NUMBER_OF_ANIMATIONS = 10u;
+  Vector2 controlSize( 50.f, 50.f );
+
+  std::vector< DummyControl > sharedActors;
+  std::vector< DummyControl > actors;
+
+  for( unsigned int shared = 0u; shared < 2u; ++shared )
+  {
+    std::vector< DummyControl >& controls = shared ? sharedActors : actors;
+
+    clock_t start = clock();
+    for( unsigned int index = 0u; index < NUMBER_OF_ANIMATIONS; ++index )
+    {
+      Property::Map propertyMap;
+      propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+                 .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+                 .Add( DevelImageVisual::Property::SHARE_ANIMATION, shared == 1u );
+
+      Visual::Base visual = VisualFactory::Get().CreateVisual( propertyMap );
+      DALI_TEST_CHECK( visual );
+
+      DummyControl actor = DummyControl::New( true );
+      DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+      dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+      actor.SetProperty( Actor::Property::SIZE, controlSize );
+      actor.SetProperty( Actor::Property::POSITION, Vector2( 0.f, index * controlSize.height ) );
+      application.GetScene().Add( actor );
+
+      controls.push_back( actor );
+    }
+
+    application.SendNotification();
+    application.Render();
+
+    for( std::vector< DummyControl >::iterator iter = controls.begin(), endIter = controls.end(); iter != endIter; ++iter )
+    {
+      DevelControl::DoAction( *iter, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+    }
+
+    application.SendNotification();
+    application.Render();
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );    // let the rasterize threads play the animations
+
+    application.SendNotification();
+    application.Render();
+
+    const double time = static_cast< double >( clock() - start ) / CLOCKS_PER_SEC;
+    tet_printf( "%d %s animations played in %f seconds\n", NUMBER_OF_ANIMATIONS, shared ? "shared" : "separate", time );
+
+    for( std::vector< DummyControl >::iterator iter = controls.begin(), endIter = controls.end(); iter != endIter; ++iter )
+    {
+      DALI_TEST_EQUALS( iter->GetRendererCount(), 1u, TEST_LOCATION );
+    }
+  }
+
+  // The shared animations show the same textures, the others their own ones.
+  TextureSet sharedTextures = sharedActors[0u].GetRendererAt( 0u ).GetTextures();
+  for( unsigned int index = 1u; index < NUMBER_OF_ANIMATIONS; ++index )
+  {
+    DALI_TEST_CHECK( sharedActors[index].GetRendererAt( 0u ).GetTextures() == sharedTextures );
+    DALI_TEST_CHECK( actors[index].GetRendererAt( 0u ).GetTextures() != actors[0u].GetRendererAt( 0u ).GetTextures() );
+  }
+
+  Property::Map resultMap;
+  resultMap = sharedActors[0u].GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  Property::Value* value = resultMap.Find( DevelImageVisual::Property::SHARE_ANIMATION, Property::BOOLEAN );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_CHECK( value->Get< bool >() );
+
+  // A stopped visual shows its own textures again.
+  DevelControl::DoAction( sharedActors[0u], DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::STOP, Property::Map() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( sharedActors[0u].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( sharedActors[0u].GetRendererAt( 0u ).GetTextures() != sharedTextures );
+  DALI_TEST_CHECK( sharedActors[1u].GetRendererAt( 0u ).GetTextures() == sharedTextures );
+
+  // The others still share the animation when one is removed.
+  sharedActors[1u].Unparent();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( sharedActors[2u].GetRendererAt( 0u ).GetTextures() == sharedTextures );
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualFrameDropPolicy(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualFrameDropPolicy: Play many animations which drop their late frames" );
+
+  // More animations than rasterize threads, so the rasterizers are loaded unevenly.
+  const unsigned int NUMBER_OF_ANIMATIONS = 50u;
+  Vector2 controlSize( 20.f, 20.f );
+
+  std::vector< DummyControl > actors;
+
+  clock_t start = clock();
+  for( unsigned int index = 0u; index < NUMBER_OF_ANIMATIONS; ++index )
+  {
+    Property::Map propertyMap;
+    propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+               .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+               .Add( "frameDropPolicy", "DROP_LATE_FRAMES" );
+
+    Visual::Base visual = VisualFactory::Get().CreateVisual( propertyMap );
+    DALI_TEST_CHECK( visual );
+
+    DummyControl actor = DummyControl::New( true );
+    DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    actor.SetProperty( Actor::Property::SIZE, controlSize );
+    actor.SetProperty( Actor::Property::POSITION, Vector2( ( index % 10u ) * controlSize.width, ( index / 10u ) * controlSize.height ) );
+    application.GetScene().Add( actor );
+
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for( std::vector< DummyControl >::iterator iter = actors.begin(), endIter = actors.end(); iter != endIter; ++iter )
+  {
+    DevelControl::DoAction( *iter, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, Property::Map() );
+  }
+
+  for( unsigned int frame = 0u; frame < 10u; ++frame )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 30 ) );    // let the rasterize threads play the animations
+  }
+
+  const double time = static_cast< double >( clock() - start ) / CLOCKS_PER_SEC;
+  tet_printf( "%d animations played in %f seconds of processor time\n", NUMBER_OF_ANIMATIONS, time );
+
+  for( std::vector< DummyControl >::iterator iter = actors.begin(), endIter = actors.end(); iter != endIter; ++iter )
+  {
+    DALI_TEST_EQUALS( iter->GetRendererCount(), 1u, TEST_LOCATION );
+
+    Property::Map resultMap = iter->GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+    Property::Value* value = resultMap.Find( DevelImageVisual::Property::FRAME_DROP_POLICY );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::FrameDropPolicy::DROP_LATE_FRAMES ), TEST_LOCATION );
+
+    value = resultMap.Find( DevelImageVisual::Property::PLAY_STATE, Property::INTEGER );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::PlayState::PLAYING ), TEST_LOCATION );
+
+    value = resultMap.Find( DevelImageVisual::Property::FRAME_STATISTICS, Property::MAP );
+    DALI_TEST_CHECK( value );
+    DALI_TEST_CHECK( value->GetMap()->Find( "lateFrames", Property::INTEGER ) );
+    DALI_TEST_CHECK( value->GetMap()->Find( "droppedFrames", Property::INTEGER ) );
+  }
+
+  // The animations stop cleanly while the rasterizers take tasks from each other.
+  for( std::vector< DummyControl >::iterator iter = actors.begin(), endIter = actors.end(); iter != endIter; ++iter )
+  {
+    iter->Unparent();
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for( std::vector< DummyControl >::iterator iter = actors.begin(), endIter = actors.end(); iter != endIter; ++iter )
+  {
+    DALI_TEST_EQUALS( iter->GetRendererCount(), 0u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedVectorImageVisualFrameDropPolicyLateFrames(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliAnimatedVectorImageVisualFrameDropPolicyLateFrames: A stalled rasterizer skips the late frames and keeps the timeline" );
+
+  Property::Map propertyMap;
+  propertyMap.Add( Toolkit::Visual::Property::TYPE, DevelVisual::ANIMATED_VECTOR_IMAGE )
+             .Add( ImageVisual::Property::URL, TEST_VECTOR_IMAGE_FILE_NAME )
+             .Add( DevelImageVisual::Property::LOOP_COUNT, 1 )
+             .Add( DevelImageVisual::Property::FRAME_DROP_POLICY, DevelImageVisual::FrameDropPolicy::DROP_LATE_FRAMES );
+
+  Visual::Base visual = VisualFactory::Get().CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  DummyControl actor = DummyControl::New( true );
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+
+  Vector2 controlSize( 20.f, 30.f );
+  actor.SetProperty( Actor::Property::SIZE, controlSize );
+
+  application.GetScene().Add( actor );
+
+  // Each frame takes as long as 6 frames of the animation at 60 fps to rasterize
+  Test::VectorAnimationRenderer::SetRenderDelay( 100 );
+
+  Property::Map attributes;
+  DevelControl::DoAction( actor, DummyControl::Property::TEST_VISUAL, Dali::Toolkit::DevelAnimatedVectorImageVisual::Action::PLAY, attributes );
+
+  application.SendNotification();
+  application.Render();
+
+  // Trigger count is 2 - render, animation finished
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_LOCATION );
+
+  const uint32_t renderCount = Test::VectorAnimationRenderer::GetRenderCount();
+  Test::VectorAnimationRenderer::SetRenderDelay( 0 );
+
+  Property::Map map = actor.GetProperty< Property::Map >( DummyControl::Property::TEST_VISUAL );
+  Property::Value* value = map.Find( DevelImageVisual::Property::PLAY_STATE );
+  DALI_TEST_EQUALS( value->Get< int >(), static_cast< int >( DevelImageVisual::PlayState::STOPPED ), TEST_LOCATION );
+
+  // The animation reached its last frame, rasterizing fewer frames than it has
+  value = map.Find( DevelImageVisual::Property::CURRENT_FRAME_NUMBER );
+  DALI_TEST_EQUALS( value->Get< int >(), VECTOR_ANIMATION_TOTAL_FRAME_NUMBER - 1, TEST_LOCATION );
+  DALI_TEST_CHECK( renderCount < VECTOR_ANIMATION_TOTAL_FRAME_NUMBER );
+
+  value = map.Find( DevelImageVisual::Property::FRAME_STATISTICS, Property::MAP );
+  DALI_TEST_CHECK( value );
+
+  Property::Value* lateFrames = value->GetMap()->Find( "lateFrames", Property::INTEGER );
+  Property::Value* droppedFrames = value->GetMap()->Find( "droppedFrames", Property::INTEGER );
+  DALI_TEST_CHECK( lateFrames && droppedFrames );
+  DALI_TEST_CHECK( lateFrames->Get< int >() > 0 );
+  DALI_TEST_CHECK( droppedFrames->Get< int >() > 0 );
+
+  tet_printf( "%u frames rasterized, %d late, %d dropped\n", renderCount, lateFrames->Get< int >(), droppedFrames->Get< int >() );
+
+  END_TEST;
+}
@@ -16,6 +16,8 @@
  */
 
 #include <iostream>
+#include <chrono>
+#include <vector>
 #include <stdlib.h>
 
 // Need to override adaptor classes for toolkit test harness, so include
@@ -103,6 +105,13 @@ void ResourceReadySignal( Control control )
   gResourceReadySignalFired = true;
 }
 
+unsigned int gResourceReadySignalCount = 0u;
+
+void ResourceReadyCountSignal( Control control )
+{
+  ++gResourceReadySignalCount;
+}
+
 } // namespace
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1083,6 +1092,157 @@ int UtcDaliControlResourcesReady02(void)
   END_TEST;
 }
 
+int UtcDaliControlResourcesReadyBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Create 1000 controls with 16 visuals each, then replace all the visuals, and check the controls are ready" );
+
+  const unsigned int controlCount = 1000u;
+  const int visualCount = 16;
+
+  VisualFactory factory = VisualFactory::Get();
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Visual::COLOR );
+  propertyMap.Insert( ColorVisual::Property::MIX_COLOR, Color::RED );
+
+  gResourceReadySignalCount = 0u;
+
+  std::vector< DummyControl > controls;
+  auto begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0u; i < controlCount; ++i )
+  {
+    DummyControl control = DummyControl::New();
+    DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( control.GetImplementation() );
+    for( int index = 0; index < visualCount; ++index )
+    {
+      Visual::Base visual = factory.CreateVisual( propertyMap );
+      visual.SetName( "visual" );
+      dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL + index, visual );
+    }
+    control.ResourceReadySignal().Connect( &ResourceReadyCountSignal );
+    application.GetScene().Add( control );
+    controls.push_back( control );
+  }
+  const long long createDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // Each control is ready once, when its last visual is put on the scene
+  DALI_TEST_EQUALS( gResourceReadySignalCount, controlCount, TEST_LOCATION );
+
+  unsigned int readyCount = 0u;
+  for( auto&& control : controls )
+  {
+    readyCount += control.IsResourceReady() ? 1u : 0u;
+  }
+  DALI_TEST_EQUALS( readyCount, controlCount, TEST_LOCATION );
+
+  // Replace every visual, each replacement being ready at once
+  gResourceReadySignalCount = 0u;
+  std::vector< Visual::Base > lastVisuals;
+  begin = std::chrono::steady_clock::now();
+  for( auto&& control : controls )
+  {
+    DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( control.GetImplementation() );
+    for( int index = 0; index < visualCount; ++index )
+    {
+      Visual::Base visual = factory.CreateVisual( propertyMap );
+      visual.SetName( "visual" );
+      dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL + index, visual );
+      if( index == visualCount - 1 )
+      {
+        lastVisuals.push_back( visual );
+      }
+    }
+  }
+  const long long replaceDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+  DALI_TEST_EQUALS( gResourceReadySignalCount, controlCount * visualCount, TEST_LOCATION );
+
+  readyCount = 0u;
+  unsigned int replacedCount = 0u;
+  for( unsigned int i = 0u; i < controlCount; ++i )
+  {
+    DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( controls[ i ].GetImplementation() );
+    readyCount += controls[ i ].IsResourceReady() ? 1u : 0u;
+    replacedCount += ( dummyImpl.GetVisual( DummyControl::Property::TEST_VISUAL + visualCount - 1 ) == lastVisuals[ i ] ) ? 1u : 0u;
+  }
+  DALI_TEST_EQUALS( readyCount, controlCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( replacedCount, controlCount, TEST_LOCATION );
+
+  // A disabled visual does not count, the other visuals are still ready
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( controls[ 0 ].GetImplementation() );
+  dummyImpl.EnableVisual( DummyControl::Property::TEST_VISUAL, false );
+  DALI_TEST_EQUALS( dummyImpl.IsVisualEnabled( DummyControl::Property::TEST_VISUAL ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( controls[ 0 ].IsResourceReady(), true, TEST_LOCATION );
+  dummyImpl.UnregisterVisual( DummyControl::Property::TEST_VISUAL + 1 );
+  DALI_TEST_CHECK( !dummyImpl.GetVisual( DummyControl::Property::TEST_VISUAL + 1 ) );
+  DALI_TEST_EQUALS( controls[ 0 ].IsResourceReady(), true, TEST_LOCATION );
+
+  tet_printf( "%u controls with %d visuals: %lld us to create, %lld us to replace every visual\n",
+              controlCount, visualCount, createDuration, replaceDuration );
+
+  END_TEST;
+}
+
+int UtcDaliControlResourcesReadyAsyncImage(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Check a control with an image loaded asynchronously is ready once the image is loaded, and again after being put back on the scene" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Visual::IMAGE );
+  propertyMap.Insert( ImageVisual::Property::URL, TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( ImageVisual::Property::RELEASE_POLICY, ImageVisual::ReleasePolicy::DETACHED );
+
+  DummyControl control = DummyControl::New();
+  DummyControlImpl& dummyImpl = static_cast< DummyControlImpl& >( control.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, factory.CreateVisual( propertyMap ) );
+  control.SetProperty( Actor::Property::SIZE, Vector2( 200.0f, 200.0f ) );
+
+  gResourceReadySignalCount = 0u;
+  control.ResourceReadySignal().Connect( &ResourceReadyCountSignal );
+
+  application.GetScene().Add( control );
+  application.SendNotification();
+  application.Render();
+
+  // The image is being loaded
+  DALI_TEST_EQUALS( control.IsResourceReady(), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( gResourceReadySignalCount, 0u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( control.IsResourceReady(), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( gResourceReadySignalCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( control.GetRendererCount(), 1u, TEST_LOCATION );
+
+  // The image is released once the control is off the scene
+  application.GetScene().Remove( control );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( control.IsResourceReady(), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( control.GetRendererCount(), 0u, TEST_LOCATION );
+
+  // And loaded again once it's back on the scene
+  application.GetScene().Add( control );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( control.IsResourceReady(), false, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( control.IsResourceReady(), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( gResourceReadySignalCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( control.GetRendererCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliControlMarginProperty(void)
 {
   ToolkitTestApplication application;
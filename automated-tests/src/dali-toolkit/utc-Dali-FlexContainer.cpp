@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <chrono>
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
@@ -47,6 +48,19 @@ const char* const CHILD_PROPERTY_NAME_FLEX = "flex";
 const char* const CHILD_PROPERTY_NAME_ALIGN_SELF = "alignSelf";
 const char* const CHILD_PROPERTY_NAME_FLEX_MARGIN =  "flexMargin";
 
+long long GetMicroseconds( const std::chrono::steady_clock::time_point& begin )
+{
+  return static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+}
+
+FlexContainer CreateNestedContainer( const Vector2& size )
+{
+  FlexContainer container = FlexContainer::New();
+  container.SetProperty( FlexContainer::Property::FLEX_DIRECTION, FlexContainer::COLUMN );
+  container.SetProperty( Actor::Property::SIZE, size );
+  return container;
+}
+
 } // namespace
 
 int UtcDaliToolkitFlexContainerConstructorP(void)
@@ -595,3 +609,122 @@ int UtcDaliToolkitFlexContainerRTLSupportP(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexContainerNestedP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitFlexContainerNestedP");
+
+  FlexContainer flexContainer = FlexContainer::New();
+  flexContainer.SetProperty( FlexContainer::Property::FLEX_DIRECTION, FlexContainer::ROW );
+  flexContainer.SetProperty( Actor::Property::SIZE, Vector2( 400.0f, 400.0f ) );
+  application.GetScene().Add( flexContainer );
+
+  FlexContainer nested1 = CreateNestedContainer( Vector2( 100.0f, 100.0f ) );
+  FlexContainer nested2 = CreateNestedContainer( Vector2( 100.0f, 100.0f ) );
+  flexContainer.Add( nested1 );
+  flexContainer.Add( nested2 );
+
+  Actor leaf1 = Actor::New();
+  Actor leaf2 = Actor::New();
+  leaf1.SetProperty( Actor::Property::SIZE, Vector2( 20.0f, 20.0f ) );
+  leaf2.SetProperty( Actor::Property::SIZE, Vector2( 20.0f, 30.0f ) );
+  nested1.Add( leaf1 );
+  nested1.Add( leaf2 );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( nested1.GetProperty< Vector3 >( Actor::Property::POSITION ).x, 0.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( nested2.GetProperty< Vector3 >( Actor::Property::POSITION ).x, 100.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( leaf2.GetProperty< Vector3 >( Actor::Property::POSITION ).y, 20.0f, TEST_LOCATION );
+
+  // The nested container is laid out again when one of its children changes
+  leaf1.SetProperty( Actor::Property::SIZE, Vector2( 20.0f, 40.0f ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( leaf2.GetProperty< Vector3 >( Actor::Property::POSITION ).y, 40.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( nested2.GetProperty< Vector3 >( Actor::Property::POSITION ).x, 100.0f, TEST_LOCATION );
+
+  // A removed container lays out its children on its own
+  flexContainer.Remove( nested1 );
+  application.GetScene().Add( nested1 );
+  leaf1.SetProperty( Actor::Property::SIZE, Vector2( 20.0f, 50.0f ) );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( leaf2.GetProperty< Vector3 >( Actor::Property::POSITION ).y, 50.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitFlexContainerNestedBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitFlexContainerNestedBenchmark: One leaf of a deep hierarchy changes its size");
+
+  const unsigned int BRANCHES = 4u;
+  const unsigned int LEAVES = 7u;
+  const float LEAF_SIZE = 10.0f;
+
+  // 1 + 4 + 16 + 64 containers and 448 leaves over 5 levels
+  FlexContainer flexContainer = FlexContainer::New();
+  flexContainer.SetProperty( FlexContainer::Property::FLEX_DIRECTION, FlexContainer::ROW );
+  flexContainer.SetProperty( Actor::Property::SIZE, Vector2( 800.0f, 2000.0f ) );
+  application.GetScene().Add( flexContainer );
+
+  std::vector< Actor > leaves;
+  unsigned int nodeCount = 1u;
+  for( unsigned int i = 0; i < BRANCHES; ++i )
+  {
+    FlexContainer level1 = CreateNestedContainer( Vector2( 200.0f, 2000.0f ) );
+    flexContainer.Add( level1 );
+    for( unsigned int j = 0; j < BRANCHES; ++j )
+    {
+      FlexContainer level2 = CreateNestedContainer( Vector2( 200.0f, 500.0f ) );
+      level1.Add( level2 );
+      for( unsigned int k = 0; k < BRANCHES; ++k )
+      {
+        FlexContainer level3 = CreateNestedContainer( Vector2( 200.0f, 125.0f ) );
+        level2.Add( level3 );
+        for( unsigned int l = 0; l < LEAVES; ++l )
+        {
+          Actor leaf = Actor::New();
+          leaf.SetProperty( Actor::Property::SIZE, Vector2( LEAF_SIZE, LEAF_SIZE ) );
+          level3.Add( leaf );
+          leaves.push_back( leaf );
+        }
+        nodeCount += LEAVES + 1u;
+      }
+      ++nodeCount;
+    }
+    ++nodeCount;
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  application.SendNotification();
+  application.Render();
+  tet_printf( "%u nodes laid out in %lld us\n", nodeCount, GetMicroseconds( begin ) );
+
+  Actor changedLeaf = leaves[ 0 ];
+  Actor siblingLeaf = leaves[ 1 ];
+  Actor otherLeaf = leaves.back();
+  DALI_TEST_EQUALS( siblingLeaf.GetProperty< Vector3 >( Actor::Property::POSITION ).y, LEAF_SIZE, TEST_LOCATION );
+  const Vector3 otherPosition = otherLeaf.GetProperty< Vector3 >( Actor::Property::POSITION );
+  DALI_TEST_EQUALS( otherPosition.y, LEAF_SIZE * ( LEAVES - 1u ), TEST_LOCATION );
+
+  changedLeaf.SetProperty( Actor::Property::SIZE, Vector2( LEAF_SIZE, LEAF_SIZE * 2.0f ) );
+
+  begin = std::chrono::steady_clock::now();
+  application.SendNotification();
+  application.Render();
+  tet_printf( "%u nodes laid out again after one leaf changed in %lld us\n", nodeCount, GetMicroseconds( begin ) );
+
+  DALI_TEST_EQUALS( siblingLeaf.GetProperty< Vector3 >( Actor::Property::POSITION ).y, LEAF_SIZE * 2.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( otherLeaf.GetProperty< Vector3 >( Actor::Property::POSITION ), otherPosition, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -51,6 +51,19 @@ void MeasureChild( Actor child, float width, int measureModeWidth, float height,
   tet_printf(" MeasureChild test callback executed (%f,%f)\n", childSize->width, childSize->height );
 }
 
+const float TEXT_WIDTH = 100.0f;
+const float LINE_HEIGHT = 20.0f;
+unsigned int gMeasureTextCount = 0u;
+
+// Measures like a label whose text wraps into two lines when it's narrower than its natural width
+void MeasureText( Actor child, float width, int measureModeWidth, float height, int measureModeHeight, Flex::SizeTuple *childSize)
+{
+  ++gMeasureTextCount;
+  const bool wrapped = ( measureModeWidth != 0 ) && ( width < TEXT_WIDTH );
+  const float lineCount = ( child.GetProperty< std::string >( Dali::Actor::Property::NAME ) == "threeLines" ) ? 3.0f : ( wrapped ? 2.0f : 1.0f );
+  *childSize = Flex::SizeTuple{ wrapped ? width : TEXT_WIDTH, LINE_HEIGHT * lineCount };
+}
+
 }
 
 int UtcDaliToolkitFlexNodeConstructorP(void)
@@ -807,3 +820,75 @@ int UtcDaliToolkitFlexNodeFlexBasisShrinkGrow(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitFlexNodeMeasureCacheP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliToolkitFlexNodeMeasureCacheP");
+  Flex::Node* flexNode = new Flex::Node();
+  DALI_TEST_CHECK( flexNode );
+
+  // A row of labels wrapped in a narrow container
+  flexNode->SetFlexDirection(Flex::FlexDirection::ROW);
+  flexNode->SetFlexWrap(Flex::WrapType::WRAP);
+
+  const int LABEL_COUNT = 6;
+  std::vector< Actor > labels;
+  std::vector< Flex::Node* > labelNodes;
+  for( int i = 0; i < LABEL_COUNT; ++i )
+  {
+    labels.push_back( Actor::New() );
+    labelNodes.push_back( flexNode->AddChild( labels.back(), Extents(0,0,0,0), &MeasureText, i ) );
+  }
+
+  gMeasureTextCount = 0u;
+  flexNode->CalculateLayout(250, 800, false);
+
+  Flex::MeasureStatistics statistics = flexNode->GetMeasureStatistics();
+  tet_printf("First layout: %u measure requests, %u measure callbacks\n", statistics.requests, statistics.measures );
+  DALI_TEST_EQUALS( statistics.measures, gMeasureTextCount, TEST_LOCATION );
+  DALI_TEST_CHECK( statistics.requests >= statistics.measures );
+
+  Vector4 labelFrame = flexNode->GetNodeFrame(2);
+  DALI_TEST_EQUALS( labelFrame.y, LINE_HEIGHT, TEST_LOCATION );
+
+  // Moving a label doesn't measure it again
+  labels[0].SetProperty( Actor::Property::POSITION, Vector2( 10.0f, 10.0f ) );
+  gMeasureTextCount = 0u;
+  flexNode->CalculateLayout(250, 800, false);
+  statistics = flexNode->GetMeasureStatistics();
+  tet_printf("Unchanged layout: %u measure requests, %u measure callbacks\n", statistics.requests, statistics.measures );
+  DALI_TEST_EQUALS( gMeasureTextCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.measures, 0u, TEST_LOCATION );
+
+  // Yoga measures the labels again when the direction changes, with the same sizes, which are found in the cache
+  gMeasureTextCount = 0u;
+  flexNode->CalculateLayout(250, 800, true);
+  statistics = flexNode->GetMeasureStatistics();
+  tet_printf("Right to left layout: %u measure requests, %u measure callbacks\n", statistics.requests, statistics.measures );
+  DALI_TEST_CHECK( statistics.requests > 0u );
+  DALI_TEST_EQUALS( statistics.measures, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gMeasureTextCount, 0u, TEST_LOCATION );
+
+  // Changing the text of a label measures it again
+  labels[0].SetProperty( Dali::Actor::Property::NAME, "threeLines" );
+  gMeasureTextCount = 0u;
+  flexNode->CalculateLayout(250, 800, false);
+  statistics = flexNode->GetMeasureStatistics();
+  tet_printf("Changed layout: %u measure requests, %u measure callbacks\n", statistics.requests, statistics.measures );
+  DALI_TEST_CHECK( gMeasureTextCount > 0u );
+  DALI_TEST_EQUALS( statistics.measures, gMeasureTextCount, TEST_LOCATION );
+
+  labelFrame = flexNode->GetNodeFrame(0);
+  DALI_TEST_EQUALS( labelFrame.w - labelFrame.y, LINE_HEIGHT * 3.0f, TEST_LOCATION );
+  labelFrame = flexNode->GetNodeFrame(2);
+  DALI_TEST_EQUALS( labelFrame.y, LINE_HEIGHT * 3.0f, TEST_LOCATION );
+
+  // The size can be measured again explicitly
+  labelNodes[1]->InvalidateMeasure();
+  gMeasureTextCount = 0u;
+  flexNode->CalculateLayout(250, 800, false);
+  DALI_TEST_CHECK( gMeasureTextCount > 0u );
+
+  END_TEST;
+}
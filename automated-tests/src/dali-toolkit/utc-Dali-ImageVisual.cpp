@@ -51,6 +51,7 @@ const char* TEST_INVALID_FILE_NAME =  TEST_RESOURCE_DIR  "/invalid.jpg";
 const char* TEST_REMOTE_INVALID_FILE_NAME = "https://www.tizen.org/invalid.png";
 const char* TEST_MASK_IMAGE_FILE_NAME =  TEST_RESOURCE_DIR "/mask.png";
 const char* TEST_ROTATED_IMAGE =  TEST_RESOURCE_DIR  "/keyboard-Landscape.jpg";
+const char* TEST_OPAQUE_AND_TRANSPARENT_IMAGE = TEST_RESOURCE_DIR "/opaque-left-transparent-right.png";
 
 
 bool gResourceReadySignalFired = false;
@@ -2337,6 +2338,51 @@ int UtcDaliImageVisualCustomShader(void)
 }
 
 
+int UtcDaliImageVisualOpacityBlendsOpaqueRegions(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliImageVisualOpacityBlendsOpaqueRegions: The opaque regions of a half transparent image are blended" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Property::Map propertyMap;
+  propertyMap.Insert( Toolkit::Visual::Property::TYPE, Visual::IMAGE );
+  propertyMap.Insert( ImageVisual::Property::URL, TEST_OPAQUE_AND_TRANSPARENT_IMAGE );
+  propertyMap.Insert( Visual::Property::OPACITY, 0.5f );
+
+  Visual::Base visual = factory.CreateVisual( propertyMap );
+  DALI_TEST_CHECK( visual );
+
+  DummyControl actor = DummyControl::New( true );
+  Impl::DummyControl& dummyImpl = static_cast< Impl::DummyControl& >( actor.GetImplementation() );
+  dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+  actor.SetProperty( Actor::Property::SIZE, Vector2( 256.0f, 64.0f ) );
+  application.GetScene().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  // The opacity of the image regions is found when the image is loaded
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableEnableDisableCallTrace( true );
+  gl.EnableDrawCallTrace( true );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( gl.GetDrawTrace().CountMethod( "DrawElements" ) > 0 );
+
+  // Blending is never turned off, so the opaque regions are drawn half transparent too
+  std::ostringstream blendStr;
+  blendStr << GL_BLEND;
+  DALI_TEST_CHECK( gl.GetEnableDisableTrace().FindMethodAndParams( "Enable", blendStr.str().c_str() ) );
+  DALI_TEST_CHECK( !gl.GetEnableDisableTrace().FindMethodAndParams( "Disable", blendStr.str().c_str() ) );
+
+  END_TEST;
+}
+
 void ResourceReadyLoadNext( Control control )
 {
   static int callNumber = 0;
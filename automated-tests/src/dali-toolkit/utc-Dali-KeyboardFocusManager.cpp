@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <chrono>
 #include <stdlib.h>
 
 // Need to override adaptor classes for toolkit test harness, so include
@@ -1617,3 +1618,120 @@ int UtcDaliKeyboardFocusManagerFocusPerWindow(void)
 }
 
 
+
+int UtcDaliKeyboardFocusManagerFocusNavigationIndex(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline( "Ensure the focus moves to the closest focusable actor on the screen when the focus navigation index is enabled" );
+
+  KeyboardFocusManager manager = KeyboardFocusManager::Get();
+  DALI_TEST_CHECK( !DevelKeyboardFocusManager::IsFocusNavigationIndexEnabled( manager ) );
+
+  // A grid of focusable tiles
+  const int GRID_SIZE = 30;
+  const float TILE_SIZE = 20.0f;
+  std::vector< Control > tiles;
+  for( int row = 0; row < GRID_SIZE; ++row )
+  {
+    for( int column = 0; column < GRID_SIZE; ++column )
+    {
+      Control tile = Control::New();
+      tile.SetProperty( Actor::Property::KEYBOARD_FOCUSABLE, true );
+      tile.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+      tile.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+      tile.SetProperty( Actor::Property::SIZE, Vector2( TILE_SIZE, TILE_SIZE ) );
+      tile.SetProperty( Actor::Property::POSITION, Vector2( column * TILE_SIZE, row * TILE_SIZE ) );
+      application.GetScene().Add( tile );
+      tiles.push_back( tile );
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // The focus doesn't move without the index
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( tiles[ 0 ] ) );
+  DALI_TEST_CHECK( !manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == tiles[ 0 ] );
+
+  DevelKeyboardFocusManager::EnableFocusNavigationIndex( manager, true );
+  DALI_TEST_CHECK( DevelKeyboardFocusManager::IsFocusNavigationIndexEnabled( manager ) );
+
+  auto begin = std::chrono::steady_clock::now();
+  for( int column = 1; column < GRID_SIZE; ++column )
+  {
+    DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  }
+  for( int row = 1; row < GRID_SIZE; ++row )
+  {
+    DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::DOWN ) );
+  }
+  const long long duration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+  tet_printf( "%d focus movements in a %dx%d grid in %lld us\n", ( GRID_SIZE - 1 ) * 2, GRID_SIZE, GRID_SIZE, duration );
+
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == tiles.back() );
+
+  // There is nothing beyond the corner
+  DALI_TEST_CHECK( !manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::LEFT ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == tiles[ GRID_SIZE * GRID_SIZE - 2 ] );
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::UP ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == tiles[ GRID_SIZE * ( GRID_SIZE - 1 ) - 2 ] );
+
+  // Moved actors are found at their new position once the index is updated, hidden ones are skipped
+  tiles[ GRID_SIZE * ( GRID_SIZE - 1 ) - 3 ].SetProperty( Actor::Property::VISIBLE, false );
+  tiles[ 0 ].SetProperty( Actor::Property::POSITION, Vector2( ( GRID_SIZE - 3 ) * TILE_SIZE, ( GRID_SIZE - 2 ) * TILE_SIZE + TILE_SIZE * 0.5f ) );
+
+  // Two actors on the right of the grid, the upper one above the lower one
+  Control upperEdge = Control::New();
+  Control lowerEdge = Control::New();
+  Control edges[] = { upperEdge, lowerEdge };
+  for( auto&& edge : edges )
+  {
+    edge.SetProperty( Actor::Property::KEYBOARD_FOCUSABLE, true );
+    edge.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    edge.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+    edge.SetProperty( Actor::Property::SIZE, Vector2( TILE_SIZE, TILE_SIZE ) );
+    application.GetScene().Add( edge );
+  }
+  upperEdge.SetProperty( Actor::Property::POSITION, Vector2( GRID_SIZE * TILE_SIZE + 100.0f, 0.0f ) );
+  lowerEdge.SetProperty( Actor::Property::POSITION, Vector2( GRID_SIZE * TILE_SIZE + 100.0f, 20 * TILE_SIZE ) );
+
+  application.SendNotification();
+  application.Render();
+  DevelKeyboardFocusManager::UpdateFocusNavigationIndex( manager );
+
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::LEFT ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == tiles[ 0 ] );
+
+  const Control rowEnd = tiles[ 25 * GRID_SIZE + GRID_SIZE - 1 ];
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( rowEnd ) );
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == lowerEdge );
+
+  // A relaid out actor is moved in the index, without updating it explicitly
+  upperEdge.SetProperty( Actor::Property::SIZE, Vector2( TILE_SIZE, 51 * TILE_SIZE ) );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( rowEnd ) );
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == upperEdge );
+  DALI_TEST_CHECK( manager.SetCurrentFocusActor( tiles[ 0 ] ) );
+
+  // The closest actor is proposed to the application
+  bool preFocusChangeSignalVerified = false;
+  PreFocusChangeCallback preFocusChangeCallback( preFocusChangeSignalVerified );
+  manager.PreFocusChangeSignal().Connect( &preFocusChangeCallback, &PreFocusChangeCallback::Callback );
+  DALI_TEST_CHECK( manager.MoveFocus( Control::KeyboardFocus::RIGHT ) );
+  DALI_TEST_CHECK( preFocusChangeCallback.mSignalVerified );
+  DALI_TEST_CHECK( preFocusChangeCallback.mCurrentFocusedActor == tiles[ 0 ] );
+  DALI_TEST_CHECK( preFocusChangeCallback.mProposedActorToFocus );
+  DALI_TEST_CHECK( manager.GetCurrentFocusActor() == preFocusChangeCallback.mProposedActorToFocus );
+
+  DevelKeyboardFocusManager::EnableFocusNavigationIndex( manager, false );
+  DALI_TEST_CHECK( !DevelKeyboardFocusManager::IsFocusNavigationIndexEnabled( manager ) );
+
+  END_TEST;
+}
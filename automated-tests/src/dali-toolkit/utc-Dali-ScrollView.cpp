@@ -15,10 +15,13 @@
  *
  */
 
+#include <chrono>
 #include <iostream>
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/scroll-view-devel.h>
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/table-ruler.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -2699,6 +2702,196 @@ int UtcDaliToolkitScrollViewFixedRulerSnapP(void)
   END_TEST;
 }
 
+namespace
+{
+
+Dali::Vector< float > CreateSnapPoints( std::initializer_list< float > points )
+{
+  Dali::Vector< float > snapPoints;
+  for( auto&& point : points )
+  {
+    snapPoints.PushBack( point );
+  }
+  return snapPoints;
+}
+
+} // namespace
+
+int UtcDaliToolkitScrollViewTableRulerSnapP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewTableRulerSnapP");
+
+  TableRulerPtr tableRuler = new TableRuler( CreateSnapPoints( { 0.0f, 100.0f, 250.0f, 300.0f, 600.0f } ) );
+  DALI_TEST_EQUALS( tableRuler->GetType(), Ruler::FIXED, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( tableRuler->Snap(-50.0f, 0.0f), 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(100.0f, 0.0f), 100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(120.0f, 0.0f), 100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(299.0f, 0.0f), 250.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(700.0f, 0.0f), 600.0f, TEST_LOCATION);
+
+  DALI_TEST_EQUALS( tableRuler->Snap(-50.0f, 0.5f), 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(170.0f, 0.5f), 100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(180.0f, 0.5f), 250.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(280.0f, 0.5f), 300.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(700.0f, 0.5f), 600.0f, TEST_LOCATION);
+
+  DALI_TEST_EQUALS( tableRuler->Snap(-50.0f, 1.0f), 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(100.0f, 1.0f), 250.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(120.0f, 1.0f), 250.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(600.0f, 1.0f), 600.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewTableRulerPagesP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewTableRulerPagesP");
+
+  TableRulerPtr tableRuler = new TableRuler( CreateSnapPoints( { 0.0f, 100.0f, 250.0f, 300.0f, 600.0f } ) );
+  tableRuler->SetDomain( RulerDomain(0.0f, 600.0f, true) );
+
+  DALI_TEST_EQUALS( tableRuler->GetTotalPages(), 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPageFromPosition(270.0f, false), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPageFromPosition(650.0f, false), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPageFromPosition(650.0f, true), 1u, TEST_LOCATION);
+
+  unsigned int volume = 0;
+  DALI_TEST_EQUALS( tableRuler->GetPositionFromPage(3, volume, false), 300.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( volume, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPositionFromPage(7, volume, false), 600.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( volume, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPositionFromPage(7, volume, true), 250.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( volume, 1u, TEST_LOCATION);
+
+  tableRuler->Disable();
+  DALI_TEST_EQUALS( tableRuler->GetTotalPages(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPageFromPosition(270.0f, false), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetPositionFromPage(3, volume, true), 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( volume, 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewTableRulerAppendP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewTableRulerAppendP");
+
+  // Without snap points, the ruler is free.
+  TableRulerPtr tableRuler = new TableRuler();
+  DALI_TEST_EQUALS( tableRuler->Snap(42.0f, 0.5f), 42.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetTotalPages(), 1u, TEST_LOCATION);
+
+  DALI_TEST_CHECK( tableRuler->AppendSnapPoints( CreateSnapPoints( { 0.0f, 100.0f } ) ) );
+  DALI_TEST_EQUALS( tableRuler->Snap(42.0f, 0.5f), 0.0f, TEST_LOCATION);
+
+  // Out of order.
+  DALI_TEST_CHECK( !tableRuler->AppendSnapPoints( CreateSnapPoints( { 50.0f } ) ) );
+  DALI_TEST_CHECK( !tableRuler->AppendSnapPoints( CreateSnapPoints( { 300.0f, 200.0f } ) ) );
+  DALI_TEST_EQUALS( tableRuler->GetSnapPoints().Count(), 2u, TEST_LOCATION);
+
+  DALI_TEST_CHECK( tableRuler->AppendSnapPoints( CreateSnapPoints( { 100.0f, 200.0f } ) ) );
+  DALI_TEST_EQUALS( tableRuler->GetSnapPoints().Count(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->Snap(180.0f, 0.5f), 200.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetTotalPages(), 4u, TEST_LOCATION);
+
+  // Replaced snap points are sorted.
+  tableRuler->SetSnapPoints( CreateSnapPoints( { 300.0f, 0.0f, 100.0f } ) );
+  DALI_TEST_EQUALS( tableRuler->GetSnapPoints()[ 0 ], 0.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS( tableRuler->GetSnapPoints()[ 2 ], 300.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewTableRulerScrollP(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewTableRulerScrollP");
+
+  ScrollView scrollView = ScrollView::New();
+  application.GetScene().Add( scrollView );
+  scrollView.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize() );
+
+  TableRulerPtr rulerX = new TableRuler( CreateSnapPoints( { 0.0f, 100.0f, 250.0f, 300.0f, 600.0f } ) );
+  rulerX->SetDomain( RulerDomain(0.0f, 1000.0f, true) );
+  RulerPtr rulerY = new DefaultRuler();
+  rulerY->Disable();
+  scrollView.SetRulerX( rulerX );
+  scrollView.SetRulerY( rulerY );
+
+  scrollView.ScrollTo( 3, 0.0f );
+  Wait( application );
+  DALI_TEST_EQUALS( scrollView.GetCurrentScrollPosition().x, 300.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetCurrentPage(), 3u, TEST_LOCATION );
+
+  scrollView.ScrollTo( Vector2( 170.0f, 0.0f ), 0.0f );
+  Wait( application );
+  scrollView.ScrollToSnapPoint();
+  Wait( application, RENDER_DELAY_SCROLL );
+  DALI_TEST_EQUALS( scrollView.GetCurrentScrollPosition().x, 100.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewTableRulerBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewTableRulerBenchmark: Snapping among 100000 snap points");
+
+  const unsigned int SNAP_POINT_COUNT = 100000u;
+  const unsigned int QUERY_COUNT = 100000u;
+  const unsigned int CHECKED_QUERY_COUNT = 1000u;
+
+  // Rows of varying heights, appended in batches as an infinite feed would.
+  TableRulerPtr tableRuler = new TableRuler();
+  Dali::Vector< float > batch;
+  float position = 0.0f;
+  for( unsigned int i = 0u; i < SNAP_POINT_COUNT; ++i )
+  {
+    batch.PushBack( position );
+    position += 40.0f + static_cast< float >( ( i * 37u ) % 160u );
+    if( batch.Count() == 1000u )
+    {
+      DALI_TEST_CHECK( tableRuler->AppendSnapPoints( batch ) );
+      batch.Clear();
+    }
+  }
+  DALI_TEST_EQUALS( tableRuler->GetTotalPages(), SNAP_POINT_COUNT, TEST_LOCATION );
+
+  const Dali::Vector< float >& snapPoints = tableRuler->GetSnapPoints();
+  const float step = position / QUERY_COUNT;
+
+  float checksum = 0.0f;
+  const auto begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0u; i < QUERY_COUNT; ++i )
+  {
+    checksum += tableRuler->Snap( i * step, 0.5f );
+  }
+  const auto end = std::chrono::steady_clock::now();
+  tet_printf( "%u snaps among %u snap points in %lld us (checksum %f)\n", QUERY_COUNT, SNAP_POINT_COUNT,
+              static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( end - begin ).count() ), checksum );
+
+  // Compare with a search of all the snap points.
+  for( unsigned int i = 0u; i < CHECKED_QUERY_COUNT; ++i )
+  {
+    const float x = i * position / CHECKED_QUERY_COUNT + 0.25f;
+    float closest = snapPoints[ 0 ];
+    for( unsigned int j = 1u; j < snapPoints.Count(); ++j )
+    {
+      if( fabsf( snapPoints[ j ] - x ) < fabsf( closest - x ) )
+      {
+        closest = snapPoints[ j ];
+      }
+    }
+    DALI_TEST_EQUALS( tableRuler->Snap( x, 0.5f ), closest, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
 int UtcDaliToolkitScrollViewConstraintsMove(void)
 {
   ToolkitTestApplication application;
@@ -3098,3 +3291,239 @@ int UtcDaliToolkitScrollViewWheelEvent(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+/**
+ * Creates a scroll view filling the scene, whose children follow the scroll position.
+ */
+ScrollView CreateSpatialIndexScrollView( ToolkitTestApplication& application, float domainSize )
+{
+  ScrollView scrollView = ScrollView::New();
+  application.GetScene().Add( scrollView );
+  scrollView.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize() );
+  scrollView.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  scrollView.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+
+  RulerPtr rulerX = new DefaultRuler();
+  RulerPtr rulerY = new DefaultRuler();
+  rulerX->SetDomain( RulerDomain( 0.0f, domainSize, false ) );
+  rulerY->SetDomain( RulerDomain( 0.0f, domainSize, false ) );
+  scrollView.SetRulerX( rulerX );
+  scrollView.SetRulerY( rulerY );
+  return scrollView;
+}
+
+void ApplyMoveConstraint( ScrollView& scrollView )
+{
+  Constraint constraint = Constraint::New< Vector3 >( scrollView, Actor::Property::POSITION, MoveActorConstraint );
+  constraint.AddSource( Source( scrollView, ScrollView::Property::SCROLL_POSITION ) );
+  constraint.SetRemoveAction( Constraint::DISCARD );
+  scrollView.ApplyConstraintToChildren( constraint );
+}
+
+Actor AddSpatialIndexChild( ScrollView& scrollView, const Vector3& position, const Vector3& size )
+{
+  Actor child = Actor::New();
+  child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  child.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+  child.SetProperty( Actor::Property::POSITION, position );
+  child.SetProperty( Actor::Property::SIZE, size );
+  scrollView.Add( child );
+  return child;
+}
+
+} // namespace
+
+int UtcDaliToolkitScrollViewSpatialIndexProperties(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewSpatialIndexProperties");
+
+  ScrollView scrollView = ScrollView::New();
+  DALI_TEST_CHECK( scrollView.GetPropertyIndex( "spatialIndexEnabled" ) == DevelScrollView::Property::SPATIAL_INDEX_ENABLED );
+  DALI_TEST_CHECK( scrollView.GetPropertyIndex( "viewportCullingMargin" ) == DevelScrollView::Property::VIEWPORT_CULLING_MARGIN );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED ).Get< bool >(), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN ).Get< float >(), -1.0f, TEST_LOCATION );
+
+  scrollView.SetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED, true );
+  scrollView.SetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN, 100.0f );
+  DALI_TEST_EQUALS( scrollView.GetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED ).Get< bool >(), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN ).Get< float >(), 100.0f, TEST_LOCATION );
+
+  scrollView.SetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED, false );
+  DALI_TEST_EQUALS( scrollView.GetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED ).Get< bool >(), false, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewSpatialIndexActorAutoSnap(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewSpatialIndexActorAutoSnap: The index snaps to the same children as the search of all the children");
+
+  for( int spatialIndexEnabled = 0; spatialIndexEnabled < 2; ++spatialIndexEnabled )
+  {
+    ScrollView scrollView = CreateSpatialIndexScrollView( application, 1000.0f );
+    scrollView.SetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED, spatialIndexEnabled == 1 );
+    const Vector2 halfSize = application.GetScene().GetSize() * 0.5f;
+
+    const Vector3 aCenter( 400.0f, 600.0f, 0.0f );
+    AddSpatialIndexChild( scrollView, aCenter - Vector3( 10.0f, 10.0f, 0.0f ), Vector3( 20.0f, 20.0f, 0.0f ) );
+    const Vector3 bCenter( 1000.0f, 1200.0f, 0.0f );
+    AddSpatialIndexChild( scrollView, bCenter - Vector3( 10.0f, 10.0f, 0.0f ), Vector3( 20.0f, 20.0f, 0.0f ) );
+    ApplyMoveConstraint( scrollView );
+    scrollView.SetActorAutoSnap( true );
+
+    // b is the closest to the center of the view.
+    scrollView.ScrollTo( Vector2( 500.0f, 500.0f ), 0.0f );
+    Wait( application );
+    scrollView.ScrollToSnapPoint();
+    Wait( application, RENDER_DELAY_SCROLL );
+    DALI_TEST_EQUALS( scrollView.GetCurrentScrollPosition(), bCenter.GetVectorXY() - halfSize, TEST_LOCATION );
+
+    // a is the closest to the center of the view.
+    scrollView.ScrollTo( Vector2( 0.0f, 0.0f ), 0.0f );
+    Wait( application );
+    scrollView.ScrollToSnapPoint();
+    Wait( application, RENDER_DELAY_SCROLL );
+    DALI_TEST_EQUALS( scrollView.GetCurrentScrollPosition(), aCenter.GetVectorXY() - halfSize, TEST_LOCATION );
+
+    scrollView.Unparent();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewViewportCulling(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewViewportCulling: The children outside the view are hidden");
+
+  ScrollView scrollView = CreateSpatialIndexScrollView( application, 5000.0f );
+  const Vector3 childSize( 50.0f, 50.0f, 0.0f );
+  Actor top = AddSpatialIndexChild( scrollView, Vector3( 100.0f, 100.0f, 0.0f ), childSize );
+  Actor bottom = AddSpatialIndexChild( scrollView, Vector3( 100.0f, 2000.0f, 0.0f ), childSize );
+  Actor hidden = AddSpatialIndexChild( scrollView, Vector3( 100.0f, 150.0f, 0.0f ), childSize );
+  hidden.SetProperty( Actor::Property::VISIBLE, false );
+  ApplyMoveConstraint( scrollView );
+
+  // The culling needs the spatial index.
+  scrollView.SetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN, 0.0f );
+  Wait( application );
+  DALI_TEST_EQUALS( bottom.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  scrollView.SetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED, true );
+  Wait( application );
+  DALI_TEST_EQUALS( top.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( bottom.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( hidden.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // Scroll to the bottom child.
+  scrollView.ScrollTo( Vector2( 0.0f, 1500.0f ), 0.0f );
+  Wait( application, RENDER_FRAME_INTERVAL * 2 );
+  DALI_TEST_EQUALS( top.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( bottom.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( hidden.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // Move a child into the view, and add one outside.
+  top.SetProperty( Actor::Property::POSITION, Vector3( 100.0f, 1600.0f, 0.0f ) );
+  Actor added = AddSpatialIndexChild( scrollView, Vector3( 100.0f, 100.0f, 0.0f ), childSize );
+  Wait( application );
+  DALI_TEST_EQUALS( top.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( added.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // A removed child is shown again.
+  scrollView.Remove( added );
+  DALI_TEST_EQUALS( added.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  // Disabling the culling shows the culled children only.
+  scrollView.ScrollTo( Vector2( 0.0f, 0.0f ), 0.0f );
+  Wait( application, RENDER_FRAME_INTERVAL * 2 );
+  DALI_TEST_EQUALS( bottom.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  scrollView.SetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN, -1.0f );
+  DALI_TEST_EQUALS( top.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( bottom.GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( hidden.GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewSpatialIndexBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewSpatialIndexBenchmark: Snapping and culling among 10000 children");
+
+  const int CHILDREN_PER_ROW = 100;
+  const float CHILD_SPACING = 60.0f;
+  const Vector3 childSize( 50.0f, 50.0f, 0.0f );
+  const int SNAP_COUNT = 20;
+
+  ScrollView scrollView = CreateSpatialIndexScrollView( application, CHILDREN_PER_ROW * CHILD_SPACING );
+  for( int i = 0; i < CHILDREN_PER_ROW * CHILDREN_PER_ROW; ++i )
+  {
+    const Vector3 position( ( i % CHILDREN_PER_ROW ) * CHILD_SPACING, ( i / CHILDREN_PER_ROW ) * CHILD_SPACING, 0.0f );
+    AddSpatialIndexChild( scrollView, position, childSize );
+  }
+  ApplyMoveConstraint( scrollView );
+  scrollView.SetActorAutoSnap( true );
+
+  const Vector2 start( 1234.0f, 2345.0f );
+  Vector2 snapPositions[ 2 ];
+  for( int spatialIndexEnabled = 0; spatialIndexEnabled < 2; ++spatialIndexEnabled )
+  {
+    scrollView.SetProperty( DevelScrollView::Property::SPATIAL_INDEX_ENABLED, spatialIndexEnabled == 1 );
+    scrollView.ScrollTo( start, 0.0f );
+    Wait( application );
+
+    const auto begin = std::chrono::steady_clock::now();
+    for( int i = 0; i < SNAP_COUNT; ++i )
+    {
+      scrollView.ScrollToSnapPoint();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    tet_printf( "%s: %d snaps in %lld us\n", spatialIndexEnabled ? "Spatial index" : "All the children", SNAP_COUNT,
+                static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( end - begin ).count() ) );
+
+    Wait( application, RENDER_DELAY_SCROLL );
+    snapPositions[ spatialIndexEnabled ] = scrollView.GetCurrentScrollPosition();
+  }
+  DALI_TEST_EQUALS( snapPositions[ 0 ], snapPositions[ 1 ], TEST_LOCATION );
+
+  // Only the children around the view are left visible.
+  const float margin = 100.0f;
+  const auto begin = std::chrono::steady_clock::now();
+  scrollView.SetProperty( DevelScrollView::Property::VIEWPORT_CULLING_MARGIN, margin );
+  const auto end = std::chrono::steady_clock::now();
+  tet_printf( "Culling enabled in %lld us\n", static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( end - begin ).count() ) );
+
+  // The region is grown by half the margin, so the children are shown before the culling is updated.
+  const Vector2 scrollPosition = scrollView.GetCurrentScrollPosition();
+  const Vector2 viewSize = application.GetScene().GetSize();
+  const float grownMargin = margin * 1.5f;
+  unsigned int expectedVisibleCount = 0u;
+  unsigned int visibleCount = 0u;
+  for( unsigned int i = 0u; i < scrollView.GetChildCount(); ++i )
+  {
+    Actor child = scrollView.GetChildAt( i );
+    if( child.GetProperty< Vector3 >( Actor::Property::SIZE ) == childSize )
+    {
+      const Vector3 position = child.GetProperty< Vector3 >( Actor::Property::POSITION ) - Vector3( scrollPosition );
+      if( position.x <= viewSize.width + grownMargin && position.x + childSize.width >= -grownMargin &&
+          position.y <= viewSize.height + grownMargin && position.y + childSize.height >= -grownMargin )
+      {
+        ++expectedVisibleCount;
+      }
+      if( child.GetProperty< bool >( Actor::Property::VISIBLE ) )
+      {
+        ++visibleCount;
+      }
+    }
+  }
+  DALI_TEST_CHECK( expectedVisibleCount > 0u && expectedVisibleCount < 1000u );
+  DALI_TEST_EQUALS( visibleCount, expectedVisibleCount, TEST_LOCATION );
+
+  END_TEST;
+}
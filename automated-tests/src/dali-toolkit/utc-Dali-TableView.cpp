@@ -15,6 +15,7 @@
  *
  */
 
+#include <chrono>
 #include <iostream>
 #include <stdlib.h>
 #include <sstream>
@@ -89,6 +90,11 @@ static void SetupTableViewAndActors(Integration::Scene scene, TableView& tableVi
   tableView.AddChild( actor3, TableView::CellPosition( 1, 0 ) );
 }
 
+long long GetMicroseconds( const std::chrono::steady_clock::time_point& begin )
+{
+  return static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+}
+
 } // namespace
 
 int UtcDaliTableViewCtorCopyP(void)
@@ -1057,3 +1063,196 @@ int UtcDaliTableViewKeyboardFocusInNestedTableView(void)
 
   END_TEST;
 }
+
+int UtcDaliTableViewAddAfterRemove(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliTableViewAddAfterRemove: Add fills the cells freed by removed children" );
+
+  TableView tableView = TableView::New( 1, 4 );
+  std::vector< Actor > actors;
+  for( unsigned int i = 0; i < 8; ++i )
+  {
+    actors.push_back( Actor::New() );
+    tableView.Add( actors.back() );
+  }
+  DALI_TEST_EQUALS( tableView.GetRows(), 2u, TEST_LOCATION );
+
+  // Free a cell of the second row
+  actors[ 5 ].Unparent();
+  TableView::CellPosition position;
+  DALI_TEST_CHECK( !tableView.FindChildPosition( actors[ 5 ], position ) );
+  DALI_TEST_CHECK( !tableView.GetChildAt( TableView::CellPosition( 1, 1 ) ) );
+
+  Actor actor = Actor::New();
+  tableView.Add( actor );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actor, position ) );
+  DALI_TEST_EQUALS( position.rowIndex, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( position.columnIndex, 1u, TEST_LOCATION );
+
+  // Free a cell of the first row
+  DALI_TEST_CHECK( tableView.RemoveChildAt( TableView::CellPosition( 0, 2 ) ) == actors[ 2 ] );
+
+  actor = Actor::New();
+  tableView.Add( actor );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actor, position ) );
+  DALI_TEST_EQUALS( position.rowIndex, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( position.columnIndex, 2u, TEST_LOCATION );
+
+  // The table is full again
+  actor = Actor::New();
+  tableView.Add( actor );
+  DALI_TEST_CHECK( tableView.FindChildPosition( actor, position ) );
+  DALI_TEST_EQUALS( position.rowIndex, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( position.columnIndex, 0u, TEST_LOCATION );
+
+  // The children moved by an inserted column are still found
+  tableView.InsertColumn( 0 );
+  for( unsigned int i = 0; i < 8; ++i )
+  {
+    if( i != 2 && i != 5 )
+    {
+      DALI_TEST_CHECK( tableView.FindChildPosition( actors[ i ], position ) );
+      DALI_TEST_EQUALS( position.rowIndex, i / 4, TEST_LOCATION );
+      DALI_TEST_EQUALS( position.columnIndex, i % 4 + 1, TEST_LOCATION );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTableViewFitRowAfterChildRemoved(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliTableViewFitRowAfterChildRemoved: The rows after a changed row are moved" );
+
+  TableView tableView = TableView::New( 4, 1 );
+  application.GetScene().Add( tableView );
+  tableView.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+
+  Actor actor1 = Actor::New();
+  actor1.SetProperty( Actor::Property::SIZE, Vector2( 10.0f, 40.0f ) );
+  Actor actor2 = Actor::New();
+  actor2.SetProperty( Actor::Property::SIZE, CELL_SIZE );
+  tableView.AddChild( actor1, TableView::CellPosition( 0, 0 ) );
+  tableView.AddChild( actor2, TableView::CellPosition( 2, 0 ) );
+  tableView.SetFitHeight( 0 );
+
+  application.SendNotification();
+  application.Render();
+
+  // The fit row takes 40 pixels, the other rows share the rest
+  DALI_TEST_EQUALS( actor2.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, 60.0f, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  // The fit row is empty once its child is removed
+  actor1.Unparent();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor2.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, 200.0f / 3.0f, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  // A fixed row after the child shrinks the fill rows before it
+  tableView.SetFixedHeight( 3, 40.0f );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor2.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, 30.0f, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTableViewLargeTableBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliTableViewLargeTableBenchmark: Children of a large table are found and laid out" );
+
+  const unsigned int ROWS = 100u;
+  const unsigned int COLUMNS = 50u;
+  const unsigned int FIT_ROW = 50u;
+  const float HEIGHT = 2000.0f;
+
+  TableView tableView = TableView::New( ROWS, COLUMNS );
+  application.GetScene().Add( tableView );
+  tableView.SetProperty( Actor::Property::SIZE, Vector2( 1000.0f, HEIGHT ) );
+  tableView.SetFitHeight( FIT_ROW );
+
+  std::vector< Actor > actors;
+  auto begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0; i < ROWS * COLUMNS; ++i )
+  {
+    actors.push_back( Actor::New() );
+    actors.back().SetProperty( Actor::Property::SIZE, CELL_SIZE );
+    tableView.Add( actors.back() );
+  }
+  tet_printf( "%u children added in %lld us\n", ROWS * COLUMNS, GetMicroseconds( begin ) );
+  DALI_TEST_EQUALS( tableView.GetRows(), ROWS, TEST_LOCATION );
+
+  // Every child is found in its cell
+  begin = std::chrono::steady_clock::now();
+  unsigned int found = 0u;
+  TableView::CellPosition position;
+  for( unsigned int i = 0; i < ROWS * COLUMNS; ++i )
+  {
+    if( tableView.FindChildPosition( actors[ i ], position ) && ( position.rowIndex * COLUMNS + position.columnIndex == i ) )
+    {
+      ++found;
+    }
+  }
+  tet_printf( "%u children found in %lld us\n", ROWS * COLUMNS, GetMicroseconds( begin ) );
+  DALI_TEST_EQUALS( found, ROWS * COLUMNS, TEST_LOCATION );
+
+  // Compare with walking the cells, as the table used to
+  const unsigned int SAMPLE_COUNT = 100u;
+  begin = std::chrono::steady_clock::now();
+  found = 0u;
+  for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+  {
+    const unsigned int child = ( i * 7919u ) % ( ROWS * COLUMNS );
+    for( unsigned int cell = 0; cell < ROWS * COLUMNS; ++cell )
+    {
+      if( tableView.GetChildAt( TableView::CellPosition( cell / COLUMNS, cell % COLUMNS ) ) == actors[ child ] )
+      {
+        found += ( cell == child ) ? 1u : 0u;
+        break;
+      }
+    }
+  }
+  tet_printf( "%u children found by walking the cells in %lld us\n", SAMPLE_COUNT, GetMicroseconds( begin ) );
+  DALI_TEST_EQUALS( found, SAMPLE_COUNT, TEST_LOCATION );
+
+  begin = std::chrono::steady_clock::now();
+  application.SendNotification();
+  application.Render();
+  tet_printf( "First layout in %lld us\n", GetMicroseconds( begin ) );
+
+  const float fillHeight = ( HEIGHT - CELL_SIZE.height ) / ( ROWS - 1u );
+  Actor below = actors[ ( FIT_ROW + 1u ) * COLUMNS ];
+  DALI_TEST_EQUALS( below.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, FIT_ROW * fillHeight + CELL_SIZE.height, 0.01f, TEST_LOCATION );
+
+  // Replace a child of the fit row by a taller one
+  tableView.RemoveChildAt( TableView::CellPosition( FIT_ROW, 0 ) );
+  Actor tall = Actor::New();
+  tall.SetProperty( Actor::Property::SIZE, Vector2( 10.0f, 30.0f ) );
+  tableView.AddChild( tall, TableView::CellPosition( FIT_ROW, 0 ) );
+
+  begin = std::chrono::steady_clock::now();
+  application.SendNotification();
+  application.Render();
+  tet_printf( "Layout after a cell changed in %lld us\n", GetMicroseconds( begin ) );
+
+  const float newFillHeight = ( HEIGHT - 30.0f ) / ( ROWS - 1u );
+  DALI_TEST_EQUALS( below.GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, FIT_ROW * newFillHeight + 30.0f, 0.01f, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[ COLUMNS ].GetCurrentProperty< Vector3 >( Actor::Property::POSITION ).y, newFillHeight, 0.01f, TEST_LOCATION );
+
+  // Removing every child empties the table
+  begin = std::chrono::steady_clock::now();
+  for( unsigned int i = 0; i < ROWS * COLUMNS; ++i )
+  {
+    actors[ i ].Unparent();
+  }
+  tet_printf( "%u children removed in %lld us\n", ROWS * COLUMNS, GetMicroseconds( begin ) );
+  DALI_TEST_CHECK( !tableView.FindChildPosition( actors[ 0 ], position ) );
+  DALI_TEST_CHECK( tableView.FindChildPosition( tall, position ) );
+
+  END_TEST;
+}
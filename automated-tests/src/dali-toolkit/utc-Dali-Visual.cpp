@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <ctime>
 #include <iostream>
 #include <stdlib.h>
 #include <unistd.h>
+#include <vector>
 
 #include <toolkit-event-thread-callback.h>
 #include <dali-toolkit-test-suite-utils.h>
@@ -3272,6 +3274,118 @@ int UtcDaliVisualTextVisualDisableEnable(void)
   END_TEST;
 }
 
+namespace
+{
+
+/**
+ * @brief Adds to the scene a grid of controls with text visuals which repeat a few labels.
+ *
+ * @return The number of textures generated to render the labels.
+ */
+unsigned int RenderRepeatedLabels( ToolkitTestApplication& application, bool shareTexture, std::vector<DummyControl>& controls )
+{
+  const char* const LABELS[] = { "Settings", "Wi-Fi", "Bluetooth", "Display" };
+  const unsigned int NUMBER_OF_LABELS = sizeof( LABELS ) / sizeof( LABELS[0] );
+  const unsigned int NUMBER_OF_CONTROLS = 100u;
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  const unsigned int numberOfTextures = gl.GetNumGeneratedTextures();
+
+  VisualFactory factory = VisualFactory::Get();
+  for( unsigned int index = 0u; index < NUMBER_OF_CONTROLS; ++index )
+  {
+    Property::Map propertyMap;
+    propertyMap.Insert( Visual::Property::TYPE, Visual::TEXT );
+    propertyMap.Insert( TextVisual::Property::TEXT, LABELS[index % NUMBER_OF_LABELS] );
+    propertyMap.Insert( TextVisual::Property::POINT_SIZE, 12.f );
+    propertyMap.Insert( TextVisual::Property::TEXT_COLOR, Color::WHITE );
+    propertyMap.Insert( DevelTextVisual::Property::SHARE_TEXTURE, shareTexture );
+
+    DummyControl dummyControl = DummyControl::New( true );
+    Impl::DummyControl& dummyImpl = static_cast<Impl::DummyControl&>( dummyControl.GetImplementation() );
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, factory.CreateVisual( propertyMap ) );
+    dummyControl.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 50.f ) );
+    dummyControl.SetProperty( Actor::Property::POSITION, Vector2( 0.f, 50.f * static_cast<float>( index ) ) );
+
+    application.GetScene().Add( dummyControl );
+    controls.push_back( dummyControl );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  return gl.GetNumGeneratedTextures() - numberOfTextures;
+}
+
+} // namespace
+
+int UtcDaliVisualTextVisualShareTexture(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualTextVisualShareTexture Ensure text visuals with the same text share their texture" );
+
+  std::vector<DummyControl> controls;
+
+  clock_t start = clock();
+  const unsigned int numberOfTexturesNotShared = RenderRepeatedLabels( application, false, controls );
+  const double timeNotShared = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  for( std::vector<DummyControl>::iterator it = controls.begin(), endIt = controls.end(); it != endIt; ++it )
+  {
+    it->Unparent();
+  }
+  controls.clear();
+
+  start = clock();
+  const unsigned int numberOfTexturesShared = RenderRepeatedLabels( application, true, controls );
+  const double timeShared = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  tet_printf( "Not shared: %d textures in %f seconds. Shared: %d textures in %f seconds\n", numberOfTexturesNotShared, timeNotShared, numberOfTexturesShared, timeShared );
+
+  DALI_TEST_EQUALS( controls.size(), static_cast<size_t>( 100u ), TEST_LOCATION );
+  DALI_TEST_CHECK( numberOfTexturesShared < numberOfTexturesNotShared );
+  DALI_TEST_CHECK( numberOfTexturesShared <= 4u );
+
+  // All the controls render a texture.
+  for( std::vector<DummyControl>::iterator it = controls.begin(), endIt = controls.end(); it != endIt; ++it )
+  {
+    DALI_TEST_EQUALS( it->GetRendererCount(), 1u, TEST_LOCATION );
+  }
+
+  // Removing a control must not release the texture used by the others.
+  controls[0u].Unparent();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( controls[4u].GetRendererCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( controls[4u].GetRendererAt( 0u ).GetTextures() );
+
+  END_TEST;
+}
+
+int UtcDaliVisualTextVisualShareTexturePropertyMap(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualTextVisualShareTexturePropertyMap" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Property::Map propertyMap;
+  propertyMap.Insert( Visual::Property::TYPE, Visual::TEXT );
+  propertyMap.Insert( "text", "Hello world" );
+  propertyMap.Insert( "shareTexture", true );
+
+  Visual::Base textVisual = factory.CreateVisual( propertyMap );
+
+  Property::Map resultMap;
+  textVisual.CreatePropertyMap( resultMap );
+
+  Property::Value* value = resultMap.Find( DevelTextVisual::Property::SHARE_TEXTURE, Property::BOOLEAN );
+  DALI_TEST_CHECK( value );
+  DALI_TEST_CHECK( value->Get<bool>() );
+
+  END_TEST;
+}
+
 int UtcDaliVisualPremultipliedAlpha(void)
 {
   ToolkitTestApplication application;
@@ -14,8 +14,11 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <ctime>
 #include <iostream>
 #include <stdlib.h>
+#include <vector>
 #include <dali-toolkit-test-suite-utils.h>
 #include <toolkit-timer.h>
 #include <toolkit-event-thread-callback.h>
@@ -1236,6 +1239,176 @@ int UtcDaliVisualFactoryGetSvgVisualAtlas(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryGetSvgVisualShared(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualShared: Request svg visuals with the same url and size" );
+
+  VisualFactory factory = VisualFactory::Get();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  const unsigned int numberOfTextures = gl.GetNumGeneratedTextures();
+
+  // The same icon used by many controls.
+  const unsigned int NUMBER_OF_CONTROLS = 50u;
+  std::vector<DummyControl> controls;
+  std::vector<Visual::Base> visuals;
+
+  clock_t start = clock();
+  for( unsigned int index = 0u; index < NUMBER_OF_CONTROLS; ++index )
+  {
+    Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+    DALI_TEST_CHECK( visual );
+
+    DummyControl actor = DummyControl::New( true );
+    DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    actor.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+    application.GetScene().Add( actor );
+    visual.SetTransformAndSize( DefaultTransform(), Vector2( 200.f, 200.f ) );
+
+    controls.push_back( actor );
+    visuals.push_back( visual );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // Only one rasterization for all the visuals.
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  const double time = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  tet_printf( "%d svg visuals rasterized with %d textures in %f seconds\n", NUMBER_OF_CONTROLS, gl.GetNumGeneratedTextures() - numberOfTextures, time );
+
+  for( std::vector<DummyControl>::iterator it = controls.begin(), endIt = controls.end(); it != endIt; ++it )
+  {
+    DALI_TEST_EQUALS( it->GetRendererCount(), 1u, TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( gl.GetNumGeneratedTextures() - numberOfTextures, 1u, TEST_LOCATION );
+
+  // An icon with another size needs another rasterization.
+  visuals[0u].SetTransformAndSize( DefaultTransform(), Vector2( 100.f, 100.f ) );
+  application.SendNotification();
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gl.GetNumGeneratedTextures() - numberOfTextures, 2u, TEST_LOCATION );
+
+  // The rasterized image is kept in the cache when the controls are removed, so it's shown immediately when they are added back.
+  for( std::vector<DummyControl>::iterator it = controls.begin(), endIt = controls.end(); it != endIt; ++it )
+  {
+    it->Unparent();
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  controls[1u].SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( controls[1u] );
+  visuals[1u].SetTransformAndSize( DefaultTransform(), Vector2( 200.f, 200.f ) );
+
+  DALI_TEST_EQUALS( controls[1u].GetRendererCount(), 1u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gl.GetNumGeneratedTextures() - numberOfTextures, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryGetSvgVisualRasterizeSizes(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualRasterizeSizes: Rasterize svg icons at several sizes with the worker threads" );
+
+  VisualFactory factory = VisualFactory::Get();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  const unsigned int numberOfTextures = gl.GetNumGeneratedTextures();
+
+  // A settings screen: 80 icons, 10 at each size.
+  const float SIZES[] = { 24.f, 32.f, 48.f, 64.f, 96.f, 128.f, 192.f, 256.f };
+  const unsigned int NUMBER_OF_SIZES = sizeof( SIZES ) / sizeof( SIZES[0] );
+  const unsigned int NUMBER_OF_CONTROLS_PER_SIZE = 10u;
+
+  std::vector<DummyControl> controls;
+
+  clock_t start = clock();
+  for( unsigned int sizeIndex = 0u; sizeIndex < NUMBER_OF_SIZES; ++sizeIndex )
+  {
+    for( unsigned int index = 0u; index < NUMBER_OF_CONTROLS_PER_SIZE; ++index )
+    {
+      Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+      DALI_TEST_CHECK( visual );
+
+      DummyControl actor = DummyControl::New( true );
+      DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+      dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+      actor.SetProperty( Actor::Property::SIZE, Vector2( SIZES[sizeIndex], SIZES[sizeIndex] ) );
+      application.GetScene().Add( actor );
+      visual.SetTransformAndSize( DefaultTransform(), Vector2( SIZES[sizeIndex], SIZES[sizeIndex] ) );
+
+      controls.push_back( actor );
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // One rasterization per size.
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( NUMBER_OF_SIZES ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  const double time = static_cast<double>( clock() - start ) / CLOCKS_PER_SEC;
+
+  tet_printf( "%d svg visuals rasterized at %d sizes in %f seconds\n", NUMBER_OF_SIZES * NUMBER_OF_CONTROLS_PER_SIZE, NUMBER_OF_SIZES, time );
+
+  for( std::vector<DummyControl>::iterator it = controls.begin(), endIt = controls.end(); it != endIt; ++it )
+  {
+    DALI_TEST_EQUALS( it->GetRendererCount(), 1u, TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( gl.GetNumGeneratedTextures() - numberOfTextures, NUMBER_OF_SIZES, TEST_LOCATION );
+
+  // The icons removed before their rasterization is started are cancelled, the others are still rasterized.
+  std::vector<DummyControl> hiddenControls;
+  for( unsigned int sizeIndex = 0u; sizeIndex < NUMBER_OF_SIZES; ++sizeIndex )
+  {
+    Visual::Base visual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+
+    DummyControl actor = DummyControl::New( true );
+    DummyControlImpl& dummyImpl = static_cast<DummyControlImpl&>( actor.GetImplementation() );
+    dummyImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual );
+    actor.SetProperty( Actor::Property::SIZE, Vector2( SIZES[sizeIndex] + 1.f, SIZES[sizeIndex] + 1.f ) );
+    application.GetScene().Add( actor );
+    visual.SetTransformAndSize( DefaultTransform(), Vector2( SIZES[sizeIndex] + 1.f, SIZES[sizeIndex] + 1.f ) );
+
+    hiddenControls.push_back( actor );
+  }
+
+  for( std::vector<DummyControl>::iterator it = hiddenControls.begin() + 1u, endIt = hiddenControls.end(); it != endIt; ++it )
+  {
+    it->Unparent();
+  }
+
+  // The first icon is still on scene, so its rasterization is done. The others may have been started before they were cancelled.
+  for( unsigned int trigger = 0u; ( trigger < NUMBER_OF_SIZES ) && ( 0u == hiddenControls[0u].GetRendererCount() ); ++trigger )
+  {
+    DALI_TEST_CHECK( Test::WaitForEventThreadTrigger( 1 ) );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( hiddenControls[0u].GetRendererCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
 //Creates a mesh visual from the given propertyMap and tries to load it on stage in the given application.
 //This is expected to succeed, which will then pass the test.
 void MeshVisualLoadsCorrectlyTest( Property::Map& propertyMap, ToolkitTestApplication& application )
@@ -2175,3 +2348,137 @@ int UtcDaliVisualFactoryGetAnimatedImageVisual2(void)
 
   END_TEST;
 }
+
+int UtcDaliVisualFactoryVisualDescriptor(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryVisualDescriptor: The string keys of an image visual are replaced by index keys" );
+
+  Property::Map propertyMap;
+  propertyMap.Insert( "visualType", "IMAGE" );
+  propertyMap.Insert( "url", TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( "desiredWidth", 100 );
+  propertyMap.Insert( "customKey", 1.0f );
+
+  VisualDescriptor descriptor = VisualDescriptor::New( propertyMap );
+  DALI_TEST_CHECK( descriptor );
+  DALI_TEST_CHECK( descriptor.IsValid() );
+
+  BaseHandle handle = descriptor;
+  DALI_TEST_CHECK( VisualDescriptor::DownCast( handle ) );
+
+  const Property::Map& descriptorMap = descriptor.GetPropertyMap();
+  DALI_TEST_EQUALS( descriptorMap.Count(), 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( descriptorMap.Find( Visual::Property::TYPE ) );
+  DALI_TEST_EQUALS( descriptorMap.Find( Visual::Property::TYPE )->Get< int >(), static_cast< int >( Visual::IMAGE ), TEST_LOCATION );
+  DALI_TEST_CHECK( descriptorMap.Find( ImageVisual::Property::URL ) );
+  DALI_TEST_CHECK( descriptorMap.Find( ImageVisual::Property::DESIRED_WIDTH ) );
+  DALI_TEST_CHECK( descriptorMap.Find( "customKey" ) );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual = factory.CreateVisual( descriptor );
+  DALI_TEST_CHECK( visual );
+
+  // The keys of the other visuals are kept
+  Property::Map colorMap;
+  colorMap.Insert( "visualType", "COLOR" );
+  colorMap.Insert( "mixColor", Color::RED );
+  VisualDescriptor colorDescriptor = VisualDescriptor::New( colorMap );
+  DALI_TEST_CHECK( colorDescriptor.IsValid() );
+  DALI_TEST_CHECK( colorDescriptor.GetPropertyMap().Find( "mixColor" ) );
+  DALI_TEST_CHECK( factory.CreateVisual( colorDescriptor ) );
+
+  // An image without a url is not valid
+  Property::Map invalidMap;
+  invalidMap.Insert( Visual::Property::TYPE, Visual::IMAGE );
+  VisualDescriptor invalidDescriptor = VisualDescriptor::New( invalidMap );
+  DALI_TEST_CHECK( !invalidDescriptor.IsValid() );
+  DALI_TEST_CHECK( !factory.CreateVisual( invalidDescriptor ) );
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryVisualDescriptorBenchmark(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryVisualDescriptorBenchmark: Create image visuals from string keyed maps and from a descriptor" );
+
+  const int VISUAL_COUNT = 1000;
+
+  Property::Map propertyMap;
+  propertyMap.Insert( "visualType", "IMAGE" );
+  propertyMap.Insert( "url", TEST_IMAGE_FILE_NAME );
+  propertyMap.Insert( "desiredWidth", 100 );
+  propertyMap.Insert( "desiredHeight", 100 );
+  propertyMap.Insert( "fittingMode", "SCALE_TO_FILL" );
+  propertyMap.Insert( "pixelArea", Vector4( 0.0f, 0.0f, 1.0f, 1.0f ) );
+
+  VisualFactory factory = VisualFactory::Get();
+  std::vector< Visual::Base > visuals;
+  visuals.reserve( VISUAL_COUNT * 5 );
+
+  // The path without the cache of the factory: every map is checked and normalized
+  auto begin = std::chrono::steady_clock::now();
+  for( int i = 0; i < VISUAL_COUNT; ++i )
+  {
+    Property::Map map( propertyMap );
+    map[ "desiredWidth" ] = 100 + i;
+    map[ "url" ] = std::string( TEST_RESOURCE_DIR "/image-" ) + std::to_string( i ) + ".jpg";
+    visuals.push_back( factory.CreateVisual( VisualDescriptor::New( map ) ) );
+  }
+  const long long uncachedDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // The same maps through the cache, which never finds them
+  begin = std::chrono::steady_clock::now();
+  for( int i = 0; i < VISUAL_COUNT; ++i )
+  {
+    Property::Map map( propertyMap );
+    map[ "desiredWidth" ] = 100 + VISUAL_COUNT + i;
+    map[ "url" ] = std::string( TEST_RESOURCE_DIR "/image-" ) + std::to_string( i ) + ".jpg";
+    visuals.push_back( factory.CreateVisual( map ) );
+  }
+  const long long missDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // A different url every time, the rest of the map being found in the cache
+  begin = std::chrono::steady_clock::now();
+  for( int i = 0; i < VISUAL_COUNT; ++i )
+  {
+    Property::Map map( propertyMap );
+    map[ "url" ] = std::string( TEST_RESOURCE_DIR "/image-" ) + std::to_string( i ) + ".jpg";
+    visuals.push_back( factory.CreateVisual( map ) );
+  }
+  const long long urlDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  // The visual created from a cached map uses its own url
+  Property::Map resultMap;
+  visuals.back().CreatePropertyMap( resultMap );
+  Property::Value* urlValue = resultMap.Find( ImageVisual::Property::URL, Property::STRING );
+  DALI_TEST_CHECK( urlValue );
+  DALI_TEST_EQUALS( urlValue->Get< std::string >(), std::string( TEST_RESOURCE_DIR "/image-" ) + std::to_string( VISUAL_COUNT - 1 ) + ".jpg", TEST_LOCATION );
+
+  begin = std::chrono::steady_clock::now();
+  for( int i = 0; i < VISUAL_COUNT; ++i )
+  {
+    visuals.push_back( factory.CreateVisual( propertyMap ) );
+  }
+  const long long cachedDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  VisualDescriptor descriptor = VisualDescriptor::New( propertyMap );
+  begin = std::chrono::steady_clock::now();
+  for( int i = 0; i < VISUAL_COUNT; ++i )
+  {
+    visuals.push_back( factory.CreateVisual( descriptor ) );
+  }
+  const long long descriptorDuration = static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - begin ).count() );
+
+  tet_printf( "%d image visuals: %lld us uncached, %lld us from maps missing the cache, %lld us from maps with new urls, %lld us from the same map, %lld us from a descriptor\n",
+              VISUAL_COUNT, uncachedDuration, missDuration, urlDuration, cachedDuration, descriptorDuration );
+
+  DALI_TEST_EQUALS( static_cast< unsigned int >( visuals.size() ), static_cast< unsigned int >( VISUAL_COUNT * 5 ), TEST_LOCATION );
+  for( auto&& visual : visuals )
+  {
+    DALI_TEST_CHECK( visual );
+  }
+
+  END_TEST;
+}
@@ -85,6 +85,11 @@ void AccessibilityManager::SetFocusOrder(Actor actor, const unsigned int order)
   GetImpl(*this).SetFocusOrder(actor, order);
 }
 
+void AccessibilityManager::SetFocusOrders(const std::vector< std::pair< Actor, unsigned int > >& orders)
+{
+  GetImpl(*this).SetFocusOrders(orders);
+}
+
 unsigned int AccessibilityManager::GetFocusOrder(Actor actor) const
 {
   return GetImpl(*this).GetFocusOrder(actor);
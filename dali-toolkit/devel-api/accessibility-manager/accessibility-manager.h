@@ -19,7 +19,9 @@
  */
 
 // EXTERNAL INCLUDES
+#include <utility>
 #include <dali/public-api/actors/actor.h>
+#include <dali/public-api/common/vector-wrapper.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
@@ -177,6 +179,26 @@ public:
    */
   void SetFocusOrder(Actor actor, const unsigned int order);
 
+  /**
+   * @brief Sets the focus orders of several actors at once.
+   *
+   * The focus chain is sorted once for all the actors, which is faster
+   * than calling SetFocusOrder() for each of them. The actors are
+   * placed by the focus orders given and the focus orders the other
+   * actors of the focus chain have, an actor given a focus order that
+   * is already taken going before the actor that has it. Actors given
+   * the same focus order keep the order they are given in. The focus
+   * orders of the focus chain are then given to the actors in turn,
+   * the last ones getting new focus orders at the end of the focus
+   * chain, as SetFocusOrder() does. An actor given the focus order 0
+   * is removed from the focus chain and is not focusable. If an actor
+   * is given several times, the last focus order given is used.
+   *
+   * @param orders The actors and the focus orders to set
+   * @pre The AccessibilityManager has been initialized.
+   */
+  void SetFocusOrders(const std::vector< std::pair< Actor, unsigned int > >& orders);
+
   /**
    * @brief Gets the focus order of the actor.
    *
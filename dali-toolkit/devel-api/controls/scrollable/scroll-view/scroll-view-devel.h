@@ -0,0 +1,62 @@
+#ifndef DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+#define DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace DevelScrollView
+{
+
+namespace Property
+{
+
+enum Type
+{
+  /**
+   * @brief name "spatialIndexEnabled", type BOOLEAN
+   * @details Whether the bounds of the children are kept in a grid, so the closest child and the
+   * visible children are found without visiting every child. The children are expected to follow
+   * the scroll position, e.g. with the MoveActorConstraint. False by default.
+   */
+  SPATIAL_INDEX_ENABLED = Dali::Toolkit::ScrollView::Property::SCROLL_MODE + 1,
+
+  /**
+   * @brief name "viewportCullingMargin", type FLOAT
+   * @details When the spatial index is enabled, the children further than this margin outside the
+   * scroll view are made invisible while scrolling. Negative to disable, which is the default.
+   */
+  VIEWPORT_CULLING_MARGIN
+};
+
+} // namespace Property
+
+} // namespace DevelScrollView
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
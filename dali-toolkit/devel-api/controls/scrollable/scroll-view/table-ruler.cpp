@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/table-ruler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/math/math-utils.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+TableRuler::TableRuler( const Dali::Vector< float >& snapPoints )
+: mSnapPoints()
+{
+  mType = FIXED;
+  SetSnapPoints( snapPoints );
+}
+
+void TableRuler::SetSnapPoints( const Dali::Vector< float >& snapPoints )
+{
+  mSnapPoints = snapPoints;
+  if( !std::is_sorted( mSnapPoints.Begin(), mSnapPoints.End() ) )
+  {
+    std::sort( mSnapPoints.Begin(), mSnapPoints.End() );
+  }
+}
+
+bool TableRuler::AppendSnapPoints( const Dali::Vector< float >& snapPoints )
+{
+  if( snapPoints.Empty() )
+  {
+    return true;
+  }
+
+  if( !std::is_sorted( snapPoints.Begin(), snapPoints.End() ) ||
+      ( !mSnapPoints.Empty() && snapPoints[ 0 ] < mSnapPoints[ mSnapPoints.Count() - 1u ] ) )
+  {
+    DALI_LOG_ERROR( "Snap points appended out of order (%f).\n", double( snapPoints[ 0 ] ) );
+    return false;
+  }
+
+  const unsigned int count = mSnapPoints.Count();
+  mSnapPoints.Resize( count + snapPoints.Count() );
+  std::copy( snapPoints.Begin(), snapPoints.End(), mSnapPoints.Begin() + count );
+  return true;
+}
+
+const Dali::Vector< float >& TableRuler::GetSnapPoints() const
+{
+  return mSnapPoints;
+}
+
+float TableRuler::Snap( float x, float bias ) const
+{
+  if( mSnapPoints.Empty() )
+  {
+    return x;
+  }
+
+  return mSnapPoints[ FindSnapPoint( x, bias ) ];
+}
+
+float TableRuler::GetPositionFromPage( unsigned int page, unsigned int& volume, bool wrap ) const
+{
+  float position = mDomain.min;
+
+  volume = 0;
+
+  if( mEnabled && !mSnapPoints.Empty() )
+  {
+    const unsigned int pageCount = mSnapPoints.Count();
+    unsigned int column = page;
+
+    // In carry mode, a volume (carry) is produced when page exceeds the snap points
+    if( wrap )
+    {
+      column %= pageCount;
+      volume = page / pageCount;
+    }
+
+    position = mSnapPoints[ std::min( column, pageCount - 1u ) ];
+  }
+  else // Snap points are not present, carry page to volume.
+  {
+    if( wrap )
+    {
+      volume = page;
+    }
+  }
+
+  return position;
+}
+
+unsigned int TableRuler::GetPageFromPosition( float position, bool wrap ) const
+{
+  unsigned int page = 0;
+
+  if( mEnabled && !mSnapPoints.Empty() )
+  {
+    if( wrap )
+    {
+      position = WrapInDomain( position, mDomain.min, mDomain.max );
+    }
+    page = FindSnapPoint( position, 0.5f );
+  }
+
+  return page;
+}
+
+unsigned int TableRuler::GetTotalPages() const
+{
+  unsigned int pageCount = 1;
+
+  if( mEnabled && !mSnapPoints.Empty() )
+  {
+    pageCount = mSnapPoints.Count();
+  }
+
+  return pageCount;
+}
+
+unsigned int TableRuler::FindSnapPoint( float x, float bias ) const
+{
+  // The first snap point after x, so x lies between the previous one and this one.
+  const float* const begin = mSnapPoints.Begin();
+  const float* const end = mSnapPoints.End();
+  const float* next = std::upper_bound( begin, end, x );
+  if( next == begin )
+  {
+    return 0u;
+  }
+  if( next == end )
+  {
+    return mSnapPoints.Count() - 1u;
+  }
+
+  // As FixedRuler, floor( fraction + bias ) selects the previous or the next snap point.
+  const float* previous = next - 1;
+  const float fraction = ( x - *previous ) / ( *next - *previous );
+  return static_cast< unsigned int >( ( fraction + bias >= 1.0f ? next : previous ) - begin );
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
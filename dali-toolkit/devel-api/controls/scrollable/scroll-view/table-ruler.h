@@ -0,0 +1,120 @@
+#ifndef DALI_TOOLKIT_TABLE_RULER_H
+#define DALI_TOOLKIT_TABLE_RULER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+/**
+ * @brief Concrete implementation of Ruler that snaps to a table of positions, e.g. the boundaries of
+ * rows of different heights.
+ *
+ * Each snap point is a page. The snap points are kept sorted, so the snapping and page queries are
+ * binary searches. Snap points can be appended as the content grows, e.g. for an infinite feed; the
+ * domain of the ruler is left to the application.
+ *
+ * Without any snap point, the ruler doesn't snap and has one single page, like the DefaultRuler.
+ */
+class DALI_TOOLKIT_API TableRuler : public Ruler
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] snapPoints The positions to snap to.
+   */
+  TableRuler( const Dali::Vector< float >& snapPoints = Dali::Vector< float >() );
+
+  /**
+   * @brief Replaces the positions to snap to.
+   *
+   * @param[in] snapPoints The positions to snap to, which are sorted if they aren't already.
+   */
+  void SetSnapPoints( const Dali::Vector< float >& snapPoints );
+
+  /**
+   * @brief Adds positions to snap to after the existing ones.
+   *
+   * @param[in] snapPoints The positions to add, in increasing order and not before the last existing one.
+   * @return False, and nothing is added, if the positions aren't in order.
+   */
+  bool AppendSnapPoints( const Dali::Vector< float >& snapPoints );
+
+  /**
+   * @brief Retrieves the positions to snap to.
+   *
+   * @return The positions, in increasing order.
+   */
+  const Dali::Vector< float >& GetSnapPoints() const;
+
+  /**
+   * @copydoc Toolkit::Ruler::Snap
+   *
+   * @note The position is snapped between the snap points it lies between, using the bias as
+   * a fraction of the distance between them, and clamped to the first and last snap points.
+   */
+  float Snap( float x, float bias ) const override;
+
+  /**
+   * @copydoc Toolkit::Ruler::GetPositionFromPage
+   */
+  float GetPositionFromPage( unsigned int page, unsigned int& volume, bool wrap ) const override;
+
+  /**
+   * @copydoc Toolkit::Ruler::GetPageFromPosition
+   */
+  unsigned int GetPageFromPosition( float position, bool wrap ) const override;
+
+  /**
+   * @copydoc Toolkit::Ruler::GetTotalPages
+   */
+  unsigned int GetTotalPages() const override;
+
+private:
+
+  /**
+   * @brief Retrieves the index of the snap point a position snaps to.
+   *
+   * @param[in] x The position.
+   * @param[in] bias The biasing employed for snapping.
+   * @return The index of the snap point; there must be at least one.
+   */
+  unsigned int FindSnapPoint( float x, float bias ) const;
+
+private:
+  Dali::Vector< float > mSnapPoints; ///< The positions to snap to, in increasing order
+};
+
+typedef IntrusivePtr< TableRuler > TableRulerPtr; ///< Pointer to Dali::Toolkit::TableRuler object
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TABLE_RULER_H
@@ -40,6 +40,21 @@ bool IsFocusIndicatorEnabled(KeyboardFocusManager keyboardFocusManager)
   return GetImpl(keyboardFocusManager).IsFocusIndicatorEnabled();
 }
 
+void EnableFocusNavigationIndex(KeyboardFocusManager keyboardFocusManager, bool enable)
+{
+  GetImpl(keyboardFocusManager).EnableFocusNavigationIndex(enable);
+}
+
+bool IsFocusNavigationIndexEnabled(KeyboardFocusManager keyboardFocusManager)
+{
+  return GetImpl(keyboardFocusManager).IsFocusNavigationIndexEnabled();
+}
+
+void UpdateFocusNavigationIndex(KeyboardFocusManager keyboardFocusManager)
+{
+  GetImpl(keyboardFocusManager).UpdateFocusNavigationIndex();
+}
+
 } // namespace DevelKeyboardFocusManager
 
 } // namespace Toolkit
@@ -84,6 +84,38 @@ DALI_TOOLKIT_API void EnableFocusIndicator(KeyboardFocusManager keyboardFocusMan
  */
 DALI_TOOLKIT_API bool IsFocusIndicatorEnabled(KeyboardFocusManager keyboardFocusManager);
 
+/**
+ * @brief Decide whether to index the focusable actors on the screen to move the focus
+ *
+ * When the focus can't be moved by a layout control or the focusable properties, the closest focusable
+ * actor on the screen in the direction of the movement is proposed to the custom algorithm or the
+ * PreFocusChangeSignal, or focused if none is provided. The actors relaid out are moved in the index
+ * before the next movement, without indexing the others again. The whole index is built again,
+ * walking the actors of the window, after a scrollable containing indexed actors is scrolled, so
+ * it's best suited to the screens which are not scrolled between the movements of the focus.
+ *
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @param[in] enable Whether to index the focusable actors
+ */
+DALI_TOOLKIT_API void EnableFocusNavigationIndex(KeyboardFocusManager keyboardFocusManager, bool enable);
+
+/**
+ * @brief Check whether the focusable actors on the screen are indexed to move the focus
+ *
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ * @return True when the focus navigation index is enabled
+ */
+DALI_TOOLKIT_API bool IsFocusNavigationIndexEnabled(KeyboardFocusManager keyboardFocusManager);
+
+/**
+ * @brief Build the focus navigation index again before the next focus movement
+ *
+ * This is needed when focusable actors are added, removed or moved without being relaid out or scrolled.
+ *
+ * @param[in] keyboardFocusManager The instance of KeyboardFocusManager
+ */
+DALI_TOOLKIT_API void UpdateFocusNavigationIndex(KeyboardFocusManager keyboardFocusManager);
+
 } // namespace DevelKeyboardFocusManager
 
 } // namespace Toolkit
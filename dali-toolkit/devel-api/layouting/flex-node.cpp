@@ -18,9 +18,11 @@
 #include "flex-node.h"
 
 //EXTERNAL INCLUDES
+#include <dali/devel-api/object/handle-devel.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/object/weak-handle.h>
+#include <dali/public-api/signals/connection-tracker.h>
 
 //INTERNAL INCLUDES
 #include <dali-toolkit/third-party/yoga/Yoga.h>
@@ -37,6 +39,53 @@ namespace Flex
 {
 namespace
 {
+// The number of sizes cached per node, enough for the widths probed while wrapping a line
+const uint32_t MAXIMUM_CACHED_MEASURES = 8u;
+
+// Whether setting a property of an actor may change the size measured by its callback
+bool AffectsMeasure(Property::Index index)
+{
+  switch(index)
+  {
+    case Actor::Property::PARENT_ORIGIN:
+    case Actor::Property::PARENT_ORIGIN_X:
+    case Actor::Property::PARENT_ORIGIN_Y:
+    case Actor::Property::PARENT_ORIGIN_Z:
+    case Actor::Property::ANCHOR_POINT:
+    case Actor::Property::ANCHOR_POINT_X:
+    case Actor::Property::ANCHOR_POINT_Y:
+    case Actor::Property::ANCHOR_POINT_Z:
+    case Actor::Property::POSITION:
+    case Actor::Property::POSITION_X:
+    case Actor::Property::POSITION_Y:
+    case Actor::Property::POSITION_Z:
+    case Actor::Property::ORIENTATION:
+    case Actor::Property::SCALE:
+    case Actor::Property::SCALE_X:
+    case Actor::Property::SCALE_Y:
+    case Actor::Property::SCALE_Z:
+    case Actor::Property::VISIBLE:
+    case Actor::Property::COLOR:
+    case Actor::Property::COLOR_RED:
+    case Actor::Property::COLOR_GREEN:
+    case Actor::Property::COLOR_BLUE:
+    case Actor::Property::COLOR_ALPHA:
+    {
+      return false;
+    }
+    default:
+    {
+      return true;
+    }
+  }
+}
+
+// Whether two measure specifications are the same, the size is ignored when undefined
+bool IsSameSpecification(float size, int mode, float cachedSize, int cachedMode)
+{
+  return (mode == cachedMode) && ((mode == YGMeasureModeUndefined) || (size == cachedSize));
+}
+
 // Common callback function that is registered when AddChild is called.
 // Calls MeasureNode which in turns calls the actual callback passed in AddChild not the common callback.
 YGSize MeasureChild(YGNodeRef child, float width, YGMeasureMode measureModeWidth, float height, YGMeasureMode measureModeHeight)
@@ -66,12 +115,56 @@ using NodePtr = std::unique_ptr<Node>;
 
 using FlexNodeVector = std::vector<NodePtr>;
 
-struct Node::Impl
+struct Node::Impl : public ConnectionTracker
 {
-  YGNodeRef               mYogaNode;
-  MeasureCallback         mMeasureCallback;
-  WeakHandle<Dali::Actor> mActor;
-  FlexNodeVector          mChildNodes;
+  // A size measured by the callback
+  struct CachedMeasure
+  {
+    float     width;
+    int       widthMode;
+    float     height;
+    int       heightMode;
+    SizeTuple size;
+  };
+
+  // The text or style of the actor may have changed, so its size is measured again
+  void OnActorPropertySet(Handle& handle, Property::Index index, Property::Value value)
+  {
+    if(AffectsMeasure(index) && !mMeasureCache.empty())
+    {
+      mMeasureCache.clear();
+      YGNodeMarkDirty(mYogaNode);
+    }
+  }
+
+  // Clear the measure statistics of the descendants
+  void ResetStatistics()
+  {
+    mStatistics = MeasureStatistics{0u, 0u};
+    for(auto&& childNode : mChildNodes)
+    {
+      childNode->mImpl->ResetStatistics();
+    }
+  }
+
+  // Add the measure statistics of the descendants to this node
+  void GatherStatistics()
+  {
+    for(auto&& childNode : mChildNodes)
+    {
+      childNode->mImpl->GatherStatistics();
+      mStatistics.requests += childNode->mImpl->mStatistics.requests;
+      mStatistics.measures += childNode->mImpl->mStatistics.measures;
+    }
+  }
+
+  YGNodeRef                  mYogaNode;
+  MeasureCallback            mMeasureCallback;
+  WeakHandle<Dali::Actor>    mActor;
+  FlexNodeVector             mChildNodes;
+  std::vector<CachedMeasure> mMeasureCache;      ///< The sizes measured, up to MAXIMUM_CACHED_MEASURES
+  uint32_t                   mNextCachedMeasure; ///< The entry of the cache replaced when it is full
+  MeasureStatistics          mStatistics;        ///< The measurements made by the last layout calculation
 };
 
 Node::Node()
@@ -80,6 +173,8 @@ Node::Node()
   mImpl->mYogaNode = YGNodeNew();
   YGNodeSetContext(mImpl->mYogaNode, this);
   mImpl->mMeasureCallback = NULL;
+  mImpl->mNextCachedMeasure = 0u;
+  mImpl->mStatistics = MeasureStatistics{0u, 0u};
   DALI_LOG_INFO(gLogFilter, Debug::General, "Node()  Context [%p] set to mYogaNode[%p]\n", this, mImpl->mYogaNode);
 
   // Set default style
@@ -127,6 +222,7 @@ Node* Node::AddChild(Actor child, Extents margin, MeasureCallback measureFunctio
     YGNodeStyleSetMargin(childNode->mImpl->mYogaNode, YGEdgeBottom, margin.bottom);
 
     YGNodeSetMeasureFunc(childNode->mImpl->mYogaNode, &MeasureChild);
+    DevelHandle::PropertySetSignal(child).Connect(childNode->mImpl.get(), &Impl::OnActorPropertySet);
 
     YGNodeInsertChild(mImpl->mYogaNode, childNode->mImpl->mYogaNode, index);
 
@@ -158,12 +254,38 @@ SizeTuple Node::MeasureNode(float width, int widthMode, float height, int height
 {
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode\n");
 
+  ++mImpl->mStatistics.requests;
+
+  // Yoga probes the same widths several times while wrapping and aligning a line
+  for(auto&& cachedMeasure : mImpl->mMeasureCache)
+  {
+    if(IsSameSpecification(width, widthMode, cachedMeasure.width, cachedMeasure.widthMode) &&
+       IsSameSpecification(height, heightMode, cachedMeasure.height, cachedMeasure.heightMode))
+    {
+      DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode cached width:%f height:%f\n", cachedMeasure.size.width, cachedMeasure.size.height);
+      return cachedMeasure.size;
+    }
+  }
+
   // Execute callback registered with AddChild
   Toolkit::Flex::SizeTuple nodeSize{8, 8}; // Default size set to 8,8 to aid bug detection.
-  if(mImpl->mMeasureCallback && mImpl->mActor.GetHandle())
+  Actor actor = mImpl->mActor.GetHandle();
+  if(mImpl->mMeasureCallback && actor)
   {
-    DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode MeasureCallback executing on %s\n", mImpl->mActor.GetHandle().GetProperty< std::string >( Dali::Actor::Property::NAME ).c_str());
-    mImpl->mMeasureCallback(mImpl->mActor.GetHandle(), width, widthMode, height, heightMode, &nodeSize);
+    DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode MeasureCallback executing on %s\n", actor.GetProperty< std::string >( Dali::Actor::Property::NAME ).c_str());
+    mImpl->mMeasureCallback(actor, width, widthMode, height, heightMode, &nodeSize);
+    ++mImpl->mStatistics.measures;
+
+    Impl::CachedMeasure cachedMeasure{width, widthMode, height, heightMode, nodeSize};
+    if(mImpl->mMeasureCache.size() < MAXIMUM_CACHED_MEASURES)
+    {
+      mImpl->mMeasureCache.push_back(cachedMeasure);
+    }
+    else
+    {
+      mImpl->mMeasureCache[mImpl->mNextCachedMeasure] = cachedMeasure;
+      mImpl->mNextCachedMeasure = (mImpl->mNextCachedMeasure + 1u) % MAXIMUM_CACHED_MEASURES;
+    }
   }
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "MeasureNode nodeSize width:%f height:%f\n", nodeSize.width, nodeSize.height);
   return nodeSize;
@@ -172,7 +294,24 @@ SizeTuple Node::MeasureNode(float width, int widthMode, float height, int height
 void Node::CalculateLayout(float availableWidth, float availableHeight, bool isRTL)
 {
   DALI_LOG_INFO(gLogFilter, Debug::General, "CalculateLayout availableSize(%f,%f)\n", availableWidth, availableHeight);
+  mImpl->ResetStatistics();
   YGNodeCalculateLayout(mImpl->mYogaNode, availableWidth, availableHeight, isRTL ? YGDirectionRTL : YGDirectionLTR);
+  mImpl->GatherStatistics();
+  DALI_LOG_INFO(gLogFilter, Debug::General, "CalculateLayout measure requests:%u measures:%u\n", mImpl->mStatistics.requests, mImpl->mStatistics.measures);
+}
+
+void Node::InvalidateMeasure()
+{
+  mImpl->mMeasureCache.clear();
+  if(YGNodeGetMeasureFunc(mImpl->mYogaNode))
+  {
+    YGNodeMarkDirty(mImpl->mYogaNode);
+  }
+}
+
+MeasureStatistics Node::GetMeasureStatistics() const
+{
+  return mImpl->mStatistics;
 }
 
 Dali::Vector4 Node::GetNodeFrame(int index) const
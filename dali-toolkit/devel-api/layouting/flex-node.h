@@ -106,6 +106,15 @@ struct SizeTuple
   float height;
 };
 
+/**
+ * @brief The measurements made by the last layout calculation.
+ */
+struct MeasureStatistics
+{
+  uint32_t requests; ///< The number of sizes asked to the children
+  uint32_t measures; ///< The number of sizes which were not cached, so the measure callbacks were called
+};
+
 /**
  * @brief Callback signature for child Actor measure callback.
  * @note Actor, child Actor to measure
@@ -156,6 +165,8 @@ public:
 
   /**
    * @brief Return the dimensions of the node.
+   * The sizes measured are cached, so the measure callback is called once per distinct specification
+   * until a property of the actor is set.
    * @param[in] width width specification
    * @param[in] widthMode width specification mode
    * @param[in] height height specification
@@ -164,6 +175,18 @@ public:
    */
   SizeTuple MeasureNode(float width, int widthMode, float height, int heightMode);
 
+  /**
+   * @brief Discard the sizes measured, so the measure callback is called again by the next layout calculation.
+   * @note This is done when a property of the actor is set, it is only needed when the size depends on something else.
+   */
+  void InvalidateMeasure();
+
+  /**
+   * @brief Get the number of measurements made by the last layout calculation of this node.
+   * @return The measure statistics of the children and their descendants
+   */
+  MeasureStatistics GetMeasureStatistics() const;
+
   /**
    * @brief Perform the layout measure calculations.
    * @param[in] availableWidth Amount of space available for layout, width.
@@ -170,17 +170,16 @@ void ShapeTextPreprocess(const RendererParameters& textParameters, TextAbstracti
   // Process the markup string if the mark-up processor is enabled.
   ////////////////////////////////////////////////////////////////////////////////
 
-  MarkupProcessData markupProcessData(colorRuns,
-                                      fontDescriptionRuns,
-                                      textModel->mLogicalModel->mEmbeddedItems);
-
   if(textParameters.markupEnabled)
   {
-    ProcessMarkupString(textParameters.text, markupProcessData);
-    textSize = markupProcessData.markupProcessedText.size();
+    MarkupProcessData markupProcessData(colorRuns,
+                                        fontDescriptionRuns,
+                                        textModel->mLogicalModel->mEmbeddedItems,
+                                        utf32Characters);
 
-    // This is a bit horrible but std::string returns a (signed) char*
-    utf8 = reinterpret_cast<const uint8_t*>(markupProcessData.markupProcessedText.c_str());
+    // The mark-up processor writes the plain text encoded in utf32.
+    ProcessMarkupString(textParameters.text, markupProcessData);
+    numberOfCharacters = utf32Characters.Count();
   }
   else
   {
@@ -188,18 +187,18 @@ void ShapeTextPreprocess(const RendererParameters& textParameters, TextAbstracti
 
     // This is a bit horrible but std::string returns a (signed) char*
     utf8 = reinterpret_cast<const uint8_t*>(textParameters.text.c_str());
-  }
 
-  ////////////////////////////////////////////////////////////////////////////////
-  // Convert from utf8 to utf32
-  ////////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////////
+    // Convert from utf8 to utf32
+    ////////////////////////////////////////////////////////////////////////////////
 
-  utf32Characters.Resize(textSize);
+    utf32Characters.Resize(textSize);
 
-  // Transform a text array encoded in utf8 into an array encoded in utf32.
-  // It returns the actual number of characters.
-  numberOfCharacters = Utf8ToUtf32(utf8, textSize, utf32Characters.Begin());
-  utf32Characters.Resize(numberOfCharacters);
+    // Transform a text array encoded in utf8 into an array encoded in utf32.
+    // It returns the actual number of characters.
+    numberOfCharacters = Utf8ToUtf32(utf8, textSize, utf32Characters.Begin());
+    utf32Characters.Resize(numberOfCharacters);
+  }
 
   ////////////////////////////////////////////////////////////////////////////////
   // Retrieve the Line and Word Break Info.
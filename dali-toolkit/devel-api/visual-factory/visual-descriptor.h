@@ -0,0 +1,117 @@
+#ifndef DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal DALI_INTERNAL
+{
+class VisualDescriptor;
+}
+
+/**
+ * @brief A visual property map which is validated and normalized once, to create many visuals from it.
+ *
+ * The visual type and the URL are resolved when the descriptor is created, and the string keys known
+ * by the visual are replaced by their index keys. Creating a visual from the descriptor with
+ * VisualFactory::CreateVisual( const VisualDescriptor& ) then skips this work.
+ *
+ * The descriptor does not change once created.
+ */
+class DALI_TOOLKIT_API VisualDescriptor : public BaseHandle
+{
+public:
+  /**
+   * @brief Creates an uninitialized VisualDescriptor handle.
+   */
+  VisualDescriptor();
+
+  /**
+   * @brief Destructor
+   *
+   * This is non-virtual since derived Handle types must not contain data or virtual methods.
+   */
+  ~VisualDescriptor();
+
+  /**
+   * @brief Creates a VisualDescriptor object
+   *
+   * @param[in] propertyMap The map of the properties of the visual, as passed to VisualFactory::CreateVisual( const Property::Map& )
+   * @return A handle to the descriptor.
+   */
+  static VisualDescriptor New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Downcast to a VisualDescriptor handle
+   *
+   * If handle is not a VisualDescriptor, the returned handle is left uninitialized.
+   * @param[in] handle Handle to an object
+   * @return VisualDescriptor handle or an uninitialized handle.
+   */
+  static VisualDescriptor DownCast(BaseHandle handle);
+
+  /**
+   * @brief Copy constructor
+   *
+   * @param[in] handle Handle to an object
+   */
+  VisualDescriptor(const VisualDescriptor& handle);
+
+  /**
+   * @brief Assignment Operator
+   *
+   * @param[in] handle Handle to an object
+   * @return A reference to this object.
+   */
+  VisualDescriptor& operator=(const VisualDescriptor& handle);
+
+  /**
+   * @brief Whether a visual can be created from the descriptor.
+   *
+   * The visual type must be known, and the URL given if the visual type requires one.
+   *
+   * @return True if a visual can be created.
+   */
+  bool IsValid() const;
+
+  /**
+   * @brief Retrieves the normalized property map of the visual.
+   *
+   * @return The property map, with index keys in place of the string keys known by the visual.
+   */
+  const Property::Map& GetPropertyMap() const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL VisualDescriptor(Internal::VisualDescriptor* impl);
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
@@ -96,6 +96,11 @@ Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyMap)
   return GetImplementation(*this).CreateVisual(propertyMap);
 }
 
+Visual::Base VisualFactory::CreateVisual(const VisualDescriptor& descriptor)
+{
+  return GetImplementation(*this).CreateVisual(GetImplementation(descriptor));
+}
+
 Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions size)
 {
   return GetImplementation(*this).CreateVisual(url, size);
@@ -111,6 +116,21 @@ bool VisualFactory::GetPreMultiplyOnLoad() const
   return GetImplementation(*this).GetPreMultiplyOnLoad();
 }
 
+void VisualFactory::GetShaderVariantNames(std::vector<std::string>& names)
+{
+  GetImplementation(*this).GetShaderVariantNames(names);
+}
+
+uint32_t VisualFactory::WarmUpShaders(const std::vector<std::string>& names)
+{
+  return GetImplementation(*this).WarmUpShaders(names);
+}
+
+Property::Map VisualFactory::GetShaderMetrics() const
+{
+  return GetImplementation(*this).GetShaderMetrics();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
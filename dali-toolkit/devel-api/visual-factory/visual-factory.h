@@ -19,12 +19,15 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
+#include <vector>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/object/base-handle.h>
 #include <dali/public-api/object/property-map.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
 
 namespace Dali
 {
@@ -98,6 +101,17 @@ public:
    */
   Visual::Base CreateVisual(const Property::Map& propertyMap);
 
+  /**
+   * @brief Request the visual described by a descriptor.
+   *
+   * The property map of the descriptor was checked when the descriptor was created, so creating many
+   * visuals from the same descriptor skips the lookups of the property map version.
+   *
+   * @param[in] descriptor The descriptor of the visual.
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualDescriptor& descriptor);
+
   /**
    * @brief Request the visual to render the given resource at the url.
    *
@@ -126,6 +140,40 @@ public:
    */
   bool GetPreMultiplyOnLoad() const;
 
+  /**
+   * @brief Retrieve the names of the shader variants the toolkit may use, e.g. "ColorVisual" or "TextVisual".
+   *
+   * The variants of the visuals are always listed, the others once they were used.
+   *
+   * @param[out] names The names of the variants, once each.
+   */
+  void GetShaderVariantNames(std::vector<std::string>& names);
+
+  /**
+   * @brief Create the shaders of the given variants ahead of their first use.
+   *
+   * Their programs are compiled when the shaders are created instead of during the first frame
+   * drawing them, e.g. at startup or while the application is idle.
+   *
+   * @param[in] names The names of the variants to create, or all the variants if empty.
+   * @return The number of shaders created.
+   */
+  uint32_t WarmUpShaders(const std::vector<std::string>& names);
+
+  /**
+   * @brief Retrieve the metrics of the shaders created by the toolkit.
+   *
+   * The map holds the following integer values:
+   * - "variants": The number of shader variants currently recorded.
+   * - "requests": The number of shaders requested.
+   * - "creations": The number of shaders created, i.e. the requests not served by a shared shader.
+   * - "lastFrameCreations": The number of shaders created by the last frame which created any.
+   * - "maxFrameCreations": The largest number of shaders created by a frame.
+   *
+   * @return The metrics of the shaders.
+   */
+  Property::Map GetShaderMetrics() const;
+
 private:
   explicit DALI_INTERNAL VisualFactory(Internal::VisualFactory* impl);
 };
@@ -138,7 +138,36 @@ enum Type
    * And the array contains 2 integer values which are the frame numbers, the start frame number and the end frame number of the layer.
    * @note This property is read-only.
    */
-  CONTENT_INFO = ORIENTATION_CORRECTION + 10
+  CONTENT_INFO = ORIENTATION_CORRECTION + 10,
+
+  /**
+   * @brief Whether the AnimatedVectorImageVisual shares its rasterization with the identical animations.
+   *
+   * While playing, the visuals with this property set, the same url, the same size and the same play range,
+   * loop count, stop behavior and looping mode show one rasterization of the animation.
+   * A visual which starts playing while the others are playing joins them at their current frame.
+   *
+   * @details Name "shareAnimation", Type Property::BOOLEAN.
+   * @note Default false.
+   */
+  SHARE_ANIMATION = ORIENTATION_CORRECTION + 11,
+
+  /**
+   * @brief What the AnimatedVectorImageVisual does when its rasterization falls behind the frame rate of the animation.
+   * @details Name "frameDropPolicy", Type FrameDropPolicy::Type (Property::INTEGER)
+   * @note Default value is FrameDropPolicy::RENDER_ALL_FRAMES.
+   */
+  FRAME_DROP_POLICY = ORIENTATION_CORRECTION + 12,
+
+  /**
+   * @brief The statistics of the frames the AnimatedVectorImageVisual rasterized after their time.
+   * @details Name "frameStatistics", Type Property::MAP.
+   * The map contains the integer values "lateFrames", the number of frames rasterized after their time,
+   * and "droppedFrames", the number of frames skipped to catch up with the animation.
+   * Frames are only dropped with FrameDropPolicy::DROP_LATE_FRAMES.
+   * @note This property is read-only.
+   */
+  FRAME_STATISTICS = ORIENTATION_CORRECTION + 13
 };
 
 } //namespace Property
@@ -184,6 +213,19 @@ enum Type
 
 } // namespace LoopingMode
 
+/**
+ * @brief Enumeration for what to do when the rasterization of the animation is late.
+ */
+namespace FrameDropPolicy
+{
+enum Type
+{
+  RENDER_ALL_FRAMES, ///< Every frame is rendered. The animation slows down when the rasterization is late.
+  DROP_LATE_FRAMES   ///< The frames whose time has passed are skipped, so the animation keeps its duration.
+};
+
+} // namespace FrameDropPolicy
+
 } // namespace DevelImageVisual
 
 } // namespace Toolkit
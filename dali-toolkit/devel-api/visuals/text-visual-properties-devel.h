@@ -56,6 +56,15 @@ enum
    * @copydoc Dali::Toolkit::DevelTextLabel::Property::BACKGROUND
    */
   BACKGROUND = UNDERLINE + 2,
+
+  /**
+   * @brief Whether the texture of the text is shared with the other text visuals which render the same text.
+   * @details name "shareTexture", type Property::BOOLEAN.
+   * @note Optional. The default value is false.
+   * @note The texture is shared if the text, the style properties, the size and the layout direction are the same.
+   *       Useful for labels repeated many times, i.e. in lists.
+   */
+  SHARE_TEXTURE = UNDERLINE + 3,
 };
 
 } // namespace Property
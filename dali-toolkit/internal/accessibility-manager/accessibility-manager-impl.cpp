@@ -19,7 +19,9 @@
 #include "accessibility-manager-impl.h"
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring> // for strcmp
+#include <iterator>
 #include <dali/public-api/actors/layer.h>
 #include <dali/devel-api/adaptor-framework/accessibility-adaptor.h>
 #include <dali/devel-api/adaptor-framework/sound-player.h>
@@ -64,6 +66,22 @@ const char* FOCUS_BORDER_IMAGE_FILE_NAME = "B16-8_TTS_focus.9.png";
 const char* FOCUS_SOUND_FILE_NAME = "Focus.ogg";
 const char* FOCUS_CHAIN_END_SOUND_FILE_NAME = "End_of_List.ogg";
 
+/**
+ * The function to be used to search the focus chain, which is sorted by focus order.
+ */
+bool IsBeforeFocusOrder(const std::pair<unsigned int, unsigned int>& focusIDPair, unsigned int order)
+{
+  return focusIDPair.first < order;
+}
+
+/**
+ * The function to be used to sort the focus chain by focus order.
+ */
+bool IsBeforeFocusIDPair(const std::pair<unsigned int, unsigned int>& lhs, const std::pair<unsigned int, unsigned int>& rhs)
+{
+  return lhs.first < rhs.first;
+}
+
 /**
  * The function to be used in the hit-test algorithm to check whether the actor is hittable.
  */
@@ -141,24 +159,53 @@ void AccessibilityManager::Initialise()
   ChangeAccessibilityStatus();
 }
 
-AccessibilityManager::ActorAdditionalInfo AccessibilityManager::GetActorAdditionalInfo(const unsigned int actorID) const
+const AccessibilityManager::ActorAdditionalInfo& AccessibilityManager::GetActorAdditionalInfo(const unsigned int actorID) const
 {
-  ActorAdditionalInfo data;
+  static const ActorAdditionalInfo defaultInfo;
+
   IDAdditionalInfoConstIter iter = mIDAdditionalInfoContainer.find(actorID);
   if(iter != mIDAdditionalInfoContainer.end())
   {
-    data = (*iter).second;
+    return (*iter).second;
   }
 
-  return data;
+  return defaultInfo;
 }
 
 void AccessibilityManager::SynchronizeActorAdditionalInfo(const unsigned int actorID, const unsigned int order)
 {
-  ActorAdditionalInfo actorInfo = GetActorAdditionalInfo(actorID);
-  actorInfo.mFocusOrder = order;
-  mIDAdditionalInfoContainer.erase(actorID);
-  mIDAdditionalInfoContainer.insert(IDAdditionalInfoPair(actorID, actorInfo));
+  mIDAdditionalInfoContainer[actorID].mFocusOrder = order;
+}
+
+AccessibilityManager::FocusIDIter AccessibilityManager::FindFocusOrder(const unsigned int order)
+{
+  FocusIDIter focusIDIter = std::lower_bound(mFocusIDContainer.begin(), mFocusIDContainer.end(), order, IsBeforeFocusOrder);
+  if(focusIDIter != mFocusIDContainer.end() && (*focusIDIter).first != order)
+  {
+    focusIDIter = mFocusIDContainer.end();
+  }
+
+  return focusIDIter;
+}
+
+Actor AccessibilityManager::FindActor(Actor root, const unsigned int actorID) const
+{
+  // The actors in the focus chain are found by walking up from them rather than searching the whole tree
+  Actor actor = GetActorAdditionalInfo(actorID).mActor.GetHandle();
+  if(actor)
+  {
+    for(Actor ancestor = actor; ancestor; ancestor = ancestor.GetParent())
+    {
+      if(ancestor == root)
+      {
+        return actor;
+      }
+    }
+
+    return Actor();
+  }
+
+  return root.FindChildById(actorID);
 }
 
 void AccessibilityManager::SetAccessibilityAttribute(Actor actor, Toolkit::AccessibilityManager::AccessibilityAttribute type, const std::string& text)
@@ -167,11 +214,9 @@ void AccessibilityManager::SetAccessibilityAttribute(Actor actor, Toolkit::Acces
   {
     unsigned int actorID = actor.GetProperty< int >( Actor::Property::ID );
 
-    ActorAdditionalInfo info = GetActorAdditionalInfo(actorID);
+    ActorAdditionalInfo& info = mIDAdditionalInfoContainer[actorID];
+    info.mActor = actor;
     info.mAccessibilityAttributes[type] = text;
-
-    mIDAdditionalInfoContainer.erase(actorID);
-    mIDAdditionalInfoContainer.insert(IDAdditionalInfoPair(actorID, info));
   }
 }
 
@@ -181,8 +226,7 @@ std::string AccessibilityManager::GetAccessibilityAttribute(Actor actor, Toolkit
 
   if(actor)
   {
-    ActorAdditionalInfo data = GetActorAdditionalInfo(actor.GetProperty< int >( Actor::Property::ID ));
-    text = data.mAccessibilityAttributes[type];
+    text = GetActorAdditionalInfo(actor.GetProperty< int >( Actor::Property::ID )).mAccessibilityAttributes[type];
   }
 
   return text;
@@ -193,8 +237,14 @@ void AccessibilityManager::SetFocusOrder(Actor actor, const unsigned int order)
   // Do nothing if the focus order of the actor is not changed.
   if(actor && GetFocusOrder(actor) != order)
   {
+    const unsigned int actorID = actor.GetProperty< int >( Actor::Property::ID );
+
     // Firstly delete the actor from the focus chain if it's already there with a different focus order.
-    mFocusIDContainer.erase(GetFocusOrder(actor));
+    FocusIDIter previousIter = FindFocusOrder(GetFocusOrder(actor));
+    if(previousIter != mFocusIDContainer.end())
+    {
+      mFocusIDContainer.erase(previousIter);
+    }
 
     // Create/retrieve actor focusable property
     Property::Index propertyActorFocusable = actor.RegisterProperty( ACTOR_FOCUSABLE, true, Property::READ_WRITE );
@@ -212,42 +262,144 @@ void AccessibilityManager::SetFocusOrder(Actor actor, const unsigned int order)
     }
     else // Insert the actor to the focus chain
     {
+      // The actor is focusable
+      actor.SetProperty(propertyActorFocusable, true);
+
       // Check whether there is another actor in the focus chain with the same focus order already.
-      FocusIDIter focusIDIter = mFocusIDContainer.find(order);
-      if(focusIDIter != mFocusIDContainer.end())
+      FocusIDIter focusIDIter = std::lower_bound(mFocusIDContainer.begin(), mFocusIDContainer.end(), order, IsBeforeFocusOrder);
+      if(focusIDIter != mFocusIDContainer.end() && (*focusIDIter).first == order)
       {
-        // We need to increase the focus order of that actor and all the actors followed it
-        // in the focus chain.
-        FocusIDIter lastIter = mFocusIDContainer.end();
-        --lastIter;//We want forward iterator to the last element here
-        mFocusIDContainer.insert(FocusIDPair((*lastIter).first + 1, (*lastIter).second));
-
-        // Update the actor's focus order in its additional data
-        SynchronizeActorAdditionalInfo((*lastIter).second, (*lastIter).first + 1);
+        // We need to move that actor and all the actors followed it to the next focus order
+        // in the focus chain, the last one getting a new focus order. This is done in one pass.
+        const unsigned int index = focusIDIter - mFocusIDContainer.begin();
+        mFocusIDContainer.push_back(FocusIDPair(mFocusIDContainer.back().first + 1, 0));
 
-        for(FocusIDIter iter = lastIter; iter != focusIDIter; iter--)
+        for(unsigned int i = mFocusIDContainer.size() - 1; i > index; --i)
         {
-          FocusIDIter previousIter = iter;
-          --previousIter;//We want forward iterator to the previous element here
-          unsigned int actorID = (*previousIter).second;
-          (*iter).second = actorID;
+          mFocusIDContainer[i].second = mFocusIDContainer[i - 1].second;
 
           // Update the actor's focus order in its additional data
-          SynchronizeActorAdditionalInfo(actorID, (*iter).first);
+          SynchronizeActorAdditionalInfo(mFocusIDContainer[i].second, mFocusIDContainer[i].first);
         }
 
-        mFocusIDContainer.erase(order);
+        // Now we put the actor into the focus chain with the specified focus order
+        mFocusIDContainer[index].second = actorID;
+      }
+      else
+      {
+        // Now we insert the actor into the focus chain with the specified focus order
+        mFocusIDContainer.insert(focusIDIter, FocusIDPair(order, actorID));
       }
+    }
 
-      // The actor is focusable
-      actor.SetProperty(propertyActorFocusable, true);
+    // Update the actor's focus order in its additional data
+    ActorAdditionalInfo& info = mIDAdditionalInfoContainer[actorID];
+    info.mFocusOrder = order;
+    info.mActor = actor;
+  }
+}
 
-      // Now we insert the actor into the focus chain with the specified focus order
-      mFocusIDContainer.insert(FocusIDPair(order, actor.GetProperty< int >( Actor::Property::ID )));
+void AccessibilityManager::SetFocusOrders(const std::vector< std::pair< Actor, unsigned int > >& orders)
+{
+  // Only the last focus order given to an actor is used.
+  std::unordered_map<unsigned int, unsigned int> lastIndices;
+  for(unsigned int i = 0; i < orders.size(); ++i)
+  {
+    if(orders[i].first)
+    {
+      lastIndices[orders[i].first.GetProperty< int >( Actor::Property::ID )] = i;
     }
+  }
 
-    // Update the actor's focus order in its additional data
-    SynchronizeActorAdditionalInfo(actor.GetProperty< int >( Actor::Property::ID ), order);
+  if(lastIndices.empty())
+  {
+    return;
+  }
+
+  // Firstly delete the actors from the focus chain in one pass.
+  mFocusIDContainer.erase(std::remove_if(mFocusIDContainer.begin(), mFocusIDContainer.end(),
+                                         [&lastIndices](const FocusIDPair& focusIDPair)
+                                         {
+                                           return lastIndices.find(focusIDPair.second) != lastIndices.end();
+                                         }),
+                          mFocusIDContainer.end());
+
+  bool clearFocus = false;
+  FocusIDContainer insertedIDs;
+  insertedIDs.reserve(lastIndices.size());
+
+  for(unsigned int i = 0; i < orders.size(); ++i)
+  {
+    Actor actor = orders[i].first;
+    if(!actor)
+    {
+      continue;
+    }
+
+    const unsigned int actorID = actor.GetProperty< int >( Actor::Property::ID );
+    if(lastIndices[actorID] != i)
+    {
+      continue;
+    }
+
+    const unsigned int order = orders[i].second;
+
+    // Create/retrieve actor focusable property. The actor is not focusable without a defined focus order.
+    Property::Index propertyActorFocusable = actor.RegisterProperty( ACTOR_FOCUSABLE, true, Property::READ_WRITE );
+    actor.SetProperty(propertyActorFocusable, order != 0);
+
+    if(order == 0)
+    {
+      // If the actor is currently being focused, it should clear the focus
+      clearFocus = clearFocus || actor == GetCurrentFocusActor();
+    }
+    else
+    {
+      insertedIDs.push_back(FocusIDPair(order, actorID));
+    }
+
+    ActorAdditionalInfo& info = mIDAdditionalInfoContainer[actorID];
+    info.mFocusOrder = order;
+    info.mActor = actor;
+  }
+
+  // Sort the actors once, keeping the order they are given in for the same focus order, and put them
+  // before the actors of the focus chain which have the same focus order.
+  std::stable_sort(insertedIDs.begin(), insertedIDs.end(), IsBeforeFocusIDPair);
+
+  FocusIDContainer focusIDContainer;
+  focusIDContainer.reserve(mFocusIDContainer.size() + insertedIDs.size());
+  std::merge(insertedIDs.begin(), insertedIDs.end(), mFocusIDContainer.begin(), mFocusIDContainer.end(), std::back_inserter(focusIDContainer), IsBeforeFocusIDPair);
+
+  std::vector<unsigned int> focusOrders;
+  focusOrders.reserve(focusIDContainer.size());
+  for(const FocusIDPair& focusIDPair : focusIDContainer)
+  {
+    if(focusOrders.empty() || focusOrders.back() != focusIDPair.first)
+    {
+      focusOrders.push_back(focusIDPair.first);
+    }
+  }
+
+  // Give the focus orders to the actors in turn, the last ones getting new focus orders at the end of the focus chain.
+  unsigned int order = 0;
+  for(unsigned int i = 0; i < focusIDContainer.size(); ++i)
+  {
+    order = i < focusOrders.size() ? focusOrders[i] : order + 1;
+    if(focusIDContainer[i].first != order)
+    {
+      focusIDContainer[i].first = order;
+
+      // Update the actor's focus order in its additional data
+      SynchronizeActorAdditionalInfo(focusIDContainer[i].second, order);
+    }
+  }
+
+  mFocusIDContainer.swap(focusIDContainer);
+
+  if(clearFocus)
+  {
+    ClearFocus();
   }
 }
 
@@ -257,8 +409,7 @@ unsigned int AccessibilityManager::GetFocusOrder(Actor actor) const
 
   if(actor)
   {
-    ActorAdditionalInfo data = GetActorAdditionalInfo(actor.GetProperty< int >( Actor::Property::ID ));
-    focusOrder = data.mFocusOrder;
+    focusOrder = GetActorAdditionalInfo(actor.GetProperty< int >( Actor::Property::ID )).mFocusOrder;
   }
 
   return focusOrder;
@@ -267,11 +418,10 @@ unsigned int AccessibilityManager::GetFocusOrder(Actor actor) const
 unsigned int AccessibilityManager::GenerateNewFocusOrder() const
 {
   unsigned int order = 1;
-  FocusIDContainer::const_reverse_iterator iter = mFocusIDContainer.rbegin();
 
-  if(iter != mFocusIDContainer.rend())
+  if(!mFocusIDContainer.empty())
   {
-    order = (*iter).first + 1;
+    order = mFocusIDContainer.back().first + 1;
   }
 
   return order;
@@ -281,11 +431,11 @@ Actor AccessibilityManager::GetActorByFocusOrder(const unsigned int order)
 {
   Actor actor = Actor();
 
-  FocusIDIter focusIDIter = mFocusIDContainer.find(order);
+  FocusIDIter focusIDIter = FindFocusOrder(order);
   if(focusIDIter != mFocusIDContainer.end())
   {
     Actor rootActor = Stage::GetCurrent().GetRootLayer();
-    actor = rootActor.FindChildById(mFocusIDContainer[order]);
+    actor = FindActor(rootActor, (*focusIDIter).second);
   }
 
   return actor;
@@ -317,7 +467,7 @@ bool AccessibilityManager::DoSetCurrentFocusActor(const unsigned int actorID)
     focusGroup = rootActor;
   }
 
-  Actor actor = focusGroup.FindChildById(actorID);
+  Actor actor = FindActor(focusGroup, actorID);
 
   // Check whether the actor is in the stage
   if(actor)
@@ -375,16 +525,17 @@ bool AccessibilityManager::DoSetCurrentFocusActor(const unsigned int actorID)
         Dali::TtsPlayer player = Dali::TtsPlayer::Get(Dali::TtsPlayer::SCREEN_READER);
 
         // Combine attribute texts to one text
+        const ActorAdditionalInfo& info = GetActorAdditionalInfo(actorID);
         std::string informationText;
         for(int i = 0; i < Toolkit::AccessibilityManager::ACCESSIBILITY_ATTRIBUTE_NUM; i++)
         {
-          if(!GetActorAdditionalInfo(actorID).mAccessibilityAttributes[i].empty())
+          if(!info.mAccessibilityAttributes[i].empty())
           {
             if( i > 0 )
             {
               informationText += ", "; // for space time between each information
             }
-            informationText += GetActorAdditionalInfo(actorID).mAccessibilityAttributes[i];
+            informationText += info.mAccessibilityAttributes[i];
           }
         }
         player.Play(informationText);
@@ -401,7 +552,7 @@ bool AccessibilityManager::DoSetCurrentFocusActor(const unsigned int actorID)
 Actor AccessibilityManager::GetCurrentFocusActor()
 {
   Actor rootActor = Stage::GetCurrent().GetRootLayer();
-  return rootActor.FindChildById(mCurrentFocusActor.second);
+  return FindActor(rootActor, mCurrentFocusActor.second);
 }
 
 Actor AccessibilityManager::GetCurrentFocusGroup()
@@ -419,11 +570,11 @@ bool AccessibilityManager::MoveFocusForward()
   bool ret = false;
   mRecursiveFocusMoveCounter = 0;
 
-  FocusIDIter focusIDIter = mFocusIDContainer.find(mCurrentFocusActor.first);
+  FocusIDIter focusIDIter = FindFocusOrder(mCurrentFocusActor.first);
   if(focusIDIter != mFocusIDContainer.end())
   {
     DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] focus order : %d\n", __FUNCTION__, __LINE__, (*focusIDIter).first);
-    ret = DoMoveFocus(focusIDIter, true, mIsWrapped);
+    ret = DoMoveFocus(focusIDIter - mFocusIDContainer.begin(), true, mIsWrapped);
   }
   else
   {
@@ -431,7 +582,7 @@ bool AccessibilityManager::MoveFocusForward()
     if(!mFocusIDContainer.empty())
     {
       //if there is not focused actor, move 1st actor
-      focusIDIter = mFocusIDContainer.begin(); // TODO: I'm not sure it was sorted.
+      focusIDIter = mFocusIDContainer.begin();
       DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] focus order : %d\n", __FUNCTION__, __LINE__, (*focusIDIter).first);
       ret = DoSetCurrentFocusActor((*focusIDIter).second);
     }
@@ -447,11 +598,11 @@ bool AccessibilityManager::MoveFocusBackward()
   bool ret = false;
   mRecursiveFocusMoveCounter = 0;
 
-  FocusIDIter focusIDIter = mFocusIDContainer.find(mCurrentFocusActor.first);
+  FocusIDIter focusIDIter = FindFocusOrder(mCurrentFocusActor.first);
   if(focusIDIter != mFocusIDContainer.end())
   {
     DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] focus order : %d\n", __FUNCTION__, __LINE__, (*focusIDIter).first);
-    ret = DoMoveFocus(focusIDIter, false, mIsWrapped);
+    ret = DoMoveFocus(focusIDIter - mFocusIDContainer.begin(), false, mIsWrapped);
   }
   else
   {
@@ -620,13 +771,13 @@ Actor AccessibilityManager::GetFocusIndicatorActor()
   return mFocusIndicatorActor;
 }
 
-bool AccessibilityManager::DoMoveFocus(FocusIDIter focusIDIter, bool forward, bool wrapped)
+bool AccessibilityManager::DoMoveFocus(unsigned int index, bool forward, bool wrapped)
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] %d focusable actors\n", __FUNCTION__, __LINE__, mFocusIDContainer.size());
-  DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] focus order : %d\n", __FUNCTION__, __LINE__, (*focusIDIter).first);
+  DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] focus index : %d\n", __FUNCTION__, __LINE__, index);
 
-  if( (forward && ++focusIDIter == mFocusIDContainer.end())
-    || (!forward && focusIDIter-- == mFocusIDContainer.begin()) )
+  if( (forward && ++index >= mFocusIDContainer.size())
+    || (!forward && index-- == 0u) )
   {
     if(mIsEndcapFeedbackEnabled)
     {
@@ -655,12 +806,11 @@ bool AccessibilityManager::DoMoveFocus(FocusIDIter focusIDIter, bool forward, bo
     {
       if(forward)
       {
-        focusIDIter = mFocusIDContainer.begin();
+        index = 0u;
       }
       else
       {
-        focusIDIter = mFocusIDContainer.end();
-        --focusIDIter;//We want forward iterator to the last element here
+        index = mFocusIDContainer.size() - 1u; // The last element
       }
     }
     else
@@ -674,13 +824,13 @@ bool AccessibilityManager::DoMoveFocus(FocusIDIter focusIDIter, bool forward, bo
   }
 
   // Invalid focus.
-  if( focusIDIter == mFocusIDContainer.end() )
+  if( index >= mFocusIDContainer.size() )
   {
     return false;
   }
 
   // Note: This function performs the focus change.
-  if( !DoSetCurrentFocusActor( (*focusIDIter).second ) )
+  if( !DoSetCurrentFocusActor( mFocusIDContainer[index].second ) )
   {
     mRecursiveFocusMoveCounter++;
     if(mRecursiveFocusMoveCounter > mFocusIDContainer.size())
@@ -693,7 +843,7 @@ bool AccessibilityManager::DoMoveFocus(FocusIDIter focusIDIter, bool forward, bo
     }
     else
     {
-      return DoMoveFocus(focusIDIter, forward, wrapped);
+      return DoMoveFocus(index, forward, wrapped);
     }
   }
 
@@ -840,7 +990,7 @@ bool AccessibilityManager::AccessibilityActionRead(bool allowReadAgain)
     Dali::HitTestAlgorithm::Results results;
     Dali::HitTestAlgorithm::HitTest( Stage::GetCurrent(), adaptor.GetReadPosition(), results, IsActorFocusableFunction );
 
-    FocusIDIter focusIDIter = mFocusIDContainer.find(GetFocusOrder(results.actor));
+    FocusIDIter focusIDIter = FindFocusOrder(GetFocusOrder(results.actor));
     if(focusIDIter != mFocusIDContainer.end())
     {
       if( allowReadAgain || (results.actor != GetCurrentFocusActor()) )
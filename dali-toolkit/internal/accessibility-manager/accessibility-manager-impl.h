@@ -20,11 +20,13 @@
 
 // EXTERNAL INCLUDES
 #include <string>
-#include <dali/devel-api/common/map-wrapper.h>
+#include <unordered_map>
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/devel-api/adaptor-framework/accessibility-action-handler.h>
 #include <dali/devel-api/adaptor-framework/accessibility-gesture-handler.h>
 #include <dali/devel-api/adaptor-framework/accessibility-gesture-event.h>
 #include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/weak-handle.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/accessibility-manager/accessibility-manager.h>
@@ -60,18 +62,20 @@ public:
 
     unsigned int mFocusOrder; ///< The focus order of the actor. It is undefined by default.
 
+    WeakHandle< Actor > mActor; ///< The actor, to find it without searching the scene
+
     std::string mAccessibilityAttributes[Toolkit::AccessibilityManager::ACCESSIBILITY_ATTRIBUTE_NUM]; ///< The array of attribute texts
   };
 
-  typedef std::pair<unsigned int, unsigned int>        FocusIDPair;
-  typedef std::map<unsigned int, unsigned int>         FocusIDContainer;
-  typedef FocusIDContainer::iterator                   FocusIDIter;
-  typedef FocusIDContainer::const_iterator             FocusIDConstIter;
+  typedef std::pair<unsigned int, unsigned int>                 FocusIDPair;
+  typedef std::vector<FocusIDPair>                              FocusIDContainer; ///< Sorted by focus order
+  typedef FocusIDContainer::iterator                            FocusIDIter;
+  typedef FocusIDContainer::const_iterator                      FocusIDConstIter;
 
-  typedef std::pair<unsigned int, ActorAdditionalInfo> IDAdditionalInfoPair;
-  typedef std::map<unsigned int, ActorAdditionalInfo>  IDAdditionalInfoContainer;
-  typedef IDAdditionalInfoContainer::iterator          IDAdditionalInfoIter;
-  typedef IDAdditionalInfoContainer::const_iterator    IDAdditionalInfoConstIter;
+  typedef std::pair<unsigned int, ActorAdditionalInfo>          IDAdditionalInfoPair;
+  typedef std::unordered_map<unsigned int, ActorAdditionalInfo> IDAdditionalInfoContainer;
+  typedef IDAdditionalInfoContainer::iterator                   IDAdditionalInfoIter;
+  typedef IDAdditionalInfoContainer::const_iterator             IDAdditionalInfoConstIter;
 
   /**
    * Construct a new AccessibilityManager.
@@ -98,6 +102,11 @@ public:
    */
   void SetFocusOrder(Actor actor, const unsigned int order);
 
+  /**
+   * @copydoc Toolkit::AccessibilityManager::SetFocusOrders
+   */
+  void SetFocusOrders(const std::vector< std::pair< Actor, unsigned int > >& orders);
+
   /**
    * @copydoc Toolkit::AccessibilityManager::GetFocusOrder
    */
@@ -442,9 +451,24 @@ private:
   /**
    * Get the additional information (e.g. focus order and description) of the given actor.
    * @param actorID The ID of the actor to be queried
-   * @return The additional information of the actor
+   * @return The additional information of the actor, or the default information if there is none
+   */
+  const ActorAdditionalInfo& GetActorAdditionalInfo(const unsigned int actorID) const;
+
+  /**
+   * Find the given focus order in the focus chain.
+   * @param order The focus order
+   * @return The iterator pointing to the focus order, or the end of the focus chain if it is not found
+   */
+  FocusIDIter FindFocusOrder(const unsigned int order);
+
+  /**
+   * Find an actor within a tree, using the actor kept in its additional information if there is one.
+   * @param root The root of the tree
+   * @param actorID The ID of the actor
+   * @return The actor, or an empty handle if it is not in the tree
    */
-  ActorAdditionalInfo GetActorAdditionalInfo(const unsigned int actorID) const;
+  Actor FindActor(Actor root, const unsigned int actorID) const;
 
   /**
    * Synchronize the actor's additional information to reflect its latest focus order
@@ -463,12 +487,13 @@ private:
 
   /**
    * Move the focus to the next actor in the focus chain towards the specified direction.
-   * @param focusIDIter The iterator pointing to the current focused actor
+   * @param index The position of the current focused actor in the focus chain
    * @param forward Whether the focus movement is forward or not. The focus movement will be backward if this is false.
    * @param wrapped Whether the focus shoule be moved wrapped around or not
    * @return Whether the focus is successful or not
+   * @note The position is used rather than an iterator, as the focus chain may change when the focus change is notified.
    */
-  bool DoMoveFocus(FocusIDIter focusIDIter, bool forward, bool wrapped);
+  bool DoMoveFocus(unsigned int index, bool forward, bool wrapped);
 
   /**
    * Activate the actor. If the actor is control, call OnAccessibilityActivated virtual function.
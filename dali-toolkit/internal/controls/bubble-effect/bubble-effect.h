@@ -22,6 +22,9 @@
 #include <sstream>
 #include <dali/public-api/rendering/shader.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+
 namespace Dali
 {
 
@@ -118,7 +121,7 @@ inline Shader CreateBubbleShader( unsigned int numBubble )
   std::ostringstream vertexShaderStringStream;
   vertexShaderStringStream << "#define NUMBER_OF_BUBBLE "<< numBubble << "\n"
                            << VERTEX_SHADER;
-  Shader shader = Shader::New( vertexShaderStringStream.str(), FRAGMENT_SHADER );
+  Shader shader = ShaderRegistry::Get().GetGeneratedShader( "BubbleEffect", vertexShaderStringStream.str(), FRAGMENT_SHADER );
 
   return shader;
 }
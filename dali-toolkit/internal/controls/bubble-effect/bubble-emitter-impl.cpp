@@ -27,6 +27,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/controls/bubble-effect/bubble-effect.h>
 #include <dali-toolkit/internal/controls/bubble-effect/bubble-renderer.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace
 {
@@ -265,7 +266,7 @@ void BubbleEmitter::SetBackground( Texture bgTexture, const Vector3& hsvDelta )
 
   //Create renderer
   Dali::Geometry geometry = CreateTexturedQuad();
-  Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+  Shader shader = ShaderRegistry::Get().GetShader( "BubbleEmitter", VERTEX_SHADER, FRAGMENT_SHADER );
   Renderer renderer = Renderer::New( geometry, shader );
   TextureSet textureSet = TextureSet::New();
   textureSet.SetTexture(0u, bgTexture );
@@ -420,6 +421,11 @@ void BubbleEmitter::SetBubbleParameter( BubbleRenderer& bubbleRenderer, unsigned
   bubbleRenderer.SetPercentage( curUniform, 0.f);
 }
 
+void BubbleEmitter::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "BubbleEmitter", VERTEX_SHADER, FRAGMENT_SHADER );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -43,6 +43,7 @@ namespace Internal
 {
 
 class BubbleRenderer;
+class ShaderRegistry;
 
 /**
  * BubbleEmitter implementation class.
@@ -99,6 +100,13 @@ public:
    */
   void Restore();
 
+  /**
+   * @brief Records the shader variants of the background of the emitter, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 private:
 
   /**
@@ -26,6 +26,7 @@
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/object/type-registry-helper.h>
+#include <algorithm>
 #include <cstring>
 #include <limits>
 
@@ -150,19 +151,6 @@ Toolkit::Visual::Base GetVisualByName(
   return visualHandle;
 }
 
-/**
- * Move visual from source to destination container
- */
-void MoveVisual( RegisteredVisualContainer::Iterator sourceIter, RegisteredVisualContainer& source, RegisteredVisualContainer& destination )
-{
-   Toolkit::Visual::Base visual = (*sourceIter)->visual;
-   if( visual )
-   {
-     RegisteredVisual* rv = source.Release( sourceIter );
-     destination.PushBack( rv );
-   }
-}
-
 /**
  * Performs actions as requested using the action name.
  * @param[in] object The object on which to perform the action.
@@ -320,6 +308,9 @@ Control::Impl::Impl( Control& controlImpl )
   mRightFocusableActorId( -1 ),
   mUpFocusableActorId( -1 ),
   mDownFocusableActorId( -1 ),
+  mVisualIndices(),
+  mVisualImpls(),
+  mPendingVisualCount( 0u ),
   mStyleName(""),
   mBackgroundColor(Color::TRANSPARENT),
   mStartingPinchScale( NULL ),
@@ -416,56 +407,53 @@ void Control::Impl::RegisterVisual( Property::Index index, Toolkit::Visual::Base
   }
 
   // Visual replacement, existing visual should only be removed from stage when replacement ready.
-  if( !mVisuals.Empty() )
+  // Check if visual (index) is already registered, this is the current visual.
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if( registeredVisual )
   {
-    RegisteredVisualContainer::Iterator registeredVisualsiter;
-    // Check if visual (index) is already registered, this is the current visual.
-    if( FindVisual( index, mVisuals, registeredVisualsiter ) )
+    Toolkit::Visual::Base& currentRegisteredVisual = registeredVisual->visual;
+    if( currentRegisteredVisual )
     {
-      Toolkit::Visual::Base& currentRegisteredVisual = (*registeredVisualsiter)->visual;
-      if( currentRegisteredVisual )
-      {
-        // Store current visual depth index as may need to set the replacement visual to same depth
-        const int currentDepthIndex = (*registeredVisualsiter)->visual.GetDepthIndex();
+      // Store current visual depth index as may need to set the replacement visual to same depth
+      const int currentDepthIndex = currentRegisteredVisual.GetDepthIndex();
 
-        // No longer required to know if the replaced visual's resources are ready
-        StopObservingVisual( currentRegisteredVisual );
+      // No longer required to know if the replaced visual's resources are ready
+      StopObservingVisual( currentRegisteredVisual );
 
-        // If control staged and visual enabled then visuals will be swapped once ready
-        if(  self.GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) && enabled )
+      // If control staged and visual enabled then visuals will be swapped once ready
+      if(  self.GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) && enabled )
+      {
+        // Check if visual is currently in the process of being replaced ( is in removal container )
+        RegisteredVisualContainer::Iterator visualQueuedForRemoval;
+        if ( FindVisual( index, mRemoveVisuals, visualQueuedForRemoval ) )
         {
-          // Check if visual is currently in the process of being replaced ( is in removal container )
-          RegisteredVisualContainer::Iterator visualQueuedForRemoval;
-          if ( FindVisual( index, mRemoveVisuals, visualQueuedForRemoval ) )
-          {
-            // Visual with same index is already in removal container so current visual pending
-            // Only the the last requested visual will be displayed so remove current visual which is staged but not ready.
-            Toolkit::GetImplementation( currentRegisteredVisual ).SetOffScene( self );
-            mVisuals.Erase( registeredVisualsiter );
-          }
-          else
-          {
-            // current visual not already in removal container so add now.
-            DALI_LOG_INFO( gLogFilter, Debug::Verbose, "RegisterVisual Move current registered visual to removal Queue: %d \n", index );
-            MoveVisual( registeredVisualsiter, mVisuals, mRemoveVisuals );
-          }
+          // Visual with same index is already in removal container so current visual pending
+          // Only the the last requested visual will be displayed so remove current visual which is staged but not ready.
+          Toolkit::GetImplementation( currentRegisteredVisual ).SetOffScene( self );
+          RemoveRegisteredVisual( registeredVisual, NULL );
         }
         else
         {
-          // Control not staged or visual disabled so can just erase from registered visuals and new visual will be added later.
-          mVisuals.Erase( registeredVisualsiter );
-        }
-
-        // If we've not set the depth-index value and the new visual does not have a depth index applied to it, then use the previously set depth-index for this index
-        if( ( depthIndexValueSet == DepthIndexValue::NOT_SET ) &&
-            ( visual.GetDepthIndex() == 0 ) )
-        {
-          requiredDepthIndex = currentDepthIndex;
+          // current visual not already in removal container so add now.
+          DALI_LOG_INFO( gLogFilter, Debug::Verbose, "RegisterVisual Move current registered visual to removal Queue: %d \n", index );
+          RemoveRegisteredVisual( registeredVisual, &mRemoveVisuals );
         }
       }
+      else
+      {
+        // Control not staged or visual disabled so can just erase from registered visuals and new visual will be added later.
+        RemoveRegisteredVisual( registeredVisual, NULL );
+      }
 
-      visualReplaced = true;
+      // If we've not set the depth-index value and the new visual does not have a depth index applied to it, then use the previously set depth-index for this index
+      if( ( depthIndexValueSet == DepthIndexValue::NOT_SET ) &&
+          ( visual.GetDepthIndex() == 0 ) )
+      {
+        requiredDepthIndex = currentDepthIndex;
+      }
     }
+
+    visualReplaced = true;
   }
 
   // If not set, set the name of the visual to the same name as the control's property.
@@ -518,7 +506,7 @@ void Control::Impl::RegisterVisual( Property::Index index, Toolkit::Visual::Base
     RegisteredVisual* newRegisteredVisual  = new RegisteredVisual( index, visual,
                                              ( enabled == VisualState::ENABLED ? true : false ),
                                              ( visualReplaced && enabled ) ) ;
-    mVisuals.PushBack( newRegisteredVisual );
+    AddRegisteredVisual( newRegisteredVisual );
 
     Internal::Visual::Base& visualImpl = Toolkit::GetImplementation( visual );
     // Put on stage if enabled and the control is already on the stage
@@ -538,18 +526,18 @@ void Control::Impl::RegisterVisual( Property::Index index, Toolkit::Visual::Base
 
 void Control::Impl::UnregisterVisual( Property::Index index )
 {
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( index, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if ( registeredVisual )
   {
     // stop observing visual
-    StopObservingVisual( (*iter)->visual );
+    StopObservingVisual( registeredVisual->visual );
 
     Actor self( mControlImpl.Self() );
-    Toolkit::GetImplementation((*iter)->visual).SetOffScene( self );
-    (*iter)->visual.Reset();
-    mVisuals.Erase( iter );
+    Toolkit::GetImplementation( registeredVisual->visual ).SetOffScene( self );
+    RemoveRegisteredVisual( registeredVisual, NULL );
   }
 
+  RegisteredVisualContainer::Iterator iter;
   if( FindVisual( index, mRemoveVisuals, iter ) )
   {
     Actor self( mControlImpl.Self() );
@@ -562,10 +550,10 @@ void Control::Impl::UnregisterVisual( Property::Index index )
 
 Toolkit::Visual::Base Control::Impl::GetVisual( Property::Index index ) const
 {
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( index, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if ( registeredVisual )
   {
-    return (*iter)->visual;
+    return registeredVisual->visual;
   }
 
   return Toolkit::Visual::Base();
@@ -575,28 +563,28 @@ void Control::Impl::EnableVisual( Property::Index index, bool enable )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "Control::EnableVisual(%d, %s)\n", index, enable?"T":"F");
 
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( index, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if ( registeredVisual )
   {
-    if (  (*iter)->enabled == enable )
+    if (  registeredVisual->enabled == enable )
     {
-      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Visual %s(%d) already %s\n", (*iter)->visual.GetName().c_str(), index, enable?"enabled":"disabled");
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Visual %s(%d) already %s\n", registeredVisual->visual.GetName().c_str(), index, enable?"enabled":"disabled");
       return;
     }
 
-    (*iter)->enabled = enable;
+    UpdateVisualReadiness( *registeredVisual, enable );
     Actor parentActor = mControlImpl.Self();
     if ( mControlImpl.Self().GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) ) // If control not on Scene then Visual will be added when SceneConnection is called.
     {
       if ( enable )
       {
-        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Setting %s(%d) on stage \n", (*iter)->visual.GetName().c_str(), index );
-        Toolkit::GetImplementation((*iter)->visual).SetOnScene( parentActor );
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Setting %s(%d) on stage \n", registeredVisual->visual.GetName().c_str(), index );
+        Toolkit::GetImplementation( registeredVisual->visual ).SetOnScene( parentActor );
       }
       else
       {
-        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Setting %s(%d) off stage \n", (*iter)->visual.GetName().c_str(), index );
-        Toolkit::GetImplementation((*iter)->visual).SetOffScene( parentActor );  // No need to call if control not staged.
+        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Control::EnableVisual Setting %s(%d) off stage \n", registeredVisual->visual.GetName().c_str(), index );
+        Toolkit::GetImplementation( registeredVisual->visual ).SetOffScene( parentActor );  // No need to call if control not staged.
       }
     }
   }
@@ -608,10 +596,10 @@ void Control::Impl::EnableVisual( Property::Index index, bool enable )
 
 bool Control::Impl::IsVisualEnabled( Property::Index index ) const
 {
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( index, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if ( registeredVisual )
   {
-    return (*iter)->enabled;
+    return registeredVisual->enabled;
   }
   return false;
 }
@@ -639,25 +627,23 @@ void Control::Impl::ResourceReady( Visual::Base& object)
 
   Actor self = mControlImpl.Self();
 
-  // A resource is ready, find resource in the registered visuals container and get its index
-  for( auto registeredIter = mVisuals.Begin(),  end = mVisuals.End(); registeredIter != end; ++registeredIter )
+  // A resource is ready, find resource in the registered visuals and get its index
+  auto registeredRange = mVisualImpls.equal_range( &object );
+  for( auto registeredIter = registeredRange.first; registeredIter != registeredRange.second; ++registeredIter )
   {
-    Internal::Visual::Base& registeredVisualImpl = Toolkit::GetImplementation( (*registeredIter)->visual );
-
-    if( &object == &registeredVisualImpl )
+    RegisteredVisual& registeredVisual = *registeredIter->second;
+    UpdateVisualReadiness( registeredVisual, registeredVisual.enabled );
+
+    RegisteredVisualContainer::Iterator visualToRemoveIter;
+    // Find visual with the same index in the removal container
+    // Set if off stage as it's replacement is now ready.
+    // Remove if from removal list as now removed from stage.
+    // Set Pending flag on the ready visual to false as now ready.
+    if( FindVisual( registeredVisual.index, mRemoveVisuals, visualToRemoveIter ) )
     {
-      RegisteredVisualContainer::Iterator visualToRemoveIter;
-      // Find visual with the same index in the removal container
-      // Set if off stage as it's replacement is now ready.
-      // Remove if from removal list as now removed from stage.
-      // Set Pending flag on the ready visual to false as now ready.
-      if( FindVisual( (*registeredIter)->index, mRemoveVisuals, visualToRemoveIter ) )
-      {
-        (*registeredIter)->pending = false;
-        Toolkit::GetImplementation( (*visualToRemoveIter)->visual ).SetOffScene( self );
-        mRemoveVisuals.Erase( visualToRemoveIter );
-      }
-      break;
+      registeredVisual.pending = false;
+      Toolkit::GetImplementation( (*visualToRemoveIter)->visual ).SetOffScene( self );
+      mRemoveVisuals.Erase( visualToRemoveIter );
     }
   }
 
@@ -677,42 +663,101 @@ void Control::Impl::ResourceReady( Visual::Base& object)
 
 void Control::Impl::NotifyVisualEvent( Visual::Base& object, Property::Index signalId )
 {
-  for( auto registeredIter = mVisuals.Begin(),  end = mVisuals.End(); registeredIter != end; ++registeredIter )
+  RegisteredVisualImplContainer::const_iterator registeredIter = mVisualImpls.find( &object );
+  if( registeredIter != mVisualImpls.end() )
   {
-    Internal::Visual::Base& registeredVisualImpl = Toolkit::GetImplementation( (*registeredIter)->visual );
-    if( &object == &registeredVisualImpl )
-    {
-      Dali::Toolkit::Control handle( mControlImpl.GetOwner() );
-      mVisualEventSignal.Emit( handle, (*registeredIter)->index, signalId );
-      break;
-    }
+    Dali::Toolkit::Control handle( mControlImpl.GetOwner() );
+    mVisualEventSignal.Emit( handle, registeredIter->second->index, signalId );
   }
 }
 
 bool Control::Impl::IsResourceReady() const
 {
-  // Iterate through and check all the enabled visuals are ready
-  for( auto visualIter = mVisuals.Begin();
-         visualIter != mVisuals.End(); ++visualIter )
+  // All the enabled visuals are ready
+  return mPendingVisualCount == 0u;
+}
+
+void Control::Impl::AddRegisteredVisual( RegisteredVisual* registeredVisual )
+{
+  mVisuals.PushBack( registeredVisual );
+  mVisualIndices[ registeredVisual->index ] = registeredVisual;
+  mVisualImpls.insert( std::make_pair( &Toolkit::GetImplementation( registeredVisual->visual ), registeredVisual ) );
+
+  // The visual is counted as not ready until checked
+  if( registeredVisual->enabled && !registeredVisual->ready )
   {
-    const Toolkit::Visual::Base visual = (*visualIter)->visual;
-    const Internal::Visual::Base& visualImpl = Toolkit::GetImplementation( visual );
+    ++mPendingVisualCount;
+  }
+  UpdateVisualReadiness( *registeredVisual, registeredVisual->enabled );
+}
 
-    // one of the enabled visuals is not ready
-    if( !visualImpl.IsResourceReady() && (*visualIter)->enabled )
+void Control::Impl::RemoveRegisteredVisual( RegisteredVisual* registeredVisual, RegisteredVisualContainer* destination )
+{
+  if( registeredVisual->enabled && !registeredVisual->ready )
+  {
+    --mPendingVisualCount;
+  }
+
+  RegisteredVisualIndexContainer::iterator indexIter = mVisualIndices.find( registeredVisual->index );
+  if( indexIter != mVisualIndices.end() && indexIter->second == registeredVisual )
+  {
+    mVisualIndices.erase( indexIter );
+  }
+
+  if( registeredVisual->visual )
+  {
+    auto implRange = mVisualImpls.equal_range( &Toolkit::GetImplementation( registeredVisual->visual ) );
+    for( auto implIter = implRange.first; implIter != implRange.second; ++implIter )
     {
-      return false;
+      if( implIter->second == registeredVisual )
+      {
+        mVisualImpls.erase( implIter );
+        break;
+      }
     }
   }
-  return true;
+
+  RegisteredVisualContainer::Iterator iter = std::find( mVisuals.Begin(), mVisuals.End(), registeredVisual );
+  if( destination )
+  {
+    destination->PushBack( mVisuals.Release( iter ) );
+  }
+  else
+  {
+    mVisuals.Erase( iter );
+  }
+}
+
+RegisteredVisual* Control::Impl::FindRegisteredVisual( Property::Index index ) const
+{
+  RegisteredVisualIndexContainer::const_iterator iter = mVisualIndices.find( index );
+  if( iter != mVisualIndices.end() )
+  {
+    return iter->second;
+  }
+  return NULL;
+}
+
+void Control::Impl::UpdateVisualReadiness( RegisteredVisual& registeredVisual, bool enabled )
+{
+  const bool wasPending = registeredVisual.enabled && !registeredVisual.ready;
+
+  registeredVisual.enabled = enabled;
+  registeredVisual.ready = Toolkit::GetImplementation( registeredVisual.visual ).IsResourceReady();
+
+  const bool isPending = registeredVisual.enabled && !registeredVisual.ready;
+  if( isPending != wasPending )
+  {
+    isPending ? ++mPendingVisualCount : --mPendingVisualCount;
+  }
 }
 
 Toolkit::Visual::ResourceStatus Control::Impl::GetVisualResourceStatus( Property::Index index ) const
 {
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( index, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( index );
+  if ( registeredVisual )
   {
-    const Toolkit::Visual::Base visual = (*iter)->visual;
+    const Toolkit::Visual::Base visual = registeredVisual->visual;
     const Internal::Visual::Base& visualImpl = Toolkit::GetImplementation( visual );
     return visualImpl.GetResourceStatus( );
   }
@@ -808,10 +853,10 @@ Dali::Animation Control::Impl::CreateTransition( const Toolkit::TransitionData&
 
 void Control::Impl::DoAction( Dali::Property::Index visualIndex, Dali::Property::Index actionId, const Dali::Property::Value attributes )
 {
-  RegisteredVisualContainer::Iterator iter;
-  if ( FindVisual( visualIndex, mVisuals, iter ) )
+  RegisteredVisual* registeredVisual = FindRegisteredVisual( visualIndex );
+  if ( registeredVisual )
   {
-    Toolkit::GetImplementation((*iter)->visual).DoAction( actionId, attributes );
+    Toolkit::GetImplementation( registeredVisual->visual ).DoAction( actionId, attributes );
   }
 }
 
@@ -1130,31 +1175,30 @@ void  Control::Impl::CopyInstancedProperties( RegisteredVisualContainer& visuals
 }
 
 
-void Control::Impl::RemoveVisual( RegisteredVisualContainer& visuals, const std::string& visualName )
+void Control::Impl::RemoveVisual( const std::string& visualName )
 {
   Actor self( mControlImpl.Self() );
 
-  for ( RegisteredVisualContainer::Iterator visualIter = visuals.Begin();
-        visualIter != visuals.End(); ++visualIter )
+  for ( RegisteredVisualContainer::Iterator visualIter = mVisuals.Begin();
+        visualIter != mVisuals.End(); ++visualIter )
   {
     Toolkit::Visual::Base visual = (*visualIter)->visual;
     if( visual && visual.GetName() == visualName )
     {
       Toolkit::GetImplementation(visual).SetOffScene( self );
-      (*visualIter)->visual.Reset();
-      visuals.Erase( visualIter );
+      RemoveRegisteredVisual( *visualIter, NULL );
       break;
     }
   }
 }
 
-void Control::Impl::RemoveVisuals( RegisteredVisualContainer& visuals, DictionaryKeys& removeVisuals )
+void Control::Impl::RemoveVisuals( DictionaryKeys& removeVisuals )
 {
   Actor self( mControlImpl.Self() );
   for( DictionaryKeys::iterator iter = removeVisuals.begin(); iter != removeVisuals.end(); ++iter )
   {
     const std::string visualName = *iter;
-    RemoveVisual( visuals, visualName );
+    RemoveVisual( visualName );
   }
 }
 
@@ -1210,7 +1254,7 @@ void Control::Impl::RecreateChangedVisuals( Dictionary<Property::Map>& stateVisu
       const Property::Map* instancedMap = instancedProperties.FindConst( visualName );
       if( recreate || instancedMap )
       {
-        RemoveVisual( mVisuals, visualName );
+        RemoveVisual( visualName );
         Style::ApplyVisual( handle, visualName, toMap, instancedMap );
       }
       else
@@ -1218,7 +1262,7 @@ void Control::Impl::RecreateChangedVisuals( Dictionary<Property::Map>& stateVisu
         // @todo check to see if we can apply toMap without recreating the visual
         // e.g. by setting only animatable properties
         // For now, recreate all visuals, but merge in instance data.
-        RemoveVisual( mVisuals, visualName );
+        RemoveVisual( visualName );
         Style::ApplyVisual( handle, visualName, toMap, instancedMap );
       }
     }
@@ -1268,7 +1312,7 @@ void Control::Impl::ReplaceStateVisualsAndProperties( const StylePtr oldState, c
   CopyInstancedProperties( mVisuals, instancedProperties );
 
   // For each visual in remove list, remove from mVisuals
-  RemoveVisuals( mVisuals, stateVisualsToRemove );
+  RemoveVisuals( stateVisualsToRemove );
 
   // For each visual in add list, create and add to mVisuals
   Dali::CustomActor handle( mControlImpl.GetOwner() );
@@ -1372,9 +1416,11 @@ void Control::Impl::OnSceneDisconnection()
     Toolkit::GetImplementation((*removalIter)->visual).SetOffScene( self );
   }
 
+  // Visuals may release their resources when set off scene
   for( auto replacedIter = mVisuals.Begin(), end = mVisuals.End(); replacedIter != end; replacedIter++ )
   {
     (*replacedIter)->pending = false;
+    UpdateVisualReadiness( **replacedIter, (*replacedIter)->enabled );
   }
 
   mRemoveVisuals.Clear();
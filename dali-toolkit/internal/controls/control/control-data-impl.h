@@ -22,6 +22,7 @@
 #include <dali/public-api/object/type-registry.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-event-observer.h>
@@ -51,14 +52,17 @@ struct RegisteredVisual
   Toolkit::Visual::Base visual;
   bool enabled : 1;
   bool pending : 1;
+  bool ready : 1; ///< Whether the resources of the visual were ready when last checked
 
   RegisteredVisual( Property::Index aIndex, Toolkit::Visual::Base &aVisual, bool aEnabled, bool aPendingReplacement )
-  : index(aIndex), visual(aVisual), enabled(aEnabled), pending( aPendingReplacement )
+  : index(aIndex), visual(aVisual), enabled(aEnabled), pending( aPendingReplacement ), ready( false )
   {
   }
 };
 
 typedef Dali::OwnerContainer< RegisteredVisual* > RegisteredVisualContainer;
+typedef std::unordered_map< Property::Index, RegisteredVisual* > RegisteredVisualIndexContainer;
+typedef std::unordered_multimap< const Visual::Base*, RegisteredVisual* > RegisteredVisualImplContainer;
 
 
 /**
@@ -252,17 +256,15 @@ public:
 
   /**
    * @brief Removes a visual from the control's container.
-   * @param[in] visuals The container of visuals
    * @param[in] visualName The name of the visual to remove
    */
-  void RemoveVisual( RegisteredVisualContainer& visuals, const std::string& visualName );
+  void RemoveVisual( const std::string& visualName );
 
   /**
    * @brief Removes several visuals from the control's container.
-   * @param[in] visuals The container of visuals
    * @param[in] removeVisuals The visuals to remove
    */
-  void RemoveVisuals( RegisteredVisualContainer& visuals, DictionaryKeys& removeVisuals );
+  void RemoveVisuals( DictionaryKeys& removeVisuals );
 
   /**
    * @brief Copies the visual properties that are specific to the control instance into the instancedProperties container.
@@ -289,6 +291,34 @@ public:
    */
   bool IsResourceReady() const;
 
+  /**
+   * @brief Adds a visual to the registered visuals and indexes it.
+   * @param[in] registeredVisual The visual, owned by the registered visuals from now on
+   */
+  void AddRegisteredVisual( RegisteredVisual* registeredVisual );
+
+  /**
+   * @brief Removes a visual from the registered visuals and from their indices.
+   * @param[in] registeredVisual The visual
+   * @param[in] destination The container taking the ownership of the visual, or NULL to delete it
+   */
+  void RemoveRegisteredVisual( RegisteredVisual* registeredVisual, RegisteredVisualContainer* destination );
+
+  /**
+   * @brief Finds a registered visual by its property index.
+   * @param[in] index The property index of the visual
+   * @return The registered visual, or NULL if there is none
+   */
+  RegisteredVisual* FindRegisteredVisual( Property::Index index ) const;
+
+  /**
+   * @brief Updates whether a registered visual is enabled and its resources are ready,
+   * and the number of enabled visuals whose resources are not ready.
+   * @param[in] registeredVisual The visual
+   * @param[in] enabled Whether the visual is enabled
+   */
+  void UpdateVisualReadiness( RegisteredVisual& registeredVisual, bool enabled );
+
   /**
    * @copydoc CustomActorImpl::OnSceneDisconnection()
    */
@@ -398,6 +428,9 @@ public:
   int mDownFocusableActorId;       ///< Actor ID of Down focusable control.
 
   RegisteredVisualContainer mVisuals;     ///< Stores visuals needed by the control, non trivial type so std::vector used.
+  RegisteredVisualIndexContainer mVisualIndices; ///< The visuals of mVisuals by property index
+  RegisteredVisualImplContainer mVisualImpls;    ///< The visuals of mVisuals by implementation, to find the visual notifying an event
+  uint32_t mPendingVisualCount;                  ///< The number of enabled visuals of mVisuals whose resources are not ready
   std::string mStyleName;
   Vector4 mBackgroundColor;               ///< The color of the background visual
   Vector3* mStartingPinchScale;           ///< The scale when a pinch gesture starts, TODO: consider removing this
@@ -16,6 +16,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -120,7 +121,7 @@ Geometry CreateGridGeometry( Uint16Pair gridSize )
 
 Dali::Renderer CreateRenderer( const char* vertexSrc, const char* fragmentSrc )
 {
-  Dali::Shader shader = Dali::Shader::New( vertexSrc, fragmentSrc );
+  Dali::Shader shader = ShaderRegistry::Get().GetGeneratedShader( "ControlRenderers", vertexSrc, fragmentSrc );
 
   Dali::Geometry texturedQuadGeometry = Dali::Geometry::New();
 
@@ -155,7 +156,7 @@ Dali::Renderer CreateRenderer( const char* vertexSrc, const char* fragmentSrc )
 
 Dali::Renderer CreateRenderer( const char* vertexSrc, const char* fragmentSrc, Dali::Shader::Hint::Value hints, Uint16Pair gridSize )
 {
-  Dali::Shader shader = Dali::Shader::New( vertexSrc, fragmentSrc, hints );
+  Dali::Shader shader = ShaderRegistry::Get().GetGeneratedShader( "ControlRenderers", vertexSrc, fragmentSrc, hints );
 
   Dali::Geometry gridGeometry = CreateGridGeometry( gridSize );
 
@@ -185,6 +186,11 @@ void SetRendererTexture( Dali::Renderer renderer, Dali::FrameBuffer frameBuffer
   }
 }
 
+void AddControlRendererShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "ControlRenderers", BASIC_VERTEX_SOURCE, BASIC_FRAGMENT_SOURCE );
+}
+
 } // namespace Internal
 } // namespace Toolkit
 } // namespace Dali
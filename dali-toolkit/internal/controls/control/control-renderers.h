@@ -26,6 +26,8 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
+
 extern const char* const BASIC_VERTEX_SOURCE;
 
 extern const char* const BASIC_FRAGMENT_SOURCE;
@@ -61,6 +63,13 @@ void SetRendererTexture( Dali::Renderer renderer, Dali::Texture texture );
  */
 void SetRendererTexture( Dali::Renderer renderer, Dali::FrameBuffer frameBuffer );
 
+/**
+ * Helper method for recording the shader variant of the basic sources, used by the effect controls,
+ * so it may be warmed up before its first use.
+ * @param[in] registry The shader registry
+ */
+void AddControlRendererShaderVariants( ShaderRegistry& registry );
+
 } // namespace Internal
 } // namespace Toolkit
 } // namespace Dali
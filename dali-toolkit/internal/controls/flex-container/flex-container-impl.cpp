@@ -24,6 +24,7 @@
 #include <dali/public-api/object/type-registry.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/object/handle-devel.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/public-api/size-negotiation/relayout-container.h>
 #include <dali/integration-api/debug.h>
@@ -157,6 +158,20 @@ const Scripting::StringEnum ALIGN_CONTENT_STRING_TABLE[] =
 };
 const unsigned int ALIGN_CONTENT_STRING_TABLE_COUNT = sizeof( ALIGN_CONTENT_STRING_TABLE ) / sizeof( ALIGN_CONTENT_STRING_TABLE[0] );
 
+/**
+ * @brief Whether a property of a child is read into the style of its node
+ *
+ * @param[in] index The index of the property
+ */
+bool IsStyleProperty( Property::Index index )
+{
+  return index == Actor::Property::MINIMUM_SIZE ||
+         index == Actor::Property::MAXIMUM_SIZE ||
+         index == Toolkit::FlexContainer::ChildProperty::FLEX ||
+         index == Toolkit::FlexContainer::ChildProperty::ALIGN_SELF ||
+         index == Toolkit::FlexContainer::ChildProperty::FLEX_MARGIN;
+}
+
 } // Unnamed namespace
 
 Toolkit::FlexContainer FlexContainer::New()
@@ -180,7 +195,11 @@ FlexContainer::~FlexContainer()
 
   for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
   {
-    YGNodeFree( mChildrenNodes[i].node );
+    // The nodes of the nested containers are freed by them
+    if( !mChildrenNodes[i].container )
+    {
+      YGNodeFree( mChildrenNodes[i].node );
+    }
   }
 
   mChildrenNodes.clear();
@@ -476,14 +495,35 @@ Property::Value FlexContainer::GetProperty( BaseObject* object, Property::Index
 
 void FlexContainer::OnChildAdd( Actor& child )
 {
-  // Create a new node for the child.
   FlexItemNode childNode;
   childNode.actor = child;
-  childNode.node = YGNodeNew();
+  childNode.node = NULL;
+  childNode.container = false;
+  childNode.styleDirty = true;
+
+  // A nested flex container joins the layout tree with its own node, so the whole tree is calculated at once.
+  Toolkit::FlexContainer nestedContainer = Toolkit::FlexContainer::DownCast( child );
+  if( nestedContainer )
+  {
+    YGNodeRef nestedNode = GetImpl( nestedContainer ).mRootNode.node;
+    if( nestedNode && !YGNodeGetOwner( nestedNode ) )
+    {
+      childNode.node = nestedNode;
+      childNode.container = true;
+    }
+  }
+
+  if( !childNode.node )
+  {
+    // Create a new node for the child.
+    childNode.node = YGNodeNew();
+  }
 
   mChildrenNodes.push_back( childNode );
   YGNodeInsertChild( mRootNode.node, childNode.node, mChildrenNodes.size() - 1 );
 
+  DevelHandle::PropertySetSignal( child ).Connect( this, &FlexContainer::OnChildPropertySet );
+
   Control::OnChildAdd( child );
 }
 
@@ -493,8 +533,14 @@ void FlexContainer::OnChildRemove( Actor& child )
   {
     if( mChildrenNodes[i].actor.GetHandle() == child )
     {
+      DevelHandle::PropertySetSignal( child ).Disconnect( this, &FlexContainer::OnChildPropertySet );
+
+      // A nested container keeps its node and calculates its own layout again
       YGNodeRemoveChild( mRootNode.node, mChildrenNodes[i].node );
-      YGNodeFree( mChildrenNodes[i].node );
+      if( !mChildrenNodes[i].container )
+      {
+        YGNodeFree( mChildrenNodes[i].node );
+      }
 
       mChildrenNodes.erase( mChildrenNodes.begin() + i );
 
@@ -509,32 +555,6 @@ void FlexContainer::OnChildRemove( Actor& child )
 
 void FlexContainer::OnRelayout( const Vector2& size, RelayoutContainer& container )
 {
-  for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
-  {
-    Actor child = mChildrenNodes[i].actor.GetHandle();
-    if( child )
-    {
-      // Anchor actor to top left of the container
-      if( child.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
-      {
-        child.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
-      }
-      child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
-
-      float negotiatedWidth = child.GetRelayoutSize(Dimension::WIDTH);
-      float negotiatedHeight = child.GetRelayoutSize(Dimension::HEIGHT);
-
-      if( negotiatedWidth > 0 )
-      {
-        YGNodeStyleSetWidth( mChildrenNodes[i].node, negotiatedWidth );
-      }
-      if( negotiatedHeight > 0 )
-      {
-        YGNodeStyleSetHeight( mChildrenNodes[i].node, negotiatedHeight );
-      }
-    }
-  }
-
   // Relayout the container
   RelayoutChildren();
 #if defined(FLEX_CONTAINER_DEBUG)
@@ -583,6 +603,23 @@ void FlexContainer::OnSizeSet( const Vector3& size )
   Control::OnSizeSet( size );
 }
 
+void FlexContainer::OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value )
+{
+  // Only the child whose style changed is read again, the layout of the others is reused
+  if( IsStyleProperty( index ) )
+  {
+    for( auto&& childNode : mChildrenNodes )
+    {
+      if( childNode.actor.GetHandle() == handle )
+      {
+        childNode.styleDirty = true;
+        RelayoutRequest();
+        break;
+      }
+    }
+  }
+}
+
 void FlexContainer::OnLayoutDirectionChanged( Dali::Actor actor, Dali::LayoutDirection::Type type )
 {
   Toolkit::FlexContainer flexContainer = Toolkit::FlexContainer::DownCast(actor);
@@ -612,10 +649,47 @@ void FlexContainer::ComputeLayout()
 {
   if( mRootNode.node )
   {
-    for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
+    // Update the nodes of the whole tree, Yoga recalculates only the dirty ones
+    UpdateNodes( true );
+
+#if defined(FLEX_CONTAINER_DEBUG)
+    YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
+#endif
+    YGNodeCalculateLayout( mRootNode.node, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).x, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).y, GetNodeLayoutDirection() );
+#if defined(FLEX_CONTAINER_DEBUG)
+    YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
+#endif
+  }
+}
+
+void FlexContainer::UpdateNodes( bool nested )
+{
+  YGNodeStyleSetDirection( mRootNode.node, GetNodeLayoutDirection() );
+
+  for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
+  {
+    YGNodeRef childNode = mChildrenNodes[i].node;
+    Actor childActor = mChildrenNodes[i].actor.GetHandle();
+    if( !childActor )
+    {
+      continue;
+    }
+
+    float negotiatedWidth = childActor.GetRelayoutSize(Dimension::WIDTH);
+    float negotiatedHeight = childActor.GetRelayoutSize(Dimension::HEIGHT);
+
+    if( negotiatedWidth > 0 )
+    {
+      YGNodeStyleSetWidth( childNode, negotiatedWidth );
+    }
+    if( negotiatedHeight > 0 )
+    {
+      YGNodeStyleSetHeight( childNode, negotiatedHeight );
+    }
+
+    if( mChildrenNodes[i].styleDirty )
     {
-      YGNodeRef childNode = mChildrenNodes[i].node;
-      Actor childActor = mChildrenNodes[i].actor.GetHandle();
+      mChildrenNodes[i].styleDirty = false;
 
       // Intialize the style of the child.
       YGNodeStyleSetMinWidth( childNode, childActor.GetProperty< Vector2 >( Actor::Property::MINIMUM_SIZE ).x );
@@ -661,42 +735,74 @@ void FlexContainer::ComputeLayout()
       }
     }
 
-    // Calculate the layout
-    YGDirection nodeLayoutDirection = YGDirectionInherit;
-    switch( mContentDirection )
+    if( nested && mChildrenNodes[i].container )
     {
-    case Dali::Toolkit::FlexContainer::LTR:
-    {
-      nodeLayoutDirection = YGDirectionLTR;
-      break;
+      Toolkit::FlexContainer nestedContainer = Toolkit::FlexContainer::DownCast( childActor );
+      GetImpl( nestedContainer ).UpdateNodes( true );
     }
+  }
+}
 
-    case Dali::Toolkit::FlexContainer::RTL:
-    {
-      nodeLayoutDirection = YGDirectionRTL;
-      break;
-    }
+FlexContainer& FlexContainer::GetLayoutRoot()
+{
+  // Only the nodes of the containers have children, their context is the container
+  YGNodeRef node = mRootNode.node;
+  if( !node )
+  {
+    return *this;
+  }
 
-    case Dali::Toolkit::FlexContainer::INHERIT:
-    {
-      nodeLayoutDirection = YGDirectionInherit;
-      break;
-    }
-    }
+  while( YGNodeGetOwner( node ) )
+  {
+    node = YGNodeGetOwner( node );
+  }
 
-#if defined(FLEX_CONTAINER_DEBUG)
-    YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
-#endif
-    YGNodeCalculateLayout( mRootNode.node, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).x, Self().GetProperty< Vector2 >( Actor::Property::MAXIMUM_SIZE ).y, nodeLayoutDirection );
-#if defined(FLEX_CONTAINER_DEBUG)
-    YGNodePrint( mRootNode.node, (YGPrintOptions)( YGPrintOptionsLayout | YGPrintOptionsStyle | YGPrintOptionsChildren ) );
-#endif
+  return *static_cast< FlexContainer* >( YGNodeGetContext( node ) );
+}
+
+YGDirection FlexContainer::GetNodeLayoutDirection() const
+{
+  YGDirection nodeLayoutDirection = YGDirectionInherit;
+  switch( mContentDirection )
+  {
+  case Dali::Toolkit::FlexContainer::LTR:
+  {
+    nodeLayoutDirection = YGDirectionLTR;
+    break;
+  }
+
+  case Dali::Toolkit::FlexContainer::RTL:
+  {
+    nodeLayoutDirection = YGDirectionRTL;
+    break;
+  }
+
+  case Dali::Toolkit::FlexContainer::INHERIT:
+  {
+    nodeLayoutDirection = YGDirectionInherit;
+    break;
+  }
   }
+
+  return nodeLayoutDirection;
 }
 
 void FlexContainer::RelayoutChildren()
 {
-  ComputeLayout();
+  FlexContainer& layoutRoot = GetLayoutRoot();
+  if( &layoutRoot == this )
+  {
+    ComputeLayout();
+  }
+  else
+  {
+    // A nested container is calculated by the outermost one, unless its children changed since then
+    UpdateNodes( false );
+    if( YGNodeIsDirty( mRootNode.node ) )
+    {
+      layoutRoot.ComputeLayout();
+    }
+  }
 
   // Set size and position of children according to the layout calculation
   for( unsigned int i = 0; i < mChildrenNodes.size(); i++ )
@@ -704,6 +810,13 @@ void FlexContainer::RelayoutChildren()
     Dali::Actor child = mChildrenNodes[i].actor.GetHandle();
     if( child )
     {
+      // Anchor actor to top left of the container
+      if( child.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
+      {
+        child.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+      }
+      child.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+
       child.SetProperty( Actor::Property::POSITION_X,  YGNodeLayoutGetLeft( mChildrenNodes[i].node ) );
       child.SetProperty( Actor::Property::POSITION_Y,  YGNodeLayoutGetTop( mChildrenNodes[i].node ) );
     }
@@ -832,7 +945,9 @@ void FlexContainer::OnInitialize()
 
   mRootNode.actor = self;
   mRootNode.node = YGNodeNew();
-  YGNodeSetContext( mRootNode.node, &mChildrenNodes );
+  mRootNode.container = false;
+  mRootNode.styleDirty = false;
+  YGNodeSetContext( mRootNode.node, this );
 
   // Set default style
   YGNodeStyleSetFlexDirection( mRootNode.node, static_cast<YGFlexDirection>( mFlexDirection ) );
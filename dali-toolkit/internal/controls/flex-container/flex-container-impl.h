@@ -50,6 +50,8 @@ public:
   {
     WeakHandle< Dali::Actor > actor;      ///< Actor handle of the flex item
     YGNodeRef node;                     ///< The style properties and layout information
+    bool container;                     ///< Whether the node is the root node of a nested flex container, which owns it
+    bool styleDirty;                    ///< Whether the style must be read again from the properties of the actor
   };
 
   typedef std::vector< FlexItemNode > FlexItemNodeContainer;
@@ -209,13 +211,39 @@ private: // From Control
   */
   void OnLayoutDirectionChanged( Dali::Actor actor, Dali::LayoutDirection::Type type );
 
+  /**
+   * Called when a property of a child is set, to read the style of the child again if needed
+   * @param[in] handle The child.
+   * @param[in] index The index of the property.
+   * @param[in] value The value of the property.
+   */
+  void OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value );
+
 private: // Implementation
 
   /**
-   * Calculate the layout properties of all the children
+   * Calculate the layout properties of all the children, including the ones of the nested containers
    */
   void ComputeLayout();
 
+  /**
+   * Update the nodes of the children from their size and style
+   * @param[in] nested Whether to update the nodes of the nested containers as well
+   */
+  void UpdateNodes( bool nested );
+
+  /**
+   * Retrieve the outermost container whose layout tree this container joined
+   * @return The container calculating the layout of this one
+   */
+  FlexContainer& GetLayoutRoot();
+
+  /**
+   * Retrieve the layout direction of the node from the content direction
+   * @return The layout direction
+   */
+  YGDirection GetNodeLayoutDirection() const;
+
   /**
    * Calculate the layout of the children and relayout them with their new size and position
    */
@@ -32,6 +32,7 @@
 #include <dali-toolkit/internal/controls/page-turn-view/page-turn-book-spine-effect.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 using namespace Dali;
 
@@ -248,6 +249,32 @@ DALI_SIGNAL_REGISTRATION( Toolkit, PageTurnView, "pagePanFinished",    SIGNAL_PA
 
 DALI_TYPE_REGISTRATION_END()
 
+/**
+ * Retrieves the shader source of a shader property map, returning false if it's not available.
+ */
+bool GetShaderSource( const Property::Map& shaderMap, std::string& vertexShader, std::string& fragmentShader )
+{
+  Property::Value* shaderValue = shaderMap.Find( Toolkit::Visual::Property::SHADER, CUSTOM_SHADER );
+  Property::Map shaderSource;
+  if( !shaderValue || !shaderValue->Get( shaderSource ) )
+  {
+    DALI_LOG_ERROR("PageTurnView::CreateShader failed: shader source is not available.\n");
+    return false;
+  }
+
+  Property::Value* vertexShaderValue = shaderSource.Find( Toolkit::Visual::Shader::Property::VERTEX_SHADER, CUSTOM_VERTEX_SHADER );
+  if( !vertexShaderValue || !vertexShaderValue->Get( vertexShader ) )
+  {
+    DALI_LOG_ERROR("PageTurnView::CreateShader failed: vertex shader source is not available.\n");
+  }
+  Property::Value* fragmentShaderValue = shaderSource.Find( Toolkit::Visual::Shader::Property::FRAGMENT_SHADER, CUSTOM_FRAGMENT_SHADER );
+  if( !fragmentShaderValue || !fragmentShaderValue->Get( fragmentShader ) )
+  {
+    DALI_LOG_ERROR("PageTurnView::CreateShader failed: fragment shader source is not available.\n");
+  }
+  return true;
+}
+
 }
 
 // these several constants are also used in the derived classes
@@ -416,30 +443,31 @@ void PageTurnView::OnInitialize()
   EnableGestureDetection(GestureType::Value(GestureType::PAN));
 }
 
-Shader PageTurnView::CreateShader( const Property::Map& shaderMap )
+void PageTurnView::AddShaderVariants( ShaderRegistry& registry )
 {
-  Shader shader;
-  Property::Value* shaderValue = shaderMap.Find( Toolkit::Visual::Property::SHADER, CUSTOM_SHADER );
-  Property::Map shaderSource;
-  if( shaderValue && shaderValue->Get( shaderSource ) )
+  std::string vertexShader;
+  std::string fragmentShader;
+  if( GetShaderSource( CreatePageTurnBookSpineEffect(), vertexShader, fragmentShader ) )
   {
-    std::string vertexShader;
-    Property::Value* vertexShaderValue = shaderSource.Find( Toolkit::Visual::Shader::Property::VERTEX_SHADER, CUSTOM_VERTEX_SHADER );
-    if( !vertexShaderValue || !vertexShaderValue->Get( vertexShader ) )
-    {
-      DALI_LOG_ERROR("PageTurnView::CreateShader failed: vertex shader source is not available.\n");
-    }
-    std::string fragmentShader;
-    Property::Value* fragmentShaderValue = shaderSource.Find( Toolkit::Visual::Shader::Property::FRAGMENT_SHADER, CUSTOM_FRAGMENT_SHADER );
-    if( !fragmentShaderValue || !fragmentShaderValue->Get( fragmentShader ) )
-    {
-      DALI_LOG_ERROR("PageTurnView::CreateShader failed: fragment shader source is not available.\n");
-    }
-    shader = Shader::New( vertexShader, fragmentShader );
+    registry.AddVariant( "PageTurnView", vertexShader, fragmentShader );
   }
-  else
+
+  vertexShader.clear();
+  fragmentShader.clear();
+  if( GetShaderSource( CreatePageTurnEffect(), vertexShader, fragmentShader ) )
   {
-    DALI_LOG_ERROR("PageTurnView::CreateShader failed: shader source is not available.\n");
+    registry.AddVariant( "PageTurnView", vertexShader, fragmentShader );
+  }
+}
+
+Shader PageTurnView::CreateShader( const Property::Map& shaderMap )
+{
+  Shader shader;
+  std::string vertexShader;
+  std::string fragmentShader;
+  if( GetShaderSource( shaderMap, vertexShader, fragmentShader ) )
+  {
+    shader = ShaderRegistry::Get().NewShader( "PageTurnView", vertexShader, fragmentShader );
   }
 
   return shader;
@@ -38,6 +38,8 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
+
 class PageTurnView : public Control
 {
 protected:
@@ -170,6 +172,12 @@ public:
    */
   unsigned int GetCurrentPage();
 
+  /**
+   * Records the shader variants of the page turn effects, so they may be warmed up before their first use.
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 protected:
 
   /**
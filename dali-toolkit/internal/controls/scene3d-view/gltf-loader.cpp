@@ -24,6 +24,9 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+
 namespace Dali
 {
 
@@ -1570,7 +1573,7 @@ Actor Loader::AddNode( Scene3dView& scene3dView, uint32_t index )
     FRAGMENT_SHADER += PHYSICALLY_BASED_FRAGMENT_SHADER;
     if( !mShaderCache[shaderTypeIndex] )
     {
-      mShaderCache[shaderTypeIndex] = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+      mShaderCache[shaderTypeIndex] = ShaderRegistry::Get().NewShader( "Scene3dView", VERTEX_SHADER, FRAGMENT_SHADER );
       scene3dView.AddShader( mShaderCache[shaderTypeIndex] );
     }
     Shader shader = mShaderCache[shaderTypeIndex];
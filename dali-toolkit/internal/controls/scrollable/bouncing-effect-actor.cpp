@@ -26,6 +26,9 @@
 #include <dali/public-api/rendering/shader.h>
 #include <dali/public-api/rendering/texture-set.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+
 namespace Dali
 {
 
@@ -123,7 +126,7 @@ Actor CreateBouncingEffectActor( Property::Index& bouncePropertyIndex )
   meshGeometry.SetIndexBuffer( indexData, sizeof(indexData)/sizeof(indexData[0]) );
 
   // Create the shader
-  Shader shader = Shader::New( MESH_VERTEX_SHADER, MESH_FRAGMENT_SHADER );
+  Shader shader = ShaderRegistry::Get().GetShader( "BouncingEffect", MESH_VERTEX_SHADER, MESH_FRAGMENT_SHADER );
 
   // Create renderer
   Renderer renderer = Renderer::New( meshGeometry, shader );
@@ -138,6 +141,11 @@ Actor CreateBouncingEffectActor( Property::Index& bouncePropertyIndex )
   return meshActor;
 }
 
+void AddBouncingEffectShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "BouncingEffect", MESH_VERTEX_SHADER, MESH_FRAGMENT_SHADER );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
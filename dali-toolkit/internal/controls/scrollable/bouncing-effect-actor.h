@@ -31,6 +31,8 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
+
 /**
  * @brief Creates a Dali::Actor to display the bouncing effect for overshoot
  *
@@ -59,6 +61,13 @@ namespace Internal
  */
 Actor CreateBouncingEffectActor( Property::Index& bouncePropertyIndex);
 
+/**
+ * @brief Records the shader variants of the bouncing effect, so they may be warmed up before their first use.
+ *
+ * @param[in] registry The shader registry
+ */
+void AddBouncingEffectShaderVariants( ShaderRegistry& registry );
+
 } // namespace Internal
 
 } // namespace Toolkit
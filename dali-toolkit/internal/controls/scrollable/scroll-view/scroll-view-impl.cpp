@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-view-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring> // for strcmp
 #include <dali/public-api/animation/constraints.h>
 #include <dali/devel-api/common/stage.h>
@@ -27,12 +28,14 @@
 #include <dali/public-api/object/type-registry.h>
 #include <dali/public-api/object/type-registry-helper.h>
 #include <dali/public-api/object/property-map.h>
+#include <dali/devel-api/object/handle-devel.h>
 #include <dali/devel-api/object/property-helper-devel.h>
 #include <dali/devel-api/events/pan-gesture-devel.h>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/scroll-view-devel.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view-constraints.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-mode.h>
@@ -77,6 +80,8 @@ const Vector2 DEFAULT_WHEEL_SCROLL_DISTANCE_STEP_PROPORTION = Vector2(0.17f, 0.1
 const unsigned long MINIMUM_TIME_BETWEEN_DOWN_AND_UP_FOR_RESET( 150u );
 const float TOUCH_DOWN_TIMER_INTERVAL = 100.0f;
 const float DEFAULT_SCROLL_UPDATE_DISTANCE( 30.0f );                ///< Default distance to travel in pixels for scroll update signal
+const float SPATIAL_INDEX_CELL_SIZE( 256.0f );                      ///< Width and height of the cells of the spatial index of the children
+const float MINIMUM_CULLING_STEP( 16.0f );                          ///< Minimum distance to travel in pixels before updating the culled children
 
 const std::string INTERNAL_MAX_POSITION_PROPERTY_NAME( "internalMaxPosition" );
 
@@ -153,6 +158,43 @@ Vector3 GetPositionOfAnchor(Actor &actor, const Vector3 &anchor)
   return childPosition + childAnchor * childSize;
 }
 
+/**
+ * Whether a property changes the bounds of a child in the spatial index.
+ */
+bool IsBoundsProperty( Property::Index index )
+{
+  switch( index )
+  {
+    case Actor::Property::PARENT_ORIGIN:
+    case Actor::Property::PARENT_ORIGIN_X:
+    case Actor::Property::PARENT_ORIGIN_Y:
+    case Actor::Property::ANCHOR_POINT:
+    case Actor::Property::ANCHOR_POINT_X:
+    case Actor::Property::ANCHOR_POINT_Y:
+    case Actor::Property::ANCHOR_POINT_Z:
+    case Actor::Property::SIZE:
+    case Actor::Property::SIZE_WIDTH:
+    case Actor::Property::SIZE_HEIGHT:
+    case Actor::Property::SIZE_DEPTH:
+    case Actor::Property::POSITION:
+    case Actor::Property::POSITION_X:
+    case Actor::Property::POSITION_Y:
+    case Actor::Property::POSITION_Z:
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Orders the handles by object, so the children within the culling region can be searched and diffed.
+ */
+bool CompareObjects( const Actor& lhs, const Actor& rhs )
+{
+  return lhs.GetObjectPtr() < rhs.GetObjectPtr();
+}
+
 // AlphaFunctions /////////////////////////////////////////////////////////////////////////////////
 
 float FinalDefaultAlphaFunction(float offset)
@@ -253,6 +295,8 @@ DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "panningEnabled",             B
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "axisAutoLockEnabled",        BOOLEAN,   AXIS_AUTO_LOCK_ENABLED      )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "wheelScrollDistanceStep",    VECTOR2,   WHEEL_SCROLL_DISTANCE_STEP  )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollMode",                 MAP,       SCROLL_MODE )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, ScrollView, "spatialIndexEnabled",   BOOLEAN,   SPATIAL_INDEX_ENABLED       )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, ScrollView, "viewportCullingMargin", FLOAT,     VIEWPORT_CULLING_MARGIN     )
 
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPosition",  VECTOR2, SCROLL_POSITION)
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPrePosition",   VECTOR2, SCROLL_PRE_POSITION)
@@ -650,6 +694,12 @@ ScrollView::ScrollView()
   mFlickSpeedCoefficient(DEFAULT_FLICK_SPEED_COEFFICIENT),
   mMaxFlickSpeed(DEFAULT_MAX_FLICK_SPEED),
   mWheelScrollDistanceStep(Vector2::ZERO),
+  mSpatialIndex(),
+  mCullingVisibleChildren(),
+  mCulledChildren(),
+  mCullingPendingChildren(),
+  mCullingRegion(),
+  mViewportCullingMargin(-1.0f),
   mInAccessibilityPan(false),
   mScrolling(false),
   mScrollInterrupted(false),
@@ -1343,6 +1393,22 @@ Actor ScrollView::FindClosestActor()
 
 Actor ScrollView::FindClosestActorToPosition(const Vector3& position, FindDirection dirX, FindDirection dirY, FindDirection dirZ)
 {
+  if( mSpatialIndex )
+  {
+    // The children are indexed in scroll space, where they don't move while scrolling.
+    Vector3 scrollPosition( position );
+    scrollPosition.GetVectorXY() += GetCurrentScrollPosition();
+
+    const Vector3 weights( dirX != None ? 1.0f : 0.0f, dirY != None ? 1.0f : 0.0f, dirZ != None ? 1.0f : 0.0f );
+    return mSpatialIndex->FindClosest( scrollPosition, weights, [dirX, dirY, dirZ]( const Vector3& delta )
+    {
+      // Same direction checks as below.
+      return ( dirX <= All || dirX == ( delta.x > 0 ? Right : Left ) ) &&
+             ( dirY <= All || dirY == ( delta.y > 0 ? Down : Up ) ) &&
+             ( dirZ <= All || dirZ == ( delta.y > 0 ? In : Out ) );
+    } );
+  }
+
   Actor closestChild;
   float closestDistance2 = 0.0f;
   Vector3 actualPosition = position;
@@ -1961,9 +2027,44 @@ void ScrollView::OnSizeSet( const Vector3& size )
     mOvershootIndicator->Reset();
   }
 
+  if( mSpatialIndex )
+  {
+    // The parent origin of the children is relative to the size.
+    Actor self = Self();
+    for( unsigned int i = 0; i < self.GetChildCount(); ++i )
+    {
+      Actor child = self.GetChildAt( i );
+      if( child != mInternalActor )
+      {
+        UpdateSpatialIndex( child );
+      }
+    }
+    UpdateCulling();
+  }
+
   ScrollBase::OnSizeSet( size );
 }
 
+void ScrollView::OnRelayout( const Vector2& size, RelayoutContainer& container )
+{
+  ScrollBase::OnRelayout( size, container );
+
+  if( mCullingXNotification )
+  {
+    std::unordered_map< const BaseObject*, Actor > pendingChildren;
+    pendingChildren.swap( mCullingPendingChildren );
+    for( auto&& pending : pendingChildren )
+    {
+      Actor& child = pending.second;
+      if( child.GetParent() == Self() )
+      {
+        auto iter = std::lower_bound( mCullingVisibleChildren.begin(), mCullingVisibleChildren.end(), child, CompareObjects );
+        SetChildCulled( child, iter == mCullingVisibleChildren.end() || iter->GetObjectPtr() != child.GetObjectPtr() );
+      }
+    }
+  }
+}
+
 void ScrollView::OnChildAdd(Actor& child)
 {
   ScrollBase::OnChildAdd( child );
@@ -2003,10 +2104,20 @@ void ScrollView::OnChildAdd(Actor& child)
   {
     BindActor(child);
   }
+
+  if( mSpatialIndex && !scrollBar && child != mInternalActor )
+  {
+    AddToSpatialIndex( child );
+  }
 }
 
 void ScrollView::OnChildRemove(Actor& child)
 {
+  if( mSpatialIndex )
+  {
+    RemoveFromSpatialIndex( child );
+  }
+
   // TODO: Actor needs a RemoveConstraint method to take out an individual constraint.
   UnbindActor(child);
 
@@ -2920,6 +3031,17 @@ void ScrollView::SetProperty( BaseObject* object, Property::Index index, const P
         {
           scrollViewImpl.SetScrollMode( *map );
         }
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::SPATIAL_INDEX_ENABLED:
+      {
+        scrollViewImpl.SetSpatialIndexEnabled( value.Get<bool>() );
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::VIEWPORT_CULLING_MARGIN:
+      {
+        scrollViewImpl.SetViewportCullingMargin( value.Get<float>() );
+        break;
       }
     }
   }
@@ -2956,6 +3078,16 @@ Property::Value ScrollView::GetProperty( BaseObject* object, Property::Index ind
         value = scrollViewImpl.GetWheelScrollDistanceStep();
         break;
       }
+      case Toolkit::DevelScrollView::Property::SPATIAL_INDEX_ENABLED:
+      {
+        value = static_cast< bool >( scrollViewImpl.mSpatialIndex );
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::VIEWPORT_CULLING_MARGIN:
+      {
+        value = scrollViewImpl.mViewportCullingMargin;
+        break;
+      }
     }
   }
 
@@ -3046,6 +3178,264 @@ void ScrollView::SetScrollMode( const Property::Map& scrollModeMap )
   SetRulerY(rulerY);
 }
 
+void ScrollView::SetSpatialIndexEnabled( bool enabled )
+{
+  if( enabled == static_cast< bool >( mSpatialIndex ) )
+  {
+    return;
+  }
+
+  Actor self = Self();
+  if( enabled )
+  {
+    mSpatialIndex.reset( new ScrollViewSpatialIndex( SPATIAL_INDEX_CELL_SIZE ) );
+    for( unsigned int i = 0; i < self.GetChildCount(); ++i )
+    {
+      Actor child = self.GetChildAt( i );
+      if( child != mInternalActor )
+      {
+        AddToSpatialIndex( child );
+      }
+    }
+    SetCullingNotification( mViewportCullingMargin >= 0.0f );
+  }
+  else
+  {
+    SetCullingNotification( false );
+    for( unsigned int i = 0; i < self.GetChildCount(); ++i )
+    {
+      Actor child = self.GetChildAt( i );
+      if( child != mInternalActor )
+      {
+        RemoveFromSpatialIndex( child );
+      }
+    }
+    mSpatialIndex.reset();
+  }
+}
+
+void ScrollView::SetViewportCullingMargin( float margin )
+{
+  mViewportCullingMargin = margin;
+  SetCullingNotification( mSpatialIndex && mViewportCullingMargin >= 0.0f );
+}
+
+void ScrollView::AddToSpatialIndex( Actor child )
+{
+  DevelHandle::PropertySetSignal( child ).Connect( this, &ScrollView::OnChildPropertySet );
+  child.OnRelayoutSignal().Connect( this, &ScrollView::OnChildRelayout );
+  UpdateSpatialIndex( child );
+  RequestCullingUpdate();
+}
+
+void ScrollView::RemoveFromSpatialIndex( Actor child )
+{
+  DevelHandle::PropertySetSignal( child ).Disconnect( this, &ScrollView::OnChildPropertySet );
+  child.OnRelayoutSignal().Disconnect( this, &ScrollView::OnChildRelayout );
+  mSpatialIndex->Remove( child );
+  mCullingPendingChildren.erase( child.GetObjectPtr() );
+
+  auto iter = std::lower_bound( mCullingVisibleChildren.begin(), mCullingVisibleChildren.end(), child, CompareObjects );
+  if( iter != mCullingVisibleChildren.end() && iter->GetObjectPtr() == child.GetObjectPtr() )
+  {
+    mCullingVisibleChildren.erase( iter );
+  }
+  SetChildCulled( child, false );
+}
+
+void ScrollView::UpdateSpatialIndex( Actor child )
+{
+  // The bounds are in scroll space, i.e. where the children are laid out before the scroll position
+  // is applied, so they only change when the children are moved or resized.
+  const Vector3 viewSize = Self().GetProperty< Vector3 >( Actor::Property::SIZE );
+  const Vector3 parentOrigin = child.GetProperty< Vector3 >( Actor::Property::PARENT_ORIGIN );
+  const Vector3 anchorPoint = child.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT );
+  const Vector3 position = child.GetProperty< Vector3 >( Actor::Property::POSITION );
+  const Vector3 size = child.GetProperty< Vector3 >( Actor::Property::SIZE );
+
+  const Vector3 topLeft = parentOrigin * viewSize + position - anchorPoint * size;
+  const Rect< float > bounds( topLeft.x, topLeft.y, size.width, size.height );
+
+  // Same center as GetPositionOfAnchor(), which FindClosestActorToPosition() measures from.
+  const Vector3 center = position + ( AnchorPoint::CENTER - anchorPoint ) * size;
+  mSpatialIndex->Set( child, bounds, center );
+
+  if( mCullingXNotification )
+  {
+    const bool inside = bounds.x <= mCullingRegion.x + mCullingRegion.width && mCullingRegion.x <= bounds.x + bounds.width &&
+                        bounds.y <= mCullingRegion.y + mCullingRegion.height && mCullingRegion.y <= bounds.y + bounds.height;
+
+    auto iter = std::lower_bound( mCullingVisibleChildren.begin(), mCullingVisibleChildren.end(), child, CompareObjects );
+    const bool listed = iter != mCullingVisibleChildren.end() && iter->GetObjectPtr() == child.GetObjectPtr();
+    if( inside && !listed )
+    {
+      mCullingVisibleChildren.insert( iter, child );
+    }
+    else if( !inside && listed )
+    {
+      mCullingVisibleChildren.erase( iter );
+    }
+
+    // The visibility can't be changed while the child is emitting its property set signal, so it's
+    // updated by the next relayout. A child is only recorded once, however often it changes.
+    mCullingPendingChildren[ child.GetObjectPtr() ] = child;
+  }
+}
+
+void ScrollView::RequestCullingUpdate()
+{
+  if( !mCullingPendingChildren.empty() )
+  {
+    RelayoutRequest();
+  }
+}
+
+void ScrollView::OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value )
+{
+  if( index == Actor::Property::VISIBLE )
+  {
+    // The application takes back the visibility of a culled child.
+    mCulledChildren.erase( handle.GetObjectPtr() );
+  }
+  else if( mSpatialIndex && IsBoundsProperty( index ) )
+  {
+    UpdateSpatialIndex( Actor::DownCast( handle ) );
+    RequestCullingUpdate();
+  }
+}
+
+void ScrollView::OnChildRelayout( Actor child )
+{
+  if( mSpatialIndex )
+  {
+    // Requesting a relayout while relaying out would relayout every frame, so the visibility of the
+    // child is updated by the next relayout, whatever causes it.
+    UpdateSpatialIndex( child );
+  }
+}
+
+void ScrollView::SetCullingNotification( bool enabled )
+{
+  Actor self = Self();
+  if( mCullingXNotification )
+  {
+    // disconnect now to avoid a notification before removed from update thread
+    mCullingXNotification.NotifySignal().Disconnect( this, &ScrollView::OnCullingNotification );
+    self.RemovePropertyNotification( mCullingXNotification );
+    mCullingXNotification.Reset();
+
+    mCullingYNotification.NotifySignal().Disconnect( this, &ScrollView::OnCullingNotification );
+    self.RemovePropertyNotification( mCullingYNotification );
+    mCullingYNotification.Reset();
+  }
+
+  if( enabled )
+  {
+    // The region is grown by a step, so the children entering the scroll view are shown before
+    // the scroll position moved enough to update the culling.
+    const float step = std::max( mViewportCullingMargin * 0.5f, MINIMUM_CULLING_STEP );
+    mCullingXNotification = self.AddPropertyNotification( Toolkit::ScrollView::Property::SCROLL_POSITION, 0, StepCondition( step, 0.0f ) );
+    mCullingXNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+    mCullingYNotification = self.AddPropertyNotification( Toolkit::ScrollView::Property::SCROLL_POSITION, 1, StepCondition( step, 0.0f ) );
+    mCullingYNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+
+    // All the children which aren't culled yet are checked by the first update.
+    mCullingVisibleChildren.clear();
+    for( unsigned int i = 0; i < self.GetChildCount(); ++i )
+    {
+      Actor child = self.GetChildAt( i );
+      if( child != mInternalActor && mCulledChildren.find( child.GetObjectPtr() ) == mCulledChildren.end() )
+      {
+        mCullingVisibleChildren.push_back( child );
+      }
+    }
+    std::sort( mCullingVisibleChildren.begin(), mCullingVisibleChildren.end(), CompareObjects );
+    UpdateCulling();
+  }
+  else
+  {
+    // Showing a child removes it from the culled children.
+    std::unordered_map< const BaseObject*, Actor > culledChildren;
+    culledChildren.swap( mCulledChildren );
+    for( auto&& culled : culledChildren )
+    {
+      culled.second.SetProperty( Actor::Property::VISIBLE, true );
+    }
+    mCullingVisibleChildren.clear();
+    mCullingPendingChildren.clear();
+  }
+}
+
+void ScrollView::OnCullingNotification( Dali::PropertyNotification& source )
+{
+  // Guard against destruction during signal emission
+  Toolkit::ScrollView handle( GetOwner() );
+
+  UpdateCulling();
+}
+
+void ScrollView::UpdateCulling()
+{
+  if( !mCullingXNotification )
+  {
+    return;
+  }
+
+  const Vector3 size = Self().GetProperty< Vector3 >( Actor::Property::SIZE );
+  const Vector2 scrollPosition = GetCurrentScrollPosition();
+  const float margin = mViewportCullingMargin + std::max( mViewportCullingMargin * 0.5f, MINIMUM_CULLING_STEP );
+  mCullingRegion = Rect< float >( scrollPosition.x - margin, scrollPosition.y - margin, size.width + margin * 2.0f, size.height + margin * 2.0f );
+
+  std::vector< Actor > visibleChildren;
+  mSpatialIndex->FindInRegion( mCullingRegion, visibleChildren );
+  std::sort( visibleChildren.begin(), visibleChildren.end(), CompareObjects );
+
+  // Both lists are sorted, so the children which left or entered the region are found in one pass.
+  auto previous = mCullingVisibleChildren.begin();
+  auto current = visibleChildren.begin();
+  while( previous != mCullingVisibleChildren.end() || current != visibleChildren.end() )
+  {
+    if( current == visibleChildren.end() || ( previous != mCullingVisibleChildren.end() && CompareObjects( *previous, *current ) ) )
+    {
+      SetChildCulled( *previous, true );
+      ++previous;
+    }
+    else if( previous == mCullingVisibleChildren.end() || CompareObjects( *current, *previous ) )
+    {
+      SetChildCulled( *current, false );
+      ++current;
+    }
+    else
+    {
+      ++previous;
+      ++current;
+    }
+  }
+  mCullingVisibleChildren.swap( visibleChildren );
+}
+
+void ScrollView::SetChildCulled( Actor child, bool culled )
+{
+  if( culled )
+  {
+    // Recorded after being hidden, as the application setting the visibility takes the child back.
+    if( child.GetProperty< bool >( Actor::Property::VISIBLE ) )
+    {
+      child.SetProperty( Actor::Property::VISIBLE, false );
+      mCulledChildren[ child.GetObjectPtr() ] = child;
+    }
+  }
+  else
+  {
+    auto iter = mCulledChildren.find( child.GetObjectPtr() );
+    if( iter != mCulledChildren.end() )
+    {
+      mCulledChildren.erase( iter );
+      child.SetProperty( Actor::Property::VISIBLE, true );
+    }
+  }
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
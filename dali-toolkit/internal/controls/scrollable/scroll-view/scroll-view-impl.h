@@ -19,6 +19,9 @@
  */
 
 // EXTERNAL INCLUDES
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/animation/animation.h>
 #include <dali/public-api/object/property-notification.h>
@@ -28,6 +31,7 @@
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
 #include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-base-impl.h>
+#include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-view-spatial-index.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view-effect.h>
 
@@ -553,6 +557,11 @@ private: // private overridden functions from CustomActorImpl and Controls
    */
   void OnSizeSet( const Vector3& size ) override;
 
+  /**
+   * @copydoc CustomActorImpl::OnRelayout()
+   */
+  void OnRelayout( const Vector2& size, RelayoutContainer& container ) override;
+
   /**
    * From CustomActorImpl; called after a child has been added to the owning actor.
    * @param[in] child The child which has been added.
@@ -867,6 +876,74 @@ private:
    */
   void SetScrollMode( const Property::Map& scrollModeMap );
 
+  /**
+   * Enables or disables the spatial index of the children.
+   * @param[in] enabled Whether the bounds of the children are kept in a grid.
+   */
+  void SetSpatialIndexEnabled( bool enabled );
+
+  /**
+   * Sets the margin outside the scroll view beyond which the children are made invisible.
+   * @param[in] margin The margin in pixels, or a negative value to disable the culling.
+   */
+  void SetViewportCullingMargin( float margin );
+
+  /**
+   * Adds a child to the spatial index and tracks the changes of its bounds.
+   * @param[in] child The child.
+   */
+  void AddToSpatialIndex( Actor child );
+
+  /**
+   * Removes a child from the spatial index, restoring its visibility if it was culled.
+   * @param[in] child The child.
+   */
+  void RemoveFromSpatialIndex( Actor child );
+
+  /**
+   * Updates the bounds of a child in the spatial index and, if culling, records it to have its visibility updated by the next relayout.
+   * @param[in] child The child.
+   */
+  void UpdateSpatialIndex( Actor child );
+
+  /**
+   * Requests a relayout if the visibility of some children is to be updated.
+   */
+  void RequestCullingUpdate();
+
+  /**
+   * Called when a property of a child is set, to track the changes of its bounds.
+   */
+  void OnChildPropertySet( Handle& handle, Property::Index index, Property::Value value );
+
+  /**
+   * Called when a child is relaid out, to track the changes of its size.
+   */
+  void OnChildRelayout( Actor child );
+
+  /**
+   * Starts or stops the culling, with the property notifications updating it while scrolling.
+   * @param[in] enabled Whether the children outside the culling region are hidden.
+   */
+  void SetCullingNotification( bool enabled );
+
+  /**
+   * Called when the scroll position moved by a culling step.
+   */
+  void OnCullingNotification( Dali::PropertyNotification& source );
+
+  /**
+   * Hides the children which left the culling region and shows the children which entered it.
+   */
+  void UpdateCulling();
+
+  /**
+   * Shows or hides a child for the culling, leaving the children hidden by the application alone.
+   * @param[in] child The child.
+   * @param[in] culled Whether the child is outside the culling region.
+   */
+  void SetChildCulled( Actor child, bool culled );
+
 private:
 
   // Undefined
@@ -951,6 +1028,15 @@ private:
 
   Toolkit::ScrollView::SnapStartedSignalType mSnapStartedSignal;
 
+  std::unique_ptr< ScrollViewSpatialIndex > mSpatialIndex;                ///< The bounds of the children in scroll space, when enabled
+  std::vector< Actor > mCullingVisibleChildren;                           ///< The children within the culling region, sorted by object
+  std::unordered_map< const BaseObject*, Actor > mCulledChildren;         ///< The children hidden by the culling
+  std::unordered_map< const BaseObject*, Actor > mCullingPendingChildren; ///< The children whose visibility is updated by the next relayout
+  Rect< float > mCullingRegion;                                           ///< The region in scroll space the children are shown in
+  float mViewportCullingMargin;                                           ///< The margin outside the scroll view, negative if not culling
+  Dali::PropertyNotification mCullingXNotification;                       ///< scroll x position culling notification
+  Dali::PropertyNotification mCullingYNotification;                       ///< scroll y position culling notification
+
   bool mInAccessibilityPan:1;             ///< With AccessibilityPan its easier to move between snap positions
   bool mScrolling:1;                      ///< Flag indicating whether the scroll view is being scrolled (by user or animation)
   bool mScrollInterrupted:1;              ///< Flag set for when a down event interrupts a scroll
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/scrollable/scroll-view/scroll-view-spatial-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t INVALID_ENTRY_ID = std::numeric_limits< uint32_t >::max();
+const uint32_t MAXIMUM_CELLS_PER_CHILD = 64u;  ///< The children overlapping more cells are checked by every query instead.
+const float MAXIMUM_CELL_COORDINATE = 1.0e9f;  ///< Keeps the cells of far away children within 32 bits.
+
+/**
+ * @brief Removes an entry from a list, without keeping the order.
+ */
+void EraseId( std::vector< uint32_t >& ids, uint32_t entryId )
+{
+  auto iter = std::find( ids.begin(), ids.end(), entryId );
+  if( iter != ids.end() )
+  {
+    *iter = ids.back();
+    ids.pop_back();
+  }
+}
+
+/**
+ * @brief Whether two rectangles touch or overlap, so the children without a size are found too.
+ */
+bool Overlaps( const Rect< float >& a, const Rect< float >& b )
+{
+  return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+         a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+} // unnamed namespace
+
+ScrollViewSpatialIndex::ScrollViewSpatialIndex( float cellSize )
+: mEntries(),
+  mFreeIds(),
+  mEntryIds(),
+  mCells(),
+  mCenterCells(),
+  mOversized(),
+  mExtent(),
+  mCenterExtent(),
+  mCellSize( std::max( cellSize, 1.0f ) ),
+  mQueryStamp( 0u )
+{
+  Clear();
+}
+
+void ScrollViewSpatialIndex::Set( Actor actor, const Rect< float >& bounds, const Vector3& center )
+{
+  uint32_t entryId;
+  auto iter = mEntryIds.find( actor.GetObjectPtr() );
+  if( iter != mEntryIds.end() )
+  {
+    entryId = iter->second;
+    Entry& entry = mEntries[ entryId ];
+
+    // Moving within the same cells doesn't change the grid.
+    const CellRange cells = GetCells( bounds );
+    if( entry.cells.minX == cells.minX && entry.cells.minY == cells.minY &&
+        entry.cells.maxX == cells.maxX && entry.cells.maxY == cells.maxY &&
+        entry.centerX == GetCell( center.x ) && entry.centerY == GetCell( center.y ) )
+    {
+      entry.bounds = bounds;
+      entry.center = center;
+      return;
+    }
+    Erase( entryId );
+  }
+  else
+  {
+    if( !mFreeIds.empty() )
+    {
+      entryId = mFreeIds.back();
+      mFreeIds.pop_back();
+    }
+    else
+    {
+      entryId = mEntries.size();
+      mEntries.push_back( Entry() );
+    }
+    mEntryIds[ actor.GetObjectPtr() ] = entryId;
+  }
+
+  Entry& entry = mEntries[ entryId ];
+  entry.actor = actor;
+  entry.bounds = bounds;
+  entry.center = center;
+  entry.queryStamp = mQueryStamp;
+  Insert( entryId );
+}
+
+void ScrollViewSpatialIndex::Remove( Actor actor )
+{
+  auto iter = mEntryIds.find( actor.GetObjectPtr() );
+  if( iter != mEntryIds.end() )
+  {
+    const uint32_t entryId = iter->second;
+    Erase( entryId );
+    mEntries[ entryId ].actor.Reset();
+    mFreeIds.push_back( entryId );
+    mEntryIds.erase( iter );
+  }
+}
+
+void ScrollViewSpatialIndex::Clear()
+{
+  mEntries.clear();
+  mFreeIds.clear();
+  mEntryIds.clear();
+  mCells.clear();
+  mCenterCells.clear();
+  mOversized.clear();
+
+  // An empty range, which is replaced by the first cells included.
+  mExtent.minX = mExtent.minY = 0;
+  mExtent.maxX = mExtent.maxY = -1;
+  mCenterExtent = mExtent;
+}
+
+uint32_t ScrollViewSpatialIndex::GetCount() const
+{
+  return mEntryIds.size();
+}
+
+Actor ScrollViewSpatialIndex::FindClosest( const Vector3& position, const Vector3& weights, const Filter& filter ) const
+{
+  uint32_t closestId = INVALID_ENTRY_ID;
+  float closestDistance2 = 0.0f;
+
+  if( weights.x <= 0.0f || weights.y <= 0.0f )
+  {
+    // The cells don't bound the distance along a single axis, all the children are checked.
+    for( uint32_t entryId = 0u; entryId < mEntries.size(); ++entryId )
+    {
+      if( mEntries[ entryId ].actor )
+      {
+        CheckClosest( entryId, position, weights, filter, closestId, closestDistance2 );
+      }
+    }
+  }
+  else if( mCenterExtent.minX <= mCenterExtent.maxX )
+  {
+    // Visit the rings of cells around the position, from the first one reaching the centers, until
+    // they can't hold a closer child or they cover all the centers.
+    const int32_t cellX = GetCell( position.x );
+    const int32_t cellY = GetCell( position.y );
+    const int32_t firstRing = std::max( std::max( mCenterExtent.minX - cellX, cellX - mCenterExtent.maxX ),
+                                        std::max( mCenterExtent.minY - cellY, cellY - mCenterExtent.maxY ) );
+    const int32_t lastRing = std::max( std::max( cellX - mCenterExtent.minX, mCenterExtent.maxX - cellX ),
+                                       std::max( cellY - mCenterExtent.minY, mCenterExtent.maxY - cellY ) );
+
+    for( int32_t ring = std::max( firstRing, 0 ); ring <= lastRing; ++ring )
+    {
+      // The centers within this ring are at least ring - 1 cells away.
+      const float minimumDistance = static_cast< float >( ring - 1 ) * mCellSize;
+      if( closestId != INVALID_ENTRY_ID && minimumDistance > 0.0f && minimumDistance * minimumDistance >= closestDistance2 )
+      {
+        break;
+      }
+
+      const int32_t startY = std::max( cellY - ring, mCenterExtent.minY );
+      const int32_t endY = std::min( cellY + ring, mCenterExtent.maxY );
+      for( int32_t y = startY; y <= endY; ++y )
+      {
+        // Only the first and last cells of the inner rows are on the ring.
+        const bool fullRow = ( y == cellY - ring || y == cellY + ring );
+        const int32_t step = fullRow ? 1 : std::max( ring * 2, 1 );
+        for( int32_t x = cellX - ring; x <= cellX + ring; x += step )
+        {
+          if( x < mCenterExtent.minX || x > mCenterExtent.maxX )
+          {
+            continue;
+          }
+
+          auto cell = mCenterCells.find( GetCellKey( x, y ) );
+          if( cell != mCenterCells.end() )
+          {
+            for( auto&& entryId : cell->second )
+            {
+              CheckClosest( entryId, position, weights, filter, closestId, closestDistance2 );
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return closestId != INVALID_ENTRY_ID ? mEntries[ closestId ].actor : Actor();
+}
+
+void ScrollViewSpatialIndex::FindInRegion( const Rect< float >& region, std::vector< Actor >& actors ) const
+{
+  ++mQueryStamp;
+
+  for( auto&& entryId : mOversized )
+  {
+    if( Overlaps( mEntries[ entryId ].bounds, region ) )
+    {
+      actors.push_back( mEntries[ entryId ].actor );
+    }
+  }
+
+  const CellRange cells = GetCells( region );
+  const int32_t startX = std::max( cells.minX, mExtent.minX );
+  const int32_t endX = std::min( cells.maxX, mExtent.maxX );
+  const int32_t startY = std::max( cells.minY, mExtent.minY );
+  const int32_t endY = std::min( cells.maxY, mExtent.maxY );
+  for( int32_t y = startY; y <= endY; ++y )
+  {
+    for( int32_t x = startX; x <= endX; ++x )
+    {
+      auto cell = mCells.find( GetCellKey( x, y ) );
+      if( cell != mCells.end() )
+      {
+        for( auto&& entryId : cell->second )
+        {
+          const Entry& entry = mEntries[ entryId ];
+          if( entry.queryStamp != mQueryStamp )
+          {
+            entry.queryStamp = mQueryStamp;
+            if( Overlaps( entry.bounds, region ) )
+            {
+              actors.push_back( entry.actor );
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void ScrollViewSpatialIndex::Insert( uint32_t entryId )
+{
+  Entry& entry = mEntries[ entryId ];
+  entry.cells = GetCells( entry.bounds );
+  entry.centerX = GetCell( entry.center.x );
+  entry.centerY = GetCell( entry.center.y );
+
+  mCenterCells[ GetCellKey( entry.centerX, entry.centerY ) ].push_back( entryId );
+  const CellRange centerCells = { entry.centerX, entry.centerY, entry.centerX, entry.centerY };
+  Include( mCenterExtent, centerCells );
+
+  const uint64_t cellCount = static_cast< uint64_t >( entry.cells.maxX - entry.cells.minX + 1 ) *
+                             static_cast< uint64_t >( entry.cells.maxY - entry.cells.minY + 1 );
+  entry.oversized = cellCount > MAXIMUM_CELLS_PER_CHILD;
+  if( entry.oversized )
+  {
+    mOversized.push_back( entryId );
+    return;
+  }
+
+  for( int32_t y = entry.cells.minY; y <= entry.cells.maxY; ++y )
+  {
+    for( int32_t x = entry.cells.minX; x <= entry.cells.maxX; ++x )
+    {
+      mCells[ GetCellKey( x, y ) ].push_back( entryId );
+    }
+  }
+  Include( mExtent, entry.cells );
+}
+
+void ScrollViewSpatialIndex::Erase( uint32_t entryId )
+{
+  const Entry& entry = mEntries[ entryId ];
+
+  auto centerCell = mCenterCells.find( GetCellKey( entry.centerX, entry.centerY ) );
+  if( centerCell != mCenterCells.end() )
+  {
+    EraseId( centerCell->second, entryId );
+    if( centerCell->second.empty() )
+    {
+      mCenterCells.erase( centerCell );
+    }
+  }
+
+  if( entry.oversized )
+  {
+    EraseId( mOversized, entryId );
+    return;
+  }
+
+  for( int32_t y = entry.cells.minY; y <= entry.cells.maxY; ++y )
+  {
+    for( int32_t x = entry.cells.minX; x <= entry.cells.maxX; ++x )
+    {
+      auto cell = mCells.find( GetCellKey( x, y ) );
+      if( cell != mCells.end() )
+      {
+        EraseId( cell->second, entryId );
+        if( cell->second.empty() )
+        {
+          mCells.erase( cell );
+        }
+      }
+    }
+  }
+}
+
+int32_t ScrollViewSpatialIndex::GetCell( float coordinate ) const
+{
+  const float clamped = std::min( std::max( coordinate, -MAXIMUM_CELL_COORDINATE ), MAXIMUM_CELL_COORDINATE );
+  return static_cast< int32_t >( std::floor( clamped / mCellSize ) );
+}
+
+ScrollViewSpatialIndex::CellRange ScrollViewSpatialIndex::GetCells( const Rect< float >& rect ) const
+{
+  const CellRange cells = { GetCell( rect.x ), GetCell( rect.y ), GetCell( rect.x + rect.width ), GetCell( rect.y + rect.height ) };
+  return cells;
+}
+
+int64_t ScrollViewSpatialIndex::GetCellKey( int32_t cellX, int32_t cellY )
+{
+  return ( static_cast< int64_t >( cellX ) << 32 ) | static_cast< uint32_t >( cellY );
+}
+
+void ScrollViewSpatialIndex::Include( CellRange& extent, const CellRange& cells )
+{
+  if( extent.maxX < extent.minX )
+  {
+    extent = cells;
+  }
+  else
+  {
+    extent.minX = std::min( extent.minX, cells.minX );
+    extent.minY = std::min( extent.minY, cells.minY );
+    extent.maxX = std::max( extent.maxX, cells.maxX );
+    extent.maxY = std::max( extent.maxY, cells.maxY );
+  }
+}
+
+void ScrollViewSpatialIndex::CheckClosest( uint32_t entryId, const Vector3& position, const Vector3& weights, const Filter& filter,
+                                           uint32_t& closestId, float& closestDistance2 ) const
+{
+  const Entry& entry = mEntries[ entryId ];
+  const Vector3 delta = entry.center - position;
+  if( filter && !filter( delta ) )
+  {
+    return;
+  }
+
+  const float distance2 = weights.x * delta.x * delta.x + weights.y * delta.y * delta.y + weights.z * delta.z * delta.z;
+  if( closestId == INVALID_ENTRY_ID || distance2 < closestDistance2 )
+  {
+    closestId = entryId;
+    closestDistance2 = distance2;
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,201 @@
+#ifndef DALI_TOOLKIT_INTERNAL_SCROLL_VIEW_SPATIAL_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_SCROLL_VIEW_SPATIAL_INDEX_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/math/vector3.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief A uniform grid of the bounds of the children of a scroll view, in scroll space.
+ *
+ * Each child is registered in the cells its bounds overlap and in the cell of its center, so the
+ * children within a region or closest to a position are found by visiting the cells around it
+ * instead of every child. The bounds bigger than a few screens are kept aside and checked by every
+ * region query.
+ */
+class ScrollViewSpatialIndex
+{
+public:
+
+  /**
+   * @brief Whether a child may be found, given the offset of its center from the searched position.
+   */
+  typedef std::function< bool( const Vector3& ) > Filter;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] cellSize The width and height of the cells of the grid.
+   */
+  explicit ScrollViewSpatialIndex( float cellSize );
+
+  /**
+   * @brief Adds a child or updates its bounds.
+   *
+   * @param[in] actor The child.
+   * @param[in] bounds The bounds of the child.
+   * @param[in] center The center of the child, including its depth.
+   */
+  void Set( Actor actor, const Rect< float >& bounds, const Vector3& center );
+
+  /**
+   * @brief Removes a child.
+   *
+   * @param[in] actor The child.
+   */
+  void Remove( Actor actor );
+
+  /**
+   * @brief Removes all the children.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the number of children.
+   *
+   * @return The number of children.
+   */
+  uint32_t GetCount() const;
+
+  /**
+   * @brief Finds the child whose center is the closest to a position.
+   *
+   * @param[in] position The position.
+   * @param[in] weights The weight of each axis in the distance, either 1 or 0 to ignore the axis.
+   * @param[in] filter Whether a child may be found.
+   * @return The closest child or an empty handle.
+   */
+  Actor FindClosest( const Vector3& position, const Vector3& weights, const Filter& filter ) const;
+
+  /**
+   * @brief Finds the children whose bounds intersect a region.
+   *
+   * @param[in] region The region.
+   * @param[out] actors The children found, added once each.
+   */
+  void FindInRegion( const Rect< float >& region, std::vector< Actor >& actors ) const;
+
+private:
+
+  /**
+   * @brief A range of cells, inclusive.
+   */
+  struct CellRange
+  {
+    int32_t minX;
+    int32_t minY;
+    int32_t maxX;
+    int32_t maxY;
+  };
+
+  /**
+   * @brief A child and the cells it is registered in.
+   */
+  struct Entry
+  {
+    Actor            actor;
+    Rect< float >    bounds;
+    Vector3          center;
+    CellRange        cells;      ///< The cells the bounds overlap
+    int32_t          centerX;    ///< The cell of the center
+    int32_t          centerY;
+    bool             oversized;  ///< Whether the bounds are kept aside instead of in the cells
+    mutable uint32_t queryStamp; ///< The last region query which visited the child
+  };
+
+  typedef std::vector< uint32_t > EntryIdList;
+  typedef std::unordered_map< int64_t, EntryIdList > CellContainer;
+
+  /**
+   * @brief Adds an entry to the cells of its bounds and center.
+   */
+  void Insert( uint32_t entryId );
+
+  /**
+   * @brief Removes an entry from the cells it was added to.
+   */
+  void Erase( uint32_t entryId );
+
+  /**
+   * @brief Retrieves the cell of a coordinate.
+   */
+  int32_t GetCell( float coordinate ) const;
+
+  /**
+   * @brief Retrieves the cells overlapped by a rectangle.
+   */
+  CellRange GetCells( const Rect< float >& rect ) const;
+
+  /**
+   * @brief Retrieves the key of a cell in the grid.
+   */
+  static int64_t GetCellKey( int32_t cellX, int32_t cellY );
+
+  /**
+   * @brief Grows a range of cells to include another one.
+   */
+  static void Include( CellRange& extent, const CellRange& cells );
+
+  /**
+   * @brief Adds the distance of a child to the search if it's closer.
+   */
+  void CheckClosest( uint32_t entryId, const Vector3& position, const Vector3& weights, const Filter& filter,
+                     uint32_t& closestId, float& closestDistance2 ) const;
+
+  // Undefined
+  ScrollViewSpatialIndex( const ScrollViewSpatialIndex& );
+
+  // Undefined
+  ScrollViewSpatialIndex& operator=( const ScrollViewSpatialIndex& );
+
+private:
+
+  std::vector< Entry >                              mEntries;      ///< The children, whose removed slots are reused
+  EntryIdList                                       mFreeIds;      ///< The removed slots of mEntries
+  std::unordered_map< const BaseObject*, uint32_t > mEntryIds;     ///< The slot of each child
+  CellContainer                                     mCells;        ///< The children whose bounds overlap each cell
+  CellContainer                                     mCenterCells;  ///< The children whose center is in each cell
+  EntryIdList                                       mOversized;    ///< The children whose bounds overlap too many cells
+  CellRange                                         mExtent;       ///< The cells of all the bounds so far
+  CellRange                                         mCenterExtent; ///< The cells of all the centers so far
+  float                                             mCellSize;     ///< The width and height of the cells
+  mutable uint32_t                                  mQueryStamp;   ///< Incremented by every region query
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_SCROLL_VIEW_SPATIAL_INDEX_H
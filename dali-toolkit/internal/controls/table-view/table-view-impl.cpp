@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/controls/table-view/table-view-impl.h>
 
 // EXTERNAL INCLUDES
+#include <limits>
 #include <sstream>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/object/type-registry.h>
@@ -167,6 +168,8 @@ const Scripting::StringEnum VERTICAL_ALIGNMENT_STRING_TABLE[] =
 };
 const unsigned int VERTICAL_ALIGNMENT_STRING_TABLE_COUNT = sizeof(VERTICAL_ALIGNMENT_STRING_TABLE) / sizeof( VERTICAL_ALIGNMENT_STRING_TABLE[0] );
 
+const unsigned int NO_DIRTY_INDEX = std::numeric_limits< unsigned int >::max(); ///< No row or column position needs recalculating
+
 } // Unnamed namespace
 
 Toolkit::TableView TableView::New( unsigned int initialRows, unsigned int initialColumns )
@@ -233,6 +236,7 @@ bool TableView::AddChild( Actor& child, const Toolkit::TableView::CellPosition&
   data.actor = child;
   data.position = position;
 
+  bool overwritten = false;
   for( unsigned int row = position.rowIndex; row < ( position.rowIndex + position.rowSpan ); ++row )
   {
     // store same information to all cells, this way we can identify
@@ -241,20 +245,27 @@ bool TableView::AddChild( Actor& child, const Toolkit::TableView::CellPosition&
     {
       // store same information to all cells, this way we can identify
       // if a cell is the prime location of an actor or a spanned one
-      mCellData[ row ][ column ] = data;
+      CellData& cellData = mCellData[ row ][ column ];
+      overwritten = overwritten || ( cellData.actor && cellData.actor != child );
+      cellData = data;
     }
   }
 
-  // Relayout the whole table
-  if( mRowData[position.rowIndex].sizePolicy == Toolkit::TableView::FIT && position.rowSpan == 1 )
+  if( overwritten )
   {
-    mRowDirty = true;
+    // the spanned cells of another actor were taken, its first cell may have moved
+    UpdateChildIndex();
   }
-  if( mColumnData[position.columnIndex].sizePolicy == Toolkit::TableView::FIT && position.columnSpan == 1 )
+  else if( ( position.rowSpan > 0 ) && ( position.columnSpan > 0 ) )
   {
-    mColumnDirty = true;
+    CellIndex& cellIndex = mChildIndex[ child.GetObjectPtr() ];
+    cellIndex.row = position.rowIndex;
+    cellIndex.column = position.columnIndex;
   }
 
+  // Relayout the rows and columns of the child
+  SetFitDirty( position );
+
   RelayoutRequest();
 
   return true;    // Addition successful
@@ -285,14 +296,6 @@ Actor TableView::RemoveChildAt( const Toolkit::TableView::CellPosition& position
     // relayout the table only if instances were found
     if( RemoveAllInstances( child ) )
     {
-      if( mRowData[position.rowIndex].sizePolicy == Toolkit::TableView::FIT )
-      {
-        mRowDirty = true;
-      }
-      if( mColumnData[position.columnIndex].sizePolicy == Toolkit::TableView::FIT )
-      {
-        mColumnDirty = true;
-      }
       RelayoutRequest();
     }
   }
@@ -305,20 +308,11 @@ bool TableView::FindChildPosition( const Actor& child, Toolkit::TableView::CellP
   // Only find valid child actors
   if( child )
   {
-    // Walk through the layout data
-    const unsigned int rowCount = mCellData.GetRows();
-    const unsigned int columnCount = mCellData.GetColumns();
-
-    for( unsigned int row = 0; row < rowCount; ++row )
+    ChildIndex::const_iterator iter = mChildIndex.find( child.GetObjectPtr() );
+    if( iter != mChildIndex.end() )
     {
-      for( unsigned int column = 0; column < columnCount; ++column )
-      {
-        if( mCellData[ row ][ column ].actor == child )
-        {
-          positionOut = mCellData[ row ][ column ].position;
-          return true;
-        }
-      }
+      positionOut = mCellData[ iter->second.row ][ iter->second.column ].position;
+      return true;
     }
   }
 
@@ -359,11 +353,13 @@ void TableView::InsertRow( unsigned int rowIndex )
     }
   }
 
+  UpdateChildIndex();
+
   // Expand row data array
   mRowData.Insert( mRowData.Begin() + rowIndex, RowColumnData() );
 
-  // Sizes may have changed, so relayout
-  mRowDirty = true;
+  // Sizes may have changed, so relayout from the new row
+  SetDirty( Dimension::HEIGHT, rowIndex );
   RelayoutRequest();
 }
 
@@ -412,16 +408,18 @@ void TableView::DeleteRow( unsigned int rowIndex, std::vector<Actor>& removed )
     }
   }
 
+  UpdateChildIndex();
+
   // 1 row removed, 0 columns
   RemoveAndGetLostActors( lost, removed, 1u, 0u );
 
   // Contract row data array
   mRowData.Erase( mRowData.Begin() + rowIndex );
 
-  // Sizes may have changed, so relayout
-  mRowDirty = true;
+  // Sizes may have changed, so relayout from the deleted row
+  SetDirty( Dimension::HEIGHT, rowIndex );
   // it is possible that the deletion of row leads to remove of child which might further lead to the change of FIT column
-  mColumnDirty = true;
+  SetAllFitDirty();
 
   RelayoutRequest();
 }
@@ -461,11 +459,13 @@ void TableView::InsertColumn( unsigned int columnIndex )
     }
   }
 
+  UpdateChildIndex();
+
   // Expand column data array
   mColumnData.Insert( mColumnData.Begin() + columnIndex, RowColumnData() );
 
-  // Sizes may have changed so relayout
-  mColumnDirty = true;
+  // Sizes may have changed so relayout from the new column
+  SetDirty( Dimension::WIDTH, columnIndex );
   RelayoutRequest();
 }
 
@@ -514,16 +514,18 @@ void TableView::DeleteColumn( unsigned int columnIndex, std::vector<Actor>& remo
     }
   }
 
+  UpdateChildIndex();
+
   // 0 rows, 1 column removed
   RemoveAndGetLostActors( lost, removed, 0u, 1u );
 
   // Contract column data array
   mColumnData.Erase( mColumnData.Begin() + columnIndex );
 
-  // Size may have changed so relayout
-  mColumnDirty = true;
+  // Size may have changed so relayout from the deleted column
+  SetDirty( Dimension::WIDTH, columnIndex );
   // it is possible that the deletion of column leads to remove of child which might further lead to the change of FIT row
-  mRowDirty = true;
+  SetAllFitDirty();
 
   RelayoutRequest();
 }
@@ -562,11 +564,12 @@ void TableView::Resize( unsigned int rows, unsigned int columns, std::vector<Act
     rowsRemoved = newColumns - oldColumns;
   }
 
+  UpdateChildIndex();
+
   RemoveAndGetLostActors( lost, removed, rowsRemoved, columnsRemoved );
 
-  // Sizes may have changed so request a relayout
-  mRowDirty = true;
-  mColumnDirty = true;
+  // Sizes may have changed so request a relayout, the new rows and columns were marked when resizing the containers
+  SetAllFitDirty();
   RelayoutRequest();
 }
 
@@ -594,7 +597,7 @@ void TableView::SetFitHeight( unsigned int rowIndex )
   {
     mRowData[ rowIndex ].sizePolicy = Toolkit::TableView::FIT;
 
-    mRowDirty = true;
+    SetDirty( Dimension::HEIGHT, rowIndex );
     RelayoutRequest();
   }
 }
@@ -614,7 +617,7 @@ void TableView::SetFitWidth( unsigned int columnIndex )
   {
     mColumnData[ columnIndex ].sizePolicy = Toolkit::TableView::FIT;
 
-    mColumnDirty = true;
+    SetDirty( Dimension::WIDTH, columnIndex );
     RelayoutRequest();
   }
 }
@@ -634,7 +637,7 @@ void TableView::SetFixedHeight( unsigned int rowIndex, float height )
   data.size = height;
   data.sizePolicy = Toolkit::TableView::FIXED;
 
-  mRowDirty = true;
+  SetDirty( Dimension::HEIGHT, rowIndex );
   RelayoutRequest();
 }
 
@@ -653,7 +656,7 @@ void TableView::SetFixedWidth( unsigned int columnIndex, float width )
   data.size = width;
   data.sizePolicy = Toolkit::TableView::FIXED;
 
-  mColumnDirty = true;
+  SetDirty( Dimension::WIDTH, columnIndex );
   RelayoutRequest();
 }
 
@@ -672,7 +675,7 @@ void TableView::SetRelativeHeight( unsigned int rowIndex, float heightPercentage
   data.fillRatio = heightPercentage;
   data.sizePolicy = Toolkit::TableView::RELATIVE;
 
-  mRowDirty = true;
+  SetDirty( Dimension::HEIGHT, rowIndex );
   RelayoutRequest();
 }
 
@@ -691,7 +694,7 @@ void TableView::SetRelativeWidth( unsigned int columnIndex, float widthPercentag
   data.fillRatio = widthPercentage;
   data.sizePolicy = Toolkit::TableView::RELATIVE;
 
-  mColumnDirty = true;
+  SetDirty( Dimension::WIDTH, columnIndex );
   RelayoutRequest();
 }
 
@@ -710,9 +713,9 @@ void TableView::OnCalculateRelayoutSize( Dimension::Type dimension )
      * FIXED and FIT have size in pixel
      * Nothing to do with FIXED, as its value is assigned by user and will not get changed
      *
-     * Need to update the size for FIT column here
+     * Need to update the size for FIT column here, only the marked ones are recalculated
      */
-    CalculateFitSizes( mColumnData, Dimension::WIDTH );
+    CalculateFitSizes( mColumnData, Dimension::WIDTH, mFirstDirtyColumn );
 
     /* RELATIVE and FILL have size in ratio
      * Their size in pixel is not available until we get the negotiated size for the whole table
@@ -720,7 +723,7 @@ void TableView::OnCalculateRelayoutSize( Dimension::Type dimension )
      *
      * Need to update the ratio for FILL column here
      */
-    CalculateFillSizes( mColumnData );
+    CalculateFillSizes( mColumnData, mFirstDirtyColumn );
 
     mFixedTotals.width = CalculateTotalFixedSize( mColumnData );
   }
@@ -728,10 +731,10 @@ void TableView::OnCalculateRelayoutSize( Dimension::Type dimension )
   if( (dimension & Dimension::HEIGHT) && mRowDirty )
   {
     // refer to the comment above
-    CalculateFitSizes( mRowData, Dimension::HEIGHT );
+    CalculateFitSizes( mRowData, Dimension::HEIGHT, mFirstDirtyRow );
 
     // refer to the comment above
-    CalculateFillSizes( mRowData );
+    CalculateFillSizes( mRowData, mFirstDirtyRow );
 
     mFixedTotals.height = CalculateTotalFixedSize( mRowData );
   }
@@ -742,24 +745,7 @@ void TableView::OnLayoutNegotiated( float size, Dimension::Type dimension )
   // Update the column sizes
   if( (dimension & Dimension::WIDTH) && mColumnDirty )
   {
-    float remainingSize = size - mFixedTotals.width;
-    if( remainingSize < 0.0f )
-    {
-      remainingSize = 0.0f;
-    }
-
-    // update every column position in ColumnData array
-    float cumulatedWidth = 0.0f;
-    for( auto&& element : mColumnData )
-    {
-      if( element.sizePolicy == Toolkit::TableView::FILL || element.sizePolicy == Toolkit::TableView::RELATIVE )
-      {
-        element.size = element.fillRatio * remainingSize;
-      }
-
-      cumulatedWidth += element.size;
-      element.position = cumulatedWidth;
-    }
+    CalculatePositions( mColumnData, size - mFixedTotals.width, mFillSpace.width, mFirstDirtyColumn );
 
     mColumnDirty = false;
   }
@@ -767,24 +753,7 @@ void TableView::OnLayoutNegotiated( float size, Dimension::Type dimension )
   // Update the row sizes
   if( (dimension & Dimension::HEIGHT) && mRowDirty )
   {
-    float remainingSize = size - mFixedTotals.height;
-    if( remainingSize < 0.0f )
-    {
-      remainingSize = 0.0f;
-    }
-
-    // update every row position in RowData array
-    float cumulatedHeight = 0.0f;
-    for( unsigned int row = 0, rowCount = mCellData.GetRows(); row < rowCount; ++row )
-    {
-      if( mRowData[ row ].sizePolicy == Toolkit::TableView::FILL ||  mRowData[ row ].sizePolicy == Toolkit::TableView::RELATIVE)
-      {
-        mRowData[ row ].size = mRowData[ row ].fillRatio * remainingSize;
-      }
-
-      cumulatedHeight += mRowData[ row ].size;
-      mRowData[row].position = cumulatedHeight;
-    }
+    CalculatePositions( mRowData, size - mFixedTotals.height, mFillSpace.height, mFirstDirtyRow );
 
     mRowDirty = false;
   }
@@ -794,7 +763,8 @@ void TableView::OnSizeSet( const Vector3& size )
 {
   // If this table view is size negotiated by another actor or control, then the
   // rows and columns must be recalculated or the new size will not take effect.
-  mRowDirty = mColumnDirty = true;
+  // The RELATIVE and FILL ones follow the space left to them, the FIT ones must be measured again.
+  SetAllFitDirty();
   RelayoutRequest();
 
   Control::OnSizeSet( size );
@@ -815,69 +785,69 @@ void TableView::OnRelayout( const Vector2& size, RelayoutContainer& container )
     }
   }
 
-  for( unsigned int row = 0, rowCount = mCellData.GetRows(); row < rowCount; ++row )
+  // Only the cells holding a child are visited
+  for( ChildIndex::const_iterator iter = mChildIndex.begin(), end = mChildIndex.end(); iter != end; ++iter )
   {
-    for( unsigned int column = 0, columnCount = mCellData.GetColumns(); column < columnCount; ++column )
+    const unsigned int row = iter->second.row;
+    const unsigned int column = iter->second.column;
+    CellData& cellData= mCellData[ row ][ column ];
+    Actor& actor = cellData.actor;
+    const Toolkit::TableView::CellPosition position = cellData.position;
+
+    // If there is an actor and this is the main cell of the actor.
+    // An actor can be in multiple cells if its row or column span is more than 1.
+    // We however must lay out each actor only once.
+    if( actor &&  position.rowIndex == row && position.columnIndex == column )
     {
-      CellData& cellData= mCellData[ row ][ column ];
-      Actor& actor = cellData.actor;
-      const Toolkit::TableView::CellPosition position = cellData.position;
-
-      // If there is an actor and this is the main cell of the actor.
-      // An actor can be in multiple cells if its row or column span is more than 1.
-      // We however must lay out each actor only once.
-      if( actor &&  position.rowIndex == row && position.columnIndex == column )
+      // Anchor actor to top left of the cell
+      if( actor.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
       {
-        // Anchor actor to top left of the cell
-        if( actor.GetProperty( Actor::Property::POSITION_USES_ANCHOR_POINT ).Get< bool >() )
-        {
-          actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
-        }
-        actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+        actor.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+      }
+      actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
 
-        Padding padding = actor.GetProperty<Vector4>( Actor::Property::PADDING );
+      Padding padding = actor.GetProperty<Vector4>( Actor::Property::PADDING );
 
-        float left = (column > 0) ? mColumnData[column - 1].position : 0.f;
-        float right;
+      float left = (column > 0) ? mColumnData[column - 1].position : 0.f;
+      float right;
 
-        if( Dali::LayoutDirection::RIGHT_TO_LEFT == layoutDirection )
-        {
-          right = totalWidth - left;
-          left = right - mColumnData[column].size;
-        }
-        else
-        {
-          right = left + mColumnData[column].size;
-        }
+      if( Dali::LayoutDirection::RIGHT_TO_LEFT == layoutDirection )
+      {
+        right = totalWidth - left;
+        left = right - mColumnData[column].size;
+      }
+      else
+      {
+        right = left + mColumnData[column].size;
+      }
 
-        float top = row > 0 ? mRowData[row-1].position : 0.f;
-        float bottom = mRowData[row+position.rowSpan-1].position;
+      float top = row > 0 ? mRowData[row-1].position : 0.f;
+      float bottom = mRowData[row+position.rowSpan-1].position;
 
-        if( cellData.horizontalAlignment == HorizontalAlignment::LEFT )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  left + mPadding.width + padding.left );
-        }
-        else if( cellData.horizontalAlignment ==  HorizontalAlignment::RIGHT )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  right - mPadding.width - padding.right - actor.GetRelayoutSize( Dimension::WIDTH ) );
-        }
-        else //if( cellData.horizontalAlignment ==  HorizontalAlignment::CENTER )
-        {
-          actor.SetProperty( Actor::Property::POSITION_X,  (left + right + padding.left - padding.right - actor.GetRelayoutSize( Dimension::WIDTH )) * 0.5f );
-        }
+      if( cellData.horizontalAlignment == HorizontalAlignment::LEFT )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  left + mPadding.width + padding.left );
+      }
+      else if( cellData.horizontalAlignment ==  HorizontalAlignment::RIGHT )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  right - mPadding.width - padding.right - actor.GetRelayoutSize( Dimension::WIDTH ) );
+      }
+      else //if( cellData.horizontalAlignment ==  HorizontalAlignment::CENTER )
+      {
+        actor.SetProperty( Actor::Property::POSITION_X,  (left + right + padding.left - padding.right - actor.GetRelayoutSize( Dimension::WIDTH )) * 0.5f );
+      }
 
-        if( cellData.verticalAlignment == VerticalAlignment::TOP )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  top + mPadding.height + padding.top );
-        }
-        else if( cellData.verticalAlignment == VerticalAlignment::BOTTOM )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  bottom - mPadding.height - padding.bottom -  actor.GetRelayoutSize( Dimension::HEIGHT ) );
-        }
-        else //if( cellData.verticalAlignment = VerticalAlignment::CENTER )
-        {
-          actor.SetProperty( Actor::Property::POSITION_Y,  (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize( Dimension::HEIGHT )) * 0.5f );
-        }
+      if( cellData.verticalAlignment == VerticalAlignment::TOP )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  top + mPadding.height + padding.top );
+      }
+      else if( cellData.verticalAlignment == VerticalAlignment::BOTTOM )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  bottom - mPadding.height - padding.bottom -  actor.GetRelayoutSize( Dimension::HEIGHT ) );
+      }
+      else //if( cellData.verticalAlignment = VerticalAlignment::CENTER )
+      {
+        actor.SetProperty( Actor::Property::POSITION_Y,  (top + bottom + padding.top - padding.bottom - actor.GetRelayoutSize( Dimension::HEIGHT )) * 0.5f );
       }
     }
   }
@@ -1037,48 +1007,47 @@ void TableView::OnChildAdd( Actor& child )
     }
     else
     {
-      bool availableCellFound = false;
-
-      // Find the first available cell to store the actor in
+      // Find the first available cell to store the actor in, the cells before mFirstEmptyCell are all taken
       const unsigned int rowCount = mCellData.GetRows();
       const unsigned int columnCount = mCellData.GetColumns();
-      for( unsigned int row = 0; row < rowCount && !availableCellFound; ++row )
+      const unsigned int cellCount = rowCount * columnCount;
+
+      unsigned int cell = mFirstEmptyCell;
+      while( ( cell < cellCount ) && mCellData[ cell / columnCount ][ cell % columnCount ].actor )
       {
-        for( unsigned int column = 0; column < columnCount && !availableCellFound; ++column )
-        {
-          if( !(mCellData[ row ][ column ].actor) )
-          {
-            // Put the actor in the cell
-            CellData data;
-            data.actor = child;
-            data.position.columnIndex = column;
-            data.position.rowIndex = row;
-            data.horizontalAlignment = horizontalAlignment;
-            data.verticalAlignment = verticalAlignment;
-            mCellData[ row ][ column ] = data;
-
-            availableCellFound = true;
-            break;
-          }
-        }
+        ++cell;
       }
+      mFirstEmptyCell = cell;
+
+      CellData data;
+      data.actor = child;
+      data.horizontalAlignment = horizontalAlignment;
+      data.verticalAlignment = verticalAlignment;
 
-      if( ! availableCellFound )
+      if( cell < cellCount )
+      {
+        // Put the actor in the cell
+        data.position.rowIndex = cell / columnCount;
+        data.position.columnIndex = cell % columnCount;
+      }
+      else
       {
         // No empty cells, so increase size of the table
         unsigned int newColumnCount = ( columnCount > 0 ) ? columnCount : 1;
         ResizeContainers( rowCount + 1, newColumnCount );
 
         // Put the actor in the first cell of the new row
-        CellData data;
-        data.actor = child;
         data.position.rowIndex = rowCount;
         data.position.columnIndex = 0;
-        data.horizontalAlignment = horizontalAlignment;
-        data.verticalAlignment = verticalAlignment;
-        mCellData[ rowCount ][ 0 ] = data;
       }
 
+      mCellData[ data.position.rowIndex ][ data.position.columnIndex ] = data;
+
+      CellIndex& cellIndex = mChildIndex[ child.GetObjectPtr() ];
+      cellIndex.row = data.position.rowIndex;
+      cellIndex.column = data.position.columnIndex;
+
+      SetFitDirty( data.position );
       RelayoutRequest();
     }
   }
@@ -1104,6 +1073,11 @@ void TableView::OnChildRemove( Actor& child )
 TableView::TableView( unsigned int initialRows, unsigned int initialColumns )
 : Control( ControlBehaviour( CONTROL_BEHAVIOUR_DEFAULT ) ),
   mCellData( initialRows, initialColumns ),
+  mFillSpace( -1.0f, -1.0f ),
+  mChildIndex(),
+  mFirstEmptyCell( 0u ),
+  mFirstDirtyRow( 0u ),
+  mFirstDirtyColumn( 0u ),
   mPreviousFocusedActor(),
   mLayoutingChild( false ),
   mRowDirty( true ),     // Force recalculation first time
@@ -1129,12 +1103,28 @@ void TableView::ResizeContainers( unsigned int rows, unsigned int columns )
 
 void TableView::ResizeContainers( unsigned int rows, unsigned int columns, std::vector<CellData>& removed )
 {
+  const unsigned int oldRows = mCellData.GetRows();
+  const unsigned int oldColumns = mCellData.GetColumns();
+
   // Resize cell data
   mCellData.Resize( rows, columns, removed );
 
   // We don't care if these go smaller, data will be regenerated or is not needed anymore
   mRowData.Resize( rows );
   mColumnData.Resize( columns );
+
+  // The new rows and columns must be calculated, the ratios of the FILL ones may have changed
+  if( rows != oldRows )
+  {
+    SetDirty( Dimension::HEIGHT, std::min( rows, oldRows ) );
+  }
+  if( columns != oldColumns )
+  {
+    SetDirty( Dimension::WIDTH, std::min( columns, oldColumns ) );
+
+    // The cells are numbered differently
+    mFirstEmptyCell = 0u;
+  }
 }
 
 void TableView::RemoveAndGetLostActors( const std::vector<CellData>& lost, std::vector<Actor>& removed,
@@ -1187,23 +1177,109 @@ void TableView::RemoveAndGetLostActors( const std::vector<CellData>& lost, std::
 
 bool TableView::RemoveAllInstances( const Actor& child )
 {
-  bool found = false;
-  // walk through the layout data
+  ChildIndex::iterator iter = mChildIndex.find( child.GetObjectPtr() );
+  if( iter == mChildIndex.end() )
+  {
+    return false;
+  }
+
+  const CellIndex cellIndex = iter->second;
+  const Toolkit::TableView::CellPosition position = mCellData[ cellIndex.row ][ cellIndex.column ].position;
+  mChildIndex.erase( iter );
+
+  // walk through the cells of the child, NOTE that the child might be spanning multiple cells
+  const unsigned int rowEnd = std::min( position.rowIndex + position.rowSpan, mCellData.GetRows() );
+  const unsigned int columnEnd = std::min( position.columnIndex + position.columnSpan, mCellData.GetColumns() );
+  for( unsigned int row = std::min( position.rowIndex, cellIndex.row ); row < rowEnd; ++row )
+  {
+    for( unsigned int column = std::min( position.columnIndex, cellIndex.column ); column < columnEnd; ++column )
+    {
+      if( mCellData[ row ][ column ].actor == child )
+      {
+        // clear the cell
+        mCellData[ row ][ column ] = CellData();
+      }
+    }
+  }
+
+  // the first cell of the child is free again
+  mFirstEmptyCell = std::min( mFirstEmptyCell, cellIndex.row * mCellData.GetColumns() + cellIndex.column );
+
+  SetFitDirty( position );
+
+  return true;
+}
+
+void TableView::UpdateChildIndex()
+{
+  mChildIndex.clear();
+
   const unsigned int rowCount = mCellData.GetRows();
   const unsigned int columnCount = mCellData.GetColumns();
   for( unsigned int row = 0; row < rowCount; ++row )
   {
     for( unsigned int column = 0; column < columnCount; ++column )
     {
-      if( mCellData[ row ][ column ].actor == child )
+      const Actor& actor = mCellData[ row ][ column ].actor;
+      if( actor )
       {
-        // clear the cell, NOTE that the cell might be spanning multiple cells
-        mCellData[ row ][ column ] = CellData();
-        found = true;
+        // only the first cell of a spanning actor is kept
+        CellIndex cellIndex = { row, column };
+        mChildIndex.insert( ChildIndex::value_type( actor.GetObjectPtr(), cellIndex ) );
       }
     }
   }
-  return found;
+
+  mFirstEmptyCell = 0u;
+}
+
+void TableView::SetDirty( Dimension::Type dimension, unsigned int index )
+{
+  if( dimension & Dimension::WIDTH )
+  {
+    if( index < mColumnData.Size() )
+    {
+      mColumnData[ index ].dirty = true;
+    }
+    mFirstDirtyColumn = std::min( mFirstDirtyColumn, index );
+    mColumnDirty = true;
+  }
+
+  if( dimension & Dimension::HEIGHT )
+  {
+    if( index < mRowData.Size() )
+    {
+      mRowData[ index ].dirty = true;
+    }
+    mFirstDirtyRow = std::min( mFirstDirtyRow, index );
+    mRowDirty = true;
+  }
+}
+
+void TableView::SetFitDirty( const Toolkit::TableView::CellPosition& position )
+{
+  if( ( position.rowIndex < mRowData.Size() ) && ( mRowData[ position.rowIndex ].sizePolicy == Toolkit::TableView::FIT ) )
+  {
+    SetDirty( Dimension::HEIGHT, position.rowIndex );
+  }
+  if( ( position.columnIndex < mColumnData.Size() ) && ( mColumnData[ position.columnIndex ].sizePolicy == Toolkit::TableView::FIT ) )
+  {
+    SetDirty( Dimension::WIDTH, position.columnIndex );
+  }
+}
+
+void TableView::SetAllFitDirty()
+{
+  for( auto&& element : mRowData )
+  {
+    element.dirty = element.dirty || ( element.sizePolicy == Toolkit::TableView::FIT );
+  }
+  for( auto&& element : mColumnData )
+  {
+    element.dirty = element.dirty || ( element.sizePolicy == Toolkit::TableView::FIT );
+  }
+
+  mRowDirty = mColumnDirty = true;
 }
 
 void TableView::SetHeightOrWidthProperty(TableView& tableViewImpl,
@@ -1564,7 +1640,7 @@ void TableView::SetCellAlignment( Toolkit::TableView::CellPosition position, Hor
   data.verticalAlignment = vertical;
 }
 
-void TableView::CalculateFillSizes( RowColumnArray& data )
+void TableView::CalculateFillSizes( RowColumnArray& data, unsigned int& firstDirty )
 {
   // First pass: Count number of fill entries and calculate used relative space
   Dali::Vector< RowColumnData* > fillData;
@@ -1599,7 +1675,11 @@ void TableView::CalculateFillSizes( RowColumnArray& data )
 
     for( unsigned int i = 0; i < fillCount; ++i )
     {
-      fillData[ i ]->fillRatio = evenFillRatio;
+      if( fillData[ i ]->fillRatio != evenFillRatio )
+      {
+        fillData[ i ]->fillRatio = evenFillRatio;
+        firstDirty = std::min( firstDirty, static_cast< unsigned int >( fillData[ i ] - data.Begin() ) );
+      }
     }
   }
 }
@@ -1655,7 +1735,7 @@ Vector2 TableView::GetCellPadding( Dimension::Type dimension )
   return Vector2();
 }
 
-void TableView::CalculateFitSizes( RowColumnArray& data, Dimension::Type dimension )
+void TableView::CalculateFitSizes( RowColumnArray& data, Dimension::Type dimension, unsigned int& firstDirty )
 {
   Vector2 cellPadding = GetCellPadding( dimension );
 
@@ -1665,7 +1745,11 @@ void TableView::CalculateFitSizes( RowColumnArray& data, Dimension::Type dimensi
   {
     RowColumnData& dataInstance = data[ i ];
 
-    if( dataInstance.sizePolicy == Toolkit::TableView::FIT )
+    // Only the rows or columns whose children changed are measured again
+    const bool dirty = dataInstance.dirty;
+    dataInstance.dirty = false;
+
+    if( dirty && dataInstance.sizePolicy == Toolkit::TableView::FIT )
     {
       // Find the size of the biggest actor in the row or column
       float maxActorHeight = 0.0f;
@@ -1690,9 +1774,45 @@ void TableView::CalculateFitSizes( RowColumnArray& data, Dimension::Type dimensi
         }
       }
 
-      dataInstance.size = maxActorHeight;
+      if( dataInstance.size != maxActorHeight )
+      {
+        dataInstance.size = maxActorHeight;
+        firstDirty = std::min( firstDirty, i );
+      }
+    }
+  }
+}
+
+void TableView::CalculatePositions( RowColumnArray& data, float remainingSize, float& fillSpace, unsigned int& firstDirty )
+{
+  if( remainingSize < 0.0f )
+  {
+    remainingSize = 0.0f;
+  }
+
+  // Every RELATIVE and FILL size follows the remaining space, otherwise only the positions from the first changed one move
+  const unsigned int dataCount = data.Size();
+  unsigned int start = std::min( firstDirty, dataCount );
+  if( remainingSize != fillSpace )
+  {
+    fillSpace = remainingSize;
+    start = 0u;
+  }
+
+  float cumulatedSize = ( start > 0u ) ? data[ start - 1u ].position : 0.0f;
+  for( unsigned int i = start; i < dataCount; ++i )
+  {
+    RowColumnData& element = data[ i ];
+    if( element.sizePolicy == Toolkit::TableView::FILL || element.sizePolicy == Toolkit::TableView::RELATIVE )
+    {
+      element.size = element.fillRatio * remainingSize;
     }
+
+    cumulatedSize += element.size;
+    element.position = cumulatedSize;
   }
+
+  firstDirty = NO_DIRTY_INDEX;
 }
 
 bool TableView::FindFit( const RowColumnArray& data )
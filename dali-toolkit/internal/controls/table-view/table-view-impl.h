@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
 #include <dali/public-api/object/weak-handle.h>
 
 // INTERNAL INCLUDES
@@ -286,7 +287,8 @@ private: // Implementation
     : size( 0.0f ),
       fillRatio( 0.0f ),
       position( 0.0f ),
-      sizePolicy( Toolkit::TableView::FILL )
+      sizePolicy( Toolkit::TableView::FILL ),
+      dirty( true )
     {
     }
 
@@ -300,7 +302,8 @@ private: // Implementation
     : size( newSize ),
       fillRatio( newFillRatio ),
       position( 0.0f ),
-      sizePolicy( newSizePolicy )
+      sizePolicy( newSizePolicy ),
+      dirty( true )
     {
     }
 
@@ -308,6 +311,7 @@ private: // Implementation
     float fillRatio;                             ///< Ratio to fill remaining space, only valid with RELATIVE or FILL policy
     float position;                              ///< Position of the row/column, this value is updated during every Relayout round
     Toolkit::TableView::LayoutPolicy sizePolicy; ///< The size policy used to interpret the size value
+    bool dirty;                                  ///< Whether the size of a FIT row/column must be recalculated from its children
   };
 
   typedef Dali::Vector<RowColumnData> RowColumnArray;
@@ -334,6 +338,17 @@ public:
 
 private:
 
+  /**
+   * Structure for the first cell of a child, in row major order
+   */
+  struct CellIndex
+  {
+    unsigned int row;
+    unsigned int column;
+  };
+
+  typedef std::unordered_map< const BaseObject*, CellIndex > ChildIndex;
+
   /**
    * Construct a new TableView.
    */
@@ -372,12 +387,40 @@ private:
    */
   bool RemoveAllInstances( const Actor& child );
 
+  /**
+   * @brief Rebuilds the index of the first cell of each child from the cell data
+   *
+   * Called after the cells are moved around by inserting, deleting or resizing rows and columns.
+   */
+  void UpdateChildIndex();
+
+  /**
+   * @brief Marks a row or column for recalculation, along with the positions of the ones after it
+   *
+   * @param[in] dimension The dimension of the data: row == Dimension::HEIGHT, column == Dimension::WIDTH
+   * @param[in] index The index of the row or column, may be the count to only recalculate the fill ratios
+   */
+  void SetDirty( Dimension::Type dimension, unsigned int index );
+
+  /**
+   * @brief Marks the FIT row and column of a child for recalculation
+   *
+   * @param[in] position The cell position of the child
+   */
+  void SetFitDirty( const Toolkit::TableView::CellPosition& position );
+
+  /**
+   * @brief Marks every FIT row and column for recalculation, as the sizes of the children may have changed
+   */
+  void SetAllFitDirty();
+
   /**
    * @brief Calculate the ratio of FILL rows/columns
    *
    * @param[in] data The RowColumn data to compute the relative sizes for
+   * @param[in,out] firstDirty Lowered to the first row or column whose ratio changed
    */
-  void CalculateFillSizes( RowColumnArray& data );
+  void CalculateFillSizes( RowColumnArray& data, unsigned int& firstDirty );
 
   /**
    * @brief Calculate the total fixed sizes for a row or column
@@ -391,8 +434,19 @@ private:
    *
    * @param[in] data The row or column data to process
    * @param[in] dimension The dimension being calculated: row == Dimension::HEIGHT, column == Dimension::WIDTH
+   * @param[in,out] firstDirty Lowered to the first row or column whose size changed
    */
-  void CalculateFitSizes( RowColumnArray& data, Dimension::Type dimension );
+  void CalculateFitSizes( RowColumnArray& data, Dimension::Type dimension, unsigned int& firstDirty );
+
+  /**
+   * @brief Calculate the sizes of RELATIVE and FILL rows/columns and the positions from the first changed one
+   *
+   * @param[in] data The row or column data to process
+   * @param[in] remainingSize The space left after the FIXED and FIT rows/columns
+   * @param[in,out] fillSpace The space left in the previous calculation
+   * @param[in,out] firstDirty The first row or column whose size changed, reset once the positions are calculated
+   */
+  void CalculatePositions( RowColumnArray& data, float remainingSize, float& fillSpace, unsigned int& firstDirty );
 
   /**
    * @brief Search for a FIT cell in the array
@@ -498,6 +552,12 @@ private: // Data
   RowColumnArray mRowData;       ///< Data for each row
   RowColumnArray mColumnData;    ///< Data for each column
   Size mFixedTotals;             ///< Accumulated totals for fixed width and height
+  Size mFillSpace;               ///< Space left to the RELATIVE and FILL columns and rows in the last calculation
+
+  ChildIndex mChildIndex;          ///< The first cell of each child
+  unsigned int mFirstEmptyCell;    ///< The cells before this one, in row major order, are all taken
+  unsigned int mFirstDirtyRow;     ///< The first row whose position must be recalculated
+  unsigned int mFirstDirtyColumn;  ///< The first column whose position must be recalculated
 
   Size mPadding;                 ///< Padding to apply to each cell
 
@@ -32,6 +32,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/video-view/video-view.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 
 namespace Dali
@@ -646,7 +647,7 @@ void VideoView::SetWindowSurfaceTarget()
   {
     // For underlay rendering mode, video display area have to be transparent.
     Geometry geometry = VisualFactoryCache::CreateQuadGeometry();
-    Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+    Shader shader = ShaderRegistry::Get().GetShader( "VideoView", VERTEX_SHADER, FRAGMENT_SHADER );
     mOverlayRenderer = Renderer::New( geometry, shader );
     mOverlayRenderer.SetProperty( Renderer::Property::BLEND_MODE, BlendMode::OFF );
   }
@@ -873,9 +874,12 @@ Dali::Shader VideoView::CreateShader()
   {
     vertexShader = VERTEX_SHADER_TEXTURE;
     fragmentShader += FRAGMENT_SHADER_TEXTURE;
+
+    return ShaderRegistry::Get().GetShader( "VideoView", vertexShader, fragmentShader );
   }
 
-  return Dali::Shader::New( vertexShader, fragmentShader );
+  // The shaders given by the application are not shared
+  return ShaderRegistry::Get().NewShader( "VideoView", vertexShader, fragmentShader );
 }
 
 bool VideoView::GetStringFromProperty( const Dali::Property::Value& value, std::string& output )
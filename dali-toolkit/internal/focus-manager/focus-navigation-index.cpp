@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/focus-manager/focus-navigation-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const float MINOR_AXIS_WEIGHT = 4.0f; ///< How much more the distance across the direction counts
+
+} // unnamed namespace
+
+FocusNavigationIndex::FocusNavigationIndex()
+: mEntries(),
+  mEntryIds(),
+  mSortedX(),
+  mSortedY(),
+  mSorted( true )
+{
+}
+
+void FocusNavigationIndex::Add( Actor actor, const Rect< float >& rect )
+{
+  Entry entry;
+  entry.actor = actor;
+  entry.center = Vector2( rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f );
+  mEntryIds[ actor.GetObjectPtr() ] = static_cast< uint32_t >( mEntries.size() );
+  mEntries.push_back( entry );
+  mSorted = false;
+}
+
+void FocusNavigationIndex::Update( Actor actor, const Rect< float >& rect )
+{
+  auto iter = mEntryIds.find( actor.GetObjectPtr() );
+  if( iter == mEntryIds.end() )
+  {
+    return;
+  }
+
+  const uint32_t entryId = iter->second;
+  const Vector2 center( rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f );
+  if( mSorted )
+  {
+    Move( mSortedX, entryId, center.x, true );
+    Move( mSortedY, entryId, center.y, false );
+  }
+  mEntries[ entryId ].center = center;
+}
+
+void FocusNavigationIndex::Clear()
+{
+  mEntries.clear();
+  mEntryIds.clear();
+  mSortedX.clear();
+  mSortedY.clear();
+  mSorted = true;
+}
+
+uint32_t FocusNavigationIndex::GetCount() const
+{
+  return static_cast< uint32_t >( mEntries.size() );
+}
+
+Actor FocusNavigationIndex::FindNext( const Rect< float >& rect, Toolkit::Control::KeyboardFocus::Direction direction ) const
+{
+  bool horizontal = true;
+  bool forward = true;
+  switch( direction )
+  {
+    case Toolkit::Control::KeyboardFocus::LEFT:
+    {
+      forward = false;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::RIGHT:
+    {
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::UP:
+    {
+      horizontal = false;
+      forward = false;
+      break;
+    }
+    case Toolkit::Control::KeyboardFocus::DOWN:
+    {
+      horizontal = false;
+      break;
+    }
+    default:
+    {
+      return Actor();
+    }
+  }
+
+  Sort();
+
+  const Vector2 center( rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f );
+  const std::vector< uint32_t >& sorted = horizontal ? mSortedX : mSortedY;
+  const float position = horizontal ? center.x : center.y;
+
+  // Find the first entry beyond the position in the direction.
+  std::vector< uint32_t >::const_iterator bound;
+  if( forward )
+  {
+    bound = std::upper_bound( sorted.begin(), sorted.end(), position,
+                              [this, horizontal]( float value, uint32_t entryId )
+                              {
+                                return value < ( horizontal ? mEntries[ entryId ].center.x : mEntries[ entryId ].center.y );
+                              } );
+  }
+  else
+  {
+    bound = std::lower_bound( sorted.begin(), sorted.end(), position,
+                              [this, horizontal]( uint32_t entryId, float value )
+                              {
+                                return ( horizontal ? mEntries[ entryId ].center.x : mEntries[ entryId ].center.y ) < value;
+                              } );
+  }
+
+  const int32_t count = static_cast< int32_t >( sorted.size() );
+  const int32_t step = forward ? 1 : -1;
+  int32_t index = static_cast< int32_t >( bound - sorted.begin() );
+  if( !forward )
+  {
+    --index;
+  }
+
+  // Walk away from the position until the entries left are further along the direction alone.
+  Actor closest;
+  float closestDistance2 = 0.0f;
+  for( ; index >= 0 && index < count; index += step )
+  {
+    const Entry& entry = mEntries[ sorted[ index ] ];
+    const Vector2 delta = entry.center - center;
+    const float major = horizontal ? delta.x : delta.y;
+    const float minor = horizontal ? delta.y : delta.x;
+    const float majorDistance2 = major * major;
+    if( closest && majorDistance2 >= closestDistance2 )
+    {
+      break;
+    }
+
+    const float distance2 = majorDistance2 + MINOR_AXIS_WEIGHT * minor * minor;
+    if( !closest || distance2 < closestDistance2 )
+    {
+      Actor actor = entry.actor.GetHandle();
+      if( actor )
+      {
+        closest = actor;
+        closestDistance2 = distance2;
+      }
+    }
+  }
+
+  return closest;
+}
+
+void FocusNavigationIndex::Move( std::vector< uint32_t >& sorted, uint32_t entryId, float position, bool horizontal )
+{
+  auto getPosition = [this, horizontal]( uint32_t id ) { return horizontal ? mEntries[ id ].center.x : mEntries[ id ].center.y; };
+
+  // Find the entry among the ones at its previous position
+  const float previousPosition = getPosition( entryId );
+  auto iter = std::lower_bound( sorted.begin(), sorted.end(), previousPosition,
+                                [&getPosition]( uint32_t id, float value ) { return getPosition( id ) < value; } );
+  while( iter != sorted.end() && *iter != entryId )
+  {
+    ++iter;
+  }
+  if( iter == sorted.end() || previousPosition == position )
+  {
+    return;
+  }
+  sorted.erase( iter );
+
+  iter = std::upper_bound( sorted.begin(), sorted.end(), position,
+                           [&getPosition]( float value, uint32_t id ) { return value < getPosition( id ); } );
+  sorted.insert( iter, entryId );
+}
+
+void FocusNavigationIndex::Sort() const
+{
+  if( mSorted )
+  {
+    return;
+  }
+
+  const uint32_t count = static_cast< uint32_t >( mEntries.size() );
+  mSortedX.resize( count );
+  mSortedY.resize( count );
+  for( uint32_t entryId = 0u; entryId < count; ++entryId )
+  {
+    mSortedX[ entryId ] = entryId;
+    mSortedY[ entryId ] = entryId;
+  }
+
+  std::sort( mSortedX.begin(), mSortedX.end(),
+             [this]( uint32_t lhs, uint32_t rhs ) { return mEntries[ lhs ].center.x < mEntries[ rhs ].center.x; } );
+  std::sort( mSortedY.begin(), mSortedY.end(),
+             [this]( uint32_t lhs, uint32_t rhs ) { return mEntries[ lhs ].center.y < mEntries[ rhs ].center.y; } );
+
+  mSorted = true;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,146 @@
+#ifndef DALI_TOOLKIT_INTERNAL_FOCUS_NAVIGATION_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_FOCUS_NAVIGATION_INDEX_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <unordered_map>
+#include <vector>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/object/weak-handle.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/control.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The screen rectangles of the keyboard focusable actors, to find the next actor to focus in a direction.
+ *
+ * The centers of the rectangles are sorted along each axis, so the search starts from the position
+ * of the current actor and stops as soon as the actors left are further along the direction than
+ * the closest one found.
+ */
+class FocusNavigationIndex
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  FocusNavigationIndex();
+
+  /**
+   * @brief Adds a focusable actor.
+   *
+   * @param[in] actor The actor.
+   * @param[in] rect The rectangle of the actor on the screen.
+   */
+  void Add( Actor actor, const Rect< float >& rect );
+
+  /**
+   * @brief Moves an actor already added.
+   *
+   * The actor is moved within the sorted entries, rather than sorting them all again.
+   *
+   * @param[in] actor The actor.
+   * @param[in] rect The new rectangle of the actor on the screen.
+   */
+  void Update( Actor actor, const Rect< float >& rect );
+
+  /**
+   * @brief Removes all the actors.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the number of actors.
+   *
+   * @return The number of actors.
+   */
+  uint32_t GetCount() const;
+
+  /**
+   * @brief Finds the closest actor in a direction.
+   *
+   * The distance across the direction counts more than the distance along it, so an actor in line
+   * is preferred to a closer one which is not.
+   *
+   * @param[in] rect The rectangle of the current actor on the screen.
+   * @param[in] direction The direction, only LEFT, RIGHT, UP and DOWN are supported.
+   * @return The closest actor whose center is beyond the center of the rectangle, or an empty handle.
+   */
+  Actor FindNext( const Rect< float >& rect, Toolkit::Control::KeyboardFocus::Direction direction ) const;
+
+private:
+
+  /**
+   * @brief A focusable actor.
+   */
+  struct Entry
+  {
+    WeakHandle< Actor > actor;
+    Vector2             center;
+  };
+
+  /**
+   * @brief Sorts the entries along each axis, if they changed.
+   */
+  void Sort() const;
+
+  /**
+   * @brief Moves an entry within the entries sorted along an axis.
+   *
+   * @param[in,out] sorted The entries sorted along the axis.
+   * @param[in] entryId The entry, still at its previous position.
+   * @param[in] position The new position of the center of the entry along the axis.
+   * @param[in] horizontal Whether the axis is horizontal.
+   */
+  void Move( std::vector< uint32_t >& sorted, uint32_t entryId, float position, bool horizontal );
+
+  // Undefined
+  FocusNavigationIndex( const FocusNavigationIndex& );
+
+  // Undefined
+  FocusNavigationIndex& operator=( const FocusNavigationIndex& );
+
+private:
+
+  std::vector< Entry >                              mEntries;
+  std::unordered_map< const BaseObject*, uint32_t > mEntryIds; ///< The entries by actor
+  mutable std::vector< uint32_t >                   mSortedX;  ///< The entries sorted by the horizontal position of their center
+  mutable std::vector< uint32_t >                   mSortedY;  ///< The entries sorted by the vertical position of their center
+  mutable bool                                      mSorted;   ///< Whether the entries are sorted
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_FOCUS_NAVIGATION_INDEX_H
@@ -39,6 +39,7 @@
 #include <dali-toolkit/public-api/controls/control.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/image-view/image-view.h>
+#include <dali-toolkit/public-api/controls/scrollable/scrollable.h>
 #include <dali-toolkit/devel-api/accessibility-manager/accessibility-manager.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
@@ -123,6 +124,10 @@ KeyboardFocusManager::KeyboardFocusManager()
   mFocusIndicatorActor(),
   mFocusHistory(),
   mSlotDelegate( this ),
+  mFocusNavigationSlotDelegate( this ),
+  mFocusNavigationIndex(),
+  mFocusNavigationRoot(),
+  mFocusNavigationRelaidOutActors(),
   mCustomAlgorithmInterface(NULL),
   mCurrentFocusedWindow(),
   mIsFocusIndicatorShown( UNKNOWN ),
@@ -130,7 +135,9 @@ KeyboardFocusManager::KeyboardFocusManager()
   mAlwaysShowIndicator( ALWAYS_SHOW ),
   mFocusGroupLoopEnabled( false ),
   mIsWaitingKeyboardFocusChangeCommit( false ),
-  mClearFocusOnTouch( true )
+  mClearFocusOnTouch( true ),
+  mFocusNavigationIndexEnabled( false ),
+  mFocusNavigationIndexDirty( true )
 {
   // TODO: Get FocusIndicatorEnable constant from stylesheet to set mIsFocusIndicatorShown.
 
@@ -486,20 +493,27 @@ bool KeyboardFocusManager::MoveFocus(Toolkit::Control::KeyboardFocus::Direction
 
     if( !nextFocusableActor )
     {
+      // The closest focusable actor on the screen is proposed, if they are indexed
+      Actor proposedActor = FindClosestFocusableActor( currentFocusActor, direction );
+
       // If the implementation of CustomAlgorithmInterface is provided then the PreFocusChangeSignal is no longer emitted.
       if( mCustomAlgorithmInterface )
       {
         mIsWaitingKeyboardFocusChangeCommit = true;
-        nextFocusableActor = mCustomAlgorithmInterface->GetNextFocusableActor( currentFocusActor, Actor(), direction );
+        nextFocusableActor = mCustomAlgorithmInterface->GetNextFocusableActor( currentFocusActor, proposedActor, direction );
         mIsWaitingKeyboardFocusChangeCommit = false;
       }
       else if( !mPreFocusChangeSignal.Empty() )
       {
         // Don't know how to move the focus further. The application needs to tell us which actor to move the focus to
         mIsWaitingKeyboardFocusChangeCommit = true;
-        nextFocusableActor = mPreFocusChangeSignal.Emit( currentFocusActor, Actor(), direction );
+        nextFocusableActor = mPreFocusChangeSignal.Emit( currentFocusActor, proposedActor, direction );
         mIsWaitingKeyboardFocusChangeCommit = false;
       }
+      else
+      {
+        nextFocusableActor = proposedActor;
+      }
     }
 
     if( nextFocusableActor && nextFocusableActor.GetProperty< bool >( Actor::Property::KEYBOARD_FOCUSABLE ) )
@@ -1077,6 +1091,123 @@ bool KeyboardFocusManager::IsFocusIndicatorEnabled() const
   return ( mEnableFocusIndicator == ENABLE );
 }
 
+void KeyboardFocusManager::EnableFocusNavigationIndex(bool enable)
+{
+  mFocusNavigationIndexEnabled = enable;
+  if( !enable )
+  {
+    mFocusNavigationSlotDelegate.DisconnectAll();
+    mFocusNavigationIndex.Clear();
+    mFocusNavigationRoot.Reset();
+    mFocusNavigationRelaidOutActors.clear();
+  }
+  mFocusNavigationIndexDirty = true;
+}
+
+bool KeyboardFocusManager::IsFocusNavigationIndexEnabled() const
+{
+  return mFocusNavigationIndexEnabled;
+}
+
+void KeyboardFocusManager::UpdateFocusNavigationIndex()
+{
+  mFocusNavigationIndexDirty = true;
+}
+
+Actor KeyboardFocusManager::FindClosestFocusableActor(Actor actor, Toolkit::Control::KeyboardFocus::Direction direction)
+{
+  if( !mFocusNavigationIndexEnabled || !actor || !actor.GetProperty< bool >( Actor::Property::CONNECTED_TO_SCENE ) )
+  {
+    return Actor();
+  }
+
+  Integration::SceneHolder window = Integration::SceneHolder::Get( actor );
+  if( !window )
+  {
+    return Actor();
+  }
+
+  // Build the index of the window again if its actors were scrolled since the last movement
+  Layer rootLayer = window.GetRootLayer();
+  if( mFocusNavigationIndexDirty || mFocusNavigationRoot.GetHandle() != rootLayer )
+  {
+    mFocusNavigationSlotDelegate.DisconnectAll();
+    mFocusNavigationIndex.Clear();
+    mFocusNavigationRoot = rootLayer;
+    AddToFocusNavigationIndex( rootLayer );
+    mFocusNavigationIndexDirty = false;
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] %u focusable actors indexed\n", __FUNCTION__, __LINE__, mFocusNavigationIndex.GetCount() );
+  }
+  else if( !mFocusNavigationRelaidOutActors.empty() )
+  {
+    // Only the actors relaid out are moved. Their rectangles are read now, as the sizes they were
+    // given by the relayout are only current once updated.
+    for( auto&& relaidOut : mFocusNavigationRelaidOutActors )
+    {
+      Actor relaidOutActor = relaidOut.second.GetHandle();
+      if( relaidOutActor )
+      {
+        mFocusNavigationIndex.Update( relaidOutActor, GetScreenRect( relaidOutActor ) );
+      }
+    }
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "[%s:%d] %u relaid out actors moved in the index\n", __FUNCTION__, __LINE__, static_cast< uint32_t >( mFocusNavigationRelaidOutActors.size() ) );
+  }
+  mFocusNavigationRelaidOutActors.clear();
+
+  return mFocusNavigationIndex.FindNext( GetScreenRect( actor ), direction );
+}
+
+void KeyboardFocusManager::AddToFocusNavigationIndex(Actor actor)
+{
+  if( !actor.GetProperty< bool >( Actor::Property::VISIBLE ) )
+  {
+    return;
+  }
+
+  if( actor.GetProperty< bool >( Actor::Property::KEYBOARD_FOCUSABLE ) )
+  {
+    mFocusNavigationIndex.Add( actor, GetScreenRect( actor ) );
+    actor.OnRelayoutSignal().Connect( mFocusNavigationSlotDelegate, &KeyboardFocusManager::OnIndexedActorRelayout );
+  }
+
+  // The actors move on the screen when they are scrolled
+  Toolkit::Scrollable scrollable = Toolkit::Scrollable::DownCast( actor );
+  if( scrollable )
+  {
+    scrollable.ScrollUpdatedSignal().Connect( mFocusNavigationSlotDelegate, &KeyboardFocusManager::OnIndexedActorScrolled );
+  }
+
+  const uint32_t childCount = actor.GetChildCount();
+  for( uint32_t i = 0u; i < childCount; ++i )
+  {
+    AddToFocusNavigationIndex( actor.GetChildAt( i ) );
+  }
+}
+
+void KeyboardFocusManager::OnIndexedActorRelayout(Actor actor)
+{
+  if( !mFocusNavigationIndexDirty )
+  {
+    mFocusNavigationRelaidOutActors[ actor.GetObjectPtr() ] = actor;
+  }
+}
+
+void KeyboardFocusManager::OnIndexedActorScrolled(const Vector2& position)
+{
+  mFocusNavigationIndexDirty = true;
+}
+
+Rect< float > KeyboardFocusManager::GetScreenRect(Actor actor)
+{
+  const Vector3 size = actor.GetCurrentProperty< Vector3 >( Actor::Property::SIZE ) * actor.GetCurrentProperty< Vector3 >( Actor::Property::WORLD_SCALE );
+  const Vector3 anchorPoint = actor.GetCurrentProperty< Vector3 >( Actor::Property::ANCHOR_POINT );
+  const Vector2 screenPosition = actor.GetProperty< Vector2 >( Actor::Property::SCREEN_POSITION );
+
+  return Rect< float >( screenPosition.x - size.x * anchorPoint.x, screenPosition.y - size.y * anchorPoint.y, size.x, size.y );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
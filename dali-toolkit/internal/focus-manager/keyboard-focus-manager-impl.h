@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
 #include <dali/public-api/common/vector-wrapper.h>
@@ -26,6 +27,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/focus-manager/keyboard-focus-manager.h>
 #include <dali-toolkit/devel-api/focus-manager/keyboard-focus-manager-devel.h>
+#include <dali-toolkit/internal/focus-manager/focus-navigation-index.h>
 #include <dali/devel-api/adaptor-framework/window-devel.h>
 
 namespace Dali
@@ -157,6 +159,21 @@ public:
    */
   bool IsFocusIndicatorEnabled() const;
 
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::EnableFocusNavigationIndex
+   */
+  void EnableFocusNavigationIndex(bool enable);
+
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::IsFocusNavigationIndexEnabled
+   */
+  bool IsFocusNavigationIndexEnabled() const;
+
+  /**
+   * @copydoc Toolkit::DevelKeyboardFocusManager::UpdateFocusNavigationIndex
+   */
+  void UpdateFocusNavigationIndex();
+
 public:
 
   /**
@@ -301,6 +318,39 @@ private:
    */
   Actor GetFocusActorFromCurrentWindow();
 
+  /**
+   * Find the closest focusable actor on the screen towards the specified direction
+   * @param actor The current focused actor
+   * @param direction The direction of focus movement
+   * @return The closest focusable actor, or an empty handle if there is none or the index is disabled
+   */
+  Actor FindClosestFocusableActor(Actor actor, Toolkit::Control::KeyboardFocus::Direction direction);
+
+  /**
+   * Add the visible focusable actors of a tree to the focus navigation index
+   * @param actor The root of the tree
+   */
+  void AddToFocusNavigationIndex(Actor actor);
+
+  /**
+   * Called when an indexed actor is relaid out, to move it in the index before the next focus movement
+   * @param actor The actor
+   */
+  void OnIndexedActorRelayout(Actor actor);
+
+  /**
+   * Called when a scrollable containing indexed actors is scrolled
+   * @param position The scroll position
+   */
+  void OnIndexedActorScrolled(const Vector2& position);
+
+  /**
+   * Retrieve the rectangle of an actor on the screen
+   * @param actor The actor
+   * @return The rectangle
+   */
+  static Rect< float > GetScreenRect(Actor actor);
+
 private:
 
   // Undefined
@@ -323,6 +373,14 @@ private:
 
   SlotDelegate< KeyboardFocusManager > mSlotDelegate;
 
+  SlotDelegate< KeyboardFocusManager > mFocusNavigationSlotDelegate; ///< Connected to the indexed actors, disconnected when the index is built again
+
+  FocusNavigationIndex mFocusNavigationIndex; ///< The screen rectangles of the focusable actors
+
+  WeakHandle< Layer > mFocusNavigationRoot; ///< The root layer of the window whose actors are indexed
+
+  std::unordered_map< const BaseObject*, WeakHandle< Actor > > mFocusNavigationRelaidOutActors; ///< The indexed actors to move in the index before the next focus movement
+
   CustomAlgorithmInterface* mCustomAlgorithmInterface; ///< The user's (application / toolkit) implementation of CustomAlgorithmInterface
 
   typedef std::vector< std::pair< WeakHandle< Layer >, WeakHandle< Actor > > > FocusActorContainer;
@@ -342,6 +400,10 @@ private:
   bool mIsWaitingKeyboardFocusChangeCommit:1; /// A flag to indicate PreFocusChangeSignal emitted but the proposed focus actor is not commited by the application yet.
 
   bool mClearFocusOnTouch:1; ///< Whether clear focus on touch.
+
+  bool mFocusNavigationIndexEnabled:1; ///< Whether the focusable actors on the screen are indexed
+
+  bool mFocusNavigationIndexDirty:1; ///< Whether the focus navigation index needs to be built again
 };
 
 } // namespace Internal
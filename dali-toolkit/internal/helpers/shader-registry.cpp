@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <dali/devel-api/common/singleton-service.h>
+#include <dali/integration-api/processor-interface.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+/**
+ * Combines a value into a hash.
+ */
+void CombineHash( std::size_t& hash, std::size_t value )
+{
+  hash ^= value + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+}
+
+/**
+ * Computes the hash of the source of a shader.
+ */
+std::size_t GetHash( const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+{
+  std::size_t hash = std::hash< std::string >()( vertexShader );
+  CombineHash( hash, std::hash< std::string >()( fragmentShader ) );
+  CombineHash( hash, static_cast< std::size_t >( hints ) );
+  return hash;
+}
+
+} // unnamed namespace
+
+class ShaderRegistry::Impl : public Dali::BaseObject, public Integration::Processor
+{
+public:
+
+  /**
+   * @brief Constructor
+   */
+  Impl()
+  : mVariants(),
+    mVariantIds(),
+    mMetrics(),
+    mFrameCreations( 0u ),
+    mProcessorRegistered( false )
+  {
+  }
+
+  Shader GetShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints, bool keep )
+  {
+    ++mMetrics.requests;
+
+    Variant& variant = mVariants[ FindVariant( name, vertexShader, fragmentShader, hints ) ];
+    variant.kept = variant.kept || keep;
+
+    Shader shader = variant.sharedShader.GetHandle();
+    if( !shader )
+    {
+      shader = CreateShader( variant );
+      variant.sharedShader = WeakHandle< Shader >( shader );
+    }
+    if( variant.kept )
+    {
+      variant.shader = shader;
+    }
+    return shader;
+  }
+
+  Shader NewShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+  {
+    ++mMetrics.requests;
+
+    // The program of a variant warmed up is in the program cache already
+    Variant& variant = mVariants[ FindVariant( name, vertexShader, fragmentShader, hints ) ];
+    Shader shader = CreateShader( variant );
+    variant.newShader = WeakHandle< Shader >( shader );
+    return shader;
+  }
+
+  void AddVariant( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+  {
+    mVariants[ FindVariant( name, vertexShader, fragmentShader, hints ) ].kept = true;
+  }
+
+  void GetVariantNames( std::vector< std::string >& names ) const
+  {
+    std::unordered_set< std::string > found;
+    for( auto&& variant : mVariants )
+    {
+      if( found.insert( variant.name ).second )
+      {
+        names.push_back( variant.name );
+      }
+    }
+  }
+
+  uint32_t WarmUp( const std::vector< std::string >& names )
+  {
+    const std::unordered_set< std::string > selected( names.begin(), names.end() );
+
+    uint32_t count = 0u;
+    for( auto&& variant : mVariants )
+    {
+      if( !variant.shader && ( selected.empty() || selected.find( variant.name ) != selected.end() ) )
+      {
+        variant.kept = true;
+        variant.shader = variant.sharedShader.GetHandle();
+        if( !variant.shader )
+        {
+          variant.shader = CreateShader( variant );
+          variant.sharedShader = WeakHandle< Shader >( variant.shader );
+          ++count;
+        }
+      }
+    }
+    return count;
+  }
+
+  const Metrics& GetMetrics() const
+  {
+    return mMetrics;
+  }
+
+protected: // Implementation of Processor
+
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process() override
+  {
+    mMetrics.lastFrameCreations = mFrameCreations;
+    mMetrics.maxFrameCreations = std::max( mMetrics.maxFrameCreations, mFrameCreations );
+    mFrameCreations = 0u;
+
+    Adaptor::Get().UnregisterProcessor( *this );
+    mProcessorRegistered = false;
+  }
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~Impl()
+  {
+    if( mProcessorRegistered && Adaptor::IsAvailable() )
+    {
+      Adaptor::Get().UnregisterProcessor( *this );
+    }
+  }
+
+private:
+
+  /**
+   * @brief The source of a shader and its shared shader.
+   */
+  struct Variant
+  {
+    std::string          name;
+    std::string          vertexShader;
+    std::string          fragmentShader;
+    Shader::Hint::Value  hints;
+    WeakHandle< Shader > sharedShader; ///< The shared shader, while it's used
+    WeakHandle< Shader > newShader;    ///< The last shader created which is not shared, while it's used
+    Shader               shader;       ///< The shared shader, if the variant is kept
+    bool                 kept;         ///< Whether the variant comes from a fixed toolkit source or was warmed up
+  };
+
+  /**
+   * @brief Finds the variant of a source, recording it if it's new.
+   *
+   * @return The index of the variant in mVariants
+   */
+  uint32_t FindVariant( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+  {
+    const std::size_t hash = GetHash( vertexShader, fragmentShader, hints );
+    const auto range = mVariantIds.equal_range( hash );
+    for( auto iter = range.first; iter != range.second; ++iter )
+    {
+      const Variant& variant = mVariants[ iter->second ];
+      if( variant.hints == hints && variant.vertexShader == vertexShader && variant.fragmentShader == fragmentShader )
+      {
+        return iter->second;
+      }
+    }
+
+    RemoveUnusedVariants();
+
+    const uint32_t variantId = static_cast< uint32_t >( mVariants.size() );
+    mVariants.push_back( Variant{ name, vertexShader, fragmentShader, hints, WeakHandle< Shader >(), WeakHandle< Shader >(), Shader(), false } );
+    mVariantIds.insert( std::make_pair( hash, variantId ) );
+    mMetrics.variants = static_cast< uint32_t >( mVariants.size() );
+    return variantId;
+  }
+
+  /**
+   * @brief Forgets the variants which are not kept and whose shaders were all destroyed.
+   *
+   * This is done when a new variant is recorded, so the variants generated per instance or given by the
+   * application don't accumulate.
+   */
+  void RemoveUnusedVariants()
+  {
+    const auto end = std::remove_if( mVariants.begin(), mVariants.end(), []( const Variant& variant )
+    {
+      return !variant.kept && !variant.sharedShader.GetHandle() && !variant.newShader.GetHandle();
+    } );
+    if( end == mVariants.end() )
+    {
+      return;
+    }
+    mVariants.erase( end, mVariants.end() );
+
+    mVariantIds.clear();
+    for( uint32_t variantId = 0u; variantId < mVariants.size(); ++variantId )
+    {
+      const Variant& variant = mVariants[ variantId ];
+      mVariantIds.insert( std::make_pair( GetHash( variant.vertexShader, variant.fragmentShader, variant.hints ), variantId ) );
+    }
+  }
+
+  /**
+   * @brief Creates a shader of a variant and counts it in the current frame.
+   */
+  Shader CreateShader( const Variant& variant )
+  {
+    ++mMetrics.creations;
+    ++mFrameCreations;
+    if( !mProcessorRegistered && Adaptor::IsAvailable() )
+    {
+      Adaptor::Get().RegisterProcessor( *this );
+      mProcessorRegistered = true;
+    }
+
+    return Shader::New( variant.vertexShader, variant.fragmentShader, variant.hints );
+  }
+
+private:
+
+  std::vector< Variant >                           mVariants;            ///< The sources recorded, in the order they were first seen
+  std::unordered_multimap< std::size_t, uint32_t > mVariantIds;          ///< The variants by hash of their source
+  Metrics                                          mMetrics;
+  uint32_t                                         mFrameCreations;      ///< The number of shaders created since the last frame was processed
+  bool                                             mProcessorRegistered;
+};
+
+ShaderRegistry::ShaderRegistry()
+{
+}
+
+ShaderRegistry::~ShaderRegistry()
+{
+}
+
+ShaderRegistry ShaderRegistry::Get()
+{
+  ShaderRegistry registry;
+
+  // Check whether the ShaderRegistry is already created
+  SingletonService singletonService( SingletonService::Get() );
+  if( singletonService )
+  {
+    Dali::BaseHandle handle = singletonService.GetSingleton( typeid( ShaderRegistry ) );
+    if( handle )
+    {
+      // If so, downcast the handle of singleton to ShaderRegistry
+      registry = ShaderRegistry( dynamic_cast< ShaderRegistry::Impl* >( handle.GetObjectPtr() ) );
+    }
+
+    if( !registry )
+    {
+      // If not, create the ShaderRegistry and register it as a singleton
+      registry = ShaderRegistry( new ShaderRegistry::Impl() );
+      singletonService.Register( typeid( registry ), registry );
+    }
+  }
+
+  return registry;
+}
+
+ShaderRegistry::ShaderRegistry( ShaderRegistry::Impl* impl )
+: BaseHandle( impl )
+{
+}
+
+Shader ShaderRegistry::GetShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+{
+  return static_cast< ShaderRegistry::Impl& >( GetBaseObject() ).GetShader( name, vertexShader, fragmentShader, hints, true );
+}
+
+Shader ShaderRegistry::GetGeneratedShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+{
+  return static_cast< ShaderRegistry::Impl& >( GetBaseObject() ).GetShader( name, vertexShader, fragmentShader, hints, false );
+}
+
+Shader ShaderRegistry::NewShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+{
+  return static_cast< ShaderRegistry::Impl& >( GetBaseObject() ).NewShader( name, vertexShader, fragmentShader, hints );
+}
+
+void ShaderRegistry::AddVariant( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader, Shader::Hint::Value hints )
+{
+  static_cast< ShaderRegistry::Impl& >( GetBaseObject() ).AddVariant( name, vertexShader, fragmentShader, hints );
+}
+
+void ShaderRegistry::GetVariantNames( std::vector< std::string >& names ) const
+{
+  static_cast< const ShaderRegistry::Impl& >( GetBaseObject() ).GetVariantNames( names );
+}
+
+uint32_t ShaderRegistry::WarmUp( const std::vector< std::string >& names )
+{
+  return static_cast< ShaderRegistry::Impl& >( GetBaseObject() ).WarmUp( names );
+}
+
+const ShaderRegistry::Metrics& ShaderRegistry::GetMetrics() const
+{
+  return static_cast< const ShaderRegistry::Impl& >( GetBaseObject() ).GetMetrics();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,187 @@
+#ifndef DALI_TOOLKIT_INTERNAL_SHADER_REGISTRY_H
+#define DALI_TOOLKIT_INTERNAL_SHADER_REGISTRY_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/rendering/shader.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The shaders created by the toolkit, by their source.
+ *
+ * Every variant of shader is recorded with its source, so the shaders with the same source are shared
+ * by all the visuals and controls, the variants can be listed, and a set of them can be created ahead
+ * of their first use to avoid compiling their program in the middle of an animation.
+ *
+ * Only the shaders of the fixed toolkit sources and of the variants warmed up are kept by the registry.
+ * The other shaders, generated per instance or given by the application, are only referenced weakly,
+ * and their variants are forgotten once their shaders are destroyed.
+ */
+class ShaderRegistry : public BaseHandle
+{
+public:
+
+  /**
+   * @brief Metrics of the shaders.
+   */
+  struct Metrics
+  {
+    Metrics()
+    : variants( 0u ),
+      requests( 0u ),
+      creations( 0u ),
+      lastFrameCreations( 0u ),
+      maxFrameCreations( 0u )
+    {}
+
+    uint32_t variants;           ///< The number of different sources currently recorded.
+    uint32_t requests;           ///< The number of shaders requested.
+    uint32_t creations;          ///< The number of shaders created.
+    uint32_t lastFrameCreations; ///< The number of shaders created by the last frame which created any.
+    uint32_t maxFrameCreations;  ///< The largest number of shaders created by a frame.
+  };
+
+  /**
+   * @brief Create an uninitialized handle.
+   */
+  ShaderRegistry();
+
+  /**
+   * @brief Destructor.
+   */
+  ~ShaderRegistry();
+
+  /**
+   * @brief Retrieves the singleton, creating it if necessary.
+   *
+   * @return The shader registry
+   */
+  static ShaderRegistry Get();
+
+  /**
+   * @brief Retrieves the shared shader of a fixed toolkit source, creating it if necessary.
+   *
+   * The shader is kept by the registry. Its properties must not be changed after the first time it's created.
+   *
+   * @param[in] name The name of the variant, e.g. the visual or control using it
+   * @param[in] vertexShader The source of the vertex shader
+   * @param[in] fragmentShader The source of the fragment shader
+   * @param[in] hints The hints of the shader
+   * @return The shader
+   */
+  Shader GetShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader,
+                    Shader::Hint::Value hints = Shader::Hint::NONE );
+
+  /**
+   * @brief Retrieves the shared shader of a source generated per instance, e.g. for a number of stretch pixels.
+   *
+   * The shader is shared while it's used, but not kept by the registry unless its variant was warmed up.
+   * Its properties must not be changed after the first time it's created.
+   *
+   * @param[in] name The name of the variant, e.g. the visual or control using it
+   * @param[in] vertexShader The source of the vertex shader
+   * @param[in] fragmentShader The source of the fragment shader
+   * @param[in] hints The hints of the shader
+   * @return The shader
+   */
+  Shader GetGeneratedShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader,
+                             Shader::Hint::Value hints = Shader::Hint::NONE );
+
+  /**
+   * @brief Creates a shader which is not shared, for a user which sets its properties or a custom shader.
+   *
+   * The variant is recorded while the last shader created for it is alive, unless it was added or warmed up.
+   *
+   * @param[in] name The name of the variant, e.g. the visual or control using it
+   * @param[in] vertexShader The source of the vertex shader
+   * @param[in] fragmentShader The source of the fragment shader
+   * @param[in] hints The hints of the shader
+   * @return The new shader
+   */
+  Shader NewShader( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader,
+                    Shader::Hint::Value hints = Shader::Hint::NONE );
+
+  /**
+   * @brief Records the variant of a fixed toolkit source without creating its shader, so it may be warmed
+   * up before its first use.
+   *
+   * @param[in] name The name of the variant
+   * @param[in] vertexShader The source of the vertex shader
+   * @param[in] fragmentShader The source of the fragment shader
+   * @param[in] hints The hints of the shader
+   */
+  void AddVariant( const std::string& name, const std::string& vertexShader, const std::string& fragmentShader,
+                   Shader::Hint::Value hints = Shader::Hint::NONE );
+
+  /**
+   * @brief Retrieves the names of the variants recorded, once each.
+   *
+   * @param[out] names The names
+   */
+  void GetVariantNames( std::vector< std::string >& names ) const;
+
+  /**
+   * @brief Creates the shaders of the variants with the given names which don't have one yet.
+   *
+   * The program of a shader is compiled on the render thread once the shader is created, and kept
+   * by the program cache, so the first draw of the variant doesn't wait for it. The shaders of the variants
+   * warmed up are kept by the registry.
+   *
+   * @param[in] names The names of the variants, or all the variants if empty
+   * @return The number of shaders created
+   */
+  uint32_t WarmUp( const std::vector< std::string >& names );
+
+  /**
+   * @brief Retrieves the metrics of the shaders.
+   *
+   * @return The metrics
+   */
+  const Metrics& GetMetrics() const;
+
+private:
+
+  class Impl;
+
+  /**
+   * @brief This constructor is used by ShaderRegistry::Get().
+   *
+   * @param[in] impl A pointer to a newly allocated Dali resource.
+   */
+  explicit DALI_INTERNAL ShaderRegistry( Impl* impl );
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_SHADER_REGISTRY_H
@@ -67,14 +67,17 @@ uint32_t AsyncImageLoader::Load( const VisualUrl& url,
                                  FittingMode::Type fittingMode,
                                  SamplingMode::Type samplingMode,
                                  bool orientationCorrection,
-                                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
+                                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                 bool analyseOpacity,
+                                 bool loadCompressed )
 {
   if( !mIsLoadThreadStarted )
   {
     mLoadThread.Start();
     mIsLoadThreadStarted = true;
   }
-  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, url, dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad ) );
+  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, url, dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad,
+                                        analyseOpacity, loadCompressed ) );
 
   return mLoadTaskId;
 }
@@ -105,6 +108,11 @@ Toolkit::DevelAsyncImageLoader::PixelBufferLoadedSignalType& AsyncImageLoader::P
   return mPixelBufferLoadedSignal;
 }
 
+AsyncImageLoader::LoadingTaskCompletedSignalType& AsyncImageLoader::LoadingTaskCompletedSignal()
+{
+  return mLoadingTaskCompletedSignal;
+}
+
 bool AsyncImageLoader::Cancel( uint32_t loadingTaskId )
 {
   return mLoadThread.CancelTask( loadingTaskId );
@@ -119,7 +127,11 @@ void AsyncImageLoader::ProcessLoadedImage()
 {
   while( LoadingTask *next = mLoadThread.NextCompletedTask() )
   {
-    if( mPixelBufferLoadedSignal.GetConnectionCount() > 0 )
+    if( mLoadingTaskCompletedSignal.GetConnectionCount() > 0 )
+    {
+      mLoadingTaskCompletedSignal.Emit( *next );
+    }
+    else if( mPixelBufferLoadedSignal.GetConnectionCount() > 0 )
     {
       mPixelBufferLoadedSignal.Emit( next->id, next->pixelBuffer );
     }
@@ -39,6 +39,11 @@ class AsyncImageLoader : public BaseObject
 {
 public:
 
+  /**
+   * @brief The signal type of the completed loading tasks.
+   */
+  typedef Signal< void( const LoadingTask& ) > LoadingTaskCompletedSignalType;
+
   /**
    * Constructor
    */
@@ -57,13 +62,17 @@ public:
 
   /**
    * @copydoc Toolkit::AsyncImageLoader::Load( const std::string&, ImageDimensions, FittingMode::Type, SamplingMode::Type, bool , DevelAsyncImageLoader::PreMultiplyOnLoad )
+   * @param[in] analyseOpacity Whether to find the opaque and transparent regions of the image, @see LoadingTaskCompletedSignal()
+   * @param[in] loadCompressed Whether to keep the GPU compressed pixels of a KTX file, @see LoadingTaskCompletedSignal()
    */
   uint32_t Load( const VisualUrl& url,
                  ImageDimensions dimensions,
                  FittingMode::Type fittingMode,
                  SamplingMode::Type samplingMode,
                  bool orientationCorrection,
-                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
+                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                 bool analyseOpacity = false,
+                 bool loadCompressed = false );
 
   /**
    * @brief Starts an mask applying task.
@@ -90,6 +99,19 @@ public:
    */
   Toolkit::DevelAsyncImageLoader::PixelBufferLoadedSignalType& PixelBufferLoadedSignal();
 
+  /**
+   * @brief Signal emitted instead of the other signals when an image is loaded, with the whole loading task.
+   *
+   * A callback of the following type may be connected:
+   * @code
+   *   void YourCallbackName( const LoadingTask& task );
+   * @endcode
+   * Besides the pixel buffer, the task holds the opaque and transparent regions found in the loading thread
+   * and the compressed pixels loaded instead of the pixel buffer, if they were requested.
+   * @return A reference to a signal object to Connect() with.
+   */
+  LoadingTaskCompletedSignalType& LoadingTaskCompletedSignal();
+
   /**
    * @copydoc Toolkit::AsyncImageLoader::Cancel
    */
@@ -115,6 +137,7 @@ protected:
 private:
   Toolkit::AsyncImageLoader::ImageLoadedSignalType mLoadedSignal;
   Toolkit::DevelAsyncImageLoader::PixelBufferLoadedSignalType mPixelBufferLoadedSignal;
+  LoadingTaskCompletedSignalType mLoadingTaskCompletedSignal;
 
   ImageLoadThread mLoadThread;
   uint32_t        mLoadTaskId;
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/image-loader/compressed-image.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel-data.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gCompressedImageLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_COMPRESSED_IMAGE" );
+#endif
+
+const uint8_t KTX_IDENTIFIER[] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A }; ///< "«KTX 11»\r\n\x1A\n"
+const uint32_t KTX_ENDIANNESS = 0x04030201; ///< The endianness field of a container written with the same endianness
+
+/**
+ * @brief The header of a KTX 1.1 container, following the identifier.
+ */
+struct KtxHeader
+{
+  uint32_t endianness;
+  uint32_t glType;
+  uint32_t glTypeSize;
+  uint32_t glFormat;
+  uint32_t glInternalFormat;
+  uint32_t glBaseInternalFormat;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t numberOfArrayElements;
+  uint32_t numberOfFaces;
+  uint32_t numberOfMipmapLevels;
+  uint32_t bytesOfKeyValueData;
+};
+
+const uint32_t KTX_HEADER_SIZE = sizeof( KTX_IDENTIFIER ) + sizeof( KtxHeader );
+
+/**
+ * @brief Retrieves the pixel format of a compressed GL internal format.
+ *
+ * @param[in] glInternalFormat The GL internal format.
+ * @param[out] pixelFormat The pixel format.
+ * @return True if the format is supported.
+ */
+bool GetPixelFormat( uint32_t glInternalFormat, Pixel::Format& pixelFormat )
+{
+  switch( glInternalFormat )
+  {
+    case 0x8D64: pixelFormat = Pixel::COMPRESSED_RGB8_ETC1; break;
+    case 0x9270: pixelFormat = Pixel::COMPRESSED_R11_EAC; break;
+    case 0x9271: pixelFormat = Pixel::COMPRESSED_SIGNED_R11_EAC; break;
+    case 0x9272: pixelFormat = Pixel::COMPRESSED_RG11_EAC; break;
+    case 0x9273: pixelFormat = Pixel::COMPRESSED_SIGNED_RG11_EAC; break;
+    case 0x9274: pixelFormat = Pixel::COMPRESSED_RGB8_ETC2; break;
+    case 0x9275: pixelFormat = Pixel::COMPRESSED_SRGB8_ETC2; break;
+    case 0x9276: pixelFormat = Pixel::COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2; break;
+    case 0x9277: pixelFormat = Pixel::COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2; break;
+    case 0x9278: pixelFormat = Pixel::COMPRESSED_RGBA8_ETC2_EAC; break;
+    case 0x9279: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ETC2_EAC; break;
+    case 0x8C00: pixelFormat = Pixel::COMPRESSED_RGB_PVRTC_4BPPV1; break;
+    case 0x93B0: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR; break;
+    case 0x93B1: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_5x4_KHR; break;
+    case 0x93B2: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_5x5_KHR; break;
+    case 0x93B3: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_6x5_KHR; break;
+    case 0x93B4: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_6x6_KHR; break;
+    case 0x93B5: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_8x5_KHR; break;
+    case 0x93B6: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_8x6_KHR; break;
+    case 0x93B7: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_8x8_KHR; break;
+    case 0x93B8: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_10x5_KHR; break;
+    case 0x93B9: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_10x6_KHR; break;
+    case 0x93BA: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_10x8_KHR; break;
+    case 0x93BB: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_10x10_KHR; break;
+    case 0x93BC: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_12x10_KHR; break;
+    case 0x93BD: pixelFormat = Pixel::COMPRESSED_RGBA_ASTC_12x12_KHR; break;
+    case 0x93D0: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR; break;
+    case 0x93D1: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR; break;
+    case 0x93D2: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR; break;
+    case 0x93D3: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR; break;
+    case 0x93D4: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR; break;
+    case 0x93D5: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR; break;
+    case 0x93D6: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR; break;
+    case 0x93D7: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR; break;
+    case 0x93D8: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR; break;
+    case 0x93D9: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR; break;
+    case 0x93DA: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR; break;
+    case 0x93DB: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR; break;
+    case 0x93DC: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR; break;
+    case 0x93DD: pixelFormat = Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR; break;
+    default:
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // unnamed namespace
+
+CompressedImagePtr CompressedImage::New( const std::string& path, ImageDimensions desiredSize )
+{
+  Dali::Vector< char > buffer;
+  if( !Dali::FileLoader::ReadFile( path, buffer ) )
+  {
+    return CompressedImagePtr();
+  }
+  return New( buffer, desiredSize );
+}
+
+CompressedImagePtr CompressedImage::New( Dali::Vector< char >& buffer, ImageDimensions desiredSize )
+{
+  CompressedImagePtr image = new CompressedImage();
+  image->mBuffer.Swap( buffer );
+  if( !image->Parse( desiredSize ) )
+  {
+    // Give the content back, so it can be decoded instead.
+    buffer.Swap( image->mBuffer );
+    image.Reset();
+  }
+  return image;
+}
+
+Pixel::Format CompressedImage::GetPixelFormat() const
+{
+  return mPixelFormat;
+}
+
+uint32_t CompressedImage::GetWidth() const
+{
+  return mLevels[ 0 ].width;
+}
+
+uint32_t CompressedImage::GetHeight() const
+{
+  return mLevels[ 0 ].height;
+}
+
+uint32_t CompressedImage::GetLevelCount() const
+{
+  return mLevels.Count();
+}
+
+Texture CompressedImage::CreateTexture() const
+{
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, GetWidth(), GetHeight() );
+  for( uint32_t levelIndex = 0u; levelIndex < mLevels.Count(); ++levelIndex )
+  {
+    const Level& level = mLevels[ levelIndex ];
+    uint8_t* pixels = static_cast< uint8_t* >( malloc( level.size ) );
+    memcpy( pixels, mBuffer.Begin() + level.offset, level.size );
+
+    PixelData pixelData = PixelData::New( pixels, level.size, level.width, level.height, mPixelFormat, PixelData::FREE );
+    texture.Upload( pixelData, 0u, levelIndex, 0u, 0u, level.width, level.height );
+  }
+  return texture;
+}
+
+CompressedImage::~CompressedImage()
+{
+}
+
+CompressedImage::CompressedImage()
+: mBuffer(),
+  mLevels(),
+  mPixelFormat( Pixel::INVALID )
+{
+}
+
+bool CompressedImage::Parse( ImageDimensions desiredSize )
+{
+  const uint32_t bufferSize = mBuffer.Count();
+  if( bufferSize < KTX_HEADER_SIZE || memcmp( mBuffer.Begin(), KTX_IDENTIFIER, sizeof( KTX_IDENTIFIER ) ) != 0 )
+  {
+    return false;
+  }
+
+  KtxHeader header;
+  memcpy( &header, mBuffer.Begin() + sizeof( KTX_IDENTIFIER ), sizeof( KtxHeader ) );
+
+  // Only the compressed 2D textures written with the same endianness are passed through.
+  if( header.endianness != KTX_ENDIANNESS || header.glType != 0u || header.glFormat != 0u ||
+      header.pixelWidth == 0u || header.pixelHeight == 0u || header.pixelDepth > 1u ||
+      header.numberOfArrayElements > 1u || header.numberOfFaces != 1u ||
+      !GetPixelFormat( header.glInternalFormat, mPixelFormat ) )
+  {
+    DALI_LOG_INFO( gCompressedImageLogFilter, Debug::General, "CompressedImage::Parse: Unsupported container, internal format 0x%x\n", header.glInternalFormat );
+    return false;
+  }
+
+  const uint32_t levelCount = std::max( header.numberOfMipmapLevels, 1u );
+  uint64_t offset = static_cast< uint64_t >( KTX_HEADER_SIZE ) + header.bytesOfKeyValueData;
+  for( uint32_t levelIndex = 0u; levelIndex < levelCount; ++levelIndex )
+  {
+    if( offset + sizeof( uint32_t ) > bufferSize )
+    {
+      return false;
+    }
+    uint32_t imageSize;
+    memcpy( &imageSize, mBuffer.Begin() + offset, sizeof( uint32_t ) );
+    offset += sizeof( uint32_t );
+
+    if( imageSize == 0u || offset + imageSize > bufferSize )
+    {
+      return false;
+    }
+
+    Level level;
+    level.width = std::max( header.pixelWidth >> levelIndex, 1u );
+    level.height = std::max( header.pixelHeight >> levelIndex, 1u );
+    level.offset = static_cast< uint32_t >( offset );
+    level.size = imageSize;
+    mLevels.PushBack( level );
+
+    // The levels are aligned to 4 bytes.
+    offset += ( imageSize + 3u ) & ~3u;
+  }
+
+  // Skip the levels bigger than needed, as they would only be minified.
+  const uint32_t desiredWidth = desiredSize.GetWidth();
+  const uint32_t desiredHeight = desiredSize.GetHeight();
+  uint32_t skippedLevels = 0u;
+  if( desiredWidth > 0u || desiredHeight > 0u )
+  {
+    while( skippedLevels + 1u < mLevels.Count() &&
+           mLevels[ skippedLevels + 1u ].width >= desiredWidth &&
+           mLevels[ skippedLevels + 1u ].height >= desiredHeight )
+    {
+      ++skippedLevels;
+    }
+    mLevels.Erase( mLevels.Begin(), mLevels.Begin() + skippedLevels );
+  }
+
+  DALI_LOG_INFO( gCompressedImageLogFilter, Debug::General, "CompressedImage::Parse: %ux%u, internal format 0x%x, %u levels, %u skipped\n",
+                 GetWidth(), GetHeight(), header.glInternalFormat, mLevels.Count(), skippedLevels );
+
+  return true;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
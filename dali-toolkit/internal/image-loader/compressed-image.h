@@ -0,0 +1,160 @@
+#ifndef DALI_TOOLKIT_INTERNAL_COMPRESSED_IMAGE_H
+#define DALI_TOOLKIT_INTERNAL_COMPRESSED_IMAGE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/texture.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class CompressedImage;
+typedef IntrusivePtr< CompressedImage > CompressedImagePtr;
+
+/**
+ * @brief The GPU compressed pixels of a KTX container.
+ *
+ * The mip levels are kept as they are stored in the file, so they can be uploaded to a texture
+ * without being decoded. Only the 2D textures whose format is supported by Dali are read.
+ *
+ * The container can be read in the image loading threads. The texture must be created in the
+ * event thread.
+ */
+class CompressedImage : public RefObject
+{
+public:
+
+  /**
+   * @brief Reads a KTX file.
+   *
+   * @param[in] path The path of the file.
+   * @param[in] desiredSize The size the image is displayed at. The mip levels bigger than needed for this size are skipped.
+   * @return The compressed image or an empty pointer if the file can't be uploaded without being decoded.
+   */
+  static CompressedImagePtr New( const std::string& path, ImageDimensions desiredSize );
+
+  /**
+   * @brief Reads a KTX container in memory.
+   *
+   * @param[in,out] buffer The content of the container, which is taken by the image on success.
+   * @param[in] desiredSize The size the image is displayed at. The mip levels bigger than needed for this size are skipped.
+   * @return The compressed image or an empty pointer if the container can't be uploaded without being decoded.
+   */
+  static CompressedImagePtr New( Dali::Vector< char >& buffer, ImageDimensions desiredSize );
+
+  /**
+   * @brief Retrieves the compressed pixel format.
+   *
+   * @return The pixel format.
+   */
+  Pixel::Format GetPixelFormat() const;
+
+  /**
+   * @brief Retrieves the width of the biggest mip level which is kept.
+   *
+   * @return The width in pixels.
+   */
+  uint32_t GetWidth() const;
+
+  /**
+   * @brief Retrieves the height of the biggest mip level which is kept.
+   *
+   * @return The height in pixels.
+   */
+  uint32_t GetHeight() const;
+
+  /**
+   * @brief Retrieves the number of mip levels which are kept.
+   *
+   * @return The number of mip levels.
+   */
+  uint32_t GetLevelCount() const;
+
+  /**
+   * @brief Creates a texture and uploads all the mip levels to it.
+   *
+   * @return The texture.
+   */
+  Texture CreateTexture() const;
+
+protected:
+
+  /**
+   * @brief Destructor.
+   */
+  ~CompressedImage() override;
+
+private:
+
+  /**
+   * @brief A mip level within the buffer.
+   */
+  struct Level
+  {
+    uint32_t width;  ///< The width in pixels
+    uint32_t height; ///< The height in pixels
+    uint32_t offset; ///< The offset of the compressed pixels in the buffer
+    uint32_t size;   ///< The size of the compressed pixels in bytes
+  };
+
+  /**
+   * @brief Constructor.
+   */
+  CompressedImage();
+
+  /**
+   * @brief Reads the header and finds the mip levels.
+   *
+   * @param[in] desiredSize The size the image is displayed at.
+   * @return True if the container holds a supported 2D compressed texture.
+   */
+  bool Parse( ImageDimensions desiredSize );
+
+  // Undefined
+  CompressedImage( const CompressedImage& );
+
+  // Undefined
+  CompressedImage& operator=( const CompressedImage& );
+
+private:
+
+  Dali::Vector< char >  mBuffer;      ///< The content of the container
+  Dali::Vector< Level > mLevels;      ///< The mip levels kept, from the biggest one
+  Pixel::Format         mPixelFormat; ///< The compressed pixel format
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_COMPRESSED_IMAGE_H
@@ -33,6 +33,13 @@ namespace Toolkit
 namespace Internal
 {
 
+namespace
+{
+
+const uint32_t OPACITY_MAP_TILE_SIZE = 64u; ///< The size of the regions of the images whose opacity is analysed, in pixels.
+
+} // unnamed namespace
+
 LoadingTask::LoadingTask( uint32_t id, Dali::AnimatedImageLoading animatedImageLoading, uint32_t frameIndex )
 : pixelBuffer(),
   url(),
@@ -47,12 +54,17 @@ LoadingTask::LoadingTask( uint32_t id, Dali::AnimatedImageLoading animatedImageL
   contentScale( 1.0f ),
   cropToMask( false ),
   animatedImageLoading( animatedImageLoading ),
-  frameIndex( frameIndex )
+  frameIndex( frameIndex ),
+  analyseOpacity( false ),
+  opacityMap(),
+  loadCompressed( false ),
+  compressedImage()
 {
 }
 
 LoadingTask::LoadingTask( uint32_t id, const VisualUrl& url, ImageDimensions dimensions,
-                          FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
+                          FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                          bool analyseOpacity, bool loadCompressed )
 : pixelBuffer(),
   url( url ),
   id( id ),
@@ -66,7 +78,11 @@ LoadingTask::LoadingTask( uint32_t id, const VisualUrl& url, ImageDimensions dim
   contentScale( 1.0f ),
   cropToMask( false ),
   animatedImageLoading(),
-  frameIndex( 0u )
+  frameIndex( 0u ),
+  analyseOpacity( analyseOpacity ),
+  opacityMap(),
+  loadCompressed( loadCompressed ),
+  compressedImage()
 {
 }
 
@@ -85,12 +101,26 @@ LoadingTask::LoadingTask( uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::Pi
   contentScale( contentScale ),
   cropToMask( cropToMask ),
   animatedImageLoading(),
-  frameIndex( 0u )
+  frameIndex( 0u ),
+  analyseOpacity( false ),
+  opacityMap(),
+  loadCompressed( false ),
+  compressedImage()
 {
 }
 
 void LoadingTask::Load()
-{;
+{
+  if( loadCompressed && url.GetType() == VisualUrl::KTX && url.IsLocalResource() )
+  {
+    // The compressed pixels are uploaded as they are. Unsupported formats are decoded below.
+    compressedImage = CompressedImage::New( url.GetUrl(), dimensions );
+    if( compressedImage )
+    {
+      return;
+    }
+  }
+
   if( animatedImageLoading )
   {
     pixelBuffer = animatedImageLoading.LoadFrame( frameIndex );
@@ -126,6 +156,14 @@ void LoadingTask::MultiplyAlpha()
   }
 }
 
+void LoadingTask::AnalyseOpacity()
+{
+  if( analyseOpacity && pixelBuffer )
+  {
+    opacityMap = OpacityMap::New( pixelBuffer, OPACITY_MAP_TILE_SIZE );
+  }
+}
+
 ImageLoadThread::ImageLoadThread( EventThreadCallback* trigger )
 : mTrigger( trigger ),
   mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
@@ -170,6 +208,7 @@ void ImageLoadThread::Run()
       task->ApplyMask();
     }
     task->MultiplyAlpha();
+    task->AnalyseOpacity();
 
     AddCompletedTask( task );
   }
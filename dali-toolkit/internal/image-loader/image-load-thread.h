@@ -26,6 +26,8 @@
 #include <dali/devel-api/threading/thread.h>
 #include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali-toolkit/internal/image-loader/compressed-image.h>
+#include <dali-toolkit/internal/visuals/opacity-map.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
 #include <dali/integration-api/adaptor-framework/log-factory-interface.h>
@@ -63,6 +65,8 @@ struct LoadingTask
    * @param [in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size.
    * @param [in] orientationCorrection Reorient the image to respect any orientation metadata in its header.
    * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
+   * @param [in] analyseOpacity Whether to find the opaque and transparent regions of the loaded image.
+   * @param [in] loadCompressed Whether to keep the GPU compressed pixels of a KTX file instead of decoding them.
    */
   LoadingTask( uint32_t id,
                const VisualUrl& url,
@@ -70,7 +74,9 @@ struct LoadingTask
                FittingMode::Type fittingMode,
                SamplingMode::Type samplingMode,
                bool orientationCorrection,
-               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
+               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+               bool analyseOpacity,
+               bool loadCompressed );
 
   /**
    * Constructor.
@@ -103,6 +109,11 @@ struct LoadingTask
    */
   void MultiplyAlpha();
 
+  /**
+   * Find the opaque and transparent regions of the image, if requested
+   */
+  void AnalyseOpacity();
+
 private:
 
   // Undefined
@@ -129,6 +140,10 @@ public:
   bool cropToMask;                  ///< Whether to crop the content to the mask size
   Dali::AnimatedImageLoading animatedImageLoading;
   uint32_t frameIndex;
+  bool analyseOpacity;              ///< Whether to find the opaque and transparent regions of the image
+  OpacityMapPtr opacityMap;         ///< The opaque and transparent regions of the image, if any
+  bool loadCompressed;              ///< Whether to keep the compressed pixels of a KTX file
+  CompressedImagePtr compressedImage; ///< The compressed pixels, loaded instead of the pixelBuffer
 };
 
 
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/text/color-segmentation.h>
 
 // EXTERNAL INCLUDES
+#include <cmath>
 
 // INTERNAL INCLUDES
 
@@ -33,33 +34,175 @@ namespace Toolkit
 namespace Text
 {
 
+namespace
+{
+
+const float MAX_CHANNEL_VALUE = 255.f;
+const float QUANTIZATION_TOLERANCE = 0.001f; ///< Distance to a rounding boundary within which two equal colors may be quantized differently.
+const unsigned int NUMBER_OF_CHANNELS = 4u;
+
+/**
+ * @brief Scales a color channel to the [0..255] range.
+ *
+ * @param[in] channel The color channel.
+ *
+ * @return The scaled channel.
+ */
+float ScaleChannel( float channel )
+{
+  return MAX_CHANNEL_VALUE * std::min( 1.f, std::max( 0.f, channel ) );
+}
+
+/**
+ * @brief Packs four quantized channels into a key.
+ *
+ * @param[in] channels The quantized channels.
+ *
+ * @return The key.
+ */
+uint32_t PackKey( const uint32_t* const channels )
+{
+  return ( channels[0u] << 24u ) | ( channels[1u] << 16u ) | ( channels[2u] << 8u ) | channels[3u];
+}
+
+/**
+ * @brief Quantizes a color to 8 bits per channel.
+ *
+ * @param[in] color The color.
+ *
+ * @return The key of the color in the lookup table.
+ */
+uint32_t GetColorKey( const Vector4& color )
+{
+  const uint32_t channels[NUMBER_OF_CHANNELS] = { static_cast<uint32_t>( lroundf( ScaleChannel( color.r ) ) ),
+                                                  static_cast<uint32_t>( lroundf( ScaleChannel( color.g ) ) ),
+                                                  static_cast<uint32_t>( lroundf( ScaleChannel( color.b ) ) ),
+                                                  static_cast<uint32_t>( lroundf( ScaleChannel( color.a ) ) ) };
+
+  return PackKey( channels );
+}
+
+/**
+ * @brief Adds to the lookup table the colors not indexed yet.
+ *
+ * @param[in] colors The vector of colors.
+ * @param[in,out] colorLookupTable The lookup table.
+ */
+void UpdateColorLookupTable( const Vector<Vector4>& colors,
+                             ColorLookupTable& colorLookupTable )
+{
+  const Length numberOfColors = colors.Count();
+
+  if( numberOfColors < colorLookupTable.numberOfColors )
+  {
+    // The vector of colors has been cleared. Index it again.
+    colorLookupTable.indices.clear();
+    colorLookupTable.numberOfColors = 0u;
+  }
+
+  for( Length index = colorLookupTable.numberOfColors; index < numberOfColors; ++index )
+  {
+    colorLookupTable.indices.insert( std::make_pair( GetColorKey( *( colors.Begin() + index ) ), index + 1u ) );
+  }
+
+  colorLookupTable.numberOfColors = numberOfColors;
+}
+
+/**
+ * @brief Finds the smallest index of the colors stored with the given key which are equal to the given color.
+ *
+ * @param[in] colors The vector of colors.
+ * @param[in] colorLookupTable The lookup table.
+ * @param[in] key The key.
+ * @param[in] color The color to find.
+ * @param[in,out] index The smallest index found so far. Zero if no color has been found.
+ */
+void FindColorWithKey( const Vector<Vector4>& colors,
+                       const ColorLookupTable& colorLookupTable,
+                       uint32_t key,
+                       const Vector4& color,
+                       ColorIndex& index )
+{
+  const auto range = colorLookupTable.indices.equal_range( key );
+  for( auto it = range.first; it != range.second; ++it )
+  {
+    const ColorIndex candidate = it->second;
+    if( ( ( 0u == index ) || ( candidate < index ) ) &&
+        ( color == *( colors.Begin() + candidate - 1u ) ) )
+    {
+      index = candidate;
+    }
+  }
+}
+
+} // namespace
+
 /**
  * @brief Finds a color in the vector of colors.
  *        It inserts the color in the vector if it's not in.
  *
+ * Returns the same index a linear search from the beginning of the vector would return.
+ * The colors are compared with the Vector4's equal operator which has a tolerance, therefore
+ * the keys a close color may have been quantized to are looked up as well if the color is close to a rounding boundary.
+ *
  * @param[in,out] colors The vector of colors.
+ * @param[in,out] colorLookupTable The lookup table of the vector of colors.
  * @param[in] color The color to find.
  *
  * @return The index + 1 where the color is in the vector. The index zero is reserved for the default color.
  */
 ColorIndex FindColor( Vector<Vector4>& colors,
+                      ColorLookupTable& colorLookupTable,
                       const Vector4& color )
 {
-  ColorIndex index = 1u; // The index zero is reserved for the default color.
-  for( Vector<Vector4>::Iterator it = colors.Begin(),
-         endIt = colors.End();
-       it != endIt;
-       ++it )
+  uint32_t channels[NUMBER_OF_CHANNELS];
+  uint32_t alternativeChannels[NUMBER_OF_CHANNELS];
+  unsigned int alternativeMask = 0u;
+
+  for( unsigned int channelIndex = 0u; channelIndex < NUMBER_OF_CHANNELS; ++channelIndex )
+  {
+    const float scaled = ScaleChannel( color.AsFloat()[channelIndex] );
+    channels[channelIndex] = static_cast<uint32_t>( lroundf( scaled ) );
+    alternativeChannels[channelIndex] = channels[channelIndex];
+
+    const float fraction = scaled - floorf( scaled );
+    if( fabsf( fraction - 0.5f ) < QUANTIZATION_TOLERANCE )
+    {
+      // A color equal to this one may have been rounded the other way.
+      alternativeChannels[channelIndex] = ( channels[channelIndex] == static_cast<uint32_t>( floorf( scaled ) ) ) ? channels[channelIndex] + 1u : channels[channelIndex] - 1u;
+      alternativeMask |= ( 1u << channelIndex );
+    }
+  }
+
+  ColorIndex index = 0u;
+  FindColorWithKey( colors, colorLookupTable, PackKey( channels ), color, index );
+
+  for( unsigned int mask = 1u; mask < ( 1u << NUMBER_OF_CHANNELS ); ++mask )
   {
-    if( color == *it )
+    if( mask != ( mask & alternativeMask ) )
     {
-      return index;
+      continue;
     }
 
-    ++index;
+    uint32_t candidateChannels[NUMBER_OF_CHANNELS];
+    for( unsigned int channelIndex = 0u; channelIndex < NUMBER_OF_CHANNELS; ++channelIndex )
+    {
+      candidateChannels[channelIndex] = ( mask & ( 1u << channelIndex ) ) ? alternativeChannels[channelIndex] : channels[channelIndex];
+    }
+
+    FindColorWithKey( colors, colorLookupTable, PackKey( candidateChannels ), color, index );
+  }
+
+  if( 0u != index )
+  {
+    return index;
   }
 
   colors.PushBack( color );
+  index = colors.Count();
+
+  colorLookupTable.indices.insert( std::make_pair( PackKey( channels ), index ) );
+  colorLookupTable.numberOfColors = index;
 
   return index;
 }
@@ -72,6 +215,28 @@ void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
                                Length numberOfCharacters,
                                Vector<Vector4>& colors,
                                Vector<ColorIndex>& colorIndices )
+{
+  ColorLookupTable colorLookupTable;
+  SetColorSegmentationInfo( colorRuns,
+                            charactersToGlyph,
+                            glyphsPerCharacter,
+                            startCharacterIndex,
+                            startGlyphIndex,
+                            numberOfCharacters,
+                            colors,
+                            colorLookupTable,
+                            colorIndices );
+}
+
+void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
+                               const Vector<GlyphIndex>& charactersToGlyph,
+                               const Vector<Length>& glyphsPerCharacter,
+                               CharacterIndex startCharacterIndex,
+                               GlyphIndex startGlyphIndex,
+                               Length numberOfCharacters,
+                               Vector<Vector4>& colors,
+                               ColorLookupTable& colorLookupTable,
+                               Vector<ColorIndex>& colorIndices )
 {
   if( 0u == charactersToGlyph.Count() )
   {
@@ -93,6 +258,9 @@ void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
 
   ColorIndex* newColorIndicesBuffer = newColorIndices.Begin();
 
+  // Index the colors added since the previous update.
+  UpdateColorLookupTable( colors, colorLookupTable );
+
   // Convert from characters to glyphs.
   Length index = 0u;
   for( Vector<ColorRun>::ConstIterator it = colorRuns.Begin(),
@@ -108,7 +276,7 @@ void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
       if( 0u < colorRun.characterRun.numberOfCharacters )
       {
         // Find the color index.
-        const ColorIndex colorIndex = FindColor( colors, colorRun.color );
+        const ColorIndex colorIndex = FindColor( colors, colorLookupTable, colorRun.color );
 
         // Get the index to the last character of the run.
         const CharacterIndex lastIndex = colorRun.characterRun.characterIndex + colorRun.characterRun.numberOfCharacters - 1u;
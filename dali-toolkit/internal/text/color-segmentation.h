@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/color-run.h>
@@ -35,6 +36,23 @@ namespace Text
 
 class LogicalModel;
 
+/**
+ * @brief Hashed index over a vector of colors used to find the index of a color without a linear search.
+ *
+ * The vector of colors is append-only while the text is updated, so the table only indexes the colors
+ * added since the last update. It's rebuilt if the vector of colors shrinks (i.e. it has been cleared).
+ */
+struct ColorLookupTable
+{
+  ColorLookupTable()
+  : indices(),
+    numberOfColors( 0u )
+  {}
+
+  std::unordered_multimap<uint32_t, ColorIndex> indices; ///< Maps a color quantized to 8 bits per channel to the index + 1 of the colors with that key.
+  Length numberOfColors;                                 ///< The number of colors of the vector already indexed.
+};
+
 /**
  * @brief Creates color glyph runs.
  *
@@ -56,6 +74,32 @@ void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
                                Vector<Vector4>& colors,
                                Vector<ColorIndex>& colorIndices );
 
+/**
+ * @brief Creates color glyph runs.
+ *
+ * Same as above but the lookup table of the vector of colors is kept between calls,
+ * so only the colors added since the previous call are indexed.
+ *
+ * @param[in] colorRuns The color runs in characters (set in the mark-up string).
+ * @param[in] charactersToGlyph Conversion table from characters to glyphs.
+ * @param[in] glyphsPerCharacter Table with the number of glyphs for each character.
+ * @param[in] startCharacterIndex The character from where the text is shaped.
+ * @param[in] startGlyphIndex The glyph from where the text is shaped.
+ * @param[in] numberOfCharacters The number of characters to be shaped.
+ * @param[in,out] colors The vector of colors.
+ * @param[in,out] colorLookupTable The lookup table of the vector of colors.
+ * @param[out] colorIndices Indices to the vector of colors.
+ */
+void SetColorSegmentationInfo( const Vector<ColorRun>& colorRuns,
+                               const Vector<GlyphIndex>& charactersToGlyph,
+                               const Vector<Length>& glyphsPerCharacter,
+                               CharacterIndex startCharacterIndex,
+                               GlyphIndex startGlyphIndex,
+                               Length numberOfCharacters,
+                               Vector<Vector4>& colors,
+                               ColorLookupTable& colorLookupTable,
+                               Vector<ColorIndex>& colorIndices );
+
 } // namespace Text
 
 } // namespace Toolkit
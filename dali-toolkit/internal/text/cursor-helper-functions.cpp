@@ -139,41 +139,8 @@ LineIndex GetClosestLine( VisualModelPtr visualModel,
                           float visualY,
                           bool& matchedLine )
 {
-  float totalHeight = 0.f;
-  LineIndex lineIndex = 0;
-  matchedLine = false;
-
-  if( visualY < 0.f )
-  {
-    return 0;
-  }
-
-  const Vector<LineRun>& lines = visualModel->mLines;
-
-  for( Vector<LineRun>::ConstIterator it = lines.Begin(),
-         endIt = lines.End();
-       it != endIt;
-       ++it, ++lineIndex )
-  {
-    const LineRun& lineRun = *it;
-
-    // The line height is the addition of the line ascender and the line descender.
-    // However, the line descender has a negative value, hence the subtraction.
-    totalHeight += lineRun.ascender - lineRun.descender;
-
-    if( visualY < totalHeight )
-    {
-      matchedLine = true;
-      return lineIndex;
-    }
-  }
-
-  if( lineIndex == 0 )
-  {
-    return 0;
-  }
-
-  return lineIndex - 1u;
+  // The visual model keeps the accumulated line heights so the line is found with a binary search.
+  return visualModel->GetLineOfPosition( visualY, matchedLine );
 }
 
 float CalculateLineOffset( const Vector<LineRun>& lines,
@@ -495,8 +462,7 @@ void GetCursorPosition( GetCursorPositionParameters& parameters,
     cursorInfo.isSecondaryCursor = false;
 
     // Set the line offset and height.
-    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel->mLines,
-                                                 newLineIndex );
+    cursorInfo.lineOffset = parameters.visualModel->GetLineOffset( newLineIndex );
 
     // The line height is the addition of the line ascender and the line descender.
     // However, the line descender has a negative value, hence the subtraction.
@@ -543,8 +509,7 @@ void GetCursorPosition( GetCursorPositionParameters& parameters,
                                      ( isFirstPositionOfLine && ( isRightToLeftParagraph != isCurrentRightToLeft ) ) );
 
     // Set the line offset and height.
-    cursorInfo.lineOffset = CalculateLineOffset( parameters.visualModel->mLines,
-                                                 lineIndex );
+    cursorInfo.lineOffset = parameters.visualModel->GetLineOffset( lineIndex );
 
     // The line height is the addition of the line ascender and the line descender.
     // However, the line descender has a negative value, hence the subtraction.
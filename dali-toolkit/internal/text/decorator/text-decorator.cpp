@@ -34,6 +34,7 @@
 #include <dali-toolkit/public-api/controls/image-view/image-view.h>
 #include <dali-toolkit/devel-api/controls/control-depth-index-ranges.h>
 #include <dali-toolkit/internal/controls/image-view/image-view-impl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 #ifdef DEBUG_ENABLED
 #define DECORATOR_DEBUG
@@ -45,12 +46,13 @@
 namespace
 {
 const char* VERTEX_SHADER = MAKE_SHADER(
-attribute mediump vec2    aPosition;
-uniform   highp mat4      uMvpMatrix;
+attribute highp vec2    aPosition;
+uniform   highp mat4    uMvpMatrix;
+uniform   highp vec2    uOffset;
 
 void main()
 {
-  mediump vec4 position = vec4( aPosition, 0.0, 1.0 );
+  highp vec4 position = vec4( aPosition + uOffset, 0.0, 1.0 );
   gl_Position = uMvpMatrix * position;
 }
 );
@@ -239,6 +241,7 @@ struct Decorator::Impl : public ConnectionTracker
     mHighlightSize( Vector2::ZERO ),
     mControlSize( Vector2::ZERO ),
     mHighlightOutlineOffset( 0.f ),
+    mHighlightOffsetIndex( Property::INVALID_INDEX ),
     mActiveCursor( ACTIVE_CURSOR_NONE ),
     mCursorBlinkInterval( CURSOR_BLINK_INTERVAL ),
     mCursorBlinkDuration( 0.0f ),
@@ -270,7 +273,7 @@ struct Decorator::Impl : public ConnectionTracker
     mHidePrimaryCursorAndGrabHandle( false )
   {
     mQuadVertexFormat[ "aPosition" ] = Property::VECTOR2;
-    mHighlightShader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+    mHighlightShader = Internal::ShaderRegistry::Get().GetShader( "TextDecorator", VERTEX_SHADER, FRAGMENT_SHADER );
     SetupGestures();
   }
 
@@ -1175,57 +1178,72 @@ struct Decorator::Impl : public ConnectionTracker
         mHighlightActor.SetProperty( Actor::Property::SIZE, mHighlightSize );
 
         // Used to translate the vertices given in decorator's coords to the mHighlightActor's local coords.
-        const float offsetX = mHighlightPosition.x + 0.5f * mHighlightSize.width;
-        const float offsetY = mHighlightPosition.y + 0.5f * mHighlightSize.height;
+        // The translation is done in the shader so the vertices of the quads which don't change remain valid when the highlight box changes.
+        const Vector2 offset( -mHighlightPosition.x - 0.5f * mHighlightSize.width,
+                              -mHighlightPosition.y - 0.5f * mHighlightSize.height );
 
-        Vector<Vector2> vertices;
-        Vector<unsigned short> indices;
+        // Only the vertices of the quads which are different from the ones in the mesh are set.
+        const unsigned int numberOfMeshQuads = mHighlightMeshQuadList.Count();
+        bool verticesChanged = ( numberOfQuads != numberOfMeshQuads );
 
-        vertices.Reserve( 4u * numberOfQuads );
-        indices.Reserve( 6u * numberOfQuads );
+        mHighlightMeshQuadList.Resize( numberOfQuads );
+        mHighlightVertices.Resize( 4u * numberOfQuads );
 
-        // Index to the vertex.
-        unsigned int v = 0u;
+        const Vector4* const quadsBuffer = mHighlightQuadList.Begin();
+        Vector4* const meshQuadsBuffer = mHighlightMeshQuadList.Begin();
+        Vector2* verticesBuffer = mHighlightVertices.Begin();
 
-        // Traverse all quads.
-        for( Vector<Vector4>::ConstIterator it = mHighlightQuadList.Begin(),
-               endIt = mHighlightQuadList.End();
-             it != endIt;
-             ++it, v += 4u )
+        for( unsigned int index = 0u; index < numberOfQuads; ++index, verticesBuffer += 4u )
         {
-          const Vector4& quad = *it;
+          const Vector4& quad = *( quadsBuffer + index );
+          Vector4& meshQuad = *( meshQuadsBuffer + index );
 
-          Vector2 vertex;
+          if( ( index < numberOfMeshQuads ) && ( quad == meshQuad ) )
+          {
+            // The quad is already in the mesh.
+            continue;
+          }
+
+          meshQuad = quad;
+          verticesChanged = true;
 
           // top-left (v+0)
-          vertex.x = quad.x - offsetX;
-          vertex.y = quad.y - offsetY;
-          vertices.PushBack( vertex );
+          verticesBuffer->x = quad.x;
+          verticesBuffer->y = quad.y;
 
           // top-right (v+1)
-          vertex.x = quad.z - offsetX;
-          vertex.y = quad.y - offsetY;
-          vertices.PushBack( vertex );
+          ( verticesBuffer + 1u )->x = quad.z;
+          ( verticesBuffer + 1u )->y = quad.y;
 
           // bottom-left (v+2)
-          vertex.x = quad.x - offsetX;
-          vertex.y = quad.w - offsetY;
-          vertices.PushBack( vertex );
+          ( verticesBuffer + 2u )->x = quad.x;
+          ( verticesBuffer + 2u )->y = quad.w;
 
           // bottom-right (v+3)
-          vertex.x = quad.z - offsetX;
-          vertex.y = quad.w - offsetY;
-          vertices.PushBack( vertex );
-
-          // triangle A (3, 1, 0)
-          indices.PushBack( v + 3 );
-          indices.PushBack( v + 1 );
-          indices.PushBack( v );
-
-          // triangle B (0, 2, 3)
-          indices.PushBack( v );
-          indices.PushBack( v + 2 );
-          indices.PushBack( v + 3 );
+          ( verticesBuffer + 3u )->x = quad.z;
+          ( verticesBuffer + 3u )->y = quad.w;
+        }
+
+        // The indices only depend on the number of quads. Add the ones of the quads not indexed yet.
+        const unsigned int numberOfIndexedQuads = mHighlightIndices.Count() / 6u;
+        if( numberOfQuads > numberOfIndexedQuads )
+        {
+          mHighlightIndices.Resize( 6u * numberOfQuads );
+          unsigned short* indicesBuffer = mHighlightIndices.Begin() + 6u * numberOfIndexedQuads;
+
+          // Index to the vertex.
+          for( unsigned int v = 4u * numberOfIndexedQuads; v < 4u * numberOfQuads; v += 4u, indicesBuffer += 6u )
+          {
+            // triangle A (3, 1, 0)
+            *( indicesBuffer ) = v + 3;
+            *( indicesBuffer + 1u ) = v + 1;
+            *( indicesBuffer + 2u ) = v;
+
+            // triangle B (0, 2, 3)
+            *( indicesBuffer + 3u ) = v;
+            *( indicesBuffer + 4u ) = v + 2;
+            *( indicesBuffer + 5u ) = v + 3;
+          }
         }
 
         if( ! mQuadVertices )
@@ -1233,20 +1251,32 @@ struct Decorator::Impl : public ConnectionTracker
           mQuadVertices = VertexBuffer::New( mQuadVertexFormat );
         }
 
-        mQuadVertices.SetData( &vertices[ 0 ], vertices.Size() );
+        if( verticesChanged )
+        {
+          mQuadVertices.SetData( mHighlightVertices.Begin(), 4u * numberOfQuads );
+        }
 
         if( !mQuadGeometry )
         {
           mQuadGeometry = Geometry::New();
           mQuadGeometry.AddVertexBuffer( mQuadVertices );
         }
-        mQuadGeometry.SetIndexBuffer( &indices[ 0 ], indices.Size() );
+
+        if( numberOfQuads != numberOfMeshQuads )
+        {
+          mQuadGeometry.SetIndexBuffer( mHighlightIndices.Begin(), 6u * numberOfQuads );
+        }
 
         if( !mHighlightRenderer )
         {
           mHighlightRenderer = Dali::Renderer::New( mQuadGeometry, mHighlightShader );
+          mHighlightOffsetIndex = mHighlightRenderer.RegisterProperty( "uOffset", offset );
           mHighlightActor.AddRenderer( mHighlightRenderer );
         }
+        else
+        {
+          mHighlightRenderer.SetProperty( mHighlightOffsetIndex, offset );
+        }
       }
 
       mHighlightQuadList.Clear();
@@ -1909,6 +1939,9 @@ struct Decorator::Impl : public ConnectionTracker
   VertexBuffer        mQuadVertices;
   Geometry            mQuadGeometry;
   QuadContainer       mHighlightQuadList;         ///< Sub-selections that combine to create the complete selection highlight.
+  QuadContainer       mHighlightMeshQuadList;     ///< The quads of the highlight's mesh. Used to set only the vertices of the quads which change.
+  Vector<Vector2>     mHighlightVertices;         ///< The vertices of the highlight's mesh in decorator's coords.
+  Vector<unsigned short> mHighlightIndices;       ///< The indices of the highlight's mesh. Never shrinks as they only depend on the number of quads.
 
   Vector4             mBoundingBox;               ///< The bounding box in world coords.
   Vector4             mHighlightColor;            ///< Color of the highlight
@@ -1916,6 +1949,7 @@ struct Decorator::Impl : public ConnectionTracker
   Size                mHighlightSize;             ///< The size of the highlighted text.
   Size                mControlSize;               ///< The control's size. Set by the Relayout.
   float               mHighlightOutlineOffset;    ///< The outline's offset.
+  Property::Index     mHighlightOffsetIndex;      ///< The index of the uniform used to translate the highlight's vertices to the actor's local coords.
 
   unsigned int        mActiveCursor;
   unsigned int        mCursorBlinkInterval;
@@ -2228,6 +2262,11 @@ void Decorator::ResizeHighlightQuads( unsigned int numberOfQuads )
   mImpl->mHighlightQuadList.Resize( numberOfQuads );
 }
 
+const Vector<Vector4>& Decorator::GetHighlightQuads() const
+{
+  return mImpl->mHighlightQuadList;
+}
+
 void Decorator::SetHighlightColor( const Vector4& color )
 {
   mImpl->mHighlightColor = color;
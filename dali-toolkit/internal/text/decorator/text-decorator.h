@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/math/rect.h>
@@ -486,6 +487,13 @@ public:
    */
   void ResizeHighlightQuads( unsigned int numberOfQuads );
 
+  /**
+   * @brief Retrieves the highlight quads added since the highlight was last updated.
+   *
+   * @return The quads. Vertices are in decorator's coordinates.
+   */
+  const Vector<Vector4>& GetHighlightQuads() const;
+
   /**
    * @brief Sets the selection highlight color.
    *
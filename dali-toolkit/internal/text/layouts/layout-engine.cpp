@@ -1069,6 +1069,9 @@ struct Engine::Impl
 
     Vector<LineRun>& lines = layoutParameters.textModel->mVisualModel->mLines;
 
+    // The lines are going to be laid-out. The caches built from them are not valid anymore.
+    layoutParameters.textModel->mVisualModel->ClearCaches();
+
     if( 0u == layoutParameters.numberOfGlyphs )
     {
       // Add an extra line if the last character is a new paragraph character and the last line doesn't have zero characters.
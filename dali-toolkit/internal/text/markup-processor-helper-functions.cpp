@@ -54,6 +54,49 @@ const std::string YELLOW_COLOR( "yellow" );
 const std::string MAGENTA_COLOR( "magenta" );
 const std::string CYAN_COLOR( "cyan" );
 const std::string TRANSPARENT_COLOR( "transparent" );
+
+const unsigned int OPAQUE_ALPHA = 0xFF000000; ///< Alpha component of a web color without alpha.
+
+/**
+ * @brief Converts a string of hexadecimal digits into an unsigned int.
+ *
+ * The conversion stops at the first non hexadecimal digit. The string doesn't need to be null terminated.
+ *
+ * @param[in] hexStr The hexadecimal digits.
+ * @param[in] length The number of characters to convert.
+ *
+ * @return The hexadecimal value.
+ */
+unsigned int HexStringToUint( const char* const hexStr, Length length )
+{
+  unsigned int value = 0u;
+  for( Length index = 0u; index < length; ++index )
+  {
+    const char character = *( hexStr + index );
+
+    unsigned int digit = 0u;
+    if( ( '0' <= character ) && ( character <= '9' ) )
+    {
+      digit = character - '0';
+    }
+    else if( ( 'a' <= character ) && ( character <= 'f' ) )
+    {
+      digit = 10u + character - 'a';
+    }
+    else if( ( 'A' <= character ) && ( character <= 'F' ) )
+    {
+      digit = 10u + character - 'A';
+    }
+    else
+    {
+      break;
+    }
+
+    value = ( value << 4u ) | digit;
+  }
+
+  return value;
+}
 }
 
 bool TokenComparison( const std::string& string1, const char* const stringBuffer2, Length length )
@@ -133,20 +176,27 @@ void ColorStringToVector4( const char* const colorStr, Length length, Vector4& r
 {
   if( WEB_COLOR_TOKEN == *colorStr )
   {
-    std::string webColor( colorStr + 1u, length - 1u );
+    // The web color is converted in place to avoid copying it into a temporary string.
+    const char* const webColor = colorStr + 1u;
+    unsigned int color = 0u;
     if( 4u == length )                      // 3 component web color #F00 (red)
     {
-      webColor.insert( 2u, &( webColor[2] ), 1u );
-      webColor.insert( 1u, &( webColor[1] ), 1u );
-      webColor.insert( 0u, &( webColor[0] ), 1u );
-      webColor.insert( 0u, ALPHA_ONE );
+      const unsigned int red = HexStringToUint( webColor, 1u );
+      const unsigned int green = HexStringToUint( webColor + 1u, 1u );
+      const unsigned int blue = HexStringToUint( webColor + 2u, 1u );
+
+      color = OPAQUE_ALPHA | ( red << 20u ) | ( red << 16u ) | ( green << 12u ) | ( green << 8u ) | ( blue << 4u ) | blue;
     }
     else if( 7u == length )                 // 6 component web color #FF0000 (red)
     {
-      webColor.insert( 0u, ALPHA_ONE );
+      color = OPAQUE_ALPHA | HexStringToUint( webColor, 6u );
+    }
+    else if( length > 1u )
+    {
+      color = HexStringToUint( webColor, length - 1u );
     }
 
-    UintColorToVector4( StringToHex( webColor.c_str() ), retColor );
+    UintColorToVector4( color, retColor );
   }
   else if( TokenComparison( HEX_COLOR_TOKEN, colorStr, 2u ) )
   {
@@ -54,6 +54,26 @@ const std::string XHTML_GLOW_TAG("glow");
 const std::string XHTML_OUTLINE_TAG("outline");
 const std::string XHTML_ITEM_TAG("item");
 
+/**
+ * @brief The tags recognized by the mark-up processor.
+ */
+namespace TagType
+{
+  enum Type
+  {
+    UNKNOWN,
+    COLOR,
+    FONT,
+    B,
+    I,
+    U,
+    SHADOW,
+    GLOW,
+    OUTLINE,
+    ITEM
+  };
+}
+
 const char LESS_THAN      = '<';
 const char GREATER_THAN   = '>';
 const char EQUAL          = '=';
@@ -65,6 +85,9 @@ const char HASH           = '#';
 const char SEMI_COLON     = ';';
 const char CHAR_ARRAY_END = '\0';
 const char HEX_CODE       = 'x';
+const char CR             = 0xd;
+const char LF             = 0xa;
+const char TO_LOWER_CASE  = 0x20;        // Bit to set to transform an upper case ASCII letter into lower case.
 
 const char WHITE_SPACE    = 0x20;        // ASCII value of the white space.
 
@@ -444,14 +467,14 @@ unsigned int GetXHTMLEntityLength( const char*& markupStringBuffer,
 }
 
 /**
- * @brief It parses a XHTML string which has hex/decimal entity and fill its corresponging utf-8 string.
+ * @brief It parses a XHTML string which has hex/decimal entity and retrieves its corresponding utf-32 character.
  *
  * @param[in] markupText The mark-up text buffer.
- * @param[out] utf-8 text Corresponding to markup Text
+ * @param[out] character The utf-32 character corresponding to the mark-up text.
  *
  * @return true if string is successfully parsed otherwise false
  */
-bool XHTMLNumericEntityToUtf8 ( const char* markupText, char* utf8 )
+bool XHTMLNumericEntityToUtf32( const char* markupText, Character& character )
 {
   bool result = false;
 
@@ -477,8 +500,7 @@ bool XHTMLNumericEntityToUtf8 ( const char* markupText, char* utf8 )
         ( ( XHTML_DECIMAL_ENTITY_RANGE[2] <= l ) && ( l <= XHTML_DECIMAL_ENTITY_RANGE[3] ) ) ||
         ( ( XHTML_DECIMAL_ENTITY_RANGE[4] <= l ) && ( l <= XHTML_DECIMAL_ENTITY_RANGE[5] ) ) )
       {
-        // Convert UTF32 code to UTF8
-        Utf32ToUtf8( reinterpret_cast<const uint32_t* const>( &l ), 1, reinterpret_cast<uint8_t*>( utf8 ) );
+        character = static_cast<Character>( l );
         result = true;
        }
     }
@@ -486,15 +508,150 @@ bool XHTMLNumericEntityToUtf8 ( const char* markupText, char* utf8 )
   return result;
 }
 
+/**
+ * @brief Retrieves the type of a tag.
+ *
+ * The length and the first character of the tag select the only candidate it can be,
+ * so at most one token comparison is done per tag.
+ *
+ * @param[in] tag The tag.
+ *
+ * @return The type of the tag. TagType::UNKNOWN if it's not a recognized tag.
+ */
+TagType::Type GetTagType( const Tag& tag )
+{
+  if( NULL == tag.buffer )
+  {
+    return TagType::UNKNOWN;
+  }
+
+  // Transform the first character to lower case. A wrong candidate is discarded by the token comparison.
+  const char firstCharacter = *tag.buffer | TO_LOWER_CASE;
+
+  switch( tag.length )
+  {
+    case 1u:
+    {
+      switch( firstCharacter )
+      {
+        case 'b':
+        {
+          return TagType::B;
+        }
+        case 'i':
+        {
+          return TagType::I;
+        }
+        case 'u':
+        {
+          return TagType::U;
+        }
+        default:
+        {
+          break;
+        }
+      }
+      break;
+    }
+    case 4u:
+    {
+      if( ( 'f' == firstCharacter ) && TokenComparison( XHTML_FONT_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::FONT;
+      }
+      else if( ( 'g' == firstCharacter ) && TokenComparison( XHTML_GLOW_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::GLOW;
+      }
+      else if( ( 'i' == firstCharacter ) && TokenComparison( XHTML_ITEM_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::ITEM;
+      }
+      break;
+    }
+    case 5u:
+    {
+      if( TokenComparison( XHTML_COLOR_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::COLOR;
+      }
+      break;
+    }
+    case 6u:
+    {
+      if( TokenComparison( XHTML_SHADOW_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::SHADOW;
+      }
+      break;
+    }
+    case 7u:
+    {
+      if( TokenComparison( XHTML_OUTLINE_TAG, tag.buffer, tag.length ) )
+      {
+        return TagType::OUTLINE;
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return TagType::UNKNOWN;
+}
+
+/**
+ * @brief Pushes a new font run into the logical model and its index into the style stack.
+ *
+ * @param[in] fontRun The font run.
+ * @param[in,out] markupProcessData The plain text and the style.
+ * @param[in,out] styleStack The style stack.
+ * @param[in,out] fontRunIndex Points the next free position in the vector of font runs.
+ */
+void PushFontRun( const FontDescriptionRun& fontRun,
+                  MarkupProcessData& markupProcessData,
+                  StyleStack& styleStack,
+                  StyleStack::RunIndex& fontRunIndex )
+{
+  // Push the font run in the logical model.
+  markupProcessData.fontRuns.PushBack( fontRun );
+
+  // Push the index of the run into the stack.
+  styleStack.Push( fontRunIndex );
+
+  // Point the next free font run.
+  ++fontRunIndex;
+}
+
+/**
+ * @brief Pops the top of the style stack and sets the number of characters of the font run it points.
+ *
+ * @param[in] characterIndex The index to the character after the last one of the run.
+ * @param[in,out] markupProcessData The plain text and the style.
+ * @param[in,out] styleStack The style stack.
+ */
+void PopFontRun( CharacterIndex characterIndex,
+                 MarkupProcessData& markupProcessData,
+                 StyleStack& styleStack )
+{
+  FontDescriptionRun& fontRun = *( markupProcessData.fontRuns.Begin() + styleStack.Pop() );
+  fontRun.characterRun.numberOfCharacters = characterIndex - fontRun.characterRun.characterIndex;
+}
+
 } // namespace
 
 void ProcessMarkupString( const std::string& markupString, MarkupProcessData& markupProcessData )
 {
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "markupString: %s\n", markupString.c_str() );
 
-  // Reserve space for the plain text.
+  // The number of characters of the plain text can't be bigger than the number of bytes of the mark-up string.
+  // Characters are written straight into the buffer and it's resized to the actual number of characters at the end.
   const Length markupStringSize = markupString.size();
-  markupProcessData.markupProcessedText.reserve( markupStringSize );
+  Vector<Character>& utf32Characters = markupProcessData.markupProcessedText;
+  utf32Characters.Resize( markupStringSize );
+  Character* utf32CharactersBuffer = utf32Characters.Begin();
 
   // Stores a struct with the index to the first character of the run, the type of run and its parameters.
   StyleStack styleStack;
@@ -517,7 +674,10 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
   const char* markupStringBuffer = markupString.c_str();
   const char* const markupStringEndBuffer = markupStringBuffer + markupStringSize;
 
+  // The tag's attributes are reserved once and reused by every tag.
   Tag tag;
+  tag.attributes.Reserve( MAX_NUM_OF_ATTRIBUTES );
+
   CharacterIndex characterIndex = 0u;
   for( ; markupStringBuffer < markupStringEndBuffer; )
   {
@@ -526,209 +686,158 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
                markupStringEndBuffer,
                tag ) )
     {
-      if( TokenComparison( XHTML_COLOR_TAG, tag.buffer, tag.length ) )
+      switch( GetTagType( tag ) )
       {
-        if( !tag.isEndTag )
+        case TagType::COLOR:
         {
-          // Create a new color run.
-          ColorRun colorRun;
-          colorRun.characterRun.numberOfCharacters = 0u;
+          if( !tag.isEndTag )
+          {
+            // Create a new color run.
+            ColorRun colorRun;
+            colorRun.characterRun.numberOfCharacters = 0u;
 
-          // Set the start character index.
-          colorRun.characterRun.characterIndex = characterIndex;
+            // Set the start character index.
+            colorRun.characterRun.characterIndex = characterIndex;
 
-          // Fill the run with the attributes.
-          ProcessColorTag( tag, colorRun );
+            // Fill the run with the attributes.
+            ProcessColorTag( tag, colorRun );
 
-          // Push the color run in the logical model.
-          markupProcessData.colorRuns.PushBack( colorRun );
+            // Push the color run in the logical model.
+            markupProcessData.colorRuns.PushBack( colorRun );
 
-          // Push the index of the run into the stack.
-          styleStack.Push( colorRunIndex );
+            // Push the index of the run into the stack.
+            styleStack.Push( colorRunIndex );
 
-          // Point the next color run.
-          ++colorRunIndex;
+            // Point the next color run.
+            ++colorRunIndex;
 
-          // Increase reference
-          ++colorTagReference;
-        }
-        else
-        {
-          if( colorTagReference > 0 )
+            // Increase reference
+            ++colorTagReference;
+          }
+          else
           {
-            // Pop the top of the stack and set the number of characters of the run.
-            ColorRun& colorRun = *( markupProcessData.colorRuns.Begin() + styleStack.Pop() );
-            colorRun.characterRun.numberOfCharacters = characterIndex - colorRun.characterRun.characterIndex;
-            --colorTagReference;
+            if( colorTagReference > 0 )
+            {
+              // Pop the top of the stack and set the number of characters of the run.
+              ColorRun& colorRun = *( markupProcessData.colorRuns.Begin() + styleStack.Pop() );
+              colorRun.characterRun.numberOfCharacters = characterIndex - colorRun.characterRun.characterIndex;
+              --colorTagReference;
+            }
           }
-        }
-      } // <color></color>
-      else if( TokenComparison( XHTML_I_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
+          break;
+        } // <color></color>
+        case TagType::I:
         {
-          // Create a new font run.
-          FontDescriptionRun fontRun;
-          Initialize( fontRun );
-
-          // Fill the run with the parameters.
-          fontRun.characterRun.characterIndex = characterIndex;
-          fontRun.slant = TextAbstraction::FontSlant::ITALIC;
-          fontRun.slantDefined = true;
-
-          // Push the font run in the logical model.
-          markupProcessData.fontRuns.PushBack( fontRun );
+          if( !tag.isEndTag )
+          {
+            // Create a new font run.
+            FontDescriptionRun fontRun;
+            Initialize( fontRun );
 
-          // Push the index of the run into the stack.
-          styleStack.Push( fontRunIndex );
+            // Fill the run with the parameters.
+            fontRun.characterRun.characterIndex = characterIndex;
+            fontRun.slant = TextAbstraction::FontSlant::ITALIC;
+            fontRun.slantDefined = true;
 
-          // Point the next free font run.
-          ++fontRunIndex;
+            PushFontRun( fontRun, markupProcessData, styleStack, fontRunIndex );
 
-          // Increase reference
-          ++iTagReference;
-        }
-        else
-        {
-          if( iTagReference > 0 )
+            // Increase reference
+            ++iTagReference;
+          }
+          else
           {
-            // Pop the top of the stack and set the number of characters of the run.
-            FontDescriptionRun& fontRun = *( markupProcessData.fontRuns.Begin() + styleStack.Pop() );
-            fontRun.characterRun.numberOfCharacters = characterIndex - fontRun.characterRun.characterIndex;
-            --iTagReference;
+            if( iTagReference > 0 )
+            {
+              PopFontRun( characterIndex, markupProcessData, styleStack );
+              --iTagReference;
+            }
           }
-        }
-      } // <i></i>
-      else if( TokenComparison( XHTML_U_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
+          break;
+        } // <i></i>
+        case TagType::B:
         {
-          // Create a new underline run.
-        }
-        else
-        {
-          // Pop the top of the stack and set the number of characters of the run.
-        }
-      } // <u></u>
-      else if( TokenComparison( XHTML_B_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
-        {
-          // Create a new font run.
-          FontDescriptionRun fontRun;
-          Initialize( fontRun );
-
-          // Fill the run with the parameters.
-          fontRun.characterRun.characterIndex = characterIndex;
-          fontRun.weight = TextAbstraction::FontWeight::BOLD;
-          fontRun.weightDefined = true;
-
-          // Push the font run in the logical model.
-          markupProcessData.fontRuns.PushBack( fontRun );
+          if( !tag.isEndTag )
+          {
+            // Create a new font run.
+            FontDescriptionRun fontRun;
+            Initialize( fontRun );
 
-          // Push the index of the run into the stack.
-          styleStack.Push( fontRunIndex );
+            // Fill the run with the parameters.
+            fontRun.characterRun.characterIndex = characterIndex;
+            fontRun.weight = TextAbstraction::FontWeight::BOLD;
+            fontRun.weightDefined = true;
 
-          // Point the next free font run.
-          ++fontRunIndex;
+            PushFontRun( fontRun, markupProcessData, styleStack, fontRunIndex );
 
-          // Increase reference
-          ++bTagReference;
-        }
-        else
-        {
-          if( bTagReference > 0 )
+            // Increase reference
+            ++bTagReference;
+          }
+          else
           {
-            // Pop the top of the stack and set the number of characters of the run.
-            FontDescriptionRun& fontRun = *( markupProcessData.fontRuns.Begin() + styleStack.Pop() );
-            fontRun.characterRun.numberOfCharacters = characterIndex - fontRun.characterRun.characterIndex;
-            --bTagReference;
+            if( bTagReference > 0 )
+            {
+              PopFontRun( characterIndex, markupProcessData, styleStack );
+              --bTagReference;
+            }
           }
-        }
-      } // <b></b>
-      else if( TokenComparison( XHTML_FONT_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
+          break;
+        } // <b></b>
+        case TagType::FONT:
         {
-          // Create a new font run.
-          FontDescriptionRun fontRun;
-          Initialize( fontRun );
-
-          // Fill the run with the parameters.
-          fontRun.characterRun.characterIndex = characterIndex;
-
-          ProcessFontTag( tag, fontRun );
+          if( !tag.isEndTag )
+          {
+            // Create a new font run.
+            FontDescriptionRun fontRun;
+            Initialize( fontRun );
 
-          // Push the font run in the logical model.
-          markupProcessData.fontRuns.PushBack( fontRun );
+            // Fill the run with the parameters.
+            fontRun.characterRun.characterIndex = characterIndex;
 
-          // Push the index of the run into the stack.
-          styleStack.Push( fontRunIndex );
+            ProcessFontTag( tag, fontRun );
 
-          // Point the next free font run.
-          ++fontRunIndex;
+            PushFontRun( fontRun, markupProcessData, styleStack, fontRunIndex );
 
-          // Increase reference
-          ++fontTagReference;
-        }
-        else
-        {
-          if( fontTagReference > 0 )
+            // Increase reference
+            ++fontTagReference;
+          }
+          else
           {
-            // Pop the top of the stack and set the number of characters of the run.
-            FontDescriptionRun& fontRun = *( markupProcessData.fontRuns.Begin() + styleStack.Pop() );
-            fontRun.characterRun.numberOfCharacters = characterIndex - fontRun.characterRun.characterIndex;
-            --fontTagReference;
+            if( fontTagReference > 0 )
+            {
+              PopFontRun( characterIndex, markupProcessData, styleStack );
+              --fontTagReference;
+            }
           }
-        }
-      } // <font></font>
-      else if( TokenComparison( XHTML_SHADOW_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
+          break;
+        } // <font></font>
+        case TagType::ITEM:
         {
-          // Create a new shadow run.
-        }
-        else
-        {
-          // Pop the top of the stack and set the number of characters of the run.
-        }
-      } // <shadow></shadow>
-      else if( TokenComparison( XHTML_GLOW_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
-        {
-          // Create a new glow run.
-        }
-        else
-        {
-          // Pop the top of the stack and set the number of characters of the run.
-        }
-      } // <glow></glow>
-      else if( TokenComparison( XHTML_OUTLINE_TAG, tag.buffer, tag.length ) )
-      {
-        if( !tag.isEndTag )
-        {
-          // Create a new outline run.
-        }
-        else
+          if( tag.isEndTag )
+          {
+            // Create an embedded item instance.
+            EmbeddedItem item;
+            item.characterIndex = characterIndex;
+            ProcessEmbeddedItem( tag, item );
+
+            markupProcessData.items.PushBack( item );
+
+            // Insert white space character that will be replaced by the item.
+            *( utf32CharactersBuffer + characterIndex ) = WHITE_SPACE;
+            ++characterIndex;
+          }
+          break;
+        } // <item/>
+        case TagType::U:       // <u></u>
+        case TagType::SHADOW:  // <shadow></shadow>
+        case TagType::GLOW:    // <glow></glow>
+        case TagType::OUTLINE: // <outline></outline>
         {
-          // Pop the top of the stack and set the number of characters of the run.
+          // Not supported yet.
+          break;
         }
-      } // <outline></outline>
-      else if (TokenComparison(XHTML_ITEM_TAG, tag.buffer, tag.length))
-      {
-        if (tag.isEndTag)
+        case TagType::UNKNOWN:
         {
-          // Create an embedded item instance.
-          EmbeddedItem item;
-          item.characterIndex = characterIndex;
-          ProcessEmbeddedItem(tag, item);
-
-          markupProcessData.items.PushBack(item);
-
-          // Insert white space character that will be replaced by the item.
-          markupProcessData.markupProcessedText.append( 1u, WHITE_SPACE );
-          ++characterIndex;
+          break;
         }
       }
     }  // end if( IsTag() )
@@ -737,7 +846,15 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
       unsigned char character = *markupStringBuffer;
       const char* markupBuffer = markupStringBuffer;
       unsigned char count = GetUtf8Length( character );
-      char utf8[8];
+      if( 0u == count )
+      {
+        // Non valid lead byte. It's replaced by a white space.
+        count = 1u;
+      }
+
+      // Whether the character has already been decoded from a numeric entity.
+      bool isDecoded = false;
+      Character& utf32Character = *( utf32CharactersBuffer + characterIndex );
 
       if( ( BACK_SLASH == character ) && ( markupStringBuffer + 1u < markupStringEndBuffer ) )
       {
@@ -752,6 +869,12 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
           markupBuffer = markupStringBuffer;
         }
       }
+      else if( ( CR == character ) && ( markupStringBuffer + 1u < markupStringEndBuffer ) && ( LF == *( markupStringBuffer + 1u ) ) )
+      {
+        // The CR+LF pair is replaced by a single LF as Utf8ToUtf32() does.
+        ++markupStringBuffer;
+        markupBuffer = markupStringBuffer;
+      }
       else   // checking if conatins XHTML entity or not
       {
         const unsigned int len =  GetXHTMLEntityLength( markupStringBuffer, markupStringEndBuffer);
@@ -759,28 +882,28 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
         // Parse markupStringTxt if it contains XHTML Entity between '&' and ';'
         if( len > 0 )
         {
-          char* entityCode = NULL;
           bool result = false;
           count = 0;
 
           // Checking if XHTML Numeric Entity
           if( HASH == *( markupBuffer + 1u ) )
           {
-            entityCode = &utf8[0];
             // markupBuffer is currently pointing to '&'. By adding 2u to markupBuffer it will point to numeric string by skipping "&#'
-            result = XHTMLNumericEntityToUtf8( ( markupBuffer + 2u ), entityCode );
+            result = XHTMLNumericEntityToUtf32( ( markupBuffer + 2u ), utf32Character );
+            isDecoded = result;
           }
           else    // Checking if XHTML Named Entity
           {
-            entityCode = const_cast<char*> ( NamedEntityToUtf8( markupBuffer, len ) );
+            const char* const entityCode = NamedEntityToUtf8( markupBuffer, len );
             result = ( entityCode != NULL );
+            if( result )
+            {
+              markupBuffer = entityCode; //utf8 text assigned to markupBuffer
+              character = markupBuffer[0];
+            }
           }
-          if ( result )
-          {
-            markupBuffer = entityCode; //utf8 text assigned to markupBuffer
-            character = markupBuffer[0];
-          }
-          else
+
+          if( !result )
           {
             DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Not valid XHTML entity : (%.*s) \n", len, markupBuffer );
             markupBuffer = NULL;
@@ -798,13 +921,12 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
 
       if( markupBuffer != NULL )
       {
-        const unsigned char numberOfBytes = GetUtf8Length( character );
-        markupProcessData.markupProcessedText.push_back( character );
-
-        for( unsigned char i = 1u; i < numberOfBytes; ++i )
+        if( !isDecoded )
         {
-          ++markupBuffer;
-          markupProcessData.markupProcessedText.push_back( *markupBuffer );
+          const unsigned char numberOfBytes = GetUtf8Length( character );
+
+          // Utf8ToUtf32() replaces a non valid lead byte by a white space.
+          Utf8ToUtf32( reinterpret_cast<const uint8_t*>( markupBuffer ), ( 0u == numberOfBytes ) ? 1u : numberOfBytes, &utf32Character );
         }
 
         ++characterIndex;
@@ -813,6 +935,9 @@ void ProcessMarkupString( const std::string& markupString, MarkupProcessData& ma
     }
   }
 
+  // Resize the plain text to the actual number of characters.
+  utf32Characters.Resize( characterIndex );
+
   // Resize the model's vectors.
   if( 0u == fontRunIndex )
   {
@@ -26,6 +26,7 @@
 #include <dali-toolkit/internal/text/color-run.h>
 #include <dali-toolkit/internal/text/embedded-item.h>
 #include <dali-toolkit/internal/text/font-description-run.h>
+#include <dali-toolkit/internal/text/text-definitions.h>
 
 namespace Dali
 {
@@ -37,28 +38,35 @@ namespace Text
 {
 
 /**
- * @brief Keeps the plain text and references to vectors from the model which stores runs with text styles.
+ * @brief Keeps references to vectors from the model which stores the plain text and the runs with text styles.
  */
 struct MarkupProcessData
 {
 MarkupProcessData( Vector<ColorRun>& colorRuns,
                    Vector<FontDescriptionRun>& fontRuns,
-                   Vector<EmbeddedItem>& items )
+                   Vector<EmbeddedItem>& items,
+                   Vector<Character>& markupProcessedText )
   : colorRuns( colorRuns ),
     fontRuns( fontRuns ),
-    items(items),
-    markupProcessedText()
+    items( items ),
+    markupProcessedText( markupProcessedText )
   {}
 
   Vector<ColorRun>&           colorRuns;           ///< The color runs.
   Vector<FontDescriptionRun>& fontRuns;            ///< The font description runs.
   Vector<EmbeddedItem>&       items;               ///< The embedded items.
-  std::string                 markupProcessedText; ///< The mark-up string.
+  Vector<Character>&          markupProcessedText; ///< The plain text encoded in utf32.
 };
 
 /**
  * @brief Process the mark-up string.
  *
+ * The mark-up string is parsed in a single pass. The characters of the plain text are
+ * written encoded in utf32 into the @e markupProcessedText vector, so there is no need
+ * to convert them afterwards.
+ *
+ * @note As Utf8ToUtf32() does, a single 'CR' character or a pair 'CR'+'LF' are replaced by a 'LF'.
+ *
  * @param[in] markupString The mark-up string.
  * @param[out] markupProcessData The plain text and the style.
  */
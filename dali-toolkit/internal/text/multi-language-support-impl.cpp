@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/multi-language-helper-functions.h>
+#include <dali-toolkit/internal/text/text-run-container.h>
 
 namespace Dali
 {
@@ -169,18 +170,7 @@ void MultilanguageSupport::SetScripts( const Vector<Character>& text,
   ScriptRunIndex scriptIndex = 0u;
   if( 0u != startIndex )
   {
-    for( Vector<ScriptRun>::ConstIterator it = scripts.Begin(),
-           endIt = scripts.End();
-         it != endIt;
-         ++it, ++scriptIndex )
-    {
-      const ScriptRun& run = *it;
-      if( startIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-      {
-        // Run found.
-        break;
-      }
-    }
+    scriptIndex = FindCharacterRun( startIndex, scripts );
   }
 
   // Stores the current script run.
@@ -407,18 +397,7 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
   FontRunIndex fontIndex = 0u;
   if( 0u != startIndex )
   {
-    for( Vector<FontRun>::ConstIterator it = fonts.Begin(),
-           endIt = fonts.End();
-         it != endIt;
-         ++it, ++fontIndex )
-    {
-      const FontRun& run = *it;
-      if( startIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-      {
-        // Run found.
-        break;
-      }
-    }
+    fontIndex = FindCharacterRun( startIndex, fonts );
   }
 
   // Traverse the characters and validate/set the fonts.
@@ -443,8 +422,8 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
 
   const Character* const textBuffer = text.Begin();
 
-  // Iterators of the script runs.
-  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin();
+  // Iterators of the script runs. Starts from the script run containing the first character to validate.
+  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin() + FindCharacterRun( startIndex, scripts );
   Vector<ScriptRun>::ConstIterator scriptRunEndIt = scripts.End();
   bool isNewParagraphCharacter = false;
 
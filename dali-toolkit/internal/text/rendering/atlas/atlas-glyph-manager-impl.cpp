@@ -95,6 +95,11 @@ void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
   }
 }
 
+void AtlasGlyphManager::FlushUploads()
+{
+  mAtlasManager.FlushUploads();
+}
+
 void AtlasGlyphManager::GenerateMeshData( uint32_t imageId,
                                           const Vector2& position,
                                           Toolkit::AtlasManager::Mesh2D& mesh )
@@ -140,13 +145,11 @@ Vector2 AtlasGlyphManager::GetAtlasSize( uint32_t atlasId )
   return Vector2( static_cast< float >( size.mWidth ), static_cast< float >( size.mHeight ) );
 }
 
-void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight )
+void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height )
 {
   Toolkit::AtlasManager::AtlasSize size;
   size.mWidth = width;
   size.mHeight = height;
-  size.mBlockWidth = blockWidth;
-  size.mBlockHeight = blockHeight;
   mAtlasManager.SetNewAtlasSize( size );
 }
 
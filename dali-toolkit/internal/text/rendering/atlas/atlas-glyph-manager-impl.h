@@ -77,6 +77,11 @@ public:
             const PixelData& bitmap,
             Dali::Toolkit::AtlasManager::AtlasSlot& slot );
 
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::FlushUploads
+   */
+  void FlushUploads();
+
   /**
    * @copydoc Toolkit::AtlasGlyphManager::GenerateMeshData
    */
@@ -100,7 +105,7 @@ public:
   /**
    * @copydoc Toolkit::AtlasGlyphManager::SetNewAtlasSize
    */
-  void SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight );
+  void SetNewAtlasSize( uint32_t width, uint32_t height );
 
   /**
    * @copydoc Toolkit::AtlasGlyphManager::GetPixelFormat
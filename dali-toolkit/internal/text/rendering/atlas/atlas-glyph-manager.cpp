@@ -76,6 +76,11 @@ void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
   GetImplementation(*this).Add( glyph, style, bitmap, slot );
 }
 
+void AtlasGlyphManager::FlushUploads()
+{
+  GetImplementation(*this).FlushUploads();
+}
+
 void AtlasGlyphManager::GenerateMeshData( uint32_t imageId,
                                           const Vector2& position,
                                           Toolkit::AtlasManager::Mesh2D& mesh )
@@ -93,9 +98,9 @@ bool AtlasGlyphManager::IsCached( Text::FontId fontId,
   return GetImplementation(*this).IsCached( fontId, index, style, slot );
 }
 
-void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight )
+void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height )
 {
-  GetImplementation(*this).SetNewAtlasSize( width, height, blockWidth, blockHeight );
+  GetImplementation(*this).SetNewAtlasSize( width, height );
 }
 
 Vector2 AtlasGlyphManager::GetAtlasSize( uint32_t atlasId )
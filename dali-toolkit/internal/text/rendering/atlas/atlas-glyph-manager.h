@@ -102,6 +102,11 @@ public:
             const PixelData& bitmap,
             AtlasManager::AtlasSlot& slot );
 
+  /**
+   * @brief Upload the glyphs added since the last flush to the atlases
+   */
+  void FlushUploads();
+
   /**
    * @brief Generate mesh data for an image contained in an atlas
    *
@@ -138,14 +143,12 @@ public:
   Vector2 GetAtlasSize( uint32_t atlasId );
 
    /**
-    * @brief Set the atlas size and block size for subsequent Atlas generation
+    * @brief Set the atlas size for subsequent Atlas generation
     *
     * @param[in] width width of atlas in pixels
     * @param[in] height height of atlas in pixels
-    * @param[in] blockWidth width of a block in pixels
-    * @param[in] blockHeight height of a block in pixels
     */
-  void SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight );
+  void SetNewAtlasSize( uint32_t width, uint32_t height );
 
   /**
    * @brief Get the Pixel Format used by an atlas
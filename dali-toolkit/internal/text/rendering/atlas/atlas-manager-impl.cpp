@@ -18,8 +18,11 @@
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-manager-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <stdlib.h>
 #include <string.h>
 #include <dali/integration-api/debug.h>
+#include <dali/devel-api/images/pixel-data-devel.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-mesh-factory.h>
@@ -37,25 +40,228 @@ namespace
 {
   const uint32_t DEFAULT_ATLAS_WIDTH( 512u );
   const uint32_t DEFAULT_ATLAS_HEIGHT( 512u );
-  const uint32_t DEFAULT_BLOCK_WIDTH( 16u );
-  const uint32_t DEFAULT_BLOCK_HEIGHT( 16u );
   const uint32_t SINGLE_PIXEL_PADDING( 1u );
   const uint32_t DOUBLE_PIXEL_PADDING( SINGLE_PIXEL_PADDING << 1 );
+  const float MAX_FRAGMENTATION( 0.5f ); ///< Ratio of the area of removed images in a full atlas above which it is retired
+  const uint32_t MAX_DIRTY_AREAS( 4u );  ///< Maximum number of uploads per atlas and flush
+  const uint32_t MAX_MERGE_WASTE( 2u );  ///< Dirty areas are merged if their union is at most this times their pixels
   Toolkit::AtlasManager::AtlasSize EMPTY_SIZE;
 
-  bool IsBlockSizeSufficient( uint32_t width, uint32_t height, uint32_t requiredBlockWidth, uint32_t requiredBlockHeight )
+#if defined(DEBUG_ENABLED)
+  Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_TEXT_RENDERING");
+#endif
+
+  bool IsAtlasSizeSufficient( uint32_t width, uint32_t height, const Toolkit::AtlasManager::AtlasSize& size )
+  {
+    // The top left pixel of the atlas is reserved.
+    return ( width + DOUBLE_PIXEL_PADDING + SINGLE_PIXEL_PADDING <= size.mWidth ) && ( height + DOUBLE_PIXEL_PADDING <= size.mHeight );
+  }
+
+  /**
+   * @brief Finds the lowest position of the skyline where an area fits.
+   *
+   * @param[in] skyline The skyline of the atlas.
+   * @param[in] size The size of the atlas.
+   * @param[in] width The width of the area.
+   * @param[in] height The height of the area.
+   * @param[out] segmentIndex The index of the segment where the area starts.
+   * @param[out] y The top of the area.
+   *
+   * @return Whether the area fits.
+   */
+  bool FindSkylinePosition( const Vector< AtlasManager::SkylineSegment >& skyline,
+                            const Toolkit::AtlasManager::AtlasSize& size,
+                            uint32_t width,
+                            uint32_t height,
+                            uint32_t& segmentIndex,
+                            uint32_t& y )
+  {
+    bool found = false;
+    uint32_t bestY = 0u;
+    uint32_t bestSegmentWidth = 0u;
+
+    for( uint32_t index = 0u, numberOfSegments = skyline.Count(); index < numberOfSegments; ++index )
+    {
+      const AtlasManager::SkylineSegment& segment = skyline[index];
+      if( segment.mX + width > size.mWidth )
+      {
+        // The segments are sorted from left to right.
+        break;
+      }
+
+      // The area lies on the highest segment below it.
+      uint32_t top = 0u;
+      uint32_t remainingWidth = width;
+      for( uint32_t nextIndex = index; remainingWidth > 0u; ++nextIndex )
+      {
+        const AtlasManager::SkylineSegment& nextSegment = skyline[nextIndex];
+        top = std::max( top, nextSegment.mY );
+        remainingWidth -= std::min( remainingWidth, nextSegment.mWidth );
+      }
+
+      if( top + height > size.mHeight )
+      {
+        continue;
+      }
+
+      // Choose the lowest position, then the narrowest segment to reduce the wasted area.
+      if( !found || ( top < bestY ) || ( ( top == bestY ) && ( segment.mWidth < bestSegmentWidth ) ) )
+      {
+        found = true;
+        segmentIndex = index;
+        bestY = top;
+        bestSegmentWidth = segment.mWidth;
+      }
+    }
+
+    y = bestY;
+    return found;
+  }
+
+  /**
+   * @brief Raises the skyline over an area packed at the given segment.
+   *
+   * @param[in,out] skyline The skyline of the atlas.
+   * @param[in] segmentIndex The index of the segment where the area starts.
+   * @param[in] y The top of the area.
+   * @param[in] width The width of the area.
+   * @param[in] height The height of the area.
+   */
+  void AddSkylineLevel( Vector< AtlasManager::SkylineSegment >& skyline,
+                        uint32_t segmentIndex,
+                        uint32_t y,
+                        uint32_t width,
+                        uint32_t height )
+  {
+    AtlasManager::SkylineSegment newSegment;
+    newSegment.mX = skyline[segmentIndex].mX;
+    newSegment.mY = y + height;
+    newSegment.mWidth = width;
+    skyline.Insert( skyline.Begin() + segmentIndex, newSegment );
+
+    // Shrink or remove the segments covered by the new one.
+    const uint32_t right = newSegment.mX + newSegment.mWidth;
+    for( uint32_t index = segmentIndex + 1u; index < skyline.Count(); )
+    {
+      AtlasManager::SkylineSegment& segment = skyline[index];
+      if( segment.mX >= right )
+      {
+        break;
+      }
+
+      const uint32_t covered = right - segment.mX;
+      if( segment.mWidth <= covered )
+      {
+        skyline.Remove( skyline.Begin() + index );
+        continue;
+      }
+
+      segment.mX += covered;
+      segment.mWidth -= covered;
+      break;
+    }
+
+    // Merge the contiguous segments with the same height.
+    for( uint32_t index = 0u; index + 1u < skyline.Count(); )
+    {
+      if( skyline[index].mY == skyline[index + 1u].mY )
+      {
+        skyline[index].mWidth += skyline[index + 1u].mWidth;
+        skyline.Remove( skyline.Begin() + index + 1u );
+      }
+      else
+      {
+        ++index;
+      }
+    }
+  }
+
+  /**
+   * @brief Reserves the removed image area which fits an area with less waste.
+   *
+   * The rest of the removed image area is split in two areas which can be reused.
+   *
+   * @param[in,out] freeAreas The areas of the removed images.
+   * @param[in,out] freeAreaPixels The number of pixels of the areas of the removed images.
+   * @param[in] width The width of the area.
+   * @param[in] height The height of the area.
+   * @param[out] x The horizontal position of the area.
+   * @param[out] y The vertical position of the area.
+   *
+   * @return Whether an area has been reserved.
+   */
+  bool ReuseFreeArea( Vector< AtlasManager::AtlasArea >& freeAreas,
+                      uint32_t& freeAreaPixels,
+                      uint32_t width,
+                      uint32_t height,
+                      uint32_t& x,
+                      uint32_t& y )
+  {
+    Vector< AtlasManager::AtlasArea >::Iterator bestIt = freeAreas.End();
+    uint32_t bestWaste = 0u;
+    for( Vector< AtlasManager::AtlasArea >::Iterator it = freeAreas.Begin(), endIt = freeAreas.End(); it != endIt; ++it )
+    {
+      const AtlasManager::AtlasArea& area = *it;
+      if( ( width <= area.mWidth ) && ( height <= area.mHeight ) )
+      {
+        const uint32_t waste = area.mWidth * area.mHeight - width * height;
+        if( ( bestIt == endIt ) || ( waste < bestWaste ) )
+        {
+          bestIt = it;
+          bestWaste = waste;
+        }
+      }
+    }
+
+    if( bestIt == freeAreas.End() )
+    {
+      return false;
+    }
+
+    const AtlasManager::AtlasArea area = *bestIt;
+    freeAreas.Remove( bestIt );
+    freeAreaPixels -= area.mWidth * area.mHeight;
+
+    x = area.mX;
+    y = area.mY;
+
+    // Keep the rest of the area on the right and below if an image can fit in it.
+    if( area.mWidth > width + DOUBLE_PIXEL_PADDING )
+    {
+      AtlasManager::AtlasArea right = { area.mX + width, area.mY, area.mWidth - width, height };
+      freeAreas.PushBack( right );
+      freeAreaPixels += right.mWidth * right.mHeight;
+    }
+    if( area.mHeight > height + DOUBLE_PIXEL_PADDING )
+    {
+      AtlasManager::AtlasArea bottom = { area.mX, area.mY + height, area.mWidth, area.mHeight - height };
+      freeAreas.PushBack( bottom );
+      freeAreaPixels += bottom.mWidth * bottom.mHeight;
+    }
+
+    return true;
+  }
+
+  AtlasManager::AtlasArea Union( const AtlasManager::AtlasArea& first, const AtlasManager::AtlasArea& second )
   {
-    return ( width + DOUBLE_PIXEL_PADDING <= requiredBlockWidth ) && ( height + DOUBLE_PIXEL_PADDING <= requiredBlockHeight );
+    const uint32_t left = std::min( first.mX, second.mX );
+    const uint32_t top = std::min( first.mY, second.mY );
+    const uint32_t right = std::max( first.mX + first.mWidth, second.mX + second.mWidth );
+    const uint32_t bottom = std::max( first.mY + first.mHeight, second.mY + second.mHeight );
+
+    AtlasManager::AtlasArea area = { left, top, right - left, bottom - top };
+    return area;
   }
 }
 
 AtlasManager::AtlasManager()
-: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES )
+: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES ),
+  mCompactionCount( 0u ),
+  mUploadCount( 0u ),
+  mUploadedBytes( 0u )
 {
   mNewAtlasSize.mWidth = DEFAULT_ATLAS_WIDTH;
   mNewAtlasSize.mHeight = DEFAULT_ATLAS_HEIGHT;
-  mNewAtlasSize.mBlockWidth = DEFAULT_BLOCK_WIDTH;
-  mNewAtlasSize.mBlockHeight = DEFAULT_BLOCK_HEIGHT;
 }
 
 AtlasManagerPtr AtlasManager::New()
@@ -72,48 +278,32 @@ Toolkit::AtlasManager::AtlasId AtlasManager::CreateAtlas( const Toolkit::AtlasMa
 {
   SizeType width = size.mWidth;
   SizeType height = size.mHeight;
-  SizeType blockWidth = size.mBlockWidth;
-  SizeType blockHeight = size.mBlockHeight;
 
-  // Check to see if the atlas is large enough to hold a single block even ?
-  if ( blockWidth + DOUBLE_PIXEL_PADDING + 1u > width || blockHeight + DOUBLE_PIXEL_PADDING + 1u > height )
+  // Check to see if the atlas is large enough to hold a single pixel image even ?
+  if ( !IsAtlasSizeSufficient( 1u, 1u, size ) )
   {
     DALI_LOG_ERROR("Atlas %i x %i too small. Dimensions need to be at least %ix%i\n",
-                    width, height, blockWidth + DOUBLE_PIXEL_PADDING + 1u, blockHeight + DOUBLE_PIXEL_PADDING + 1u );
+                    width, height, DOUBLE_PIXEL_PADDING + SINGLE_PIXEL_PADDING + 1u, DOUBLE_PIXEL_PADDING + 1u );
     return 0;
   }
 
   Dali::Texture atlas = Dali::Texture::New( TextureType::TEXTURE_2D, pixelformat, width, height );
 
-  // Clear the background
-  unsigned int bufferSize(  width * height * Dali::Pixel::GetBytesPerPixel( pixelformat ) );
-  unsigned char* background = new unsigned char[bufferSize];
-  memset( background, 0, bufferSize );
-  PixelData backgroundPixels = PixelData::New( background, bufferSize, width, height, pixelformat, PixelData::DELETE_ARRAY );
-  atlas.Upload( backgroundPixels, 0u, 0u, 0u, 0u, width, height );
-
   AtlasDescriptor atlasDescriptor;
   atlasDescriptor.mAtlas = atlas;
   atlasDescriptor.mSize = size;
   atlasDescriptor.mPixelFormat = pixelformat;
-  atlasDescriptor.mTotalBlocks = ( ( width - 1u ) / blockWidth ) * ( ( height - 1u ) / blockHeight );
-  atlasDescriptor.mAvailableBlocks = atlasDescriptor.mTotalBlocks;
-
-  bufferSize = blockWidth * SINGLE_PIXEL_PADDING * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferHorizontalStrip = new unsigned char[bufferSize];
-  memset( bufferHorizontalStrip, 0, bufferSize );
-  atlasDescriptor.mHorizontalStrip = PixelData::New( bufferHorizontalStrip, bufferSize, blockWidth, SINGLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
-
-  bufferSize = SINGLE_PIXEL_PADDING * (blockHeight - DOUBLE_PIXEL_PADDING) * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferVerticalStrip = new unsigned char[bufferSize];
-  memset( bufferVerticalStrip, 0, bufferSize );
-  atlasDescriptor.mVerticalStrip = PixelData::New( bufferVerticalStrip, bufferSize, SINGLE_PIXEL_PADDING, blockHeight - DOUBLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
-
-  bufferSize = Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* buffer = new unsigned char[bufferSize];
-  memset( buffer, 0xFF, bufferSize );
-  PixelData filledPixelImage = PixelData::New( buffer, bufferSize, 1u, 1u, pixelformat, PixelData::DELETE_ARRAY );
-  atlas.Upload( filledPixelImage, 0u, 0u, 0u, 0u, 1u, 1u );
+  ResetAtlas( atlasDescriptor );
+
+  // Clear the background and fill the top left pixel
+  const uint32_t bytesPerPixel = Dali::Pixel::GetBytesPerPixel( pixelformat );
+  atlasDescriptor.mShadowBuffer.Resize( width * height * bytesPerPixel, 0u );
+  memset( atlasDescriptor.mShadowBuffer.Begin(), 0xFF, bytesPerPixel );
+
+  // The whole atlas is uploaded with the first images
+  AtlasArea atlasArea = { 0u, 0u, width, height };
+  atlasDescriptor.mDirtyAreas.PushBack( atlasArea );
+
   mAtlasList.push_back( atlasDescriptor );
   return mAtlasList.size();
 }
@@ -131,6 +321,10 @@ bool AtlasManager::Add( const PixelData& image,
   Pixel::Format pixelFormat = image.GetPixelFormat();
   SizeType width = image.GetWidth();
   SizeType height = image.GetHeight();
+  SizeType areaWidth = width + DOUBLE_PIXEL_PADDING;
+  SizeType areaHeight = height + DOUBLE_PIXEL_PADDING;
+  SizeType areaX = 0u;
+  SizeType areaY = 0u;
   SizeType foundAtlas = 0;
   SizeType index = 0;
   slot.mImageId = 0;
@@ -140,13 +334,13 @@ bool AtlasManager::Add( const PixelData& image,
   // If there is a preferred atlas then check for room in that first
   if ( atlas-- )
   {
-    foundAtlas = CheckAtlas( atlas, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( atlas, areaWidth, areaHeight, pixelFormat, areaX, areaY );
   }
 
   // Search current atlases to see if there is a good match
   while( ( 0u == foundAtlas ) && ( index < mAtlasList.size() ) )
   {
-    foundAtlas = CheckAtlas( index, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( index, areaWidth, areaHeight, pixelFormat, areaX, areaY );
     ++index;
   }
 
@@ -155,21 +349,20 @@ bool AtlasManager::Add( const PixelData& image,
   {
     if ( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES == mAddFailPolicy )
     {
-      if ( IsBlockSizeSufficient( width, height, mNewAtlasSize.mBlockWidth, mNewAtlasSize.mBlockHeight ) ) // Checks if image fits within the atlas blocks
+      if ( IsAtlasSizeSufficient( width, height, mNewAtlasSize ) ) // Checks if image fits within a new atlas
       {
-        foundAtlas = CreateAtlas( mNewAtlasSize, pixelFormat ); // Creating atlas with mNewAtlasSize, may not be the needed size!
+        foundAtlas = CreateAtlas( mNewAtlasSize, pixelFormat );
         if (  0u == foundAtlas )
         {
-          DALI_LOG_ERROR("Failed to create an atlas of %i x %i blocksize: %i x %i.\n",
+          DALI_LOG_ERROR("Failed to create an atlas of %i x %i.\n",
                          mNewAtlasSize.mWidth,
-                         mNewAtlasSize.mHeight,
-                         mNewAtlasSize.mBlockWidth,
-                         mNewAtlasSize.mBlockHeight );
+                         mNewAtlasSize.mHeight );
           return false;
         }
         else
         {
           created = true;
+          foundAtlas = CheckAtlas( foundAtlas - 1u, areaWidth, areaHeight, pixelFormat, areaX, areaY );
         }
       }
     }
@@ -184,42 +377,28 @@ bool AtlasManager::Add( const PixelData& image,
 
   foundAtlas--; // Atlas created successfully, decrement by 1 to get <vector> index (starts at 0 not 1)
 
-  // Work out which the block we're going to use
-  // Is there currently a next free block available ?
-  if ( mAtlasList[ foundAtlas ].mAvailableBlocks )
-  {
-    // Yes, so select our next block
-    desc.mBlock = mAtlasList[ foundAtlas ].mTotalBlocks - mAtlasList[ foundAtlas ].mAvailableBlocks--;
-  }
-  else
-  {
-    // Our next block must be from the free list, fetch from the start of the list
-    desc.mBlock = mAtlasList[ foundAtlas ].mFreeBlocksList[ 0 ];
-    mAtlasList[ foundAtlas ].mFreeBlocksList.Remove( mAtlasList[ foundAtlas ].mFreeBlocksList.Begin() );
-  }
+  AtlasDescriptor& atlasDescriptor = mAtlasList[ foundAtlas ];
+  ++atlasDescriptor.mImageCount;
+  atlasDescriptor.mUsedPixels += areaWidth * areaHeight;
 
+  // The image is placed inside the padding of its area
+  desc.mImageX = areaX + SINGLE_PIXEL_PADDING;
+  desc.mImageY = areaY + SINGLE_PIXEL_PADDING;
   desc.mImageWidth = width;
   desc.mImageHeight = height;
   desc.mAtlasId = foundAtlas + 1u;  // Ids start from 1 not the 0 index
   desc.mCount = 1u;
 
-  // See if there's a previously freed image ID that we can assign to this new image
-  uint32_t imageId = 0u;
-  for ( uint32_t i = 0u; i < mImageList.Size(); ++i )
-  {
-    if ( !mImageList[ i ].mCount )
-    {
-      imageId = i + 1u;
-      break;
-    }
-  }
-  if ( !imageId )
+  // Reuse a previously freed image ID if there is one
+  if ( mFreeImageIds.Empty() )
   {
     mImageList.PushBack( desc );
     slot.mImageId = mImageList.Size();
   }
   else
   {
+    const ImageId imageId = mFreeImageIds[ mFreeImageIds.Count() - 1u ];
+    mFreeImageIds.Resize( mFreeImageIds.Count() - 1u );
     mImageList[ imageId - 1u ] = desc;
     slot.mImageId = imageId;
   }
@@ -233,19 +412,34 @@ bool AtlasManager::Add( const PixelData& image,
 AtlasManager::SizeType AtlasManager::CheckAtlas( SizeType atlas,
                                                  SizeType width,
                                                  SizeType height,
-                                                 Pixel::Format pixelFormat )
+                                                 Pixel::Format pixelFormat,
+                                                 SizeType& x,
+                                                 SizeType& y )
 {
   AtlasManager::SizeType result = 0u;
-  if ( pixelFormat == mAtlasList[ atlas ].mPixelFormat )
+  AtlasDescriptor& atlasDescriptor = mAtlasList[ atlas ];
+  if ( ( pixelFormat == atlasDescriptor.mPixelFormat ) && !atlasDescriptor.mRetired )
   {
-    // Check to see if the image will fit in these blocks
-
-    const SizeType availableBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
-
-    if ( availableBlocks && IsBlockSizeSufficient( width, height,mAtlasList[ atlas ].mSize.mBlockWidth, mAtlasList[ atlas ].mSize.mBlockHeight ) )
+    // Check to see if the image fits in the area of a removed one
+    if ( ReuseFreeArea( atlasDescriptor.mFreeAreas, atlasDescriptor.mFreeAreaPixels, width, height, x, y ) )
     {
       result = atlas + 1u; // Atlas ids start from 1 not 0
     }
+    else
+    {
+      // Check to see if the image fits on the skyline
+      SizeType segmentIndex = 0u;
+      if ( FindSkylinePosition( atlasDescriptor.mSkyline, atlasDescriptor.mSize, width, height, segmentIndex, y ) )
+      {
+        x = atlasDescriptor.mSkyline[ segmentIndex ].mX;
+        AddSkylineLevel( atlasDescriptor.mSkyline, segmentIndex, y, width, height );
+        result = atlas + 1u; // Atlas ids start from 1 not 0
+      }
+      else
+      {
+        atlasDescriptor.mFull = true;
+      }
+    }
   }
   return result;
 }
@@ -255,79 +449,148 @@ void AtlasManager::UploadImage( const PixelData& image,
 {
   // Get the atlas to upload the image to
   SizeType atlas = desc.mAtlasId - 1u;
+  AtlasDescriptor& atlasDescriptor = mAtlasList[ atlas ];
 
   // Check to see that the pixel formats are compatible
-  if ( image.GetPixelFormat() != mAtlasList[ atlas ].mPixelFormat )
+  if ( image.GetPixelFormat() != atlasDescriptor.mPixelFormat )
   {
     DALI_LOG_ERROR("Cannot upload an image with a different PixelFormat to the Atlas.\n");
     return;
   }
 
-  SizeType atlasBlockWidth = mAtlasList[ atlas ].mSize.mBlockWidth;
-  SizeType atlasBlockHeight = mAtlasList[ atlas ].mSize.mBlockHeight;
-  SizeType atlasWidthInBlocks = ( mAtlasList[ atlas ].mSize.mWidth - 1u ) / mAtlasList[ atlas ].mSize.mBlockWidth;
+  const SizeType width = image.GetWidth();
+  const SizeType height = image.GetHeight();
+  const SizeType bytesPerPixel = Dali::Pixel::GetBytesPerPixel( atlasDescriptor.mPixelFormat );
+  const SizeType atlasStride = atlasDescriptor.mSize.mWidth * bytesPerPixel;
+  const SizeType imageStride = width * bytesPerPixel;
 
-  SizeType blockX = desc.mBlock % atlasWidthInBlocks;
-  SizeType blockY = desc.mBlock / atlasWidthInBlocks;
-  SizeType blockOffsetX = ( blockX * atlasBlockWidth ) + 1u;
-  SizeType blockOffsetY = ( blockY * atlasBlockHeight) + 1u;
+  AtlasArea area;
+  area.mX = desc.mImageX - SINGLE_PIXEL_PADDING;
+  area.mY = desc.mImageY - SINGLE_PIXEL_PADDING;
+  area.mWidth = width + DOUBLE_PIXEL_PADDING;
+  area.mHeight = height + DOUBLE_PIXEL_PADDING;
 
-  SizeType width = image.GetWidth();
-  SizeType height = image.GetHeight();
+  Dali::DevelPixelData::PixelDataBuffer imageBuffer = Dali::DevelPixelData::ReleasePixelDataBuffer( image );
 
-  // Blit image 1 pixel to the right and down into the block to compensate for texture filtering
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( image, 0u, 0u,
-                                           blockOffsetX + SINGLE_PIXEL_PADDING,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           width, height) )
+  // Copy the image 1 pixel to the right and down into the area, surrounded by transparent pixels to compensate for texture filtering
+  uint8_t* areaBuffer = atlasDescriptor.mShadowBuffer.Begin() + area.mY * atlasStride + area.mX * bytesPerPixel;
+  for( SizeType row = 0u; row < area.mHeight; ++row, areaBuffer += atlasStride )
   {
-    DALI_LOG_ERROR("Uploading image to Atlas Failed!.\n");
+    const bool isPaddingRow = ( row < SINGLE_PIXEL_PADDING ) || ( row >= height + SINGLE_PIXEL_PADDING );
+    if( isPaddingRow || ( NULL == imageBuffer.buffer ) )
+    {
+      memset( areaBuffer, 0, area.mWidth * bytesPerPixel );
+    }
+    else
+    {
+      memset( areaBuffer, 0, SINGLE_PIXEL_PADDING * bytesPerPixel );
+      memcpy( areaBuffer + SINGLE_PIXEL_PADDING * bytesPerPixel, imageBuffer.buffer + ( row - SINGLE_PIXEL_PADDING ) * imageStride, imageStride );
+      memset( areaBuffer + SINGLE_PIXEL_PADDING * bytesPerPixel + imageStride, 0, SINGLE_PIXEL_PADDING * bytesPerPixel );
+    }
   }
 
-  // Blit top strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY,
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetHeight()) )
+  if( NULL != imageBuffer.buffer )
   {
-    DALI_LOG_ERROR("Uploading top strip to Atlas Failed!\n");
+    if( PixelData::FREE == imageBuffer.releaseFunction )
+    {
+      free( imageBuffer.buffer );
+    }
+    else
+    {
+      delete[] imageBuffer.buffer;
+    }
   }
 
-  // Blit left strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
+  AddDirtyArea( atlasDescriptor, area );
+}
+
+void AtlasManager::AddDirtyArea( AtlasDescriptor& atlas, const AtlasArea& area )
+{
+  AtlasArea dirtyArea = area;
+
+  // Merge the areas whose union doesn't upload too many pixels which aren't dirty
+  bool merged = true;
+  while( merged )
   {
-    DALI_LOG_ERROR("Uploading left strip to Atlas Failed!\n");
+    merged = false;
+    for( Vector< AtlasArea >::Iterator it = atlas.mDirtyAreas.Begin(), endIt = atlas.mDirtyAreas.End(); it != endIt; ++it )
+    {
+      const AtlasArea unionArea = Union( *it, dirtyArea );
+      if( unionArea.mWidth * unionArea.mHeight <= MAX_MERGE_WASTE * ( it->mWidth * it->mHeight + dirtyArea.mWidth * dirtyArea.mHeight ) )
+      {
+        dirtyArea = unionArea;
+        atlas.mDirtyAreas.Remove( it );
+        merged = true;
+        break;
+      }
+    }
   }
 
-  // Blit bottom strip
-  if ( blockOffsetY + height + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mHeight )
+  if( MAX_DIRTY_AREAS == atlas.mDirtyAreas.Count() )
   {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
-                                             blockOffsetX,
-                                             blockOffsetY + height + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetHeight() ) )
+    // Merge with the area which grows less
+    Vector< AtlasArea >::Iterator bestIt = atlas.mDirtyAreas.Begin();
+    uint32_t bestGrowth = 0u;
+    for( Vector< AtlasArea >::Iterator it = atlas.mDirtyAreas.Begin(), endIt = atlas.mDirtyAreas.End(); it != endIt; ++it )
     {
-      DALI_LOG_ERROR("Uploading bottom strip to Atlas Failed!.\n");
+      const AtlasArea unionArea = Union( *it, dirtyArea );
+      const uint32_t growth = unionArea.mWidth * unionArea.mHeight - it->mWidth * it->mHeight;
+      if( ( it == atlas.mDirtyAreas.Begin() ) || ( growth < bestGrowth ) )
+      {
+        bestIt = it;
+        bestGrowth = growth;
+      }
     }
+
+    dirtyArea = Union( *bestIt, dirtyArea );
+    atlas.mDirtyAreas.Remove( bestIt );
   }
 
-  // Blit right strip
-  if ( blockOffsetX + width + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mWidth )
+  atlas.mDirtyAreas.PushBack( dirtyArea );
+}
+
+void AtlasManager::FlushUploads()
+{
+  mUploadCount = 0u;
+  mUploadedBytes = 0u;
+
+  for( std::vector< AtlasDescriptor >::iterator it = mAtlasList.begin(), endIt = mAtlasList.end(); it != endIt; ++it )
   {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                             blockOffsetX + width + SINGLE_PIXEL_PADDING,
-                                             blockOffsetY + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
+    AtlasDescriptor& atlas = *it;
+
+    const SizeType bytesPerPixel = Dali::Pixel::GetBytesPerPixel( atlas.mPixelFormat );
+    const SizeType atlasStride = atlas.mSize.mWidth * bytesPerPixel;
+
+    for( Vector< AtlasArea >::ConstIterator areaIt = atlas.mDirtyAreas.Begin(), areaEndIt = atlas.mDirtyAreas.End(); areaIt != areaEndIt; ++areaIt )
     {
-      DALI_LOG_ERROR("Uploading right strip to Atlas Failed!.\n");
+      const AtlasArea& area = *areaIt;
+      const SizeType areaStride = area.mWidth * bytesPerPixel;
+      const SizeType bufferSize = areaStride * area.mHeight;
+
+      // Copy the rows of the area from the shadow buffer
+      unsigned char* buffer = new unsigned char[bufferSize];
+      const uint8_t* shadowBuffer = atlas.mShadowBuffer.Begin() + area.mY * atlasStride + area.mX * bytesPerPixel;
+      for( SizeType row = 0u; row < area.mHeight; ++row, shadowBuffer += atlasStride )
+      {
+        memcpy( buffer + row * areaStride, shadowBuffer, areaStride );
+      }
+
+      PixelData pixels = PixelData::New( buffer, bufferSize, area.mWidth, area.mHeight, atlas.mPixelFormat, PixelData::DELETE_ARRAY );
+      if ( !atlas.mAtlas.Upload( pixels, 0u, 0u, area.mX, area.mY, area.mWidth, area.mHeight ) )
+      {
+        DALI_LOG_ERROR("Uploading image to Atlas Failed!.\n");
+      }
+
+      ++mUploadCount;
+      mUploadedBytes += bufferSize;
     }
+
+    atlas.mDirtyAreas.Clear();
+  }
+
+  if( 0u != mUploadCount )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "AtlasManager::FlushUploads uploads: %d, bytes: %d\n", mUploadCount, mUploadedBytes );
   }
 }
 
@@ -346,7 +609,8 @@ void AtlasManager::GenerateMeshData( ImageId id,
 
     AtlasMeshFactory::CreateQuad( width,
                                   height,
-                                  mImageList[ imageId ].mBlock,
+                                  mImageList[ imageId ].mImageX,
+                                  mImageList[ imageId ].mImageY,
                                   mAtlasList[ atlas ].mSize,
                                   position,
                                   meshData );
@@ -395,11 +659,43 @@ bool AtlasManager::Remove( ImageId id )
 
   if ( 2u > --mImageList[ imageId ].mCount )
   {
-    // 'Remove the blocks' from this image and add to the atlas' freelist
+    // 'Remove the area' of this image and add it to the atlas' free areas
     removed = true;
     mImageList[ imageId ].mCount = 0;
-    SizeType atlas = mImageList[ imageId ].mAtlasId - 1u;
-    mAtlasList[ atlas ].mFreeBlocksList.PushBack( mImageList[ imageId ].mBlock );
+    mFreeImageIds.PushBack( id );
+
+    AtlasDescriptor& atlas = mAtlasList[ mImageList[ imageId ].mAtlasId - 1u ];
+    AtlasArea area;
+    area.mX = mImageList[ imageId ].mImageX - SINGLE_PIXEL_PADDING;
+    area.mY = mImageList[ imageId ].mImageY - SINGLE_PIXEL_PADDING;
+    area.mWidth = mImageList[ imageId ].mImageWidth + DOUBLE_PIXEL_PADDING;
+    area.mHeight = mImageList[ imageId ].mImageHeight + DOUBLE_PIXEL_PADDING;
+
+    --atlas.mImageCount;
+    atlas.mUsedPixels -= area.mWidth * area.mHeight;
+
+    if ( 0u == atlas.mImageCount )
+    {
+      // No mesh uses the atlas anymore so it can be repacked from scratch
+      if ( atlas.mRetired )
+      {
+        ++mCompactionCount;
+      }
+      ResetAtlas( atlas );
+    }
+    else
+    {
+      atlas.mFreeAreas.PushBack( area );
+      atlas.mFreeAreaPixels += area.mWidth * area.mHeight;
+
+      // Stop adding images to a full atlas mostly made of removed images, so it drains and can be repacked
+      if ( atlas.mFull && !atlas.mRetired &&
+           ( static_cast< float >( atlas.mFreeAreaPixels ) > MAX_FRAGMENTATION * static_cast< float >( atlas.mFreeAreaPixels + atlas.mUsedPixels ) ) )
+      {
+        DALI_LOG_INFO( gLogFilter, Debug::General, "AtlasManager::Remove retiring fragmented atlas: %d, images: %d\n", mImageList[ imageId ].mAtlasId, atlas.mImageCount );
+        atlas.mRetired = true;
+      }
+    }
   }
   return removed;
 }
@@ -418,10 +714,6 @@ AtlasManager::AtlasId AtlasManager::GetAtlas( ImageId id ) const
 void AtlasManager::SetNewAtlasSize( const Toolkit::AtlasManager::AtlasSize& size )
 {
   mNewAtlasSize = size;
-
-  // Add on padding for borders around atlas entries
-  mNewAtlasSize.mBlockWidth += DOUBLE_PIXEL_PADDING;
-  mNewAtlasSize.mBlockHeight += DOUBLE_PIXEL_PADDING;
 }
 
 const Toolkit::AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atlas )
@@ -434,15 +726,15 @@ const Toolkit::AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atla
   return EMPTY_SIZE;
 }
 
-AtlasManager::SizeType AtlasManager::GetFreeBlocks( AtlasId atlas ) const
+AtlasManager::SizeType AtlasManager::GetFreePixels( AtlasId atlas ) const
 {
   DALI_ASSERT_DEBUG( atlas && atlas <= mAtlasList.size() );
-  AtlasManager::SizeType freeBlocks = 0u;
+  AtlasManager::SizeType freePixels = 0u;
   if ( atlas && atlas-- <= mAtlasList.size() )
   {
-    freeBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
+    freePixels = mAtlasList[ atlas ].mSize.mWidth * mAtlasList[ atlas ].mSize.mHeight - mAtlasList[ atlas ].mUsedPixels;
   }
-  return freeBlocks;
+  return freePixels;
 }
 
 AtlasManager::SizeType AtlasManager::GetAtlasCount() const
@@ -467,25 +759,22 @@ void AtlasManager::GetMetrics( Toolkit::AtlasManager::Metrics& metrics )
   uint32_t textureMemoryUsed = 0;
   uint32_t atlasCount = mAtlasList.size();
   metrics.mAtlasCount = atlasCount;
+  metrics.mCompactionCount = mCompactionCount;
+  metrics.mUploadCount = mUploadCount;
+  metrics.mUploadedBytes = mUploadedBytes;
   metrics.mAtlasMetrics.Resize(0);
 
   for ( uint32_t i = 0; i < atlasCount; ++i )
   {
     entry.mSize = mAtlasList[ i ].mSize;
-    entry.mTotalBlocks = mAtlasList[ i ].mTotalBlocks;
-    entry.mBlocksUsed = entry.mTotalBlocks - mAtlasList[ i ].mAvailableBlocks + mAtlasList[ i ].mFreeBlocksList.Size();
+    entry.mImageCount = mAtlasList[ i ].mImageCount;
+    entry.mPixelsUsed = mAtlasList[ i ].mUsedPixels;
+    entry.mTotalPixels = entry.mSize.mWidth * entry.mSize.mHeight;
     entry.mPixelFormat = GetPixelFormat( i + 1 );
 
     metrics.mAtlasMetrics.PushBack( entry );
 
-    uint32_t size = entry.mSize.mWidth * entry.mSize.mHeight;
-    if ( entry.mPixelFormat == Pixel::BGRA8888 )
-    {
-      size <<= 2;
-    }
-
-    textureMemoryUsed += size;
-
+    textureMemoryUsed += entry.mTotalPixels * Dali::Pixel::GetBytesPerPixel( entry.mPixelFormat );
   }
   metrics.mTextureMemoryUsed = textureMemoryUsed;
 }
@@ -510,6 +799,23 @@ void AtlasManager::SetTextures( AtlasId atlas, TextureSet& textureSet )
   }
 }
 
+void AtlasManager::ResetAtlas( AtlasDescriptor& atlas )
+{
+  atlas.mSkyline.Clear();
+  atlas.mFreeAreas.Clear();
+  atlas.mImageCount = 0u;
+  atlas.mUsedPixels = 0u;
+  atlas.mFreeAreaPixels = 0u;
+  atlas.mFull = false;
+  atlas.mRetired = false;
+
+  // The top left pixel is reserved for the filled pixel used by the underlines
+  SkylineSegment reserved = { 0u, SINGLE_PIXEL_PADDING, SINGLE_PIXEL_PADDING };
+  SkylineSegment free = { SINGLE_PIXEL_PADDING, 0u, atlas.mSize.mWidth - SINGLE_PIXEL_PADDING };
+  atlas.mSkyline.PushBack( reserved );
+  atlas.mSkyline.PushBack( free );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
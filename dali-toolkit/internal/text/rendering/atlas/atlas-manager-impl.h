@@ -54,6 +54,27 @@ public:
   typedef SizeType AtlasId;
   typedef SizeType ImageId;
 
+  /**
+   * @brief A horizontal segment of the skyline which bounds the packed area of an atlas
+   */
+  struct SkylineSegment
+  {
+    SizeType mX;                                                        // Left of the segment
+    SizeType mY;                                                        // Top of the free area above the segment
+    SizeType mWidth;                                                    // Width of the segment
+  };
+
+  /**
+   * @brief A rectangular area of an atlas
+   */
+  struct AtlasArea
+  {
+    SizeType mX;                                                        // Left of the area
+    SizeType mY;                                                        // Top of the area
+    SizeType mWidth;                                                    // Width of the area
+    SizeType mHeight;                                                   // Height of the area
+  };
+
   /**
    * @brief Internal storage of atlas attributes and image upload results
    */
@@ -62,12 +83,16 @@ public:
     Dali::Texture mAtlas;                                                 // atlas image
     Toolkit::AtlasManager::AtlasSize mSize;                             // size of atlas
     Pixel::Format mPixelFormat;                                         // pixel format used by atlas
-    PixelData mHorizontalStrip;                                       // Image used to pad upload
-    PixelData mVerticalStrip;                                         // Image used to pad upload
+    Dali::Vector< uint8_t > mShadowBuffer;                              // Copy of the atlas pixels where the images are staged before upload
+    Dali::Vector< AtlasArea > mDirtyAreas;                              // Areas of the shadow buffer not uploaded yet
     TextureSet mTextureSet;                                             // Texture set used for atlas texture
-    SizeType mTotalBlocks;                                              // total number of blocks in atlas
-    SizeType mAvailableBlocks;                                          // number of blocks available in atlas
-    Dali::Vector< SizeType > mFreeBlocksList;                           // unless there are any previously freed blocks
+    Dali::Vector< SkylineSegment > mSkyline;                            // Segments bounding the packed area, sorted from left to right
+    Dali::Vector< AtlasArea > mFreeAreas;                               // Areas of removed images which can be reused
+    SizeType mImageCount;                                               // number of images stored in atlas
+    SizeType mUsedPixels;                                               // number of pixels used by the images, including padding
+    SizeType mFreeAreaPixels;                                           // number of pixels of the free areas
+    bool mFull;                                                         // whether an image didn't fit in the atlas
+    bool mRetired;                                                      // whether the atlas is too fragmented to receive images
   };
 
   struct AtlasSlotDescriptor
@@ -76,7 +101,8 @@ public:
     SizeType mImageWidth;                                               // Width of image stored
     SizeType mImageHeight;                                              // Height of image stored
     AtlasId mAtlasId;                                                   // Image is stored in this Atlas
-    SizeType mBlock;                                                    // Block within atlas used for image
+    SizeType mImageX;                                                   // Horizontal position of the image within the atlas
+    SizeType mImageY;                                                   // Vertical position of the image within the atlas
   };
 
   AtlasManager();
@@ -105,6 +131,11 @@ public:
             Toolkit::AtlasManager::AtlasSlot& slot,
             Toolkit::AtlasManager::AtlasId atlas );
 
+  /**
+   * @copydoc Toolkit::AtlasManager::FlushUploads
+   */
+  void FlushUploads();
+
   /**
    * @copydoc Toolkit::AtlasManager::GenerateMeshData
    */
@@ -139,14 +170,9 @@ public:
   const Toolkit::AtlasManager::AtlasSize& GetAtlasSize( AtlasId atlas );
 
   /**
-   * @copydoc Toolkit::AtlasManager::GetBlockSize
+   * @copydoc Toolkit::AtlasManager::GetFreePixels
    */
-  Vector2 GetBlockSize( AtlasId atlas );
-
-  /**
-   * @copydoc Toolkit::AtlasManager::GetFreeBlocks
-   */
-  SizeType GetFreeBlocks( AtlasId atlas ) const;
+  SizeType GetFreePixels( AtlasId atlas ) const;
 
   /*
    * @copydoc Toolkit::AtlasManager::GetAtlasCount
@@ -177,17 +203,58 @@ private:
 
   std::vector< AtlasDescriptor > mAtlasList;            // List of atlases created
   Vector< AtlasSlotDescriptor > mImageList;             // List of bitmaps stored in atlases
+  Vector< ImageId > mFreeImageIds;                      // Ids of the removed bitmaps which can be reused
   Toolkit::AtlasManager::AtlasSize mNewAtlasSize;       // Atlas size to use in next creation
   Toolkit::AtlasManager::AddFailPolicy mAddFailPolicy;  // Policy for failing to add an Image
+  SizeType mCompactionCount;                            // Number of fragmented atlases emptied and repacked
+  SizeType mUploadCount;                                // Number of texture uploads of the last flush
+  SizeType mUploadedBytes;                              // Number of bytes uploaded by the last flush
 
+  /**
+   * @brief Reserves an area of an atlas for an image.
+   *
+   * The area of a removed image is reused if one fits, otherwise the area is packed on the skyline.
+   *
+   * @param[in] atlas The index of the atlas.
+   * @param[in] width The width of the area, including padding.
+   * @param[in] height The height of the area, including padding.
+   * @param[in] pixelFormat The pixel format of the image.
+   * @param[out] x The horizontal position of the area.
+   * @param[out] y The vertical position of the area.
+   *
+   * @return The atlas id if the area has been reserved, otherwise zero.
+   */
   SizeType CheckAtlas( SizeType atlas,
                        SizeType width,
                        SizeType height,
-                       Pixel::Format pixelFormat );
+                       Pixel::Format pixelFormat,
+                       SizeType& x,
+                       SizeType& y );
 
+  /**
+   * @brief Resets the packed area of an atlas which doesn't store any image.
+   *
+   * @param[in,out] atlas The atlas.
+   */
+  void ResetAtlas( AtlasDescriptor& atlas );
+
+  /**
+   * @brief Copies an image and its padding to the shadow buffer of its atlas and marks the area as dirty.
+   *
+   * @param[in] image The image. Its buffer is released.
+   * @param[in] desc The slot of the image.
+   */
   void UploadImage( const PixelData& image,
                     const AtlasSlotDescriptor& desc );
 
+  /**
+   * @brief Adds an area to the dirty areas of an atlas, merging it with the close ones.
+   *
+   * @param[in,out] atlas The atlas.
+   * @param[in] area The area to upload.
+   */
+  void AddDirtyArea( AtlasDescriptor& atlas, const AtlasArea& area );
+
 };
 
 } // namespace Internal
@@ -62,6 +62,11 @@ bool AtlasManager::Add( const PixelData& image,
   return GetImplementation(*this).Add( image, slot, atlas );
 }
 
+void AtlasManager::FlushUploads()
+{
+  GetImplementation(*this).FlushUploads();
+}
+
 bool AtlasManager::Remove( ImageId id )
 {
   return GetImplementation(*this).Remove( id );
@@ -93,9 +98,9 @@ const AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atlas )
   return GetImplementation(*this).GetAtlasSize( atlas );
 }
 
-AtlasManager::SizeType AtlasManager::GetFreeBlocks( AtlasId atlas )
+AtlasManager::SizeType AtlasManager::GetFreePixels( AtlasId atlas )
 {
-  return GetImplementation(*this).GetFreeBlocks( atlas );
+  return GetImplementation(*this).GetFreePixels( atlas );
 }
 
 void AtlasManager::SetNewAtlasSize( const AtlasSize& size )
@@ -47,8 +47,6 @@ public:
   {
     SizeType mWidth;              ///< width of the atlas in pixels
     SizeType mHeight;             ///< height of the atlas in pixels
-    SizeType mBlockWidth;         ///< width of a block in pixels
-    SizeType mBlockHeight;        ///< height of a block in pixels
   };
 
   /**
@@ -57,9 +55,10 @@ public:
    */
   struct AtlasMetricsEntry
   {
-    AtlasSize mSize;                 ///< size of atlas and blocks
-    SizeType mBlocksUsed;            ///< number of blocks used in the atlas
-    SizeType mTotalBlocks;           ///< total blocks used by atlas
+    AtlasSize mSize;                 ///< size of atlas
+    SizeType mImageCount;            ///< number of images stored in the atlas
+    SizeType mPixelsUsed;            ///< number of pixels used by the images, including their padding
+    SizeType mTotalPixels;           ///< total pixels of the atlas
     Pixel::Format mPixelFormat;      ///< pixel format of the atlas
   };
 
@@ -67,14 +66,20 @@ public:
   {
     Metrics()
     : mAtlasCount( 0u ),
-      mTextureMemoryUsed( 0u )
+      mTextureMemoryUsed( 0u ),
+      mCompactionCount( 0u ),
+      mUploadCount( 0u ),
+      mUploadedBytes( 0u )
     {}
 
     ~Metrics()
     {}
 
     SizeType mAtlasCount;                               ///< number of atlases
-    SizeType mTextureMemoryUsed;                        ///< texture memory used by atlases
+    SizeType mTextureMemoryUsed;                        ///< texture memory used by atlases, in bytes
+    SizeType mCompactionCount;                          ///< number of fragmented atlases emptied and repacked
+    SizeType mUploadCount;                              ///< number of texture uploads of the last flush
+    SizeType mUploadedBytes;                            ///< number of bytes uploaded by the last flush
     Dali::Vector< AtlasMetricsEntry > mAtlasMetrics;    ///< container of atlas information
   };
 
@@ -132,7 +137,7 @@ public:
   typedef Dali::Vector< AtlasManager::AtlasSlot > slotContainer;
 
   /**
-   * @brief Create a blank atlas of specific dimensions and pixel format with a certain block size
+   * @brief Create a blank atlas of specific dimensions and pixel format
    *
    * @param[in] size desired atlas dimensions
    * @param[in] pixelformat format of a pixel in atlas
@@ -151,10 +156,14 @@ public:
   /**
    * @brief Attempts to add an image to the most suitable atlas
    *
-   * @details Add Policy may dictate that a new atlas is created if it can't presently be placed.
+   * @details Images of any size are packed along the skyline of the atlas or reuse the area of removed images.
+   *          Add Policy may dictate that a new atlas is created if it can't presently be placed.
    *          If an add is made before an atlas is created under this policy,
    *          then a default size atlas will be created
    *
+   * @note The image is staged in a copy of the atlas. It's uploaded to the atlas texture by FlushUploads().
+   *       The buffer of the image is released.
+   *
    * @param[in] image PixelData object containing the image data
    * @param[out] slot result of add operation
    * @param[in] atlas optional preferred atlas
@@ -165,9 +174,19 @@ public:
             AtlasSlot& slot,
             AtlasId atlas = 0 );
 
+  /**
+   * @brief Upload the images added since the last flush to the atlas textures
+   *
+   * @details The areas of the images are merged into a few rectangles per atlas, so many images are uploaded at once.
+   */
+  void FlushUploads();
+
   /**
    * @brief Remove previously added bitmapimage from atlas
    *
+   * @details An atlas whose area is mostly made of removed images doesn't receive new images
+   *          until all its images are removed. It's then repacked from scratch.
+   *
    * @param[in] id ImageId returned in the AtlasSlot from the add operation
    *
    * @return if true then image has been removed from the atlas
@@ -214,20 +233,18 @@ public:
   const AtlasSize& GetAtlasSize( AtlasId atlas );
 
   /**
-   * @brief Get the number of blocks available in an atlas
+   * @brief Get the number of pixels not used by any image in an atlas
    *
    * @param[in] atlas AtlasId
    *
-   * @return Number of blocks free in this atlas
+   * @return Number of pixels free in this atlas
    */
-  SizeType GetFreeBlocks( AtlasId atlas );
+  SizeType GetFreePixels( AtlasId atlas );
 
   /**
-   * @brief Sets the pixel area of any new atlas and also the individual block size
+   * @brief Sets the pixel area of any new atlas
    *
    * @param[in] size Atlas size structure
-   *
-   * @param blockSize pixel area in atlas for a block
    */
   void SetNewAtlasSize( const AtlasSize& size );
 
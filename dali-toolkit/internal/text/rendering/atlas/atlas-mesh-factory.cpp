@@ -31,47 +31,26 @@ namespace AtlasMeshFactory
 
 void CreateQuad( SizeType imageWidth,
                  SizeType imageHeight,
-                 SizeType block,
+                 SizeType imageX,
+                 SizeType imageY,
                  const Toolkit::AtlasManager::AtlasSize& atlasSize,
                  const Vector2& position,
                  Toolkit::AtlasManager::Mesh2D& mesh )
 {
   Toolkit::AtlasManager::Vertex2D vertex;
 
-  SizeType blockWidth = atlasSize.mBlockWidth;
-  SizeType blockHeight = atlasSize.mBlockHeight;
-
-  float vertexBlockWidth = static_cast< float >( blockWidth );
-  float vertexBlockHeight = static_cast< float >( blockHeight );
-
   SizeType atlasWidth = atlasSize.mWidth;
   SizeType atlasHeight = atlasSize.mHeight;
 
-  SizeType atlasWidthInBlocks = ( atlasWidth - 1u ) / blockWidth;
-
   // Get the normalized size of a texel in both directions
   float texelX = 1.0f / static_cast< float >( atlasWidth );
   float texelY = 1.0f / static_cast< float >( atlasHeight );
 
-  float oneAndAHalfTexelX = texelX + ( texelX * 0.5f );
-  float oneAndAHalfTexelY = texelY + ( texelY * 0.5f );
+  float halfTexelX = texelX * 0.5f;
+  float halfTexelY = texelY * 0.5f;
 
-  float texelBlockWidth = texelX * vertexBlockWidth;
-  float texelBlockHeight = texelY * vertexBlockHeight;
-
-  uint32_t pixelsX = imageWidth % blockWidth;
-  uint32_t pixelsY = imageHeight % blockHeight;
-
-  if ( !pixelsX )
-  {
-    pixelsX = blockWidth;
-  }
-  if ( !pixelsY )
-  {
-    pixelsY = blockHeight;
-  }
-  float vertexWidth = static_cast< float >( pixelsX );
-  float vertexHeight = static_cast< float >( pixelsY );
+  float vertexWidth = static_cast< float >( imageWidth );
+  float vertexHeight = static_cast< float >( imageHeight );
   float texelWidth = texelX * vertexWidth;
   float texelHeight = texelY * vertexHeight;
 
@@ -82,15 +61,9 @@ void CreateQuad( SizeType imageWidth,
   // Move back half a pixel
   Vector2 topLeft = Vector2( position.x - 0.5f, position.y - 0.5f );
 
-  float fBlockX = texelBlockWidth * static_cast< float >( block % atlasWidthInBlocks );
-
-  // In the next expression, we have purposely made ( block / atlasWidthInBlocks ) yield an integer value and then convert to float as
-  // we do not want the remainder in that expression to affect the value of fBlockY
-  float fBlockY = texelBlockHeight * static_cast< float >( block / atlasWidthInBlocks );
-
-  // Add on texture filtering compensation ( half a texel plus compensation for filled pixel in top left corner )
-  fBlockX += oneAndAHalfTexelX;
-  fBlockY += oneAndAHalfTexelY;
+  // Add on texture filtering compensation ( half a texel into the padding around the image )
+  float fBlockX = texelX * static_cast< float >( imageX ) - halfTexelX;
+  float fBlockY = texelY * static_cast< float >( imageY ) - halfTexelY;
 
   float texelWidthOffset = texelWidth + texelX;
   float texelHeightOffset = texelHeight + texelY;
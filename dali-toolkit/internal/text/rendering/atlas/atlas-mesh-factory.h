@@ -38,14 +38,16 @@ namespace AtlasMeshFactory
    *
    * @param[in]  width Width of area in pixels.
    * @param[in]  height Height of area in pixels.
-   * @param[in]  block Block position in atlas.
-   * @param[in]  atlasSize Atlas and block dimensions.
+   * @param[in]  x Horizontal position of the area in the atlas, in pixels.
+   * @param[in]  y Vertical position of the area in the atlas, in pixels.
+   * @param[in]  atlasSize Atlas dimensions.
    * @param[in]  position Position to place area in space.
    * @param[out] mesh Mesh object to hold created quad.
    */
   void CreateQuad( SizeType width,
                    SizeType height,
-                   SizeType block,
+                   SizeType x,
+                   SizeType y,
                    const Toolkit::AtlasManager::AtlasSize& atlasSize,
                    const Vector2& position,
                    Toolkit::AtlasManager::Mesh2D& mesh );
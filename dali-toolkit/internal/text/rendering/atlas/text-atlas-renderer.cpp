@@ -31,6 +31,7 @@
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager.h>
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-mesh-factory.h>
 #include <dali-toolkit/internal/text/text-view.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -139,20 +140,6 @@ struct AtlasRenderer::Impl
     uint32_t mMeshRecordIndex;
   };
 
-  struct MaxBlockSize
-  {
-    MaxBlockSize()
-    : mFontId( 0 ),
-      mNeededBlockWidth( 0 ),
-      mNeededBlockHeight( 0 )
-    {
-    }
-
-    FontId mFontId;
-    uint32_t mNeededBlockWidth;
-    uint32_t mNeededBlockHeight;
-  };
-
   struct CheckEntry
   {
     CheckEntry()
@@ -215,7 +202,7 @@ struct AtlasRenderer::Impl
     return false;
   }
 
-  void CacheGlyph( const GlyphInfo& glyph, FontId lastFontId, const AtlasGlyphManager::GlyphStyle& style, AtlasManager::AtlasSlot& slot )
+  void CacheGlyph( const GlyphInfo& glyph, const AtlasGlyphManager::GlyphStyle& style, AtlasManager::AtlasSlot& slot )
   {
     const bool glyphNotCached = !mGlyphManager.IsCached( glyph.fontId, glyph.index, style, slot );  // Check FontGlyphRecord vector for entry with glyph index and fontId
 
@@ -223,26 +210,6 @@ struct AtlasRenderer::Impl
 
     if( glyphNotCached )
     {
-      MaxBlockSize& blockSize = mBlockSizes[0u];
-
-      if ( lastFontId != glyph.fontId )
-      {
-        uint32_t index = 0u;
-        // Looks through all stored block sizes until finds the one which mataches required glyph font it.  Ensures new atlas block size will match existing for same font id.
-        // CalculateBlocksSize() above ensures a block size entry exists.
-        for( std::vector<MaxBlockSize>::const_iterator it = mBlockSizes.begin(),
-               endIt = mBlockSizes.end();
-             it != endIt;
-             ++it, ++index )
-        {
-          const MaxBlockSize& blockSizeEntry = *it;
-          if( blockSizeEntry.mFontId == glyph.fontId )
-          {
-            blockSize = mBlockSizes[index];
-          }
-        }
-      }
-
       // Create a new image for the glyph
       PixelData bitmap;
 
@@ -276,24 +243,11 @@ struct AtlasRenderer::Impl
 
         if( bitmap )
         {
-          // Ensure that the next image will fit into the current block size
-          if( bitmap.GetWidth() > blockSize.mNeededBlockWidth )
-          {
-            blockSize.mNeededBlockWidth = bitmap.GetWidth();
-          }
-
-          if( bitmap.GetHeight() > blockSize.mNeededBlockHeight )
-          {
-            blockSize.mNeededBlockHeight = bitmap.GetHeight();
-          }
-
           // If CheckAtlas in AtlasManager::Add can't fit the bitmap in the current atlas it will create a new atlas
 
-          // Setting the block size and size of new atlas does not mean a new one will be created. An existing atlas may still surffice.
+          // Setting the size of new atlas does not mean a new one will be created. An existing atlas may still surffice.
           mGlyphManager.SetNewAtlasSize( DEFAULT_ATLAS_WIDTH,
-                                         DEFAULT_ATLAS_HEIGHT,
-                                         blockSize.mNeededBlockWidth,
-                                         blockSize.mNeededBlockHeight );
+                                         DEFAULT_ATLAS_HEIGHT );
 
           // Locate a new slot for our glyph
           mGlyphManager.Add( glyph, style, bitmap, slot ); // slot will be 0 is glyph not added
@@ -469,7 +423,6 @@ struct AtlasRenderer::Impl
 
     float currentUnderlinePosition = ZERO;
     float currentUnderlineThickness = underlineHeight;
-    FontId lastFontId = 0;
     FontId lastUnderlinedFontId = 0;
     Style style = STYLE_NORMAL;
 
@@ -478,8 +431,6 @@ struct AtlasRenderer::Impl
       style = STYLE_DROP_SHADOW;
     }
 
-    CalculateBlocksSize( glyphs );
-
     // Avoid emptying mTextCache (& removing references) until after incremented references for the new text
     Vector< TextCacheEntry > newTextCache;
     const GlyphInfo* const glyphsBuffer = glyphs.Begin();
@@ -539,13 +490,13 @@ struct AtlasRenderer::Impl
         style.isBold = glyph.isBoldRequired;
 
         // Retrieves and caches the glyph's bitmap.
-        CacheGlyph( glyph, lastFontId, style, slot );
+        CacheGlyph( glyph, style, slot );
 
         // Retrieves and caches the outline glyph's bitmap.
         if( isOutline )
         {
           style.outline = outlineWidth;
-          CacheGlyph( glyph, lastFontId, style, slotOutline );
+          CacheGlyph( glyph, style, slotOutline );
         }
 
         // Move the origin (0,0) of the mesh to the center of the actor
@@ -577,8 +528,6 @@ struct AtlasRenderer::Impl
                         meshContainer,
                         newTextCache,
                         extents);
-
-          lastFontId = glyph.fontId; // Prevents searching for existing blocksizes when string of the same fontId.
         }
 
         if( isOutline && ( 0u != slotOutline.mImageId ) ) // invalid slot id, glyph has failed to be added to atlas
@@ -598,6 +547,9 @@ struct AtlasRenderer::Impl
       }
     } // glyphs
 
+    // Upload all the new glyphs at once
+    mGlyphManager.FlushUploads();
+
     // Now remove references for the old text
     RemoveText();
     mTextCache.Swap( newTextCache );
@@ -641,24 +593,24 @@ struct AtlasRenderer::Impl
 
 #if defined(DEBUG_ENABLED)
     Toolkit::AtlasGlyphManager::Metrics metrics = mGlyphManager.GetMetrics();
-    DALI_LOG_INFO( gLogFilter, Debug::General, "TextAtlasRenderer::GlyphManager::GlyphCount: %i, AtlasCount: %i, TextureMemoryUse: %iK\n",
+    DALI_LOG_INFO( gLogFilter, Debug::General, "TextAtlasRenderer::GlyphManager::GlyphCount: %i, AtlasCount: %i, TextureMemoryUse: %iK, Compactions: %i\n",
                                                 metrics.mGlyphCount,
                                                 metrics.mAtlasMetrics.mAtlasCount,
-                                                metrics.mAtlasMetrics.mTextureMemoryUsed / 1024 );
+                                                metrics.mAtlasMetrics.mTextureMemoryUsed / 1024,
+                                                metrics.mAtlasMetrics.mCompactionCount );
 
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "%s\n", metrics.mVerboseGlyphCounts.c_str() );
 
     for( uint32_t i = 0; i < metrics.mAtlasMetrics.mAtlasCount; ++i )
     {
-      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   Atlas [%i] %sPixels: %s Size: %ix%i, BlockSize: %ix%i, BlocksUsed: %i/%i\n",
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "   Atlas [%i] %sPixels: %s Size: %ix%i, Images: %i, PixelsUsed: %i/%i\n",
                                                  i + 1, i > 8 ? "" : " ",
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mPixelFormat == Pixel::L8 ? "L8  " : "BGRA",
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mWidth,
                                                  metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mHeight,
-                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mBlockWidth,
-                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mSize.mBlockHeight,
-                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mBlocksUsed,
-                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mTotalBlocks );
+                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mImageCount,
+                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mPixelsUsed,
+                                                 metrics.mAtlasMetrics.mAtlasMetrics[ i ].mTotalPixels );
     }
 #endif
   }
@@ -696,7 +648,7 @@ struct AtlasRenderer::Impl
       // The glyph is an emoji and is not a shadow.
       if( !mShaderRgba )
       {
-        mShaderRgba = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_RGBA );
+        mShaderRgba = Toolkit::Internal::ShaderRegistry::Get().NewShader( "TextAtlasRenderer", VERTEX_SHADER, FRAGMENT_SHADER_RGBA );
       }
       shader = mShaderRgba;
     }
@@ -705,7 +657,7 @@ struct AtlasRenderer::Impl
       // The glyph is text or a shadow.
       if( !mShaderL8 )
       {
-        mShaderL8 = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_L8 );
+        mShaderL8 = Toolkit::Internal::ShaderRegistry::Get().NewShader( "TextAtlasRenderer", VERTEX_SHADER, FRAGMENT_SHADER_L8 );
       }
       shader = mShaderL8;
     }
@@ -863,44 +815,6 @@ struct AtlasRenderer::Impl
     }
   }
 
-  void CalculateBlocksSize( const Vector<GlyphInfo>& glyphs )
-  {
-    for( Vector<GlyphInfo>::ConstIterator glyphIt = glyphs.Begin(),
-           glyphEndIt = glyphs.End();
-         glyphIt != glyphEndIt;
-         ++glyphIt )
-    {
-      const FontId fontId = (*glyphIt).fontId;
-      bool foundFont = false;
-
-      for( std::vector< MaxBlockSize >::const_iterator blockIt = mBlockSizes.begin(),
-             blockEndIt = mBlockSizes.end();
-           blockIt != blockEndIt;
-           ++blockIt )
-      {
-        if( (*blockIt).mFontId == fontId )  // Different size fonts will have a different fontId
-        {
-          DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Text::AtlasRenderer::CalculateBlocksSize match found fontID(%u) glyphIndex(%u)\n", fontId, (*glyphIt).index );
-          foundFont = true;
-          break;
-        }
-      }
-
-      if ( !foundFont )
-      {
-        FontMetrics fontMetrics;
-        mFontClient.GetFontMetrics( fontId, fontMetrics );
-
-        MaxBlockSize maxBlockSize;
-        maxBlockSize.mNeededBlockWidth = static_cast< uint32_t >( fontMetrics.height );
-        maxBlockSize.mNeededBlockHeight = maxBlockSize.mNeededBlockWidth;
-        maxBlockSize.mFontId = fontId;
-        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Text::AtlasRenderer::CalculateBlocksSize New font with no matched blocksize, setting blocksize[%u]\n", maxBlockSize.mNeededBlockWidth );
-        mBlockSizes.push_back( maxBlockSize );
-      }
-    }
-  }
-
   void GenerateUnderlines( std::vector< MeshRecord >& meshRecords,
                            Vector< Extent >& extents,
                            const Vector4& underlineColor )
@@ -968,7 +882,6 @@ struct AtlasRenderer::Impl
   TextAbstraction::FontClient mFontClient;            ///< The font client used to supply glyph information
   Shader mShaderL8;                                   ///< The shader for glyphs and emoji's shadows.
   Shader mShaderRgba;                                 ///< The shader for emojis.
-  std::vector< MaxBlockSize > mBlockSizes;            ///< Maximum size needed to contain a glyph in a block within a new atlas
   Vector< TextCacheEntry > mTextCache;                ///< Caches data from previous render
   Property::Map mQuadVertexFormat;                    ///< Describes the vertex format for text
   int mDepth;                                         ///< DepthIndex passed by control when connect to stage
@@ -1036,6 +949,12 @@ Actor AtlasRenderer::Render( Text::ViewInterface& view,
   return mImpl->mActor;
 }
 
+void AtlasRenderer::AddShaderVariants( Toolkit::Internal::ShaderRegistry& registry )
+{
+  registry.AddVariant( "TextAtlasRenderer", VERTEX_SHADER, FRAGMENT_SHADER_L8 );
+  registry.AddVariant( "TextAtlasRenderer", VERTEX_SHADER, FRAGMENT_SHADER_RGBA );
+}
+
 AtlasRenderer::AtlasRenderer()
 {
   mImpl = new Impl();
@@ -27,6 +27,11 @@ namespace Dali
 namespace Toolkit
 {
 
+namespace Internal
+{
+class ShaderRegistry;
+}
+
 namespace Text
 {
 
@@ -52,6 +57,13 @@ public:
                         float& alignmentOffset,
                         int depth );
 
+  /**
+   * @brief Records the shader variants of the renderer, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( Toolkit::Internal::ShaderRegistry& registry );
+
 protected:
 
   /**
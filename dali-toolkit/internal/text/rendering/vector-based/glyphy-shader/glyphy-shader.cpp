@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/vector-based/glyphy-shader/glyphy-common-glsl.h>
 #include <dali-toolkit/internal/text/rendering/vector-based/glyphy-shader/glyphy-sdf-glsl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 using namespace Dali;
 
@@ -219,9 +220,10 @@ GlyphyShader GlyphyShader::New( const Dali::Vector4& atlasInfo )
                              << glyphy_sdf_glsl
                              << FRAGMENT_SHADER_MAIN;
 
-  Shader shaderEffectCustom = Shader::New( vertexShaderStringStream.str(),
-                                           fragmentShaderStringStream.str(),
-                                           Shader::Hint::OUTPUT_IS_TRANSPARENT );
+  Shader shaderEffectCustom = Internal::ShaderRegistry::Get().NewShader( "GlyphyShader",
+                                                                             vertexShaderStringStream.str(),
+                                                                             fragmentShaderStringStream.str(),
+                                                                             Shader::Hint::OUTPUT_IS_TRANSPARENT );
 
   GlyphyShader handle( shaderEffectCustom );
 
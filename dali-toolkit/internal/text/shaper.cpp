@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/shaping.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-run-container.h>
+
 namespace Dali
 {
 
@@ -77,28 +80,10 @@ void ShapeText( const Vector<Character>& text,
   // To shape the text a font and an script is needed.
 
   // Get the font run containing the startCharacterIndex character.
-  Vector<FontRun>::ConstIterator fontRunIt = fonts.Begin();
-  for( Vector<FontRun>::ConstIterator endIt = fonts.End(); fontRunIt < endIt; ++fontRunIt )
-  {
-    const FontRun& run = *fontRunIt;
-    if( startCharacterIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-    {
-      // Found.
-      break;
-    }
-  }
+  Vector<FontRun>::ConstIterator fontRunIt = fonts.Begin() + FindCharacterRun( startCharacterIndex, fonts );
 
   // Get the script run containing the startCharacterIndex character.
-  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin();
-  for( Vector<ScriptRun>::ConstIterator endIt = scripts.End(); scriptRunIt < endIt; ++scriptRunIt )
-  {
-    const ScriptRun& run = *scriptRunIt;
-    if( startCharacterIndex < run.characterRun.characterIndex + run.characterRun.numberOfCharacters )
-    {
-      // Found.
-      break;
-    }
-  }
+  Vector<ScriptRun>::ConstIterator scriptRunIt = scripts.Begin() + FindCharacterRun( startCharacterIndex, scripts );
 
   // Index to the the next one to be shaped. Is pointing the character after the last one it was shaped.
   CharacterIndex previousIndex = 0u;
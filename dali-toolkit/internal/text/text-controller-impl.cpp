@@ -35,6 +35,7 @@
 #include <dali-toolkit/internal/text/shaper.h>
 #include <dali-toolkit/internal/text/text-control-interface.h>
 #include <dali-toolkit/internal/text/text-run-container.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 using namespace Dali;
 
@@ -1228,6 +1229,7 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
                               mTextUpdateInfo.mStartGlyphIndex,
                               requestedNumberOfCharacters,
                               mModel->mVisualModel->mColors,
+                              mModel->mVisualModel->mColorLookupTable,
                               mModel->mVisualModel->mColorIndices );
 
     // Set the background color runs in glyphs.
@@ -1238,6 +1240,7 @@ bool Controller::Impl::UpdateModel( OperationsMask operationsRequired )
                               mTextUpdateInfo.mStartGlyphIndex,
                               requestedNumberOfCharacters,
                               mModel->mVisualModel->mBackgroundColors,
+                              mModel->mVisualModel->mBackgroundColorLookupTable,
                               mModel->mVisualModel->mBackgroundColorIndices );
 
     updated = true;
@@ -2294,8 +2297,7 @@ void Controller::Impl::RepositionSelectionHandles()
   // Retrieve the first line and get the line's vertical offset, the line's height and the index to the last glyph.
 
   // The line's vertical offset of all the lines before the line where the first glyph is laid-out.
-  selectionBoxInfo->lineOffset = CalculateLineOffset( mModel->mVisualModel->mLines,
-                                                      firstLineIndex );
+  selectionBoxInfo->lineOffset = mModel->mVisualModel->GetLineOffset( firstLineIndex );
 
   // Transform to decorator's (control) coords.
   selectionBoxInfo->lineOffset += mModel->mScrollPosition.y;
@@ -2327,6 +2329,38 @@ void Controller::Impl::RepositionSelectionHandles()
   // Traverse the glyphs.
   for( GlyphIndex index = glyphStart; index <= glyphEnd; ++index )
   {
+    // Whether the whole line of the glyph is highlighted by a single box.
+    bool wholeLine = false;
+
+    if( !splitStartGlyph &&
+        ( index == lineRun->glyphRun.glyphIndex ) &&
+        ( index < lastGlyphOfLine ) &&
+        ( ( lastGlyphOfLine < glyphEnd ) || ( ( lastGlyphOfLine == glyphEnd ) && !splitEndGlyph ) ) )
+    {
+      // The whole line is selected. The extents of its highlight boxes are cached in the visual model.
+      // Skip to the last glyph of the line, which retrieves the next line below.
+      float lineMinX = 0.f;
+      float lineMaxX = 0.f;
+      mModel->mVisualModel->GetLineHighlightExtents( lineIndex, lineMinX, lineMaxX );
+      const float offsetX = lineRun->alignmentOffset + mModel->mScrollPosition.x;
+
+      quad.x = offsetX + lineMinX;
+      quad.y = selectionBoxInfo->lineOffset;
+      quad.z = offsetX + lineMaxX;
+      quad.w = quad.y + selectionBoxInfo->lineHeight;
+
+      // Store the min and max 'x' for each line.
+      selectionBoxInfo->minX = std::min( selectionBoxInfo->minX, quad.x );
+      selectionBoxInfo->maxX = std::max( selectionBoxInfo->maxX, quad.z );
+
+      mEventData->mDecorator->AddHighlight( actualNumberOfQuads,
+                                            quad );
+      ++actualNumberOfQuads;
+
+      index = lastGlyphOfLine;
+      wholeLine = true;
+    }
+
     const GlyphInfo& glyph = *( glyphsBuffer + index );
     const Vector2& position = *( positionsBuffer + index );
 
@@ -2395,18 +2429,21 @@ void Controller::Impl::RepositionSelectionHandles()
       continue;
     }
 
-    quad.x = lineRun->alignmentOffset + position.x - glyph.xBearing + mModel->mScrollPosition.x;
-    quad.y = selectionBoxInfo->lineOffset;
-    quad.z = quad.x + glyph.advance;
-    quad.w = quad.y + selectionBoxInfo->lineHeight;
+    if( !wholeLine )
+    {
+      quad.x = lineRun->alignmentOffset + position.x - glyph.xBearing + mModel->mScrollPosition.x;
+      quad.y = selectionBoxInfo->lineOffset;
+      quad.z = quad.x + glyph.advance;
+      quad.w = quad.y + selectionBoxInfo->lineHeight;
 
-    // Store the min and max 'x' for each line.
-    selectionBoxInfo->minX = std::min( selectionBoxInfo->minX, quad.x );
-    selectionBoxInfo->maxX = std::max( selectionBoxInfo->maxX, quad.z );
+      // Store the min and max 'x' for each line.
+      selectionBoxInfo->minX = std::min( selectionBoxInfo->minX, quad.x );
+      selectionBoxInfo->maxX = std::max( selectionBoxInfo->maxX, quad.z );
 
-    mEventData->mDecorator->AddHighlight( actualNumberOfQuads,
-                                          quad );
-    ++actualNumberOfQuads;
+      mEventData->mDecorator->AddHighlight( actualNumberOfQuads,
+                                            quad );
+      ++actualNumberOfQuads;
+    }
 
     // Whether to retrieve the next line.
     if( index == lastGlyphOfLine )
@@ -3469,7 +3506,7 @@ Actor Controller::Impl::CreateBackgroundActor()
 
       if( !mShaderBackground )
       {
-        mShaderBackground = Shader::New( VERTEX_SHADER_BACKGROUND, FRAGMENT_SHADER_BACKGROUND );
+        mShaderBackground = Internal::ShaderRegistry::Get().GetShader( "TextBackground", VERTEX_SHADER_BACKGROUND, FRAGMENT_SHADER_BACKGROUND );
       }
 
       Dali::Renderer renderer = Dali::Renderer::New( quadGeometry, mShaderBackground );
@@ -683,36 +683,34 @@ void Controller::SetText( const std::string& text )
   {
     mImpl->mModel->mVisualModel->SetTextColor( mImpl->mTextColor );
 
-    MarkupProcessData markupProcessData( mImpl->mModel->mLogicalModel->mColorRuns,
-                                         mImpl->mModel->mLogicalModel->mFontDescriptionRuns,
-                                         mImpl->mModel->mLogicalModel->mEmbeddedItems );
+    Vector<Character>& utf32Characters = mImpl->mModel->mLogicalModel->mText;
 
-    Length textSize = 0u;
-    const uint8_t* utf8 = NULL;
+    const Length textSize = text.size();
+    Length characterCount = 0u;
     if( mImpl->mMarkupProcessorEnabled )
     {
-      ProcessMarkupString( text, markupProcessData );
-      textSize = markupProcessData.markupProcessedText.size();
+      MarkupProcessData markupProcessData( mImpl->mModel->mLogicalModel->mColorRuns,
+                                           mImpl->mModel->mLogicalModel->mFontDescriptionRuns,
+                                           mImpl->mModel->mLogicalModel->mEmbeddedItems,
+                                           utf32Characters );
 
-      // This is a bit horrible but std::string returns a (signed) char*
-      utf8 = reinterpret_cast<const uint8_t*>( markupProcessData.markupProcessedText.c_str() );
+      // The mark-up processor writes the plain text straight into the logical model encoded in utf32.
+      ProcessMarkupString( text, markupProcessData );
+      characterCount = utf32Characters.Count();
     }
     else
     {
-      textSize = text.size();
-
       // This is a bit horrible but std::string returns a (signed) char*
-      utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
-    }
+      const uint8_t* utf8 = reinterpret_cast<const uint8_t*>( text.c_str() );
 
-    //  Convert text into UTF-32
-    Vector<Character>& utf32Characters = mImpl->mModel->mLogicalModel->mText;
-    utf32Characters.Resize( textSize );
+      //  Convert text into UTF-32
+      utf32Characters.Resize( textSize );
 
-    // Transform a text array encoded in utf8 into an array encoded in utf32.
-    // It returns the actual number of characters.
-    Length characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
-    utf32Characters.Resize( characterCount );
+      // Transform a text array encoded in utf8 into an array encoded in utf32.
+      // It returns the actual number of characters.
+      characterCount = Utf8ToUtf32( utf8, textSize, utf32Characters.Begin() );
+      utf32Characters.Resize( characterCount );
+    }
 
     DALI_ASSERT_DEBUG( textSize >= characterCount && "Invalid UTF32 conversion length" );
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Controller::SetText %p UTF8 size %d, UTF32 size %d\n", this, textSize, mImpl->mModel->mLogicalModel->mText.Count() );
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/character-run.h>
 
@@ -30,6 +33,63 @@ namespace Toolkit
 namespace Text
 {
 
+/**
+ * @brief Finds the run containing the given character.
+ *
+ * It does a binary search. The runs must be sorted by character index and must not overlap,
+ * i.e. script runs, font runs, paragraphs or lines. Style runs as color runs may overlap so they can't be searched.
+ *
+ * @param[in] characterIndex The index to the character.
+ * @param[in] runs The text's runs.
+ *
+ * @return The index to the first run which ends after the given character. The number of runs if there isn't any.
+ */
+template< typename T >
+uint32_t FindCharacterRun( CharacterIndex characterIndex,
+                           const Vector<T>& runs )
+{
+  const T* const runsBuffer = runs.Begin();
+  const T* const runsEndBuffer = runsBuffer + runs.Count();
+
+  const T* const runIt = std::upper_bound( runsBuffer,
+                                           runsEndBuffer,
+                                           characterIndex,
+                                           []( CharacterIndex index, const T& run )
+                                           {
+                                             return index < run.characterRun.characterIndex + run.characterRun.numberOfCharacters;
+                                           } );
+
+  return static_cast<uint32_t>( runIt - runsBuffer );
+}
+
+/**
+ * @brief Finds the run containing the given glyph.
+ *
+ * It does a binary search. The runs must be sorted by glyph index and must not overlap, i.e. lines.
+ *
+ * @param[in] glyphIndex The index to the glyph.
+ * @param[in] runs The text's runs.
+ *
+ * @return The index to the first run which ends after the given glyph. The number of runs if there isn't any.
+ */
+template< typename T >
+uint32_t FindGlyphRun( GlyphIndex glyphIndex,
+                       const Vector<T>& runs )
+{
+  const T* const runsBuffer = runs.Begin();
+  const T* const runsEndBuffer = runsBuffer + runs.Count();
+
+  const T* const runIt = std::upper_bound( runsBuffer,
+                                           runsEndBuffer,
+                                           glyphIndex,
+                                           []( GlyphIndex index, const T& run )
+                                           {
+                                             return index < run.glyphRun.glyphIndex + run.glyphRun.numberOfGlyphs;
+                                           } );
+
+  return static_cast<uint32_t>( runIt - runsBuffer );
+}
+
 /**
  * @brief Clears the runs starting from the given character index.
  *
@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/text-scroller-interface.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -281,7 +282,7 @@ void TextScroller::SetParameters( Actor scrollingTextActor, Renderer renderer, T
   mTextureSet = mRenderer.GetTextures();
 
   // Set the shader and texture for scrolling
-  Shader shader = Shader::New( VERTEX_SHADER_SCROLL, FRAGMENT_SHADER, Shader::Hint::NONE );
+  Shader shader = Internal::ShaderRegistry::Get().NewShader( "TextScroller", VERTEX_SHADER_SCROLL, FRAGMENT_SHADER, Shader::Hint::NONE );
   mRenderer.SetShader( shader );
   mRenderer.SetTextures( textureSet );
 
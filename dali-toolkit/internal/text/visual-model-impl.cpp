@@ -20,6 +20,11 @@
 
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <algorithm>
+#include <limits>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-run-container.h>
 
 namespace Dali
 {
@@ -30,6 +35,13 @@ namespace Toolkit
 namespace Text
 {
 
+namespace
+{
+
+const Vector2 NOT_CALCULATED_EXTENT( std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() ); ///< The extent of a line which highlight boxes are not calculated yet.
+
+} // namespace
+
 VisualModelPtr VisualModel::New()
 {
   return VisualModelPtr( new VisualModel() );
@@ -214,36 +226,26 @@ void VisualModel::GetNumberOfLines( GlyphIndex glyphIndex,
                                     Length& numberOfLines ) const
 {
   // Initialize the number of lines and the first line.
-  firstLine = 0u;
+  firstLine = FindGlyphRun( glyphIndex, mLines );
   numberOfLines = 0u;
-  bool firstLineFound = false;
 
   const GlyphIndex lastGlyphIndex = glyphIndex + numberOfGlyphs;
 
-  // Traverse the lines and count those lines within the range of glyphs.
-  for( Vector<LineRun>::ConstIterator it = mLines.Begin(),
+  // Traverse the lines from the first one and count those lines within the range of glyphs.
+  for( Vector<LineRun>::ConstIterator it = mLines.Begin() + firstLine,
          endIt = mLines.End();
        it != endIt;
        ++it )
   {
     const LineRun& line = *it;
 
-    if( ( line.glyphRun.glyphIndex + line.glyphRun.numberOfGlyphs > glyphIndex ) &&
-        ( lastGlyphIndex > line.glyphRun.glyphIndex ) )
-    {
-      firstLineFound = true;
-      ++numberOfLines;
-    }
-    else if( lastGlyphIndex <= line.glyphRun.glyphIndex )
+    if( lastGlyphIndex <= line.glyphRun.glyphIndex )
     {
       // nothing else to do.
       break;
     }
 
-    if( !firstLineFound )
-    {
-      ++firstLine;
-    }
+    ++numberOfLines;
   }
 }
 
@@ -271,31 +273,92 @@ LineIndex VisualModel::GetLineOfCharacter( CharacterIndex characterIndex )
   }
 
   // 2) Check in the cached line.
-  const LineRun& lineRun = *( mLines.Begin() + mCachedLineIndex );
-  if( ( lineRun.characterRun.characterIndex <= characterIndex ) &&
-      ( characterIndex < lineRun.characterRun.characterIndex + lineRun.characterRun.numberOfCharacters ) )
+  if( mCachedLineIndex < mLines.Count() )
   {
-    return mCachedLineIndex;
+    const LineRun& lineRun = *( mLines.Begin() + mCachedLineIndex );
+    if( ( lineRun.characterRun.characterIndex <= characterIndex ) &&
+        ( characterIndex < lineRun.characterRun.characterIndex + lineRun.characterRun.numberOfCharacters ) )
+    {
+      return mCachedLineIndex;
+    }
   }
 
-  // 3) Is not in the cached line. Check in the other lines.
-  LineIndex index = characterIndex < lineRun.characterRun.characterIndex ? 0u : mCachedLineIndex + 1u;
+  // 3) Is not in the cached line. Find it with a binary search.
+  const LineIndex index = FindCharacterRun( characterIndex, mLines );
 
-  for( Vector<LineRun>::ConstIterator it = mLines.Begin() + index,
-         endIt = mLines.End();
-       it != endIt;
-       ++it, ++index )
+  if( index < mLines.Count() )
   {
-    const LineRun& lineRun = *it;
+    mCachedLineIndex = index;
+  }
+
+  return index;
+}
+
+float VisualModel::GetLineOffset( LineIndex lineIndex )
+{
+  if( 0u == lineIndex )
+  {
+    return 0.f;
+  }
+
+  UpdateLineOffsets();
+
+  const LineIndex lastLineIndex = std::min( lineIndex, static_cast<LineIndex>( mLineOffsets.Count() ) );
+  return ( 0u == lastLineIndex ) ? 0.f : *( mLineOffsets.Begin() + lastLineIndex - 1u );
+}
+
+LineIndex VisualModel::GetLineOfPosition( float visualY, bool& matchedLine )
+{
+  matchedLine = false;
+
+  if( ( visualY < 0.f ) || mLines.Empty() )
+  {
+    return 0u;
+  }
 
-    if( characterIndex < lineRun.characterRun.characterIndex + lineRun.characterRun.numberOfCharacters )
+  UpdateLineOffsets();
+
+  // Find the first line which bottom is below the given position.
+  const float* const offsetsBuffer = mLineOffsets.Begin();
+  const float* const offsetsEndBuffer = offsetsBuffer + mLineOffsets.Count();
+  const float* const offsetIt = std::upper_bound( offsetsBuffer, offsetsEndBuffer, visualY );
+
+  if( offsetIt != offsetsEndBuffer )
+  {
+    matchedLine = true;
+    return static_cast<LineIndex>( offsetIt - offsetsBuffer );
+  }
+
+  return mLines.Count() - 1u;
+}
+
+void VisualModel::GetLineHighlightExtents( LineIndex lineIndex, float& minX, float& maxX )
+{
+  if( mLines.Count() != mLineHighlightExtents.Count() )
+  {
+    mLineHighlightExtents.Clear();
+    mLineHighlightExtents.Resize( mLines.Count(), NOT_CALCULATED_EXTENT );
+  }
+
+  const LineRun& line = *( mLines.Begin() + lineIndex );
+  Vector2& lineExtent = *( mLineHighlightExtents.Begin() + lineIndex );
+
+  if( lineExtent.x > lineExtent.y )
+  {
+    const GlyphInfo* glyphsBuffer = mGlyphs.Begin() + line.glyphRun.glyphIndex;
+    const Vector2* positionsBuffer = mGlyphPositions.Begin() + line.glyphRun.glyphIndex;
+
+    for( Length index = 0u; index < line.glyphRun.numberOfGlyphs; ++index, ++glyphsBuffer, ++positionsBuffer )
     {
-      mCachedLineIndex = index;
-      break;
+      const float left = positionsBuffer->x - glyphsBuffer->xBearing;
+
+      lineExtent.x = std::min( lineExtent.x, left );
+      lineExtent.y = std::max( lineExtent.y, left + glyphsBuffer->advance );
     }
   }
 
-  return index;
+  minX = lineExtent.x;
+  maxX = lineExtent.y;
 }
 
 void VisualModel::GetUnderlineRuns( GlyphRun* underlineRuns,
@@ -451,6 +514,35 @@ Length VisualModel::GetNumberOfUnderlineRuns() const
 void VisualModel::ClearCaches()
 {
   mCachedLineIndex = 0u;
+  mLineOffsets.Clear();
+  mLineHighlightExtents.Clear();
+}
+
+void VisualModel::UpdateLineOffsets()
+{
+  const Length numberOfLines = mLines.Count();
+  if( numberOfLines == mLineOffsets.Count() )
+  {
+    // Already updated.
+    return;
+  }
+
+  mLineOffsets.Resize( numberOfLines );
+
+  float offset = 0.f;
+  float* offsetsBuffer = mLineOffsets.Begin();
+  for( Vector<LineRun>::ConstIterator it = mLines.Begin(),
+         endIt = mLines.End();
+       it != endIt;
+       ++it, ++offsetsBuffer )
+  {
+    const LineRun& lineRun = *it;
+
+    // The line height is the addition of the line ascender and the line descender.
+    // However, the line descender has a negative value, hence the subtraction.
+    offset += lineRun.ascender - lineRun.descender;
+    *offsetsBuffer = offset;
+  }
 }
 
 VisualModel::~VisualModel()
@@ -478,6 +570,8 @@ VisualModel::VisualModel()
   mNaturalSize(),
   mLayoutSize(),
   mCachedLineIndex( 0u ),
+  mLineOffsets(),
+  mLineHighlightExtents(),
   mUnderlineEnabled( false ),
   mUnderlineColorSet( false ),
   mBackgroundEnabled( false )
@@ -28,6 +28,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/line-run.h>
 #include <dali-toolkit/internal/text/color-run.h>
+#include <dali-toolkit/internal/text/color-segmentation.h>
 
 namespace Dali
 {
@@ -148,6 +149,40 @@ public:
    */
   LineIndex GetLineOfCharacter( CharacterIndex characterIndex );
 
+  /**
+   * @brief Retrieves the vertical offset of the given line.
+   *
+   * It's the addition of the heights of all the previous lines.
+   *
+   * @param[in] lineIndex The line's index.
+   *
+   * @return The vertical offset of the line.
+   */
+  float GetLineOffset( LineIndex lineIndex );
+
+  /**
+   * @brief Retrieves the line laid-out at the given vertical position.
+   *
+   * @param[in] visualY The vertical position in text's coords.
+   * @param[out] matchedLine Whether the vertical position is within a line.
+   *
+   * @return The line index. The last line if @p visualY is below all the lines.
+   */
+  LineIndex GetLineOfPosition( float visualY, bool& matchedLine );
+
+  /**
+   * @brief Retrieves the horizontal extents of the highlight boxes of the glyphs of a line.
+   *
+   * Used to highlight the lines which are fully selected with a single box, without traversing their glyphs' metrics again.
+   * The extents of a line are calculated the first time they are retrieved after the text is laid-out.
+   * They don't include the line's alignment offset.
+   *
+   * @param[in] lineIndex The line's index.
+   * @param[out] minX The minimum 'x' of the highlight boxes of the line.
+   * @param[out] maxX The maximum 'x' of the highlight boxes of the line.
+   */
+  void GetLineHighlightExtents( LineIndex lineIndex, float& minX, float& maxX );
+
   // Underline runs
 
   /**
@@ -277,6 +312,8 @@ public:
 
   /**
    * @brief Clear the caches.
+   *
+   * @note It needs to be called every time the lines are laid-out.
    */
   void ClearCaches();
 
@@ -377,6 +414,11 @@ private:
   // Undefined
   VisualModel& operator=( const VisualModel& handle );
 
+  /**
+   * @brief Builds the accumulated line heights used to find lines by position if they are not built yet.
+   */
+  void UpdateLineOffsets();
+
 public:
 
   Vector<GlyphInfo>      mGlyphs;               ///< For each glyph, the font's id, glyph's index within the font and glyph's metrics.
@@ -391,6 +433,8 @@ public:
   Vector<ColorIndex>     mColorIndices;         ///< Indices to the vector of colors for each glyphs.
   Vector<Vector4>        mBackgroundColors;     ///< Background colors of the glyphs.
   Vector<ColorIndex>     mBackgroundColorIndices; ///< Indices to the vector of background colors for each glyphs.
+  ColorLookupTable       mColorLookupTable;     ///< Hashed index of the colors of the glyphs.
+  ColorLookupTable       mBackgroundColorLookupTable; ///< Hashed index of the background colors of the glyphs.
 
   Vector4                mTextColor;            ///< The text color
   Vector4                mShadowColor;          ///< Color of drop shadow
@@ -410,6 +454,8 @@ private:
 
   // Caches to increase performance in some consecutive operations.
   LineIndex mCachedLineIndex; ///< Used to increase performance in consecutive calls to GetLineOfGlyph() or GetLineOfCharacter() with consecutive glyphs or characters.
+  Vector<float> mLineOffsets; ///< For each line, the addition of its height and the heights of the previous ones. Built on demand to find lines by position with a binary search.
+  Vector<Vector2> mLineHighlightExtents;  ///< For each line, the minimum and maximum 'x' of its glyphs' highlight boxes. 'x' greater than 'y' if not calculated yet.
 
 public:
 
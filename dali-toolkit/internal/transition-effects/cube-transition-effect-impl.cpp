@@ -27,6 +27,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -247,7 +248,7 @@ void CubeTransitionEffect::Initialize()
 void CubeTransitionEffect::OnSceneConnection( int depth )
 {
   Geometry geometry = VisualFactoryCache::CreateQuadGeometry();
-  Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+  Shader shader = ShaderRegistry::Get().GetShader( "CubeTransitionEffect", VERTEX_SHADER, FRAGMENT_SHADER );
 
   TextureSet textureSet = TextureSet::New();
 
@@ -505,6 +506,11 @@ bool CubeTransitionEffect::DoConnectSignal( BaseObject* object, ConnectionTracke
   return connected;
 }
 
+void CubeTransitionEffect::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "CubeTransitionEffect", VERTEX_SHADER, FRAGMENT_SHADER );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
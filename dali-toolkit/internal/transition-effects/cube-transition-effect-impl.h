@@ -37,6 +37,8 @@ class CubeTransitionEffect;
 namespace Internal
 {
 
+class ShaderRegistry;
+
 /**
  * CubeTransitionEffect implementation class
  */
@@ -110,6 +112,13 @@ public:
    */
   void StopTransition();
 
+  /**
+   * @brief Records the shader variants of the effect, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 public: //Signal
 
   /**
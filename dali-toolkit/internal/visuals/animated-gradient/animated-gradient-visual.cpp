@@ -25,6 +25,7 @@
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -742,7 +743,7 @@ Shader AnimatedGradientVisual::CreateShader()
        + "#define " + tagSpread + "\n"
        + BASIC_FRAGMENT_SHADER;
 
-  shader = Shader::New( vert, frag );
+  shader = ShaderRegistry::Get().GetShader( "AnimatedGradientVisual", vert, frag );
   return shader;
 }
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/animated-image/animated-image-frame-cache.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel-data.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const size_t DEFAULT_MEMORY_BUDGET = 8u * 1024u * 1024u; ///< The default memory of the unused frames kept in the cache, in bytes.
+
+// The control byte of a run of the encoded pixels is the number of literal pixels minus one
+// when below REPEAT_CONTROL_OFFSET + 2, otherwise the number of repetitions of one pixel plus REPEAT_CONTROL_OFFSET.
+const uint32_t MAXIMUM_LITERAL_PIXELS = 128u;
+const uint32_t MAXIMUM_REPEATED_PIXELS = 129u;
+const uint32_t REPEAT_CONTROL_OFFSET = 126u;
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_ANIMATED_IMAGE_FRAME_CACHE" );
+#endif
+
+/**
+ * @brief Whether two pixels are equal.
+ */
+inline bool IsSamePixel( const uint8_t* pixels, uint32_t first, uint32_t second, uint32_t bytesPerPixel )
+{
+  return 0 == memcmp( pixels + first * bytesPerPixel, pixels + second * bytesPerPixel, bytesPerPixel );
+}
+
+/**
+ * @brief Appends bytes to the encoded pixels, if they stay within the reserved capacity.
+ * @return False if the encoded pixels would be bigger than the reserved capacity.
+ */
+inline bool Append( Dali::Vector<uint8_t>& output, const uint8_t* bytes, size_t count )
+{
+  const size_t offset = output.Count();
+  if( offset + count > output.Capacity() )
+  {
+    return false;
+  }
+  output.Resize( offset + count );
+  memcpy( output.Begin() + offset, bytes, count );
+  return true;
+}
+
+/**
+ * @brief Run length encodes the pixels.
+ *
+ * @param[in] pixels The pixels to encode.
+ * @param[in] pixelCount The number of pixels.
+ * @param[in] bytesPerPixel The size of a pixel.
+ * @param[out] output The encoded pixels.
+ * @return False if the encoded pixels are not smaller than the decoded ones.
+ */
+bool EncodePixels( const uint8_t* pixels, uint32_t pixelCount, uint32_t bytesPerPixel, Dali::Vector<uint8_t>& output )
+{
+  output.Clear();
+  output.Reserve( pixelCount * bytesPerPixel );
+
+  uint32_t index = 0u;
+  while( index < pixelCount )
+  {
+    uint32_t repeated = 1u;
+    while( ( index + repeated < pixelCount ) && ( repeated < MAXIMUM_REPEATED_PIXELS ) && IsSamePixel( pixels, index, index + repeated, bytesPerPixel ) )
+    {
+      ++repeated;
+    }
+
+    uint8_t control;
+    uint32_t literal = 1u;
+    if( repeated > 1u )
+    {
+      control = static_cast<uint8_t>( repeated + REPEAT_CONTROL_OFFSET );
+    }
+    else
+    {
+      // Gather the pixels until a repetition starts.
+      while( ( index + literal < pixelCount ) && ( literal < MAXIMUM_LITERAL_PIXELS ) &&
+             !( ( index + literal + 1u < pixelCount ) && IsSamePixel( pixels, index + literal, index + literal + 1u, bytesPerPixel ) ) )
+      {
+        ++literal;
+      }
+      control = static_cast<uint8_t>( literal - 1u );
+    }
+
+    if( !Append( output, &control, 1u ) ||
+        !Append( output, pixels + index * bytesPerPixel, ( repeated > 1u ? 1u : literal ) * bytesPerPixel ) )
+    {
+      return false;
+    }
+
+    index += ( repeated > 1u ) ? repeated : literal;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Decodes the run length encoded pixels.
+ *
+ * @param[in] input The encoded pixels.
+ * @param[in] bytesPerPixel The size of a pixel.
+ * @param[out] output The buffer of the decoded pixels.
+ * @param[in] outputSize The size of the buffer.
+ */
+void DecodePixels( const Dali::Vector<uint8_t>& input, uint32_t bytesPerPixel, uint8_t* output, size_t outputSize )
+{
+  const uint8_t* read = input.Begin();
+  const uint8_t* end = input.End();
+  uint8_t* write = output;
+  uint8_t* writeEnd = output + outputSize;
+
+  while( read < end )
+  {
+    uint32_t control = *read++;
+    if( control > REPEAT_CONTROL_OFFSET + 1u )
+    {
+      const uint32_t repeated = control - REPEAT_CONTROL_OFFSET;
+      for( uint32_t i = 0u; ( i < repeated ) && ( write + bytesPerPixel <= writeEnd ); ++i )
+      {
+        memcpy( write, read, bytesPerPixel );
+        write += bytesPerPixel;
+      }
+      read += bytesPerPixel;
+    }
+    else
+    {
+      size_t count = std::min( static_cast<size_t>( control + 1u ) * bytesPerPixel, static_cast<size_t>( writeEnd - write ) );
+      memcpy( write, read, count );
+      write += count;
+      read += ( control + 1u ) * bytesPerPixel;
+    }
+  }
+}
+
+} // namespace
+
+AnimatedImageFrameCache::AnimatedImageFrameCache()
+: mEntries(),
+  mUnusedKeys(),
+  mMemoryBudget( DEFAULT_MEMORY_BUDGET ),
+  mMetrics(),
+  mCompressionEnabled( true )
+{
+}
+
+AnimatedImageFrameCache::~AnimatedImageFrameCache()
+{
+}
+
+Texture AnimatedImageFrameCache::Request( const std::string& key )
+{
+  EntryContainer::iterator it = mEntries.find( key );
+  if( it == mEntries.end() )
+  {
+    ++mMetrics.misses;
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "AnimatedImageFrameCache::Request miss. hits:%d, misses:%d\n", mMetrics.hits, mMetrics.misses );
+    return Texture();
+  }
+
+  Entry& entry = it->second;
+  if( 0u == entry.referenceCount )
+  {
+    // The frame is used again.
+    mUnusedKeys.erase( entry.unusedIt );
+    mMetrics.unusedMemory -= entry.pixels.Capacity();
+  }
+  ++entry.referenceCount;
+
+  if( !entry.texture )
+  {
+    const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel( entry.pixelFormat );
+    const size_t bufferSize = static_cast<size_t>( entry.width ) * entry.height * bytesPerPixel;
+    uint8_t* buffer = static_cast<uint8_t*>( malloc( bufferSize ) );
+    if( entry.compressed )
+    {
+      DecodePixels( entry.pixels, bytesPerPixel, buffer, bufferSize );
+    }
+    else
+    {
+      memcpy( buffer, entry.pixels.Begin(), bufferSize );
+    }
+
+    PixelData pixelData = PixelData::New( buffer, bufferSize, entry.width, entry.height, entry.pixelFormat, PixelData::FREE );
+    entry.texture = Texture::New( Dali::TextureType::TEXTURE_2D, entry.pixelFormat, entry.width, entry.height );
+    entry.texture.Upload( pixelData );
+  }
+
+  ++mMetrics.hits;
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "AnimatedImageFrameCache::Request hit. hits:%d, misses:%d\n", mMetrics.hits, mMetrics.misses );
+
+  return entry.texture;
+}
+
+Texture AnimatedImageFrameCache::Add( const std::string& key, Devel::PixelBuffer pixelBuffer )
+{
+  EntryContainer::iterator it = mEntries.find( key );
+  if( it != mEntries.end() )
+  {
+    // Already decoded for another visual. Only add the reference.
+    return Request( key );
+  }
+
+  const uint32_t width = pixelBuffer.GetWidth();
+  const uint32_t height = pixelBuffer.GetHeight();
+  const Pixel::Format pixelFormat = pixelBuffer.GetPixelFormat();
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+
+  if( bytesPerPixel > 0u )
+  {
+    Entry& entry = mEntries[key];
+    entry.width = width;
+    entry.height = height;
+    entry.pixelFormat = pixelFormat;
+    entry.referenceCount = 1u;
+
+    const size_t bufferSize = static_cast<size_t>( width ) * height * bytesPerPixel;
+    entry.compressed = mCompressionEnabled && EncodePixels( pixelBuffer.GetBuffer(), width * height, bytesPerPixel, entry.pixels );
+    if( !entry.compressed )
+    {
+      entry.pixels.Resize( bufferSize );
+      memcpy( entry.pixels.Begin(), pixelBuffer.GetBuffer(), bufferSize );
+    }
+    else
+    {
+      // Free the capacity reserved for the encoding.
+      Dali::Vector<uint8_t> pixels;
+      pixels.Resize( entry.pixels.Count() );
+      memcpy( pixels.Begin(), entry.pixels.Begin(), entry.pixels.Count() );
+      entry.pixels.Swap( pixels );
+    }
+
+    mMetrics.memory += entry.pixels.Capacity();
+    mMetrics.decodedMemory += bufferSize;
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "AnimatedImageFrameCache::Add %s compressed:%d, %zu bytes of %zu\n",
+                   key.c_str(), entry.compressed, entry.pixels.Count(), bufferSize );
+  }
+
+  PixelData pixelData = Devel::PixelBuffer::Convert( pixelBuffer ); // takes ownership of buffer
+  Texture texture = Texture::New( Dali::TextureType::TEXTURE_2D, pixelFormat, width, height );
+  texture.Upload( pixelData );
+
+  it = mEntries.find( key );
+  if( it != mEntries.end() )
+  {
+    it->second.texture = texture;
+  }
+
+  return texture;
+}
+
+void AnimatedImageFrameCache::Release( const std::string& key )
+{
+  EntryContainer::iterator it = mEntries.find( key );
+  if( ( it == mEntries.end() ) || ( 0u == it->second.referenceCount ) )
+  {
+    return;
+  }
+
+  Entry& entry = it->second;
+  --entry.referenceCount;
+
+  if( 0u == entry.referenceCount )
+  {
+    // Only the pixels are kept, as the most recently used frame.
+    entry.texture.Reset();
+    entry.unusedIt = mUnusedKeys.insert( mUnusedKeys.end(), key );
+    mMetrics.unusedMemory += entry.pixels.Capacity();
+
+    Evict();
+  }
+}
+
+void AnimatedImageFrameCache::SetMemoryBudget( size_t budget )
+{
+  mMemoryBudget = budget;
+  Evict();
+}
+
+void AnimatedImageFrameCache::SetCompressionEnabled( bool enabled )
+{
+  mCompressionEnabled = enabled;
+}
+
+const AnimatedImageFrameCache::Metrics& AnimatedImageFrameCache::GetMetrics() const
+{
+  return mMetrics;
+}
+
+std::string AnimatedImageFrameCache::GetFrameKey( const std::string& url, uint32_t frameIndex, ImageDimensions size )
+{
+  return url + '|' + std::to_string( frameIndex ) + '|' + std::to_string( size.GetWidth() ) + 'x' + std::to_string( size.GetHeight() );
+}
+
+void AnimatedImageFrameCache::Evict()
+{
+  while( ( mMetrics.unusedMemory > mMemoryBudget ) && !mUnusedKeys.empty() )
+  {
+    EntryContainer::iterator it = mEntries.find( mUnusedKeys.front() );
+    mUnusedKeys.pop_front();
+
+    const Entry& entry = it->second;
+    mMetrics.memory -= entry.pixels.Capacity();
+    mMetrics.unusedMemory -= entry.pixels.Capacity();
+    mMetrics.decodedMemory -= static_cast<size_t>( entry.width ) * entry.height * Pixel::GetBytesPerPixel( entry.pixelFormat );
+    ++mMetrics.evictions;
+
+    mEntries.erase( it );
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "AnimatedImageFrameCache::Evict memory:%zu, unused memory:%zu, evictions:%d\n", mMetrics.memory, mMetrics.unusedMemory, mMetrics.evictions );
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,202 @@
+#ifndef DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/rendering/texture.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Cache of the decoded frames of the animated images, shared by all the animated image visuals.
+ *
+ * The frames are found by the url of the image, the frame index and the size, so the visuals which
+ * show the same animated image decode each frame once.
+ *
+ * The pixels of the frames are kept run length encoded when it saves memory, so the whole loop of
+ * an image can stay in the cache. The texture of a frame is only kept while a visual uses the frame.
+ *
+ * The frames are reference counted. The ones which are not used by any visual are kept in a least
+ * recently used list until their memory exceeds the cache's budget.
+ */
+class AnimatedImageFrameCache
+{
+public:
+
+  /**
+   * @brief Metrics of the cache.
+   */
+  struct Metrics
+  {
+    Metrics()
+    : hits( 0u ),
+      misses( 0u ),
+      evictions( 0u ),
+      memory( 0u ),
+      unusedMemory( 0u ),
+      decodedMemory( 0u )
+    {}
+
+    uint32_t hits;          ///< The number of requests which found a frame.
+    uint32_t misses;        ///< The number of requests which didn't find a frame.
+    uint32_t evictions;     ///< The number of frames removed to keep the cache within its budget.
+    size_t   memory;        ///< The memory of the pixels of all the frames in the cache, in bytes.
+    size_t   unusedMemory;  ///< The memory of the pixels of the frames not used by any visual, in bytes.
+    size_t   decodedMemory; ///< The memory the pixels of all the frames would use without compression, in bytes.
+  };
+
+  /**
+   * @brief Constructor.
+   */
+  AnimatedImageFrameCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~AnimatedImageFrameCache();
+
+  /**
+   * @brief Retrieves the texture of a frame and adds a reference to it.
+   *
+   * The texture is uploaded from the cached pixels if no visual uses the frame.
+   *
+   * @param[in] key The key of the frame, @see GetFrameKey().
+   * @return The texture or an empty handle if the frame is not in the cache.
+   */
+  Texture Request( const std::string& key );
+
+  /**
+   * @brief Adds a decoded frame to the cache with one reference.
+   *
+   * @param[in] key The key of the frame.
+   * @param[in] pixelBuffer The decoded pixels of the frame.
+   * @return The texture of the frame.
+   */
+  Texture Add( const std::string& key, Devel::PixelBuffer pixelBuffer );
+
+  /**
+   * @brief Removes a reference of a frame.
+   *
+   * The pixels are kept in the cache while the memory of the unused frames is within the budget.
+   *
+   * @param[in] key The key of the frame.
+   */
+  void Release( const std::string& key );
+
+  /**
+   * @brief Sets the maximum memory of the frames kept in the cache when no visual uses them.
+   *
+   * @param[in] budget The memory budget, in bytes.
+   */
+  void SetMemoryBudget( size_t budget );
+
+  /**
+   * @brief Sets whether the pixels of the frames added to the cache are compressed.
+   *
+   * @param[in] enabled Whether to compress the pixels.
+   */
+  void SetCompressionEnabled( bool enabled );
+
+  /**
+   * @brief Retrieves the metrics of the cache.
+   *
+   * @return The metrics.
+   */
+  const Metrics& GetMetrics() const;
+
+  /**
+   * @brief Builds the key of a frame.
+   *
+   * @param[in] url The url of the animated image.
+   * @param[in] frameIndex The index of the frame.
+   * @param[in] size The size of the frame.
+   * @return The key.
+   */
+  static std::string GetFrameKey( const std::string& url, uint32_t frameIndex, ImageDimensions size );
+
+private:
+
+  /**
+   * @brief Removes the least recently used frames until the memory of the unused ones is within the budget.
+   */
+  void Evict();
+
+  // Undefined
+  AnimatedImageFrameCache( const AnimatedImageFrameCache& );
+
+  // Undefined
+  AnimatedImageFrameCache& operator=( const AnimatedImageFrameCache& );
+
+private:
+
+  typedef std::list<std::string> KeyList;
+
+  struct Entry
+  {
+    Entry()
+    : pixels(),
+      texture(),
+      width( 0u ),
+      height( 0u ),
+      pixelFormat( Pixel::RGBA8888 ),
+      compressed( false ),
+      referenceCount( 0u ),
+      unusedIt()
+    {}
+
+    Dali::Vector<uint8_t> pixels;         ///< The pixels of the frame, run length encoded if compressed.
+    Texture               texture;        ///< The texture of the frame. Only kept while the frame is used.
+    uint32_t              width;          ///< The width of the frame.
+    uint32_t              height;         ///< The height of the frame.
+    Pixel::Format         pixelFormat;    ///< The pixel format of the frame.
+    bool                  compressed;     ///< Whether the pixels are run length encoded.
+    uint32_t              referenceCount; ///< The number of visuals using the frame.
+    KeyList::iterator     unusedIt;       ///< The position in the list of unused frames. Only valid if there is no reference.
+  };
+
+  typedef std::unordered_map<std::string, Entry> EntryContainer;
+
+  EntryContainer mEntries;            ///< The cached frames.
+  KeyList        mUnusedKeys;         ///< The keys of the frames not used, the least recently used first.
+  size_t         mMemoryBudget;       ///< The maximum memory of the unused frames.
+  Metrics        mMetrics;            ///< The metrics of the cache.
+  bool           mCompressionEnabled; ///< Whether the pixels of the frames are compressed.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_ANIMATED_IMAGE_FRAME_CACHE_H
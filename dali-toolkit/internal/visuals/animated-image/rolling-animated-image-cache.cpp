@@ -37,7 +37,7 @@ Debug::Filter* gAnimImgLogFilter = Debug::Filter::New(Debug::NoLogging, false, "
     {                                                                   \
       oss<<_i<<                                                         \
         "={ frm#: " << mQueue[_i].mFrameNumber <<                        \
-           " tex: " << mImageUrls[mQueue[_i].mFrameNumber].mTextureId<<"}, ";  \
+           " ready: " << mQueue[_i].mReady<<"}, ";                        \
     }                                                                   \
     oss<<" ]"<<std::endl;                                               \
     DALI_LOG_INFO(gAnimImgLogFilter,Debug::Concise,"%s",oss.str().c_str()); \
@@ -59,17 +59,20 @@ namespace Internal
 {
 
 RollingAnimatedImageCache::RollingAnimatedImageCache(
-  TextureManager& textureManager, AnimatedImageLoading& animatedImageLoading, uint32_t frameCount, ImageCache::FrameReadyObserver& observer,
-  uint16_t cacheSize, uint16_t batchSize, bool isSynchronousLoading )
+  TextureManager& textureManager, AnimatedImageFrameCache& frameCache, AnimatedImageLoading& animatedImageLoading, uint32_t frameCount,
+  ImageCache::FrameReadyObserver& observer, uint16_t cacheSize, uint16_t batchSize, bool isSynchronousLoading )
 : ImageCache( textureManager, observer, batchSize ),
   mAnimatedImageLoading( animatedImageLoading ),
+  mFrameCache( frameCache ),
   mFrameCount( frameCount ),
   mFrameIndex( 0 ),
+  mLoadingFrameIndex( 0 ),
+  mImageSize( animatedImageLoading.GetImageSize() ),
   mQueue( cacheSize ),
   mIsSynchronousLoading( isSynchronousLoading ),
   mOnLoading( false )
 {
-  mImageUrls.resize( mFrameCount );
+  mTextureSets.resize( mFrameCount );
   mIntervals.assign( mFrameCount, 0 );
   LoadBatch();
 }
@@ -80,8 +83,7 @@ RollingAnimatedImageCache::~RollingAnimatedImageCache()
   {
     while( !mQueue.IsEmpty() )
     {
-      ImageFrame imageFrame = mQueue.PopFront();
-      mTextureManager.Remove( mImageUrls[ imageFrame.mFrameNumber ].mTextureId, this );
+      ReleaseFrame( mQueue.PopFront() );
     }
   }
 }
@@ -91,9 +93,7 @@ TextureSet RollingAnimatedImageCache::Frame( uint32_t frameIndex )
   bool popExist = false;
   while( !mQueue.IsEmpty() && mQueue.Front().mFrameNumber != frameIndex )
   {
-    ImageFrame imageFrame = mQueue.PopFront();
-    mTextureManager.Remove( mImageUrls[ imageFrame.mFrameNumber ].mTextureId, this );
-    mImageUrls[ imageFrame.mFrameNumber ].mTextureId = TextureManager::INVALID_TEXTURE_ID;
+    ReleaseFrame( mQueue.PopFront() );
     popExist = true;
   }
 
@@ -102,10 +102,34 @@ TextureSet RollingAnimatedImageCache::Frame( uint32_t frameIndex )
   // Load the frame synchronously.
   if( mIsSynchronousLoading && mQueue.IsEmpty() )
   {
-    bool synchronousLoading = true;
-    textureSet = mTextureManager.LoadAnimatedImageTexture( mAnimatedImageLoading, frameIndex, SamplingMode::BOX_THEN_LINEAR,
-                                                           synchronousLoading, mImageUrls[ frameIndex ].mTextureId, Dali::WrapMode::Type::DEFAULT,
-                                                           Dali::WrapMode::Type::DEFAULT, this );
+    const std::string key = GetFrameKey( frameIndex );
+    Texture texture = mFrameCache.Request( key );
+    if( !texture )
+    {
+      Devel::PixelBuffer pixelBuffer = mAnimatedImageLoading.LoadFrame( frameIndex );
+      if( pixelBuffer )
+      {
+        texture = mFrameCache.Add( key, pixelBuffer );
+      }
+    }
+
+    if( texture )
+    {
+      textureSet = TextureSet::New();
+      textureSet.SetTexture( 0u, texture );
+
+      // The frame is not kept in the queue, the texture set keeps the texture.
+      mFrameCache.Release( key );
+    }
+    else
+    {
+      // Let the texture manager provide the broken image.
+      bool synchronousLoading = true;
+      TextureManager::TextureId textureId = TextureManager::INVALID_TEXTURE_ID;
+      textureSet = mTextureManager.LoadAnimatedImageTexture( mAnimatedImageLoading, frameIndex, SamplingMode::BOX_THEN_LINEAR,
+                                                             synchronousLoading, textureId, Dali::WrapMode::Type::DEFAULT,
+                                                             Dali::WrapMode::Type::DEFAULT, this );
+    }
     mFrameIndex = ( frameIndex + 1 ) % mFrameCount;
   }
 
@@ -161,14 +185,30 @@ bool RollingAnimatedImageCache::IsFrontReady() const
 
 void RollingAnimatedImageCache::RequestFrameLoading( uint32_t frameIndex )
 {
-  mRequestingLoad = true;
+  // The frame may have been decoded for another visual.
+  Texture texture = mFrameCache.Request( GetFrameKey( frameIndex ) );
+  if( texture )
+  {
+    SetImageFrameReady( frameIndex, texture );
+    return;
+  }
 
-  bool synchronousLoading = false;
-  mTextureManager.LoadAnimatedImageTexture( mAnimatedImageLoading, frameIndex, SamplingMode::BOX_THEN_LINEAR,
-                                            synchronousLoading, mImageUrls[ frameIndex ].mTextureId, Dali::WrapMode::Type::DEFAULT,
-                                            Dali::WrapMode::Type::DEFAULT, this );
+  mOnLoading = true;
+  mLoadingFrameIndex = frameIndex;
+
+  mTextureManager.LoadAnimatedImagePixelBuffer( mAnimatedImageLoading, frameIndex, this );
+}
 
-  mRequestingLoad = false;
+void RollingAnimatedImageCache::LoadWaitingFrames()
+{
+  // The frames of a single animated image can not be loaded parallelly.
+  // Therefore, a frame is now loading, other orders are waiting.
+  while( !mOnLoading && !mLoadWaitingQueue.empty() )
+  {
+    uint32_t loadingIndex = mLoadWaitingQueue.front();
+    mLoadWaitingQueue.erase( mLoadWaitingQueue.begin() );
+    RequestFrameLoading( loadingIndex );
+  }
 }
 
 void RollingAnimatedImageCache::LoadBatch()
@@ -185,49 +225,67 @@ void RollingAnimatedImageCache::LoadBatch()
     imageFrame.mReady = false;
 
     mQueue.PushBack( imageFrame );
-
-    if( !mOnLoading )
-    {
-      mOnLoading = true;
-      RequestFrameLoading( mFrameIndex );
-    }
-    else
-    {
-      mLoadWaitingQueue.push_back( mFrameIndex );
-    }
+    mLoadWaitingQueue.push_back( mFrameIndex );
 
     mFrameIndex++;
     mFrameIndex %= mFrameCount;
   }
 
+  LoadWaitingFrames();
+
   CheckFrontFrame( frontFrameReady );
 
   LOG_CACHE;
 }
 
-void RollingAnimatedImageCache::SetImageFrameReady( TextureManager::TextureId textureId )
+void RollingAnimatedImageCache::SetImageFrameReady( uint32_t frameIndex, Texture texture )
 {
   for( std::size_t i = 0; i < mQueue.Count() ; ++i )
   {
-    if( GetCachedTextureId( i ) == textureId )
+    if( mQueue[i].mFrameNumber == frameIndex && !mQueue[i].mReady )
     {
       mQueue[i].mReady = true;
-      break;
+      if( texture && !mTextureSets[ frameIndex ] )
+      {
+        mTextureSets[ frameIndex ] = TextureSet::New();
+        mTextureSets[ frameIndex ].SetTexture( 0u, texture );
+      }
+      return;
     }
   }
+
+  // The frame was removed from the queue while it was loading.
+  mFrameCache.Release( GetFrameKey( frameIndex ) );
 }
 
-TextureSet RollingAnimatedImageCache::GetFrontTextureSet() const
+void RollingAnimatedImageCache::ReleaseFrame( const ImageFrame& imageFrame )
 {
-  DALI_LOG_INFO( gAnimImgLogFilter, Debug::Concise, "RollingAnimatedImageCache::GetFrontTextureSet() FrameNumber:%d\n", mQueue[ 0 ].mFrameNumber );
+  if( imageFrame.mReady )
+  {
+    mFrameCache.Release( GetFrameKey( imageFrame.mFrameNumber ) );
 
-  TextureManager::TextureId textureId = GetCachedTextureId( 0 );
-  return mTextureManager.GetTextureSet( textureId );
+    for( std::size_t i = 0; i < mQueue.Count() ; ++i )
+    {
+      if( mQueue[i].mFrameNumber == imageFrame.mFrameNumber && mQueue[i].mReady )
+      {
+        // The frame is still in the queue.
+        return;
+      }
+    }
+    mTextureSets[ imageFrame.mFrameNumber ].Reset();
+  }
+}
+
+std::string RollingAnimatedImageCache::GetFrameKey( uint32_t frameIndex ) const
+{
+  return AnimatedImageFrameCache::GetFrameKey( mAnimatedImageLoading.GetUrl(), frameIndex, mImageSize );
 }
 
-TextureManager::TextureId RollingAnimatedImageCache::GetCachedTextureId( int index ) const
+TextureSet RollingAnimatedImageCache::GetFrontTextureSet() const
 {
-  return mImageUrls[ mQueue[ index ].mFrameNumber ].mTextureId;
+  DALI_LOG_INFO( gAnimImgLogFilter, Debug::Concise, "RollingAnimatedImageCache::GetFrontTextureSet() FrameNumber:%d\n", mQueue[ 0 ].mFrameNumber );
+
+  return mTextureSets[ mQueue[ 0 ].mFrameNumber ];
 }
 
 void RollingAnimatedImageCache::CheckFrontFrame( bool wasReady )
@@ -247,49 +305,34 @@ void RollingAnimatedImageCache::UploadComplete(
   const Vector4& atlasRect,
   bool           preMultiplied )
 {
-  DALI_LOG_INFO(gAnimImgLogFilter,Debug::Concise,"AnimatedImageVisual::UploadComplete(textureId:%d) start\n", textureId);
+  // The frames are requested as pixel buffers, which are uploaded by the frame cache.
+}
+
+void RollingAnimatedImageCache::LoadComplete(
+  bool loadSuccess,
+  Devel::PixelBuffer pixelBuffer,
+  const VisualUrl& url,
+  bool preMultiplied )
+{
+  DALI_LOG_INFO(gAnimImgLogFilter,Debug::Concise,"AnimatedImageVisual::LoadComplete(frame:%d) start\n", mLoadingFrameIndex);
   LOG_CACHE;
 
   bool frontFrameReady = IsFrontReady();
 
-  if( !mRequestingLoad )
+  Texture texture;
+  if( loadSuccess && pixelBuffer )
   {
-    SetImageFrameReady( textureId );
-
-    CheckFrontFrame( frontFrameReady );
-  }
-  else
-  {
-    // UploadComplete has been called from within RequestLoad. TextureManager must
-    // therefore already have the texture cached, so make the texture ready.
-    // (Use the last texture, as the texture id hasn't been assigned yet)
-    mQueue.Back().mReady = true;
+    texture = mFrameCache.Add( GetFrameKey( mLoadingFrameIndex ), pixelBuffer );
   }
+  SetImageFrameReady( mLoadingFrameIndex, texture );
 
+  // After the frame is loaded, requests load of next order.
   mOnLoading = false;
-  // The frames of a single animated image can not be loaded parallelly.
-  // Therefore, a frame is now loading, other orders are waiting.
-  // And, after the frame is loaded, requests load of next order.
-  if( !mLoadWaitingQueue.empty() )
-  {
-    uint32_t loadingIndex = mLoadWaitingQueue.front();
-    mLoadWaitingQueue.erase( mLoadWaitingQueue.begin() );
-    mOnLoading = true;
-    RequestFrameLoading( loadingIndex );
-  }
+  LoadWaitingFrames();
 
-  LOG_CACHE;
-}
+  CheckFrontFrame( frontFrameReady );
 
-void RollingAnimatedImageCache::LoadComplete(
-  bool loadSuccess,
-  Devel::PixelBuffer pixelBuffer,
-  const VisualUrl& url,
-  bool preMultiplied )
-{
-  // LoadComplete is called if this TextureUploadObserver requested to load
-  // an image that will be returned as a type of PixelBuffer by using a method
-  // TextureManager::LoadPixelBuffer.
+  LOG_CACHE;
 }
 
 } //namespace Internal
@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
 #include <dali/devel-api/common/circular-queue.h>
+#include <dali-toolkit/internal/visuals/animated-image/animated-image-frame-cache.h>
 #include <dali-toolkit/internal/visuals/animated-image/image-cache.h>
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
@@ -36,6 +37,9 @@ namespace Internal
  *
  * Frames are always ready, so the observer.FrameReady callback is never triggered;
  * the FirstFrame and NextFrame APIs will always return a texture.
+ *
+ * The decoded frames are shared with the other visuals through the animated image frame cache,
+ * so a frame is decoded again only once it was evicted from there.
  */
 class RollingAnimatedImageCache : public ImageCache, public TextureUploadObserver
 {
@@ -43,6 +47,7 @@ public:
   /**
    * Constructor.
    * @param[in] textureManager The texture manager
+   * @param[in] frameCache The cache of the decoded frames
    * @param[in] animatedImageLoader The loaded animated image
    * @param[in] frameCount The number of frames in the animated image
    * @param[in] observer FrameReady observer
@@ -54,6 +59,7 @@ public:
    * batch and cache sizes.
    */
   RollingAnimatedImageCache( TextureManager&                 textureManager,
+                             AnimatedImageFrameCache&        frameCache,
                              AnimatedImageLoading&           animatedImageLoader,
                              uint32_t                        frameCount,
                              ImageCache::FrameReadyObserver& observer,
@@ -84,6 +90,15 @@ public:
   uint32_t GetFrameInterval( uint32_t frameIndex ) override;
 
 private:
+  /**
+   * Secondary class to hold readiness and index into url
+   */
+  struct ImageFrame
+  {
+    unsigned int mFrameNumber = 0u;
+    bool mReady = false;
+  };
+
   /**
    * @return true if the front frame is ready
    */
@@ -94,6 +109,11 @@ private:
    */
   void RequestFrameLoading( uint32_t frameIndex );
 
+  /**
+   * Request the loads of the waiting frames, until a frame must be decoded
+   */
+  void LoadWaitingFrames();
+
   /**
    * Load the next batch of images
    */
@@ -101,19 +121,26 @@ private:
 
   /**
    * Find the matching image frame, and set it to ready
+   * @param[in] frameIndex The index of the frame
+   * @param[in] texture The texture of the frame, referenced in the frame cache
    */
-  void SetImageFrameReady( TextureManager::TextureId textureId );
+  void SetImageFrameReady( uint32_t frameIndex, Texture texture );
 
   /**
-   * Get the texture set of the front frame.
-   * @return the texture set
+   * Remove the reference of a frame in the frame cache, if the frame was loaded
    */
-  TextureSet GetFrontTextureSet() const;
+  void ReleaseFrame( const ImageFrame& imageFrame );
 
   /**
-   * Get the texture id of the given index
+   * Get the key of a frame in the frame cache
    */
-  TextureManager::TextureId GetCachedTextureId( int index ) const;
+  std::string GetFrameKey( uint32_t frameIndex ) const;
+
+  /**
+   * Get the texture set of the front frame.
+   * @return the texture set
+   */
+  TextureSet GetFrontTextureSet() const;
 
   /**
    * Check if the front frame has become ready - if so, inform observer
@@ -137,19 +164,13 @@ protected:
     bool preMultiplied ) override;
 
 private:
-  /**
-   * Secondary class to hold readiness and index into url
-   */
-  struct ImageFrame
-  {
-    unsigned int mFrameNumber = 0u;
-    bool mReady = false;
-  };
-
   Dali::AnimatedImageLoading  mAnimatedImageLoading;
+  AnimatedImageFrameCache&    mFrameCache;
   uint32_t                    mFrameCount;
   int                         mFrameIndex;
-  std::vector<UrlStore>       mImageUrls;
+  uint32_t                    mLoadingFrameIndex; ///< The index of the frame being decoded
+  ImageDimensions             mImageSize;
+  std::vector<TextureSet>     mTextureSets;       ///< The texture sets of the frames in the queue, by frame index
   std::vector<int32_t>        mIntervals;
   std::vector<uint32_t>       mLoadWaitingQueue;
   CircularQueue<ImageFrame>   mQueue;
@@ -34,6 +34,7 @@
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-manager.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -62,6 +63,12 @@ DALI_ENUM_TO_STRING_WITH_SCOPE( Dali::Toolkit::DevelImageVisual::LoopingMode, RE
 DALI_ENUM_TO_STRING_WITH_SCOPE( Dali::Toolkit::DevelImageVisual::LoopingMode, AUTO_REVERSE )
 DALI_ENUM_TO_STRING_TABLE_END( LOOPING_MODE )
 
+// frame drop policy
+DALI_ENUM_TO_STRING_TABLE_BEGIN( FRAME_DROP_POLICY )
+DALI_ENUM_TO_STRING_WITH_SCOPE( Dali::Toolkit::DevelImageVisual::FrameDropPolicy, RENDER_ALL_FRAMES )
+DALI_ENUM_TO_STRING_WITH_SCOPE( Dali::Toolkit::DevelImageVisual::FrameDropPolicy, DROP_LATE_FRAMES )
+DALI_ENUM_TO_STRING_TABLE_END( FRAME_DROP_POLICY )
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_VECTOR_ANIMATION" );
 #endif
@@ -94,7 +101,9 @@ AnimatedVectorImageVisual::AnimatedVectorImageVisual( VisualFactoryCache& factor
   mPlacementActor(),
   mPlayState( DevelImageVisual::PlayState::STOPPED ),
   mEventCallback( nullptr ),
-  mRendererAdded( false )
+  mRendererAdded( false ),
+  mShareAnimation( false ),
+  mTaskPlaying( false )
 {
   // the rasterized image is with pre-multiplied alpha format
   mImpl->mFlags |= Impl::IS_PREMULTIPLIED_ALPHA;
@@ -110,6 +119,8 @@ AnimatedVectorImageVisual::~AnimatedVectorImageVisual()
     mFactoryCache.GetVectorAnimationManager().UnregisterEventCallback( mEventCallback );
   }
 
+  ReleaseSharedAnimation();
+
   // Finalize animation task and disconnect the signal in the main thread
   mVectorAnimationTask->UploadCompletedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnUploadCompleted );
   mVectorAnimationTask->Finalize();
@@ -142,8 +153,11 @@ void AnimatedVectorImageVisual::DoCreatePropertyMap( Property::Map& map ) const
   }
   map.Insert( Toolkit::DevelImageVisual::Property::LOOP_COUNT, mAnimationData.loopCount );
 
+  // The own task doesn't receive the animation data while the animation is shared.
+  VectorAnimationTask& task = mSharedAnimation ? mSharedAnimation->GetTask() : *mVectorAnimationTask;
+
   uint32_t startFrame, endFrame;
-  mVectorAnimationTask->GetPlayRange( startFrame, endFrame );
+  task.GetPlayRange( startFrame, endFrame );
 
   Property::Array playRange;
   playRange.PushBack( static_cast< int32_t >( startFrame ) );
@@ -151,11 +165,21 @@ void AnimatedVectorImageVisual::DoCreatePropertyMap( Property::Map& map ) const
   map.Insert( Toolkit::DevelImageVisual::Property::PLAY_RANGE, playRange );
 
   map.Insert( Toolkit::DevelImageVisual::Property::PLAY_STATE, static_cast< int32_t >( mPlayState ) );
-  map.Insert( Toolkit::DevelImageVisual::Property::CURRENT_FRAME_NUMBER, static_cast< int32_t >( mVectorAnimationTask->GetCurrentFrameNumber() ) );
+  map.Insert( Toolkit::DevelImageVisual::Property::CURRENT_FRAME_NUMBER, static_cast< int32_t >( task.GetCurrentFrameNumber() ) );
   map.Insert( Toolkit::DevelImageVisual::Property::TOTAL_FRAME_NUMBER, static_cast< int32_t >( mVectorAnimationTask->GetTotalFrameNumber() ) );
 
   map.Insert( Toolkit::DevelImageVisual::Property::STOP_BEHAVIOR, mAnimationData.stopBehavior );
   map.Insert( Toolkit::DevelImageVisual::Property::LOOPING_MODE, mAnimationData.loopingMode );
+  map.Insert( Toolkit::DevelImageVisual::Property::SHARE_ANIMATION, mShareAnimation );
+  map.Insert( Toolkit::DevelImageVisual::Property::FRAME_DROP_POLICY, mAnimationData.frameDropPolicy );
+
+  uint32_t lateFrames, droppedFrames;
+  task.GetFrameStatistics( lateFrames, droppedFrames );
+
+  Property::Map frameStatistics;
+  frameStatistics.Insert( "lateFrames", static_cast< int32_t >( lateFrames ) );
+  frameStatistics.Insert( "droppedFrames", static_cast< int32_t >( droppedFrames ) );
+  map.Insert( Toolkit::DevelImageVisual::Property::FRAME_STATISTICS, frameStatistics );
 
   Property::Map layerInfo;
   mVectorAnimationTask->GetLayerInfo( layerInfo );
@@ -195,6 +219,14 @@ void AnimatedVectorImageVisual::DoSetProperties( const Property::Map& propertyMa
        {
           DoSetProperty( Toolkit::DevelImageVisual::Property::LOOPING_MODE, keyValue.second );
        }
+       else if( keyValue.first == SHARE_ANIMATION_NAME )
+       {
+          DoSetProperty( Toolkit::DevelImageVisual::Property::SHARE_ANIMATION, keyValue.second );
+       }
+       else if( keyValue.first == FRAME_DROP_POLICY_NAME )
+       {
+          DoSetProperty( Toolkit::DevelImageVisual::Property::FRAME_DROP_POLICY, keyValue.second );
+       }
     }
   }
 
@@ -245,6 +277,26 @@ void AnimatedVectorImageVisual::DoSetProperty( Property::Index index, const Prop
       }
       break;
     }
+    case Toolkit::DevelImageVisual::Property::SHARE_ANIMATION:
+    {
+      bool shareAnimation;
+      if( value.Get( shareAnimation ) && ( shareAnimation != mShareAnimation ) )
+      {
+        mShareAnimation = shareAnimation;
+        mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PLAY_STATE;
+      }
+      break;
+    }
+    case Toolkit::DevelImageVisual::Property::FRAME_DROP_POLICY:
+    {
+      int32_t frameDropPolicy = mAnimationData.frameDropPolicy;
+      if( Scripting::GetEnumerationProperty( value, FRAME_DROP_POLICY_TABLE, FRAME_DROP_POLICY_TABLE_COUNT, frameDropPolicy ) )
+      {
+        mAnimationData.frameDropPolicy = DevelImageVisual::FrameDropPolicy::Type( frameDropPolicy );
+        mAnimationData.resendFlag |= VectorAnimationTask::RESEND_FRAME_DROP_POLICY;
+      }
+      break;
+    }
   }
 }
 
@@ -254,9 +306,10 @@ void AnimatedVectorImageVisual::DoSetOnScene( Actor& actor )
 
   if( mImpl->mCustomShader )
   {
-    shader = Shader::New( mImpl->mCustomShader->mVertexShader.empty() ? mImageVisualShaderFactory.GetVertexShaderSource() : mImpl->mCustomShader->mVertexShader,
-                          mImpl->mCustomShader->mFragmentShader.empty() ? mImageVisualShaderFactory.GetFragmentShaderSource() : mImpl->mCustomShader->mFragmentShader,
-                          mImpl->mCustomShader->mHints );
+    shader = ShaderRegistry::Get().NewShader( "AnimatedVectorImageVisual",
+                                              mImpl->mCustomShader->mVertexShader.empty() ? mImageVisualShaderFactory.GetVertexShaderSource() : mImpl->mCustomShader->mVertexShader,
+                                              mImpl->mCustomShader->mFragmentShader.empty() ? mImageVisualShaderFactory.GetFragmentShaderSource() : mImpl->mCustomShader->mFragmentShader,
+                                              mImpl->mCustomShader->mHints );
 
     shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
   }
@@ -459,7 +512,18 @@ void AnimatedVectorImageVisual::SendAnimationData()
 {
   if( mAnimationData.resendFlag )
   {
-    mVectorAnimationTask->SetAnimationData( mAnimationData );
+    if( mShareAnimation && mImpl->mRenderer && !mImpl->mCustomShader && ( mAnimationData.width > 0u ) && ( mAnimationData.height > 0u ) &&
+        ( mAnimationData.playState == DevelImageVisual::PlayState::PLAYING ) && !( mAnimationData.resendFlag & VectorAnimationTask::RESEND_CURRENT_FRAME ) )
+    {
+      JoinSharedAnimation();
+    }
+    else
+    {
+      LeaveSharedAnimation();
+
+      mVectorAnimationTask->SetAnimationData( mAnimationData );
+      mTaskPlaying = ( mAnimationData.playState == DevelImageVisual::PlayState::PLAYING );
+    }
 
     if( mImpl->mRenderer )
     {
@@ -573,6 +637,98 @@ void AnimatedVectorImageVisual::OnProcessEvents()
   mEventCallback = nullptr;  // The callback will be deleted in the VectorAnimationManager
 }
 
+void AnimatedVectorImageVisual::JoinSharedAnimation()
+{
+  VectorAnimationManager& manager = mFactoryCache.GetVectorAnimationManager();
+  const std::string key = VectorAnimationManager::GetSharedAnimationKey( mUrl.GetUrl(), mAnimationData );
+  if( mSharedAnimation && ( mSharedAnimation->GetKey() == key ) && !mSharedAnimation->IsFinished() )
+  {
+    return;
+  }
+
+  ReleaseSharedAnimation();
+
+  if( mTaskPlaying )
+  {
+    // The own task doesn't need to rasterize the frames anymore.
+    VectorAnimationTask::AnimationData data;
+    data.playState = DevelImageVisual::PlayState::PAUSED;
+    data.resendFlag = VectorAnimationTask::RESEND_PLAY_STATE;
+    mVectorAnimationTask->SetAnimationData( data );
+    mTaskPlaying = false;
+  }
+
+  mSharedAnimation = manager.RequestSharedAnimation( mFactoryCache, key, mUrl.GetUrl(), mAnimationData, mImageVisualShaderFactory.GetShader( mFactoryCache, false, true, false ) );
+  mSharedAnimation->UploadCompletedSignal().Connect( this, &AnimatedVectorImageVisual::OnSharedAnimationUploaded );
+  mSharedAnimation->AnimationFinishedSignal().Connect( this, &AnimatedVectorImageVisual::OnSharedAnimationFinished );
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::JoinSharedAnimation: %s [%p]\n", key.c_str(), this );
+
+  if( mSharedAnimation->IsUploaded() )
+  {
+    OnSharedAnimationUploaded();
+  }
+}
+
+void AnimatedVectorImageVisual::LeaveSharedAnimation()
+{
+  if( mSharedAnimation )
+  {
+    const uint32_t currentFrame = mSharedAnimation->GetTask().GetCurrentFrameNumber();
+
+    ReleaseSharedAnimation();
+
+    if( mImpl->mRenderer )
+    {
+      // Rasterize into the visual's own textures again.
+      mImpl->mRenderer.SetShader( mImageVisualShaderFactory.GetShader( mFactoryCache, false, true, false ) );
+      mImpl->mRenderer.SetTextures( TextureSet::New() );
+      mVectorAnimationTask->SetRenderer( mImpl->mRenderer );
+    }
+
+    // The own task hasn't received the data sent while the animation was shared. Continue from the shared frame.
+    mAnimationData.currentFrame = currentFrame;
+    mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PLAY_RANGE | VectorAnimationTask::RESEND_LOOP_COUNT | VectorAnimationTask::RESEND_STOP_BEHAVIOR |
+                                 VectorAnimationTask::RESEND_LOOPING_MODE | VectorAnimationTask::RESEND_CURRENT_FRAME | VectorAnimationTask::RESEND_SIZE |
+                                 VectorAnimationTask::RESEND_PLAY_STATE;
+
+    DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "AnimatedVectorImageVisual::LeaveSharedAnimation: frame = %d [%p]\n", currentFrame, this );
+  }
+}
+
+void AnimatedVectorImageVisual::ReleaseSharedAnimation()
+{
+  if( mSharedAnimation )
+  {
+    mSharedAnimation->UploadCompletedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnSharedAnimationUploaded );
+    mSharedAnimation->AnimationFinishedSignal().Disconnect( this, &AnimatedVectorImageVisual::OnSharedAnimationFinished );
+
+    mFactoryCache.GetVectorAnimationManager().ReleaseSharedAnimation( mSharedAnimation );
+    mSharedAnimation.Reset();
+  }
+}
+
+void AnimatedVectorImageVisual::OnSharedAnimationUploaded()
+{
+  if( mSharedAnimation && mImpl->mRenderer )
+  {
+    // The shader may have been changed to render the uploaded textures.
+    mImpl->mRenderer.SetShader( mSharedAnimation->GetShader() );
+    mImpl->mRenderer.SetTextures( mSharedAnimation->GetTextures() );
+
+    OnUploadCompleted();
+  }
+}
+
+void AnimatedVectorImageVisual::OnSharedAnimationFinished()
+{
+  OnAnimationFinished();
+
+  // Leave the finished animation once the signal emission is over.
+  mAnimationData.resendFlag |= VectorAnimationTask::RESEND_PLAY_STATE;
+  TriggerVectorRasterization();
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -30,6 +30,7 @@
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/devel-api/visuals/animated-vector-image-visual-actions-devel.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
+#include <dali-toolkit/internal/visuals/animated-vector-image/shared-vector-animation.h>
 
 namespace Dali
 {
@@ -202,6 +203,31 @@ private:
    */
   void OnProcessEvents();
 
+  /**
+   * @brief Shows the shared animation with the same key as the animation data instead of rasterizing the animation.
+   */
+  void JoinSharedAnimation();
+
+  /**
+   * @brief Stops showing the shared animation and rasterizes the animation with the visual's own task again.
+   */
+  void LeaveSharedAnimation();
+
+  /**
+   * @brief Releases the shared animation.
+   */
+  void ReleaseSharedAnimation();
+
+  /**
+   * @brief Called when a frame of the shared animation is uploaded.
+   */
+  void OnSharedAnimationUploaded();
+
+  /**
+   * @brief Called when the shared animation is finished.
+   */
+  void OnSharedAnimationFinished();
+
   // Undefined
   AnimatedVectorImageVisual( const AnimatedVectorImageVisual& visual ) = delete;
 
@@ -212,6 +238,7 @@ private:
   VisualUrl                                    mUrl;
   VectorAnimationTask::AnimationData           mAnimationData;
   VectorAnimationTaskPtr                       mVectorAnimationTask;
+  SharedVectorAnimationPtr                     mSharedAnimation;  ///< The animation shown instead of the own task's one, if shared
   ImageVisualShaderFactory&                    mImageVisualShaderFactory;
   PropertyNotification                         mScaleNotification;
   PropertyNotification                         mSizeNotification;
@@ -221,6 +248,8 @@ private:
   DevelImageVisual::PlayState::Type            mPlayState;
   CallbackBase*                                mEventCallback;    // Not owned
   bool                                         mRendererAdded;
+  bool                                         mShareAnimation;
+  bool                                         mTaskPlaying;      ///< Whether the own task has been asked to play
 };
 
 } // namespace Internal
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/animated-vector-image/shared-vector-animation.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/rendering/texture-set.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/visual-factory-cache.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_VECTOR_ANIMATION" );
+#endif
+
+} // unnamed namespace
+
+SharedVectorAnimation::SharedVectorAnimation( VisualFactoryCache& factoryCache, const std::string& key, const std::string& url, const VectorAnimationTask::AnimationData& animationData, Shader shader )
+: mKey( key ),
+  mVectorAnimationTask( new VectorAnimationTask( factoryCache, url ) ),
+  mRenderer( Renderer::New( factoryCache.GetGeometry( VisualFactoryCache::QUAD_GEOMETRY ), shader ) ),
+  mAnimationFinishedSignal(),
+  mMemory( animationData.width * animationData.height * Pixel::GetBytesPerPixel( Pixel::RGBA8888 ) ),
+  mReferenceCount( 0u ),
+  mUploaded( false ),
+  mFinished( false )
+{
+  mRenderer.SetTextures( TextureSet::New() );
+
+  mVectorAnimationTask->UploadCompletedSignal().Connect( this, &SharedVectorAnimation::OnUploadCompleted );
+  mVectorAnimationTask->SetAnimationFinishedCallback( new EventThreadCallback( MakeCallback( this, &SharedVectorAnimation::OnAnimationFinished ) ) );
+  mVectorAnimationTask->SetRenderer( mRenderer );
+
+  VectorAnimationTask::AnimationData data( animationData );
+  data.playState = DevelImageVisual::PlayState::PLAYING;
+  data.resendFlag = VectorAnimationTask::RESEND_PLAY_RANGE | VectorAnimationTask::RESEND_LOOP_COUNT | VectorAnimationTask::RESEND_STOP_BEHAVIOR |
+                    VectorAnimationTask::RESEND_LOOPING_MODE | VectorAnimationTask::RESEND_SIZE | VectorAnimationTask::RESEND_PLAY_STATE |
+                    VectorAnimationTask::RESEND_FRAME_DROP_POLICY;
+  mVectorAnimationTask->SetAnimationData( data );
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "SharedVectorAnimation::SharedVectorAnimation: %s [%p]\n", mKey.c_str(), this );
+}
+
+SharedVectorAnimation::~SharedVectorAnimation()
+{
+  // Finalize animation task and disconnect the signal in the main thread
+  mVectorAnimationTask->UploadCompletedSignal().Disconnect( this, &SharedVectorAnimation::OnUploadCompleted );
+  mVectorAnimationTask->Finalize();
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "SharedVectorAnimation::~SharedVectorAnimation: %s [%p]\n", mKey.c_str(), this );
+}
+
+const std::string& SharedVectorAnimation::GetKey() const
+{
+  return mKey;
+}
+
+TextureSet SharedVectorAnimation::GetTextures() const
+{
+  return mRenderer.GetTextures();
+}
+
+Shader SharedVectorAnimation::GetShader() const
+{
+  return mRenderer.GetShader();
+}
+
+VectorAnimationTask& SharedVectorAnimation::GetTask() const
+{
+  return *mVectorAnimationTask;
+}
+
+size_t SharedVectorAnimation::GetMemory() const
+{
+  return mMemory;
+}
+
+bool SharedVectorAnimation::IsUploaded() const
+{
+  return mUploaded;
+}
+
+bool SharedVectorAnimation::IsFinished() const
+{
+  return mFinished;
+}
+
+void SharedVectorAnimation::Reference()
+{
+  ++mReferenceCount;
+}
+
+uint32_t SharedVectorAnimation::Unreference()
+{
+  if( mReferenceCount > 0u )
+  {
+    --mReferenceCount;
+  }
+  return mReferenceCount;
+}
+
+VectorAnimationTask::UploadCompletedSignalType& SharedVectorAnimation::UploadCompletedSignal()
+{
+  return mVectorAnimationTask->UploadCompletedSignal();
+}
+
+SharedVectorAnimation::AnimationFinishedSignalType& SharedVectorAnimation::AnimationFinishedSignal()
+{
+  return mAnimationFinishedSignal;
+}
+
+void SharedVectorAnimation::OnUploadCompleted()
+{
+  mUploaded = true;
+}
+
+void SharedVectorAnimation::OnAnimationFinished()
+{
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "SharedVectorAnimation::OnAnimationFinished: %s [%p]\n", mKey.c_str(), this );
+
+  mFinished = true;
+
+  // Keep the animation alive while the visuals are notified.
+  SharedVectorAnimationPtr self( this );
+  mAnimationFinishedSignal.Emit();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,175 @@
+#ifndef DALI_TOOLKIT_SHARED_VECTOR_ANIMATION_H
+#define DALI_TOOLKIT_SHARED_VECTOR_ANIMATION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/public-api/signals/dali-signal.h>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class VisualFactoryCache;
+class SharedVectorAnimation;
+typedef IntrusivePtr< SharedVectorAnimation > SharedVectorAnimationPtr;
+
+/**
+ * @brief A vector animation rasterized once for all the AnimatedVectorImageVisuals which play it.
+ *
+ * The animation is rasterized by its own task into the textures of a renderer which is never put on scene.
+ * The visuals show the animation by using the texture set and the shader of this renderer.
+ */
+class SharedVectorAnimation : public RefObject, public ConnectionTracker
+{
+public:
+
+  using AnimationFinishedSignalType = Signal< void () >;
+
+  /**
+   * @brief Constructor. Starts playing the animation.
+   *
+   * @param[in] factoryCache A pointer pointing to the VisualFactoryCache object
+   * @param[in] key The key of the animation in the VectorAnimationManager
+   * @param[in] url The url of the vector animation file
+   * @param[in] animationData The size, play range, loop count, stop behavior and looping mode of the animation
+   * @param[in] shader The shader of the visuals
+   */
+  SharedVectorAnimation( VisualFactoryCache& factoryCache, const std::string& key, const std::string& url, const VectorAnimationTask::AnimationData& animationData, Shader shader );
+
+  /**
+   * @brief Retrieves the key of the animation in the VectorAnimationManager.
+   * @return The key
+   */
+  const std::string& GetKey() const;
+
+  /**
+   * @brief Retrieves the texture set which the animation is rasterized into.
+   * @return The texture set
+   */
+  TextureSet GetTextures() const;
+
+  /**
+   * @brief Retrieves the shader to render the texture set with.
+   * @return The shader
+   */
+  Shader GetShader() const;
+
+  /**
+   * @brief Retrieves the task which rasterizes the animation.
+   * @return The task
+   */
+  VectorAnimationTask& GetTask() const;
+
+  /**
+   * @brief Retrieves the memory of the rasterized frame, in bytes.
+   * @return The memory
+   */
+  size_t GetMemory() const;
+
+  /**
+   * @brief Whether the first texture has been uploaded.
+   * @return True if the texture set can be used
+   */
+  bool IsUploaded() const;
+
+  /**
+   * @brief Whether the animation has finished playing.
+   * @return True if the animation is stopped
+   */
+  bool IsFinished() const;
+
+  /**
+   * @brief Adds a visual to the number of visuals which show the animation.
+   */
+  void Reference();
+
+  /**
+   * @brief Removes a visual from the number of visuals which show the animation.
+   * @return The number of visuals which still show the animation
+   */
+  uint32_t Unreference();
+
+  /**
+   * @brief Connect to this signal to be notified when the texture upload is completed.
+   * @return The signal to connect to.
+   */
+  VectorAnimationTask::UploadCompletedSignalType& UploadCompletedSignal();
+
+  /**
+   * @brief Connect to this signal to be notified when the animation is finished.
+   * @return The signal to connect to.
+   */
+  AnimationFinishedSignalType& AnimationFinishedSignal();
+
+protected:
+
+  /**
+   * @brief Destructor.
+   */
+  ~SharedVectorAnimation() override;
+
+private:
+
+  /**
+   * @brief Called when the texture upload is completed.
+   */
+  void OnUploadCompleted();
+
+  /**
+   * @brief Event callback from rasterize thread. This is called after the animation is finished.
+   */
+  void OnAnimationFinished();
+
+  // Undefined
+  SharedVectorAnimation( const SharedVectorAnimation& animation ) = delete;
+
+  // Undefined
+  SharedVectorAnimation& operator=( const SharedVectorAnimation& animation ) = delete;
+
+private:
+
+  std::string                 mKey;
+  VectorAnimationTaskPtr      mVectorAnimationTask;
+  Renderer                    mRenderer;
+  AnimationFinishedSignalType mAnimationFinishedSignal;
+  size_t                      mMemory;
+  uint32_t                    mReferenceCount;
+  bool                        mUploaded;
+  bool                        mFinished;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SHARED_VECTOR_ANIMATION_H
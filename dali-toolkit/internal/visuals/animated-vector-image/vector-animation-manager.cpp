@@ -46,6 +46,8 @@ Debug::Filter* gVectorAnimationLogFilter = Debug::Filter::New( Debug::NoLogging,
 VectorAnimationManager::VectorAnimationManager()
 : mEventCallbacks(),
   mVectorAnimationThread( nullptr ),
+  mSharedAnimations(),
+  mSharedAnimationMetrics(),
   mProcessorRegistered( false )
 {
 }
@@ -103,6 +105,79 @@ void VectorAnimationManager::UnregisterEventCallback( CallbackBase* callback )
   }
 }
 
+SharedVectorAnimationPtr VectorAnimationManager::RequestSharedAnimation( VisualFactoryCache& factoryCache, const std::string& key, const std::string& url,
+                                                                         const VectorAnimationTask::AnimationData& animationData, Shader shader )
+{
+  SharedVectorAnimationPtr& animation = mSharedAnimations[key];
+  if( animation && !animation->IsFinished() )
+  {
+    ++mSharedAnimationMetrics.hits;
+  }
+  else
+  {
+    // A finished animation is kept by its visuals until they stop, but the new requests play the animation again.
+    animation = new SharedVectorAnimation( factoryCache, key, url, animationData, shader );
+
+    ++mSharedAnimationMetrics.misses;
+    ++mSharedAnimationMetrics.animations;
+    mSharedAnimationMetrics.memory += animation->GetMemory();
+  }
+
+  animation->Reference();
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::General, "VectorAnimationManager::RequestSharedAnimation: %s hits:%d, misses:%d, animations:%d, memory:%zu\n",
+                 key.c_str(), mSharedAnimationMetrics.hits, mSharedAnimationMetrics.misses, mSharedAnimationMetrics.animations, mSharedAnimationMetrics.memory );
+
+  return animation;
+}
+
+void VectorAnimationManager::ReleaseSharedAnimation( SharedVectorAnimationPtr animation )
+{
+  if( animation && ( 0u == animation->Unreference() ) )
+  {
+    --mSharedAnimationMetrics.animations;
+    mSharedAnimationMetrics.memory -= animation->GetMemory();
+
+    SharedAnimationContainer::iterator iter = mSharedAnimations.find( animation->GetKey() );
+    if( ( iter != mSharedAnimations.end() ) && ( iter->second == animation ) )
+    {
+      mSharedAnimations.erase( iter );
+    }
+  }
+}
+
+const VectorAnimationManager::SharedAnimationMetrics& VectorAnimationManager::GetSharedAnimationMetrics() const
+{
+  return mSharedAnimationMetrics;
+}
+
+std::string VectorAnimationManager::GetSharedAnimationKey( const std::string& url, const VectorAnimationTask::AnimationData& animationData )
+{
+  std::string key( url );
+  key += '|' + std::to_string( animationData.width ) + 'x' + std::to_string( animationData.height );
+
+  key += '|';
+  for( Property::Array::SizeType index = 0; index < animationData.playRange.Count(); ++index )
+  {
+    int32_t frame;
+    std::string marker;
+    if( animationData.playRange.GetElementAt( index ).Get( frame ) )
+    {
+      key += std::to_string( frame );
+    }
+    else if( animationData.playRange.GetElementAt( index ).Get( marker ) )
+    {
+      key += marker;
+    }
+    key += ',';
+  }
+
+  key += '|' + std::to_string( animationData.loopCount ) + '|' + std::to_string( animationData.stopBehavior ) + '|' + std::to_string( animationData.loopingMode ) +
+         '|' + std::to_string( animationData.frameDropPolicy );
+
+  return key;
+}
+
 void VectorAnimationManager::Process()
 {
   for( auto&& iter : mEventCallbacks )
@@ -23,8 +23,11 @@
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/integration-api/processor-interface.h>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-vector-image/shared-vector-animation.h>
 
 namespace Dali
 {
@@ -36,6 +39,7 @@ namespace Internal
 {
 
 class VectorAnimationThread;
+class VisualFactoryCache;
 
 /**
  * @brief Vector animation manager
@@ -44,6 +48,24 @@ class VectorAnimationManager: public Integration::Processor
 {
 public:
 
+  /**
+   * @brief Metrics of the shared animations.
+   */
+  struct SharedAnimationMetrics
+  {
+    SharedAnimationMetrics()
+    : hits( 0u ),
+      misses( 0u ),
+      animations( 0u ),
+      memory( 0u )
+    {}
+
+    uint32_t hits;       ///< The number of requests which joined a playing animation.
+    uint32_t misses;     ///< The number of requests which started a new animation.
+    uint32_t animations; ///< The number of shared animations in use.
+    size_t   memory;     ///< The memory of the frames of the shared animations in use, in bytes.
+  };
+
   /**
    * @brief Constructor.
    */
@@ -75,6 +97,42 @@ public:
    */
   void UnregisterEventCallback( CallbackBase* callback );
 
+  /**
+   * @brief Retrieves the playing animation with the given key, or starts a new one, and adds a reference to it.
+   *
+   * @param[in] factoryCache A pointer pointing to the VisualFactoryCache object
+   * @param[in] key The key of the animation, @see GetSharedAnimationKey()
+   * @param[in] url The url of the vector animation file
+   * @param[in] animationData The size, play range, loop count, stop behavior and looping mode of the animation
+   * @param[in] shader The shader of the visual
+   * @return The shared animation
+   */
+  SharedVectorAnimationPtr RequestSharedAnimation( VisualFactoryCache& factoryCache, const std::string& key, const std::string& url,
+                                                   const VectorAnimationTask::AnimationData& animationData, Shader shader );
+
+  /**
+   * @brief Removes a reference of a shared animation. The animation is stopped once no visual shows it.
+   *
+   * @param[in] animation The shared animation
+   */
+  void ReleaseSharedAnimation( SharedVectorAnimationPtr animation );
+
+  /**
+   * @brief Retrieves the metrics of the shared animations.
+   *
+   * @return The metrics
+   */
+  const SharedAnimationMetrics& GetSharedAnimationMetrics() const;
+
+  /**
+   * @brief Builds the key of a shared animation.
+   *
+   * @param[in] url The url of the vector animation file
+   * @param[in] animationData The size, play range, loop count, stop behavior and looping mode of the animation
+   * @return The key
+   */
+  static std::string GetSharedAnimationKey( const std::string& url, const VectorAnimationTask::AnimationData& animationData );
+
 protected: // Implementation of Processor
 
   /**
@@ -92,8 +150,12 @@ private:
 
 private:
 
+  typedef std::unordered_map< std::string, SharedVectorAnimationPtr > SharedAnimationContainer;
+
   std::vector< CallbackBase* >             mEventCallbacks;
   std::unique_ptr< VectorAnimationThread > mVectorAnimationThread;
+  SharedAnimationContainer                 mSharedAnimations;       ///< The playing shared animations, by key
+  SharedAnimationMetrics                   mSharedAnimationMetrics;
   bool                                     mProcessorRegistered;
 };
 
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/math/math-utils.h>
@@ -59,6 +60,7 @@ VectorAnimationTask::VectorAnimationTask( VisualFactoryCache& factoryCache, cons
   mPlayState( PlayState::STOPPED ),
   mStopBehavior( DevelImageVisual::StopBehavior::CURRENT_FRAME ),
   mLoopingMode( DevelImageVisual::LoopingMode::RESTART ),
+  mFrameDropPolicy( DevelImageVisual::FrameDropPolicy::RENDER_ALL_FRAMES ),
   mNextFrameStartTime(),
   mFrameDurationNanoSeconds( 0 ),
   mFrameRate( 60.0f ),
@@ -69,6 +71,9 @@ VectorAnimationTask::VectorAnimationTask( VisualFactoryCache& factoryCache, cons
   mWidth( 0 ),
   mHeight( 0 ),
   mAnimationDataIndex( 0 ),
+  mFramesToSkip( 0 ),
+  mLateFrameCount( 0 ),
+  mDroppedFrameCount( 0 ),
   mLoopCount( LOOP_FOREVER ),
   mCurrentLoop( 0 ),
   mForward( true ),
@@ -337,6 +342,13 @@ void VectorAnimationTask::SetLoopingMode( DevelImageVisual::LoopingMode::Type lo
   DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::SetLoopingMode: looping mode = %d [%p]\n", mLoopingMode, this );
 }
 
+void VectorAnimationTask::SetFrameDropPolicy( DevelImageVisual::FrameDropPolicy::Type frameDropPolicy )
+{
+  mFrameDropPolicy = frameDropPolicy;
+
+  DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::SetFrameDropPolicy: frame drop policy = %d [%p]\n", mFrameDropPolicy, this );
+}
+
 void VectorAnimationTask::GetLayerInfo( Property::Map& map ) const
 {
   mVectorRenderer.GetLayerInfo( map );
@@ -384,9 +396,27 @@ bool VectorAnimationTask::Rasterize()
 
   if( mPlayState == PlayState::PLAYING && mUpdateFrameNumber )
   {
-    mCurrentFrame = mForward ? mCurrentFrame + 1 : mCurrentFrame - 1;
+    // Skip the frames whose time has passed, without going beyond the play range
+    uint32_t step = 1u + mFramesToSkip;
+    if( mForward )
+    {
+      step = std::min( step, std::max( mEndFrame, mCurrentFrame ) - mCurrentFrame );
+      mCurrentFrame += step;
+    }
+    else
+    {
+      step = std::min( step, mCurrentFrame - std::min( mStartFrame, mCurrentFrame ) );
+      mCurrentFrame -= step;
+    }
     Dali::ClampInPlace( mCurrentFrame, mStartFrame, mEndFrame );
+
+    if( step > 1u )
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      mDroppedFrameCount += step - 1u;
+    }
   }
+  mFramesToSkip = 0u;
 
   currentFrame = mCurrentFrame;
 
@@ -471,9 +501,10 @@ bool VectorAnimationTask::Rasterize()
       {
         mAnimationFinishedTrigger->Trigger();
       }
-    }
 
-    DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::Rasterize: Animation is finished [current = %d] [%p]\n", currentFrame, this );
+      DALI_LOG_INFO( gVectorAnimationLogFilter, Debug::Verbose, "VectorAnimationTask::Rasterize: Animation is finished [current = %d] [late = %d, dropped = %d] [%p]\n",
+                     currentFrame, mLateFrameCount, mDroppedFrameCount, this );
+    }
   }
 
   bool keepAnimation = true;
@@ -526,10 +557,26 @@ std::chrono::time_point< std::chrono::system_clock > VectorAnimationTask::Calcul
   mNextFrameStartTime =  std::chrono::time_point_cast< std::chrono::time_point< std::chrono::system_clock >::duration >(
       mNextFrameStartTime + std::chrono::nanoseconds( mFrameDurationNanoSeconds ) );
   auto current = std::chrono::system_clock::now();
-  if( renderNow || mNextFrameStartTime < current )
+  if( renderNow )
   {
     mNextFrameStartTime = current;
   }
+  else if( mNextFrameStartTime < current )
+  {
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      ++mLateFrameCount;
+    }
+
+    if( mFrameDropPolicy == DevelImageVisual::FrameDropPolicy::DROP_LATE_FRAMES && mFrameDurationNanoSeconds > 0 )
+    {
+      // Skip the frames whose time has passed, so the animation keeps its duration
+      int64_t lateNanoSeconds = std::chrono::duration_cast< std::chrono::nanoseconds >( current - mNextFrameStartTime ).count();
+      uint32_t missedFrames = static_cast< uint32_t >( lateNanoSeconds / mFrameDurationNanoSeconds );
+      mFramesToSkip = std::min( missedFrames, mTotalFrame );
+    }
+    mNextFrameStartTime = current;
+  }
   return mNextFrameStartTime;
 }
 
@@ -538,6 +585,13 @@ std::chrono::time_point< std::chrono::system_clock > VectorAnimationTask::GetNex
   return mNextFrameStartTime;
 }
 
+void VectorAnimationTask::GetFrameStatistics( uint32_t& lateFrames, uint32_t& droppedFrames )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  lateFrames = mLateFrameCount;
+  droppedFrames = mDroppedFrameCount;
+}
+
 void VectorAnimationTask::ApplyAnimationData()
 {
   uint32_t index;
@@ -577,6 +631,11 @@ void VectorAnimationTask::ApplyAnimationData()
     SetLoopingMode( mAnimationData[index].loopingMode );
   }
 
+  if( mAnimationData[index].resendFlag & VectorAnimationTask::RESEND_FRAME_DROP_POLICY )
+  {
+    SetFrameDropPolicy( mAnimationData[index].frameDropPolicy );
+  }
+
   if( mAnimationData[index].resendFlag & VectorAnimationTask::RESEND_CURRENT_FRAME )
   {
     SetCurrentFrameNumber( mAnimationData[index].currentFrame );
@@ -62,7 +62,8 @@ public:
     RESEND_LOOPING_MODE  = 1 << 3,
     RESEND_CURRENT_FRAME = 1 << 4,
     RESEND_SIZE          = 1 << 5,
-    RESEND_PLAY_STATE    = 1 << 6
+    RESEND_PLAY_STATE    = 1 << 6,
+    RESEND_FRAME_DROP_POLICY = 1 << 7
   };
 
   /**
@@ -76,6 +77,7 @@ public:
       playState(),
       stopBehavior( DevelImageVisual::StopBehavior::CURRENT_FRAME ),
       loopingMode( DevelImageVisual::LoopingMode::RESTART ),
+      frameDropPolicy( DevelImageVisual::FrameDropPolicy::RENDER_ALL_FRAMES ),
       currentFrame( 0 ),
       width( 0 ),
       height( 0 ),
@@ -90,6 +92,7 @@ public:
       playState = rhs.playState;
       stopBehavior = rhs.stopBehavior;
       loopingMode = rhs.loopingMode;
+      frameDropPolicy = rhs.frameDropPolicy;
       currentFrame = rhs.currentFrame;
       width = rhs.width;
       height = rhs.height;
@@ -102,6 +105,7 @@ public:
     DevelImageVisual::PlayState::Type    playState;
     DevelImageVisual::StopBehavior::Type stopBehavior;
     DevelImageVisual::LoopingMode::Type  loopingMode;
+    DevelImageVisual::FrameDropPolicy::Type frameDropPolicy;
     uint32_t                             currentFrame;
     uint32_t                             width;
     uint32_t                             height;
@@ -200,6 +204,13 @@ public:
    */
   std::chrono::time_point< std::chrono::system_clock > GetNextFrameTime();
 
+  /**
+   * @brief Retrieves the statistics of the frames rasterized after their time.
+   * @param[out] lateFrames The number of frames which were rasterized late
+   * @param[out] droppedFrames The number of frames which were skipped to catch up
+   */
+  void GetFrameStatistics( uint32_t& lateFrames, uint32_t& droppedFrames );
+
 private:
 
   /**
@@ -262,6 +273,12 @@ private:
    */
   void SetLoopingMode( DevelImageVisual::LoopingMode::Type loopingMode );
 
+  /**
+   * @brief Sets what to do when the rasterization is late.
+   * @param[in] frameDropPolicy The frame drop policy
+   */
+  void SetFrameDropPolicy( DevelImageVisual::FrameDropPolicy::Type frameDropPolicy );
+
   /**
    * @brief Gets the frame number when the animation is stopped according to the stop behavior.
    */
@@ -297,6 +314,7 @@ private:
   PlayState                              mPlayState;
   DevelImageVisual::StopBehavior::Type   mStopBehavior;
   DevelImageVisual::LoopingMode::Type    mLoopingMode;
+  DevelImageVisual::FrameDropPolicy::Type mFrameDropPolicy;
   std::chrono::time_point< std::chrono::system_clock > mNextFrameStartTime;
   int64_t                                mFrameDurationNanoSeconds;
   float                                  mFrameRate;
@@ -307,6 +325,9 @@ private:
   uint32_t                               mWidth;
   uint32_t                               mHeight;
   uint32_t                               mAnimationDataIndex;
+  uint32_t                               mFramesToSkip;       ///< The number of frames to skip in the next rasterization
+  uint32_t                               mLateFrameCount;     ///< The number of frames rasterized late, guarded by mConditionalWait
+  uint32_t                               mDroppedFrameCount;  ///< The number of frames skipped, guarded by mConditionalWait
   int32_t                                mLoopCount;
   int32_t                                mCurrentLoop;
   bool                                   mForward;
@@ -60,13 +60,20 @@ VectorAnimationThread::VectorAnimationThread()
 : mAnimationTasks(),
   mCompletedTasks(),
   mWorkingTasks(),
-  mRasterizers( GetNumberOfThreads( NUMBER_OF_RASTERIZE_THREADS_ENV, DEFAULT_NUMBER_OF_RASTERIZE_THREADS ), [&]() { return RasterizeHelper( *this ); } ),
+  mRasterizers(),
   mSleepThread( MakeCallback( this, &VectorAnimationThread::OnAwakeFromSleep ) ),
   mConditionalWait(),
   mNeedToSleep( false ),
   mDestroyThread( false ),
   mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
 {
+  const size_t numberOfThreads = GetNumberOfThreads( NUMBER_OF_RASTERIZE_THREADS_ENV, DEFAULT_NUMBER_OF_RASTERIZE_THREADS );
+  mRasterizers.reserve( numberOfThreads );
+  for( size_t i = 0; i < numberOfThreads; ++i )
+  {
+    mRasterizers.push_back( RasterizeHelper( *this ) );
+  }
+
   mSleepThread.Start();
 }
 
@@ -93,22 +100,7 @@ void VectorAnimationThread::AddTask( VectorAnimationTaskPtr task )
   {
     auto currentTime = task->CalculateNextFrameTime( true );  // Rasterize as soon as possible
 
-    bool inserted = false;
-    for( auto iter = mAnimationTasks.begin(); iter != mAnimationTasks.end(); ++iter )
-    {
-      auto nextTime = (*iter)->GetNextFrameTime();
-      if( nextTime > currentTime )
-      {
-        mAnimationTasks.insert( iter, task );
-        inserted = true;
-        break;
-      }
-    }
-
-    if( !inserted )
-    {
-      mAnimationTasks.push_back( task );
-    }
+    InsertAnimationTask( task, currentTime );
 
     mNeedToSleep = false;
     // wake up the animation thread
@@ -163,6 +155,24 @@ void VectorAnimationThread::OnAwakeFromSleep()
   }
 }
 
+VectorAnimationTaskPtr VectorAnimationThread::OnStealTask()
+{
+  // Called from the rasterize threads, the rasterizers are not changed after the construction.
+  auto busiest = mRasterizers.end();
+  uint32_t maximumLoad = 1u;  // A rasterizer with one task is rasterizing it
+  for( auto iter = mRasterizers.begin(); iter != mRasterizers.end(); ++iter )
+  {
+    uint32_t load = iter->GetLoad();
+    if( load > maximumLoad )
+    {
+      maximumLoad = load;
+      busiest = iter;
+    }
+  }
+
+  return ( busiest != mRasterizers.end() ) ? busiest->StealTask() : VectorAnimationTaskPtr();
+}
+
 void VectorAnimationThread::Run()
 {
   SetThreadName( "VectorAnimationThread" );
@@ -195,22 +205,7 @@ void VectorAnimationThread::Rasterize()
       // Should use the frame rate of the animation file
       auto nextFrameTime = task->CalculateNextFrameTime( false );
 
-      bool inserted = false;
-      for( auto iter = mAnimationTasks.begin(); iter != mAnimationTasks.end(); ++iter )
-      {
-        auto time = (*iter)->GetNextFrameTime();
-        if( time > nextFrameTime )
-        {
-          mAnimationTasks.insert( iter, task );
-          inserted = true;
-          break;
-        }
-      }
-
-      if( !inserted )
-      {
-        mAnimationTasks.push_back( task );
-      }
+      InsertAnimationTask( task, nextFrameTime );
     }
   }
   mCompletedTasks.clear();
@@ -239,8 +234,19 @@ void VectorAnimationThread::Rasterize()
         // Add it to the working list
         mWorkingTasks.push_back( nextTask );
 
-        auto rasterizerHelperIt = mRasterizers.GetNext();
-        DALI_ASSERT_ALWAYS( rasterizerHelperIt != mRasterizers.End() );
+        // Give the task to the least busy rasterizer
+        DALI_ASSERT_ALWAYS( !mRasterizers.empty() );
+        auto rasterizerHelperIt = mRasterizers.begin();
+        uint32_t minimumLoad = rasterizerHelperIt->GetLoad();
+        for( auto iter = rasterizerHelperIt + 1; ( iter != mRasterizers.end() ) && ( minimumLoad > 0u ); ++iter )
+        {
+          uint32_t load = iter->GetLoad();
+          if( load < minimumLoad )
+          {
+            minimumLoad = load;
+            rasterizerHelperIt = iter;
+          }
+        }
 
         rasterizerHelperIt->Rasterize( nextTask );
       }
@@ -257,6 +263,26 @@ void VectorAnimationThread::Rasterize()
   }
 }
 
+void VectorAnimationThread::InsertAnimationTask( VectorAnimationTaskPtr task, std::chrono::time_point< std::chrono::system_clock > nextFrameTime )
+{
+  bool inserted = false;
+  for( auto iter = mAnimationTasks.begin(); iter != mAnimationTasks.end(); ++iter )
+  {
+    auto time = (*iter)->GetNextFrameTime();
+    if( time > nextFrameTime )
+    {
+      mAnimationTasks.insert( iter, task );
+      inserted = true;
+      break;
+    }
+  }
+
+  if( !inserted )
+  {
+    mAnimationTasks.push_back( task );
+  }
+}
+
 VectorAnimationThread::RasterizeHelper::RasterizeHelper( VectorAnimationThread& animationThread )
 : RasterizeHelper( std::unique_ptr< VectorRasterizeThread >( new VectorRasterizeThread() ), animationThread )
 {
@@ -272,6 +298,7 @@ VectorAnimationThread::RasterizeHelper::RasterizeHelper( std::unique_ptr< Vector
   mAnimationThread( animationThread )
 {
   mRasterizer->SetCompletedCallback( MakeCallback( &mAnimationThread, &VectorAnimationThread::OnTaskCompleted ) );
+  mRasterizer->SetStealCallback( MakeCallback( &mAnimationThread, &VectorAnimationThread::OnStealTask ) );
 }
 
 void VectorAnimationThread::RasterizeHelper::Rasterize( VectorAnimationTaskPtr task )
@@ -282,6 +309,16 @@ void VectorAnimationThread::RasterizeHelper::Rasterize( VectorAnimationTaskPtr t
   }
 }
 
+uint32_t VectorAnimationThread::RasterizeHelper::GetLoad() const
+{
+  return mRasterizer->GetLoad();
+}
+
+VectorAnimationTaskPtr VectorAnimationThread::RasterizeHelper::StealTask()
+{
+  return mRasterizer->StealTask();
+}
+
 VectorAnimationThread::SleepThread::SleepThread( CallbackBase* callback )
 : mConditionalWait(),
   mAwakeCallback( std::unique_ptr< CallbackBase >( callback ) ),
@@ -19,13 +19,13 @@
 
 // EXTERNAL INCLUDES
 #include <memory>
+#include <vector>
 #include <dali/public-api/signals/connection-tracker.h>
 #include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/thread.h>
 #include <dali/integration-api/adaptor-framework/log-factory-interface.h>
 
 // INTERNAL INCLUDES
-#include <dali-toolkit/internal/helpers/round-robin-container-view.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-task.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-rasterize-thread.h>
 
@@ -73,6 +73,12 @@ public:
    */
   void OnAwakeFromSleep();
 
+  /**
+   * @brief Called from a rasterize thread which has no task, to take a task waiting in the busiest rasterize thread.
+   * @return The task or an empty handle if no task waits
+   */
+  VectorAnimationTaskPtr OnStealTask();
+
 protected:
 
   /**
@@ -87,6 +93,14 @@ private:
    */
   void Rasterize();
 
+  /**
+   * Inserts a task in the list of the animation tasks, sorted by their next frame time.
+   *
+   * @param[in] task The task to insert.
+   * @param[in] nextFrameTime The next frame time of the task.
+   */
+  void InsertAnimationTask( VectorAnimationTaskPtr task, std::chrono::time_point< std::chrono::system_clock > nextFrameTime );
+
 private:
 
   /**
@@ -109,6 +123,20 @@ private:
      */
     void Rasterize( VectorAnimationTaskPtr task );
 
+    /**
+     * @brief Retrieves the number of the tasks waiting or being rasterized by the rasterize thread.
+     *
+     * @return The number of tasks
+     */
+    uint32_t GetLoad() const;
+
+    /**
+     * @brief Removes a task waiting in the rasterize thread.
+     *
+     * @return The task or an empty handle if no task waits
+     */
+    VectorAnimationTaskPtr StealTask();
+
   public:
     RasterizeHelper( const RasterizeHelper& ) = delete;
     RasterizeHelper& operator=( const RasterizeHelper& ) = delete;
@@ -184,7 +212,7 @@ private:
   std::vector< VectorAnimationTaskPtr >      mAnimationTasks;
   std::vector< VectorAnimationTaskPtr >      mCompletedTasks;
   std::vector< VectorAnimationTaskPtr >      mWorkingTasks;
-  RoundRobinContainerView< RasterizeHelper > mRasterizers;
+  std::vector< RasterizeHelper >             mRasterizers;
   SleepThread                                mSleepThread;
   ConditionalWait                            mConditionalWait;
   bool                                       mNeedToSleep;
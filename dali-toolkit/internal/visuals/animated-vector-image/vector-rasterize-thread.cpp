@@ -47,7 +47,9 @@ VectorRasterizeThread::VectorRasterizeThread()
 : mRasterizeTasks(),
   mConditionalWait(),
   mCompletedCallback(),
+  mStealCallback(),
   mDestroyThread( false ),
+  mIsRasterizing( false ),
   mIsThreadStarted( false ),
   mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
 {
@@ -74,6 +76,13 @@ void VectorRasterizeThread::SetCompletedCallback( CallbackBase* callback )
   mCompletedCallback = std::unique_ptr< CallbackBase >( callback );
 }
 
+void VectorRasterizeThread::SetStealCallback( CallbackBase* callback )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  mStealCallback = std::unique_ptr< CallbackBase >( callback );
+}
+
 void VectorRasterizeThread::AddTask( VectorAnimationTaskPtr task )
 {
   // Lock while adding task to the queue
@@ -94,6 +103,27 @@ void VectorRasterizeThread::AddTask( VectorAnimationTaskPtr task )
   }
 }
 
+VectorAnimationTaskPtr VectorRasterizeThread::StealTask()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  VectorAnimationTaskPtr task;
+  if( !mRasterizeTasks.empty() )
+  {
+    // The first task is the next one to rasterize here, take the one which would wait the longest.
+    task = mRasterizeTasks.back();
+    mRasterizeTasks.pop_back();
+  }
+  return task;
+}
+
+uint32_t VectorRasterizeThread::GetLoad()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  return static_cast< uint32_t >( mRasterizeTasks.size() ) + ( mIsRasterizing ? 1u : 0u );
+}
+
 void VectorRasterizeThread::Run()
 {
   SetThreadName( "VectorRasterizeThread" );
@@ -112,29 +142,49 @@ void VectorRasterizeThread::Rasterize()
     // Lock while popping task out from the queue
     ConditionalWait::ScopedLock lock( mConditionalWait );
 
-    // conditional wait
-    if( mRasterizeTasks.empty() )
-    {
-      mConditionalWait.Wait( lock );
-    }
-
     // pop out the next task from the queue
     if( !mRasterizeTasks.empty() )
     {
       std::vector< VectorAnimationTaskPtr >::iterator next = mRasterizeTasks.begin();
       nextTask = *next;
       mRasterizeTasks.erase( next );
+      mIsRasterizing = true;
+    }
+  }
+
+  if( !nextTask && mStealCallback )
+  {
+    // Help the busy rasterize threads. The lock isn't held, as the other thread's lock is taken.
+    nextTask = CallbackBase::ExecuteReturn< VectorAnimationTaskPtr >( *mStealCallback );
+    if( nextTask )
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      mIsRasterizing = true;
     }
   }
 
-  if( nextTask )
+  if( !nextTask )
   {
-    bool keepAnimation = nextTask->Rasterize();
+    ConditionalWait::ScopedLock lock( mConditionalWait );
 
-    if( mCompletedCallback )
+    // conditional wait
+    if( mRasterizeTasks.empty() && !mDestroyThread )
     {
-      CallbackBase::Execute( *mCompletedCallback, nextTask, keepAnimation );
+      mConditionalWait.Wait( lock );
     }
+    return;
+  }
+
+  bool keepAnimation = nextTask->Rasterize();
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mIsRasterizing = false;
+  }
+
+  if( mCompletedCallback )
+  {
+    CallbackBase::Execute( *mCompletedCallback, nextTask, keepAnimation );
   }
 }
 
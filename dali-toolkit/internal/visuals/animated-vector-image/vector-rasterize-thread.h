@@ -59,6 +59,12 @@ public:
    */
   void SetCompletedCallback( CallbackBase* callback );
 
+  /**
+   * The callback is called from the rasterize thread when it has no task to rasterize, to take a task queued in another rasterize thread.
+   * @param[in] callBack The function to call. It returns the task or an empty handle.
+   */
+  void SetStealCallback( CallbackBase* callback );
+
   /**
    * Add a task to rasterize.
    *
@@ -66,6 +72,20 @@ public:
    */
   void AddTask( VectorAnimationTaskPtr task );
 
+  /**
+   * Removes the most recently queued task, to be rasterized by another rasterize thread.
+   *
+   * @return The task or an empty handle if no task waits
+   */
+  VectorAnimationTaskPtr StealTask();
+
+  /**
+   * Retrieves the number of the tasks waiting or being rasterized.
+   *
+   * @return The number of tasks
+   */
+  uint32_t GetLoad();
+
 protected:
 
   /**
@@ -94,7 +114,9 @@ private:
   std::vector< VectorAnimationTaskPtr > mRasterizeTasks;
   ConditionalWait                       mConditionalWait;
   std::unique_ptr< CallbackBase >       mCompletedCallback;
+  std::unique_ptr< CallbackBase >       mStealCallback;
   bool                                  mDestroyThread;  ///< Whether the thread be destroyed
+  bool                                  mIsRasterizing;  ///< Whether a task is being rasterized
   bool                                  mIsThreadStarted;
   const Dali::LogFactoryInterface&      mLogFactory; ///< The log factory
 
@@ -28,6 +28,7 @@
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -153,6 +154,12 @@ ArcVisualPtr ArcVisual::New( VisualFactoryCache& factoryCache, const Property::M
   return arcVisualPtr;
 }
 
+void ArcVisual::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "ArcVisual", VERTEX_SHADER, FRAGMENT_SHADER_BUTT_CAP );
+  registry.AddVariant( "ArcVisual", VERTEX_SHADER, FRAGMENT_SHADER_ROUND_CAP );
+}
+
 ArcVisual::ArcVisual( VisualFactoryCache& factoryCache )
 : Visual::Base( factoryCache, Visual::FittingMode::FILL, static_cast<Toolkit::Visual::Type>( Toolkit::DevelVisual::ARC ) ),
   mThickness( 0.0f ),
@@ -296,7 +303,7 @@ void ArcVisual::InitializeRenderer()
     shader = mFactoryCache.GetShader( VisualFactoryCache::ARC_BUTT_CAP_SHADER );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_BUTT_CAP );
+      shader = ShaderRegistry::Get().GetShader( "ArcVisual", VERTEX_SHADER, FRAGMENT_SHADER_BUTT_CAP );
       mFactoryCache.SaveShader( VisualFactoryCache::ARC_BUTT_CAP_SHADER, shader );
     }
   }
@@ -305,7 +312,7 @@ void ArcVisual::InitializeRenderer()
     shader = mFactoryCache.GetShader( VisualFactoryCache::ARC_ROUND_CAP_SHADER );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_ROUND_CAP );
+      shader = ShaderRegistry::Get().GetShader( "ArcVisual", VERTEX_SHADER, FRAGMENT_SHADER_ROUND_CAP );
       mFactoryCache.SaveShader( VisualFactoryCache::ARC_ROUND_CAP_SHADER, shader );
     }
   }
@@ -34,6 +34,7 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
 class ArcVisual;
 typedef IntrusivePtr< ArcVisual > ArcVisualPtr;
 
@@ -62,6 +63,13 @@ public:
    */
   static ArcVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 public:  // from Visual
 
   /**
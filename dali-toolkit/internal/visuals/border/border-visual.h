@@ -34,6 +34,7 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
 class BorderVisual;
 typedef IntrusivePtr< BorderVisual > BorderVisualPtr;
 
@@ -61,6 +62,13 @@ public:
    */
   static BorderVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 protected:
 
   /**
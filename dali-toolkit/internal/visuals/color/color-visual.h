@@ -33,6 +33,7 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
 class ColorVisual;
 typedef IntrusivePtr< ColorVisual > ColorVisualPtr;
 
@@ -58,6 +59,13 @@ public:
    */
   static ColorVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 public:  // from Visual
 
   /**
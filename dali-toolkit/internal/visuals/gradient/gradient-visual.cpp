@@ -35,6 +35,7 @@
 #include <dali-toolkit/internal/visuals/gradient/linear-gradient.h>
 #include <dali-toolkit/internal/visuals/gradient/radial-gradient.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -327,6 +328,20 @@ GradientVisualPtr GradientVisual::New( VisualFactoryCache& factoryCache, const P
   return gradientVisualPtr;
 }
 
+void GradientVisual::AddShaderVariants( ShaderRegistry& registry )
+{
+  for( int roundedCorner = 0; roundedCorner < 2; ++roundedCorner )
+  {
+    for( int gradientUnits = 0; gradientUnits < 2; ++gradientUnits )
+    {
+      for( int gradientType = 0; gradientType < 2; ++gradientType )
+      {
+        registry.AddVariant( "GradientVisual", VERTEX_SHADER[ gradientUnits + roundedCorner * 2 ], FRAGMENT_SHADER[ gradientType + roundedCorner * 2 ] );
+      }
+    }
+  }
+}
+
 GradientVisual::GradientVisual( VisualFactoryCache& factoryCache )
 : Visual::Base( factoryCache, Visual::FittingMode::FILL, Toolkit::Visual::GRADIENT ),
   mGradientType( LINEAR ),
@@ -442,7 +457,7 @@ void GradientVisual::InitializeRenderer()
   Shader shader = mFactoryCache.GetShader( shaderType );
   if( !shader )
   {
-    shader = Shader::New( VERTEX_SHADER[gradientUnits + roundedCorner * 2], FRAGMENT_SHADER[ mGradientType + roundedCorner * 2 ] );
+    shader = ShaderRegistry::Get().GetShader( "GradientVisual", VERTEX_SHADER[gradientUnits + roundedCorner * 2], FRAGMENT_SHADER[ mGradientType + roundedCorner * 2 ] );
     mFactoryCache.SaveShader( shaderType, shader );
   }
 
@@ -36,6 +36,7 @@ namespace Internal
 {
 
 class Gradient;
+class ShaderRegistry;
 class GradientVisual;
 typedef IntrusivePtr< GradientVisual > GradientVisualPtr;
 
@@ -93,6 +94,13 @@ public:
    */
   static GradientVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 public:  // from Visual
 
   /**
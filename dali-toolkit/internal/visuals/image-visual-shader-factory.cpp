@@ -21,6 +21,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -201,7 +202,7 @@ Shader ImageVisualShaderFactory::GetShader( VisualFactoryCache& factoryCache, bo
       shader = factoryCache.GetShader( VisualFactoryCache::IMAGE_SHADER_ATLAS_DEFAULT_WRAP );
       if( !shader )
       {
-        shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_CLAMP );
+        shader = ShaderRegistry::Get().GetShader( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_CLAMP );
         shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
         factoryCache.SaveShader( VisualFactoryCache::IMAGE_SHADER_ATLAS_DEFAULT_WRAP, shader );
       }
@@ -211,7 +212,7 @@ Shader ImageVisualShaderFactory::GetShader( VisualFactoryCache& factoryCache, bo
       shader = factoryCache.GetShader( VisualFactoryCache::IMAGE_SHADER_ATLAS_CUSTOM_WRAP );
       if( !shader )
       {
-        shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_VARIOUS_WRAP );
+        shader = ShaderRegistry::Get().GetShader( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_VARIOUS_WRAP );
         shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
         factoryCache.SaveShader( VisualFactoryCache::IMAGE_SHADER_ATLAS_CUSTOM_WRAP, shader );
       }
@@ -224,7 +225,7 @@ Shader ImageVisualShaderFactory::GetShader( VisualFactoryCache& factoryCache, bo
       shader = factoryCache.GetShader( VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER );
       if( !shader )
       {
-        shader = Shader::New( VERTEX_SHADER_ROUNDED_CORNER, FRAGMENT_SHADER_ROUNDED_CORNER );
+        shader = ShaderRegistry::Get().GetShader( "ImageVisual", VERTEX_SHADER_ROUNDED_CORNER, FRAGMENT_SHADER_ROUNDED_CORNER );
         shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
         factoryCache.SaveShader( VisualFactoryCache::IMAGE_SHADER_ROUNDED_CORNER, shader );
       }
@@ -234,7 +235,7 @@ Shader ImageVisualShaderFactory::GetShader( VisualFactoryCache& factoryCache, bo
       shader = factoryCache.GetShader( VisualFactoryCache::IMAGE_SHADER );
       if( !shader )
       {
-        shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_NO_ATLAS );
+        shader = ShaderRegistry::Get().GetShader( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_NO_ATLAS );
         shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
         factoryCache.SaveShader( VisualFactoryCache::IMAGE_SHADER, shader );
       }
@@ -254,6 +255,14 @@ const char* ImageVisualShaderFactory::GetFragmentShaderSource()
   return FRAGMENT_SHADER_NO_ATLAS;
 }
 
+void ImageVisualShaderFactory::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_NO_ATLAS );
+  registry.AddVariant( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_CLAMP );
+  registry.AddVariant( "ImageVisual", VERTEX_SHADER, FRAGMENT_SHADER_ATLAS_VARIOUS_WRAP );
+  registry.AddVariant( "ImageVisual", VERTEX_SHADER_ROUNDED_CORNER, FRAGMENT_SHADER_ROUNDED_CORNER );
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
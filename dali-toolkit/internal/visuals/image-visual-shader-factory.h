@@ -31,6 +31,8 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
+
 /**
  * ImageVisualShaderFactory is an object that provides and shares shaders between image visuals
  */
@@ -71,6 +73,12 @@ public:
    */
   const char* GetFragmentShaderSource();
 
+  /**
+   * Record the standard image rendering shaders, so they may be warmed up before their first use.
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
 protected:
 
   /**
@@ -33,6 +33,8 @@
 #include <dali-toolkit/public-api/visuals/image-visual-properties.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-actions-devel.h>
+#include <dali-toolkit/internal/visuals/opacity-map.h>
+#include <dali-toolkit/internal/visuals/rendering-addon.h>
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
@@ -42,6 +44,7 @@
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -514,6 +517,8 @@ void ImageVisual::CreateRenderer( TextureSet& textureSet )
 {
   Geometry geometry;
   Shader shader;
+  uint32_t firstElementCount {0u};
+  uint32_t secondElementCount {0u};
 
   // Get the geometry
   if( mImpl->mCustomShader )
@@ -522,11 +527,11 @@ void ImageVisual::CreateRenderer( TextureSet& textureSet )
   }
   else // Get any geometry associated with the texture
   {
-    TextureManager& textureManager = mFactoryCache.GetTextureManager();
-
-    uint32_t firstElementCount {0u};
-    uint32_t secondElementCount {0u};
-    geometry = textureManager.GetRenderGeometry(mTextureId, firstElementCount, secondElementCount);
+    if( UsesRenderGeometry() )
+    {
+      TextureManager& textureManager = mFactoryCache.GetTextureManager();
+      geometry = textureManager.GetRenderGeometry(mTextureId, firstElementCount, secondElementCount);
+    }
 
     if(!firstElementCount && !secondElementCount) // Otherwise use quad
     {
@@ -577,11 +582,11 @@ void ImageVisual::CreateRenderer( TextureSet& textureSet )
   }
   else if(mImpl->mCustomShader)
   {
-    shader = Shader::New(vertexShader, fragmentShader, mImpl->mCustomShader->mHints);
+    shader = ShaderRegistry::Get().NewShader("ImageVisual", vertexShader, fragmentShader, mImpl->mCustomShader->mHints);
   }
   else
   {
-    shader = Shader::New(vertexShader, fragmentShader);
+    shader = ShaderRegistry::Get().GetGeneratedShader("ImageVisual", vertexShader, fragmentShader);
   }
 
   if(usesWholeTexture)
@@ -596,6 +601,7 @@ void ImageVisual::CreateRenderer( TextureSet& textureSet )
 
   // Create the renderer
   mImpl->mRenderer = Renderer::New( geometry, shader );
+  OpacityMap::AddDrawCommands( mImpl->mRenderer, firstElementCount, secondElementCount, RenderingAddOn::Get().IsValid() );
 
   if( textureSet )
   {
@@ -610,6 +616,13 @@ void ImageVisual::CreateRenderer( TextureSet& textureSet )
 }
 
 
+bool ImageVisual::UsesRenderGeometry() const
+{
+  // The regions are found in the whole texture, and drawing them without blending would hide the rounded corners.
+  return !mImpl->mCustomShader && mPixelArea == FULL_TEXTURE_RECT && !IsRoundedCornerRequired() &&
+         !( mImpl->mFlags & Impl::IS_ATLASING_APPLIED );
+}
+
 void ImageVisual::LoadTexture( bool& atlasing, Vector4& atlasRect, TextureSet& textures, bool orientationCorrection,
                                TextureManager::ReloadPolicy forceReload )
 {
@@ -905,28 +918,16 @@ void ImageVisual::UploadComplete( bool loadingSuccess, int32_t textureId, Textur
   {
     uint32_t firstElementCount{0u};
     uint32_t secondElementCount{0u};
-    auto geometry = mFactoryCache.GetTextureManager().GetRenderGeometry(mTextureId, firstElementCount, secondElementCount);
-    if (mImpl->mRenderer && geometry)
+    Geometry geometry;
+    if( UsesRenderGeometry() )
+    {
+      geometry = mFactoryCache.GetTextureManager().GetRenderGeometry(mTextureId, firstElementCount, secondElementCount);
+    }
+    // The renderer may already draw the geometry if it was created after the upload.
+    if (mImpl->mRenderer && geometry && mImpl->mRenderer.GetGeometry() != geometry)
     {
       mImpl->mRenderer.SetGeometry(geometry);
-      Dali::DevelRenderer::DrawCommand drawCommand{};
-      drawCommand.drawType = DevelRenderer::DrawType::INDEXED;
-
-      if (firstElementCount)
-      {
-        drawCommand.firstIndex = 0;
-        drawCommand.elementCount = firstElementCount;
-        drawCommand.queue = DevelRenderer::RENDER_QUEUE_OPAQUE;
-        DevelRenderer::AddDrawCommand(mImpl->mRenderer, drawCommand);
-      }
-
-      if (secondElementCount)
-      {
-        drawCommand.firstIndex = firstElementCount;
-        drawCommand.elementCount = secondElementCount;
-        drawCommand.queue = DevelRenderer::RENDER_QUEUE_TRANSPARENT;
-        DevelRenderer::AddDrawCommand(mImpl->mRenderer, drawCommand);
-      }
+      OpacityMap::AddDrawCommands( mImpl->mRenderer, firstElementCount, secondElementCount, RenderingAddOn::Get().IsValid() );
     }
   }
 
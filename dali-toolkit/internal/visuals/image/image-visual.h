@@ -290,6 +290,12 @@ private:
    */
   void CreateRenderer( TextureSet& textures );
 
+  /**
+   * @brief Checks whether the visual can use the geometry which splits the texture in opaque and translucent regions
+   * @return True if the render geometry of the texture can be used
+   */
+  bool UsesRenderGeometry() const;
+
   /**
    * Creates the texture set and adds the texture to it
    * @param[out] textureRect The texture area of the texture in the atlas.
@@ -24,6 +24,7 @@
 // EXTERNAL HEADERS
 #include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
 
 namespace Dali
 {
@@ -34,9 +35,38 @@ namespace Toolkit
 namespace Internal
 {
 
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gNPatchLoaderLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_NPATCH_LOADER" );
+#endif
+
+const size_t DEFAULT_MEMORY_BUDGET = 2u * 1024u * 1024u; ///< The default memory of the unused n-patches kept in the cache, in bytes.
+
+} // unnamed namespace
+
 namespace NPatchBuffer
 {
 
+/**
+ * @brief Retrieves the start of the fixed and stretched cells of the n-patch along one axis.
+ *
+ * @param[in] stretchPixels The stretched ranges.
+ * @return The start of each cell in pixels.
+ */
+Dali::Vector< uint32_t > GetCellStarts( const NPatchUtility::StretchRanges& stretchPixels )
+{
+  Dali::Vector< uint32_t > cellStarts;
+  cellStarts.PushBack( 0u );
+  for( auto&& range : stretchPixels )
+  {
+    cellStarts.PushBack( range.GetX() );
+    cellStarts.PushBack( range.GetY() );
+  }
+  return cellStarts;
+}
+
 void SetLoadedNPatchData( NPatchLoader::Data* data, Devel::PixelBuffer& pixelBuffer )
 {
   if( data->border == Rect< int >( 0, 0, 0, 0 ) )
@@ -56,7 +86,14 @@ void SetLoadedNPatchData( NPatchLoader::Data* data, Devel::PixelBuffer& pixelBuf
   data->croppedHeight = pixelBuffer.GetHeight();
 
   // Create opacity map
-  data->renderingMap = RenderingAddOn::Get().IsValid() ? RenderingAddOn::Get().BuildNPatch(pixelBuffer, data ) : nullptr;
+  if( RenderingAddOn::Get().IsValid() )
+  {
+    data->renderingMap = RenderingAddOn::Get().BuildNPatch( pixelBuffer, data );
+  }
+  else
+  {
+    data->opacityMap = OpacityMap::New( pixelBuffer, GetCellStarts( data->stretchPixelsX ), GetCellStarts( data->stretchPixelsY ) );
+  }
 
   PixelData pixels = Devel::PixelBuffer::Convert( pixelBuffer ); // takes ownership of buffer
 
@@ -81,6 +118,12 @@ NPatchLoader::Data::~Data()
 }
 
 NPatchLoader::NPatchLoader()
+: mEntries(),
+  mUrlIds(),
+  mUnusedIds(),
+  mNextId( UNINITIALIZED_ID + 1u ),
+  mMemoryBudget( DEFAULT_MEMORY_BUDGET ),
+  mMetrics()
 {
 }
 
@@ -90,75 +133,79 @@ NPatchLoader::~NPatchLoader()
 
 std::size_t NPatchLoader::Load( TextureManager& textureManager, TextureUploadObserver* textureObserver, const std::string& url, const Rect< int >& border, bool& preMultiplyOnLoad, bool synchronousLoading )
 {
-  std::size_t hash = CalculateHash( url );
-  OwnerContainer< Data* >::SizeType index = UNINITIALIZED_ID;
-  const OwnerContainer< Data* >::SizeType count = mCache.Count();
-  int cachedIndex = -1;
-  Data* data;
+  Entry* entry = nullptr;
+  Entry* loadedEntry = nullptr;
+  std::size_t id = UNINITIALIZED_ID;
 
-  for( ; index < count; ++index )
+  auto range = mUrlIds.equal_range( url );
+  for( auto it = range.first; it != range.second; ++it )
   {
-    if( mCache[ index ]->hash == hash )
+    Entry& urlEntry = mEntries[ it->second ];
+    if( urlEntry.data->border == border )
     {
-      // hash match, check url as well in case of hash collision
-      if( mCache[ index ]->url == url )
-      {
-        // Use cached data
-        if( mCache[ index ]->border == border )
-        {
-          if( mCache[ index ]->loadCompleted )
-          {
-            return index + 1u; // valid indices are from 1 onwards
-          }
-          data = mCache[ index ];
-          cachedIndex = index + 1u; // valid indices are from 1 onwards
-          break;
-        }
-        else
-        {
-          if( mCache[ index ]->loadCompleted )
-          {
-            // Same url but border is different - use the existing texture
-            Data* data = new Data();
-            data->hash = hash;
-            data->url = url;
-            data->croppedWidth = mCache[ index ]->croppedWidth;
-            data->croppedHeight = mCache[ index ]->croppedHeight;
-
-            data->textureSet = mCache[ index ]->textureSet;
-
-            NPatchUtility::StretchRanges stretchRangesX;
-            stretchRangesX.PushBack( Uint16Pair( border.left, ( (data->croppedWidth >= static_cast< unsigned int >( border.right )) ? data->croppedWidth - border.right : 0 ) ) );
-
-            NPatchUtility::StretchRanges stretchRangesY;
-            stretchRangesY.PushBack( Uint16Pair( border.top, ( (data->croppedHeight >= static_cast< unsigned int >( border.bottom )) ? data->croppedHeight - border.bottom : 0 ) ) );
-
-            data->stretchPixelsX = stretchRangesX;
-            data->stretchPixelsY = stretchRangesY;
-            data->border = border;
-
-            data->loadCompleted = mCache[ index ]->loadCompleted;
-
-            mCache.PushBack( data );
-
-            return mCache.Count(); // valid ids start from 1u
-          }
-        }
-      }
+      entry = &urlEntry;
+      id = it->second;
+      break;
+    }
+    else if( urlEntry.data->loadCompleted )
+    {
+      loadedEntry = &urlEntry;
     }
   }
 
-  if( cachedIndex == -1 )
+  if( entry )
+  {
+    ++mMetrics.hits;
+    if( 0u == entry->referenceCount )
+    {
+      // The n-patch is used again.
+      mUnusedIds.erase( entry->unusedIt );
+      mMetrics.unusedMemory -= entry->memory;
+    }
+    ++entry->referenceCount;
+
+    if( entry->data->loadCompleted )
+    {
+      return id;
+    }
+  }
+  else
   {
-    data = new Data();
-    data->loadCompleted = false;
-    data->hash = hash;
+    id = mNextId++;
+    entry = &mEntries[ id ];
+    entry->data.reset( new Data() );
+    entry->referenceCount = 1u;
+    mUrlIds.insert( std::make_pair( url, id ) );
+
+    Data* data = entry->data.get();
+    data->hash = CalculateHash( url );
     data->url = url;
     data->border = border;
 
-    mCache.PushBack( data );
+    if( loadedEntry )
+    {
+      // Same url but border is different - use the existing texture
+      ++mMetrics.hits;
+      data->croppedWidth = loadedEntry->data->croppedWidth;
+      data->croppedHeight = loadedEntry->data->croppedHeight;
+
+      data->textureSet = loadedEntry->data->textureSet;
+
+      NPatchUtility::StretchRanges stretchRangesX;
+      stretchRangesX.PushBack( Uint16Pair( border.left, ( (data->croppedWidth >= static_cast< unsigned int >( border.right )) ? data->croppedWidth - border.right : 0 ) ) );
+
+      NPatchUtility::StretchRanges stretchRangesY;
+      stretchRangesY.PushBack( Uint16Pair( border.top, ( (data->croppedHeight >= static_cast< unsigned int >( border.bottom )) ? data->croppedHeight - border.bottom : 0 ) ) );
+
+      data->stretchPixelsX = stretchRangesX;
+      data->stretchPixelsY = stretchRangesY;
+
+      data->loadCompleted = true;
+
+      return id;
+    }
 
-    cachedIndex = mCache.Count();
+    ++mMetrics.misses;
   }
 
   auto preMultiplyOnLoading = preMultiplyOnLoad ? TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD
@@ -169,35 +216,107 @@ std::size_t NPatchLoader::Load( TextureManager& textureManager, TextureUploadObs
 
   if( pixelBuffer )
   {
-    NPatchBuffer::SetLoadedNPatchData( data, pixelBuffer );
+    SetLoadedData( *entry, pixelBuffer );
     preMultiplyOnLoad = ( preMultiplyOnLoading == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD ) ? true : false;
   }
 
-  return cachedIndex;
+  return id;
 }
 
 void NPatchLoader::SetNPatchData( std::size_t id, Devel::PixelBuffer& pixelBuffer )
 {
-  Data* data;
-  data = mCache[ id - 1u ];
-
-  if( !data->loadCompleted )
+  EntryContainer::iterator it = mEntries.find( id );
+  if( it != mEntries.end() && !it->second.data->loadCompleted )
   {
-    NPatchBuffer::SetLoadedNPatchData( data, pixelBuffer );
+    SetLoadedData( it->second, pixelBuffer );
   }
 }
 
 bool NPatchLoader::GetNPatchData( std::size_t id, const Data*& data )
 {
-  if( ( id > UNINITIALIZED_ID )&&( id <= mCache.Count() ) )
+  EntryContainer::iterator it = mEntries.find( id );
+  if( it != mEntries.end() )
   {
-    data = mCache[ id - 1u ]; // id's start from 1u
+    data = it->second.data.get();
     return true;
   }
   data = NULL;
   return false;
 }
 
+void NPatchLoader::Release( std::size_t id )
+{
+  EntryContainer::iterator it = mEntries.find( id );
+  if( it != mEntries.end() && it->second.referenceCount > 0u )
+  {
+    Entry& entry = it->second;
+    if( 0u == --entry.referenceCount )
+    {
+      if( !entry.data->loadCompleted || 0u == entry.memory )
+      {
+        // Nothing is saved by keeping a n-patch still loading or sharing the texture of another border.
+        Remove( it );
+      }
+      else
+      {
+        entry.unusedIt = mUnusedIds.insert( mUnusedIds.end(), id );
+        mMetrics.unusedMemory += entry.memory;
+        Evict();
+      }
+    }
+  }
+}
+
+void NPatchLoader::SetMemoryBudget( size_t budget )
+{
+  mMemoryBudget = budget;
+  Evict();
+}
+
+const NPatchLoader::Metrics& NPatchLoader::GetMetrics() const
+{
+  return mMetrics;
+}
+
+void NPatchLoader::SetLoadedData( Entry& entry, Devel::PixelBuffer& pixelBuffer )
+{
+  entry.memory = pixelBuffer.GetWidth() * pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel( pixelBuffer.GetPixelFormat() );
+  mMetrics.memory += entry.memory;
+
+  NPatchBuffer::SetLoadedNPatchData( entry.data.get(), pixelBuffer );
+}
+
+void NPatchLoader::Remove( EntryContainer::iterator it )
+{
+  auto range = mUrlIds.equal_range( it->second.data->url );
+  for( auto urlIt = range.first; urlIt != range.second; ++urlIt )
+  {
+    if( urlIt->second == it->first )
+    {
+      mUrlIds.erase( urlIt );
+      break;
+    }
+  }
+
+  mMetrics.memory -= it->second.memory;
+  mEntries.erase( it );
+}
+
+void NPatchLoader::Evict()
+{
+  while( ( mMetrics.unusedMemory > mMemoryBudget ) && !mUnusedIds.empty() )
+  {
+    EntryContainer::iterator it = mEntries.find( mUnusedIds.front() );
+    mUnusedIds.pop_front();
+
+    DALI_LOG_INFO( gNPatchLoaderLogFilter, Debug::General, "NPatchLoader::Evict: %s\n", it->second.data->url.c_str() );
+
+    mMetrics.unusedMemory -= it->second.memory;
+    ++mMetrics.evictions;
+    Remove( it );
+  }
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -18,12 +18,15 @@
  */
 
 // EXTERNAL INCLUDES
+#include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <dali/public-api/rendering/texture-set.h>
-#include <dali/devel-api/common/owner-container.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/opacity-map.h>
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 #include <dali-toolkit/devel-api/utility/npatch-utilities.h>
 
@@ -41,9 +44,9 @@ namespace Internal
  * It caches them internally for better performance; i.e. to avoid loading and
  * parsing the files over and over.
  *
- * Cache is not cleaned during app lifecycle as N patches take considerably
- * small space and there's not usually a lot of them. Usually N patches are specified in
- * toolkit default style and there is 1-2 per control that are shared across the whole application.
+ * The n-patches are found by their url and border. They are reference counted by the visuals
+ * which use them. The ones not used by any visual are kept in a least recently used list until
+ * the memory of their textures exceeds the loader's budget.
  */
 class NPatchLoader
 {
@@ -54,6 +57,26 @@ public:
     UNINITIALIZED_ID = 0 ///< uninitialised id, use to initialize ids
   };
 
+  /**
+   * @brief Metrics of the cache.
+   */
+  struct Metrics
+  {
+    Metrics()
+    : hits( 0u ),
+      misses( 0u ),
+      evictions( 0u ),
+      memory( 0u ),
+      unusedMemory( 0u )
+    {}
+
+    uint32_t hits;         ///< The number of requests which found a n-patch.
+    uint32_t misses;       ///< The number of requests which loaded a n-patch.
+    uint32_t evictions;    ///< The number of n-patches removed to keep the cache within its budget.
+    size_t   memory;       ///< The memory of the textures of all the n-patches in the cache, in bytes.
+    size_t   unusedMemory; ///< The memory of the textures of the n-patches not used by any visual, in bytes.
+  };
+
   struct Data
   {
     Data()
@@ -64,7 +87,8 @@ public:
       croppedHeight( 0 ),
       border( 0, 0, 0, 0 ),
       loadCompleted( false ),
-      renderingMap{ nullptr }
+      renderingMap{ nullptr },
+      opacityMap()
     {}
 
     ~Data();
@@ -79,6 +103,7 @@ public:
     Rect< int > border;                            ///< The size of the border
     bool loadCompleted;                            ///< True if the data loading is completed
     void* renderingMap;                            ///< NPatch rendering data
+    OpacityMapPtr opacityMap;                      ///< The opacity of the cells, if there is no rendering add-on
   };
 
 public:
@@ -104,6 +129,7 @@ public:
    *                                   image has no alpha channel
    * @param [in] synchronousLoading True if the image will be loaded in synchronous time.
    * @return id of the texture.
+   * @note A reference is added to the n-patch, which must be removed with Release().
    */
   std::size_t Load( TextureManager& textureManager, TextureUploadObserver* textureObserver, const std::string& url, const Rect< int >& border, bool& preMultiplyOnLoad, bool synchronousLoading );
 
@@ -123,6 +149,28 @@ public:
    */
   bool GetNPatchData( std::size_t id, const Data*& data );
 
+  /**
+   * @brief Removes a reference of a n-patch.
+   *
+   * The n-patch is kept in the cache while the memory of the unused n-patches is within the budget.
+   * @param [in] id of data
+   */
+  void Release( std::size_t id );
+
+  /**
+   * @brief Sets the maximum memory of the textures of the n-patches kept in the cache when no visual uses them.
+   *
+   * @param [in] budget The memory budget, in bytes.
+   */
+  void SetMemoryBudget( size_t budget );
+
+  /**
+   * @brief Retrieves the metrics of the cache.
+   *
+   * @return The metrics.
+   */
+  const Metrics& GetMetrics() const;
+
 protected:
 
   /**
@@ -137,8 +185,54 @@ protected:
 
 private:
 
-  OwnerContainer< Data* > mCache;
+  typedef std::list< std::size_t > IdList;
+
+  struct Entry
+  {
+    Entry()
+    : data(),
+      memory( 0u ),
+      referenceCount( 0u ),
+      unusedIt()
+    {}
+
+    std::unique_ptr< Data > data;           ///< The n-patch.
+    size_t                  memory;         ///< The memory of the texture, in bytes. Zero if the texture is shared with another border.
+    uint32_t                referenceCount; ///< The number of visuals using the n-patch.
+    IdList::iterator        unusedIt;       ///< The position in the list of unused n-patches. Only valid if there is no reference.
+  };
+
+  typedef std::unordered_map< std::size_t, Entry > EntryContainer;
+  typedef std::unordered_multimap< std::string, std::size_t > UrlContainer;
+
+  /**
+   * @brief Sets the loaded pixels of a n-patch.
+   *
+   * @param [in] entry The entry of the n-patch.
+   * @param [in] pixelBuffer of the loaded image
+   */
+  void SetLoadedData( Entry& entry, Devel::PixelBuffer& pixelBuffer );
+
+  /**
+   * @brief Removes a n-patch from the cache.
+   *
+   * @param [in] it The n-patch to remove.
+   */
+  void Remove( EntryContainer::iterator it );
+
+  /**
+   * @brief Removes the least recently used n-patches until the memory of the unused ones is within the budget.
+   */
+  void Evict();
+
+private:
 
+  EntryContainer mEntries;      ///< The n-patches, by id.
+  UrlContainer   mUrlIds;       ///< The ids of the n-patches, by url.
+  IdList         mUnusedIds;    ///< The ids of the n-patches not used, the least recently used first.
+  std::size_t    mNextId;       ///< The id of the next n-patch.
+  size_t         mMemoryBudget; ///< The maximum memory of the unused n-patches.
+  Metrics        mMetrics;      ///< The metrics of the cache.
 };
 
 } // name Internal
@@ -28,12 +28,14 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
 #include <dali-toolkit/internal/visuals/npatch-loader.h>
+#include <dali-toolkit/internal/visuals/opacity-map.h>
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/rendering-addon.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -396,10 +398,13 @@ void NPatchVisual::DoSetOnScene( Actor& actor )
   const NPatchLoader::Data* data;
   if( mLoader.GetNPatchData( mId, data ) )
   {
-    Geometry geometry = CreateGeometry();
+    uint32_t opaqueElements = 0u;
+    uint32_t translucentElements = 0u;
+    Geometry geometry = CreateGeometry( opaqueElements, translucentElements );
     Shader shader = CreateShader();
 
     mImpl->mRenderer = Renderer::New( geometry, shader );
+    OpacityMap::AddDrawCommands( mImpl->mRenderer, opaqueElements, translucentElements, false );
 
     mPlacementActor = actor;
     if( data->loadCompleted )
@@ -476,14 +481,21 @@ NPatchVisual::NPatchVisual( VisualFactoryCache& factoryCache )
 
 NPatchVisual::~NPatchVisual()
 {
+  if( mId != NPatchLoader::UNINITIALIZED_ID )
+  {
+    mLoader.Release( mId );
+  }
 }
 
-Geometry NPatchVisual::CreateGeometry()
+Geometry NPatchVisual::CreateGeometry( uint32_t& opaqueElements, uint32_t& translucentElements )
 {
   Geometry geometry;
   const NPatchLoader::Data* data;
   if( mLoader.GetNPatchData( mId, data ) && data->loadCompleted )
   {
+    // The auxiliary image is blended over the n-patch, so its cells can't be drawn without blending.
+    const bool useOpacityMap = data->opacityMap && !mBorderOnly && !mAuxiliaryUrl.IsValid();
+
     if( data->stretchPixelsX.Size() == 1 && data->stretchPixelsY.Size() == 1 )
     {
       if( DALI_UNLIKELY( mBorderOnly ) )
@@ -501,6 +513,10 @@ Geometry NPatchVisual::CreateGeometry()
             RenderingAddOn::Get().SubmitRenderTask(mImpl->mRenderer, data->renderingMap);
           }
         }
+        else if( useOpacityMap )
+        {
+          geometry = data->opacityMap->CreateGridGeometry( opaqueElements, translucentElements );
+        }
         else
         {
           geometry = GetNinePatchGeometry( VisualFactoryCache::NINE_PATCH_GEOMETRY );
@@ -510,7 +526,11 @@ Geometry NPatchVisual::CreateGeometry()
     else if( data->stretchPixelsX.Size() > 0 || data->stretchPixelsY.Size() > 0)
     {
       Uint16Pair gridSize( 2 * data->stretchPixelsX.Size() + 1,  2 * data->stretchPixelsY.Size() + 1 );
-      if( !data->renderingMap )
+      if( useOpacityMap )
+      {
+        geometry = data->opacityMap->CreateGridGeometry( opaqueElements, translucentElements );
+      }
+      else if( !data->renderingMap )
       {
         geometry = !mBorderOnly ? CreateGridGeometry( gridSize ) : CreateBorderGeometry( gridSize );
       }
@@ -563,7 +583,7 @@ Shader NPatchVisual::CreateShader()
       shader = mFactoryCache.GetShader( shaderType );
       if( DALI_UNLIKELY( !shader ) )
       {
-        shader = Shader::New( VERTEX_SHADER_3X3, fragmentShader );
+        shader = ShaderRegistry::Get().GetShader( "NPatchVisual", VERTEX_SHADER_3X3, fragmentShader );
         // Only cache vanilla 9 patch shaders
         mFactoryCache.SaveShader( shaderType, shader );
       }
@@ -575,7 +595,7 @@ Shader NPatchVisual::CreateShader()
                    << "#define FACTOR_SIZE_Y " << yStretchCount + 2 << "\n"
                    << VERTEX_SHADER;
 
-      shader = Shader::New( vertexShader.str(), fragmentShader );
+      shader = ShaderRegistry::Get().GetGeneratedShader( "NPatchVisual", vertexShader.str(), fragmentShader );
     }
   }
   else
@@ -598,7 +618,7 @@ Shader NPatchVisual::CreateShader()
       {
         vertexShader = mImpl->mCustomShader->mVertexShader.c_str();
       }
-      shader = Shader::New( vertexShader, fragmentShader, hints );
+      shader = ShaderRegistry::Get().NewShader( "NPatchVisual", vertexShader, fragmentShader, hints );
     }
     else if( xStretchCount > 0 || yStretchCount > 0)
     {
@@ -607,7 +627,7 @@ Shader NPatchVisual::CreateShader()
                    << "#define FACTOR_SIZE_Y " << yStretchCount + 2 << "\n"
                    << VERTEX_SHADER;
 
-      shader = Shader::New( vertexShader.str(), fragmentShader, hints );
+      shader = ShaderRegistry::Get().NewShader( "NPatchVisual", vertexShader.str(), fragmentShader, hints );
     }
   }
 
@@ -841,11 +861,14 @@ void NPatchVisual::SetResource()
   const NPatchLoader::Data* data;
   if( mImpl->mRenderer && mLoader.GetNPatchData( mId, data ) )
   {
-    Geometry geometry = CreateGeometry();
+    uint32_t opaqueElements = 0u;
+    uint32_t translucentElements = 0u;
+    Geometry geometry = CreateGeometry( opaqueElements, translucentElements );
     Shader shader = CreateShader();
 
     mImpl->mRenderer.SetGeometry( geometry );
     mImpl->mRenderer.SetShader( shader );
+    OpacityMap::AddDrawCommands( mImpl->mRenderer, opaqueElements, translucentElements, false );
 
     Actor actor = mPlacementActor.GetHandle();
     if( actor )
@@ -144,9 +144,11 @@ private:
   /**
    * @brief Creates a geometry for this renderer's grid size
    *
+   * @param[out] opaqueElements The number of indices of the opaque cells, if the geometry is split by opacity
+   * @param[out] translucentElements The number of indices of the translucent cells, if the geometry is split by opacity
    * @return Returns the created geometry for this renderer's grid size
    */
-  Geometry CreateGeometry();
+  Geometry CreateGeometry( uint32_t& opaqueElements, uint32_t& translucentElements );
 
   /**
    * @brief Creates a shader for this renderer's grid size
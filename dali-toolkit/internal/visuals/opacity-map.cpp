@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/opacity-map.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <dali/devel-api/rendering/renderer-devel.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gOpacityMapLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_OPACITY_MAP" );
+#endif
+
+const uint32_t MAXIMUM_TILE_COUNT = 128u; ///< The maximum number of columns or rows, so the indices of the vertices fit in 16 bits.
+
+/**
+ * @brief Adds the indices of the two triangles of a tile.
+ *
+ * @param[out] indices The indices to add to.
+ * @param[in] index The index of the top left vertex of the tile.
+ * @param[in] nextRowIndex The index of the bottom left vertex of the tile.
+ */
+void AddTileIndices( Dali::Vector< unsigned short >& indices, uint32_t index, uint32_t nextRowIndex )
+{
+  indices.PushBack( index );
+  indices.PushBack( nextRowIndex + 1u );
+  indices.PushBack( index + 1u );
+
+  indices.PushBack( index );
+  indices.PushBack( nextRowIndex );
+  indices.PushBack( nextRowIndex + 1u );
+}
+
+} // unnamed namespace
+
+OpacityMapPtr OpacityMap::New( Devel::PixelBuffer pixelBuffer, uint32_t tileSize )
+{
+  OpacityMapPtr opacityMap;
+  if( pixelBuffer && Pixel::HasAlpha( pixelBuffer.GetPixelFormat() ) && tileSize > 0u )
+  {
+    const uint32_t width = pixelBuffer.GetWidth();
+    const uint32_t height = pixelBuffer.GetHeight();
+
+    // Keep the number of vertices within the range of the indices.
+    tileSize = std::max( tileSize, ( std::max( width, height ) + MAXIMUM_TILE_COUNT - 1u ) / MAXIMUM_TILE_COUNT );
+
+    opacityMap = new OpacityMap();
+    for( uint32_t x = 0u; x < width; x += tileSize )
+    {
+      opacityMap->mColumns.PushBack( x );
+    }
+    opacityMap->mColumns.PushBack( width );
+
+    for( uint32_t y = 0u; y < height; y += tileSize )
+    {
+      opacityMap->mRows.PushBack( y );
+    }
+    opacityMap->mRows.PushBack( height );
+
+    if( !opacityMap->Analyse( pixelBuffer ) )
+    {
+      opacityMap.Reset();
+    }
+    else if( std::all_of( opacityMap->mOpacities.Begin(), opacityMap->mOpacities.End(), []( uint8_t opacity ) { return opacity == OPAQUE; } ) )
+    {
+      // An opaque image is drawn as a single tile.
+      opacityMap->mColumns.Clear();
+      opacityMap->mColumns.PushBack( 0u );
+      opacityMap->mColumns.PushBack( width );
+      opacityMap->mRows.Clear();
+      opacityMap->mRows.PushBack( 0u );
+      opacityMap->mRows.PushBack( height );
+      opacityMap->mOpacities.Resize( 1u );
+    }
+  }
+  return opacityMap;
+}
+
+OpacityMapPtr OpacityMap::New( Devel::PixelBuffer pixelBuffer, const Dali::Vector< uint32_t >& columns, const Dali::Vector< uint32_t >& rows )
+{
+  OpacityMapPtr opacityMap;
+  if( pixelBuffer && Pixel::HasAlpha( pixelBuffer.GetPixelFormat() ) && !columns.Empty() && !rows.Empty() )
+  {
+    opacityMap = new OpacityMap();
+    opacityMap->mColumns = columns;
+    opacityMap->mColumns.PushBack( pixelBuffer.GetWidth() );
+    opacityMap->mRows = rows;
+    opacityMap->mRows.PushBack( pixelBuffer.GetHeight() );
+
+    // The cells of malformed n-patches can't be analysed.
+    if( !std::is_sorted( opacityMap->mColumns.Begin(), opacityMap->mColumns.End() ) ||
+        !std::is_sorted( opacityMap->mRows.Begin(), opacityMap->mRows.End() ) ||
+        !opacityMap->Analyse( pixelBuffer ) )
+    {
+      opacityMap.Reset();
+    }
+  }
+  return opacityMap;
+}
+
+uint32_t OpacityMap::GetColumnCount() const
+{
+  return mColumns.Count() - 1u;
+}
+
+uint32_t OpacityMap::GetRowCount() const
+{
+  return mRows.Count() - 1u;
+}
+
+OpacityMap::Opacity OpacityMap::GetOpacity( uint32_t column, uint32_t row ) const
+{
+  return static_cast< Opacity >( mOpacities[ row * GetColumnCount() + column ] );
+}
+
+Geometry OpacityMap::CreateGeometry( uint32_t& opaqueElements, uint32_t& translucentElements ) const
+{
+  const float width = static_cast< float >( mColumns[ GetColumnCount() ] );
+  const float height = static_cast< float >( mRows[ GetRowCount() ] );
+
+  Dali::Vector< Vector2 > vertices;
+  vertices.Reserve( mColumns.Count() * mRows.Count() );
+  for( auto&& y : mRows )
+  {
+    for( auto&& x : mColumns )
+    {
+      vertices.PushBack( Vector2( x / width - 0.5f, y / height - 0.5f ) );
+    }
+  }
+
+  return CreateGeometry( vertices, opaqueElements, translucentElements );
+}
+
+Geometry OpacityMap::CreateGridGeometry( uint32_t& opaqueElements, uint32_t& translucentElements ) const
+{
+  Dali::Vector< Vector2 > vertices;
+  vertices.Reserve( mColumns.Count() * mRows.Count() );
+  for( uint32_t y = 0u; y < mRows.Count(); ++y )
+  {
+    for( uint32_t x = 0u; x < mColumns.Count(); ++x )
+    {
+      vertices.PushBack( Vector2( x, y ) );
+    }
+  }
+
+  return CreateGeometry( vertices, opaqueElements, translucentElements );
+}
+
+void OpacityMap::AddDrawCommands( Renderer& renderer, uint32_t opaqueElements, uint32_t translucentElements, bool opaqueWithoutBlending )
+{
+  DevelRenderer::DrawCommand drawCommand{};
+  drawCommand.drawType = DevelRenderer::DrawType::INDEXED;
+
+  if( !opaqueWithoutBlending )
+  {
+    // The opaque and translucent regions are contiguous, only the transparent ones are skipped.
+    if( opaqueElements || translucentElements )
+    {
+      drawCommand.firstIndex = 0;
+      drawCommand.elementCount = opaqueElements + translucentElements;
+      drawCommand.queue = DevelRenderer::RENDER_QUEUE_TRANSPARENT;
+      DevelRenderer::AddDrawCommand( renderer, drawCommand );
+    }
+    return;
+  }
+
+  if( opaqueElements )
+  {
+    drawCommand.firstIndex = 0;
+    drawCommand.elementCount = opaqueElements;
+    drawCommand.queue = DevelRenderer::RENDER_QUEUE_OPAQUE;
+    DevelRenderer::AddDrawCommand( renderer, drawCommand );
+  }
+
+  if( translucentElements )
+  {
+    drawCommand.firstIndex = opaqueElements;
+    drawCommand.elementCount = translucentElements;
+    drawCommand.queue = DevelRenderer::RENDER_QUEUE_TRANSPARENT;
+    DevelRenderer::AddDrawCommand( renderer, drawCommand );
+  }
+}
+
+OpacityMap::~OpacityMap()
+{
+}
+
+OpacityMap::OpacityMap()
+: mColumns(),
+  mRows(),
+  mOpacities()
+{
+}
+
+bool OpacityMap::Analyse( Devel::PixelBuffer& pixelBuffer )
+{
+  const uint32_t width = pixelBuffer.GetWidth();
+  const uint32_t height = pixelBuffer.GetHeight();
+  const uint8_t* pixels = pixelBuffer.GetBuffer();
+  if( !pixels || width == 0u || height == 0u )
+  {
+    return false;
+  }
+
+  const Pixel::Format pixelFormat = pixelBuffer.GetPixelFormat();
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+  int alphaByte = 0;
+  int alphaBits = 0;
+  Pixel::GetAlphaOffsetAndMask( pixelFormat, alphaByte, alphaBits );
+  const uint8_t alphaMask = static_cast< uint8_t >( alphaBits );
+
+  const uint32_t columnCount = GetColumnCount();
+  const uint32_t rowCount = GetRowCount();
+  mOpacities.Resize( columnCount * rowCount );
+
+  uint32_t tileCount[ OPAQUE + 1 ] = { 0u, 0u, 0u };
+  for( uint32_t row = 0u; row < rowCount; ++row )
+  {
+    // Include the pixels around the tile, which are blended in by the bilinear filtering.
+    const uint32_t startY = mRows[ row ] > 0u ? mRows[ row ] - 1u : 0u;
+    const uint32_t endY = std::min( mRows[ row + 1u ] + 1u, height );
+
+    for( uint32_t column = 0u; column < columnCount; ++column )
+    {
+      const uint32_t startX = mColumns[ column ] > 0u ? mColumns[ column ] - 1u : 0u;
+      const uint32_t endX = std::min( mColumns[ column + 1u ] + 1u, width );
+
+      bool opaque = true;
+      bool transparent = true;
+      for( uint32_t y = startY; y < endY && ( opaque || transparent ); ++y )
+      {
+        const uint8_t* alpha = pixels + ( y * width + startX ) * bytesPerPixel + alphaByte;
+        for( uint32_t x = startX; x < endX; ++x, alpha += bytesPerPixel )
+        {
+          const uint8_t value = *alpha & alphaMask;
+          opaque = opaque && value == alphaMask;
+          transparent = transparent && value == 0u;
+        }
+      }
+
+      const Opacity opacity = opaque ? OPAQUE : ( transparent ? TRANSPARENT : TRANSLUCENT );
+      mOpacities[ row * columnCount + column ] = opacity;
+      ++tileCount[ opacity ];
+    }
+  }
+
+  DALI_LOG_INFO( gOpacityMapLogFilter, Debug::General, "OpacityMap::Analyse: %ux%u tiles, %u opaque, %u transparent\n",
+                 columnCount, rowCount, tileCount[ OPAQUE ], tileCount[ TRANSPARENT ] );
+
+  // Nothing is saved if no tile is opaque and the image is either fully translucent or fully transparent.
+  return tileCount[ OPAQUE ] > 0u || ( tileCount[ TRANSPARENT ] > 0u && tileCount[ TRANSLUCENT ] > 0u );
+}
+
+Geometry OpacityMap::CreateGeometry( const Dali::Vector< Vector2 >& vertices, uint32_t& opaqueElements, uint32_t& translucentElements ) const
+{
+  const uint32_t columnCount = GetColumnCount();
+  const uint32_t rowCount = GetRowCount();
+
+  Dali::Vector< unsigned short > indices;
+  indices.Reserve( columnCount * rowCount * 6u );
+
+  // The opaque tiles are drawn first.
+  const Opacity drawOrder[] = { OPAQUE, TRANSLUCENT };
+  for( auto opacity : drawOrder )
+  {
+    for( uint32_t row = 0u; row < rowCount; ++row )
+    {
+      for( uint32_t column = 0u; column < columnCount; ++column )
+      {
+        if( mOpacities[ row * columnCount + column ] == opacity )
+        {
+          const uint32_t index = row * ( columnCount + 1u ) + column;
+          AddTileIndices( indices, index, index + columnCount + 1u );
+        }
+      }
+    }
+
+    if( opacity == OPAQUE )
+    {
+      opaqueElements = indices.Count();
+    }
+  }
+  translucentElements = indices.Count() - opaqueElements;
+
+  Property::Map vertexFormat;
+  vertexFormat[ "aPosition" ] = Property::VECTOR2;
+  VertexBuffer vertexBuffer = VertexBuffer::New( vertexFormat );
+  if( vertices.Size() > 0 )
+  {
+    vertexBuffer.SetData( &vertices[ 0 ], vertices.Size() );
+  }
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+  if( indices.Size() > 0 )
+  {
+    geometry.SetIndexBuffer( &indices[ 0 ], indices.Size() );
+  }
+  geometry.SetType( Geometry::TRIANGLES );
+
+  return geometry;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
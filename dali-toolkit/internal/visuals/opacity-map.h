@@ -0,0 +1,200 @@
+#ifndef DALI_TOOLKIT_INTERNAL_OPACITY_MAP_H
+#define DALI_TOOLKIT_INTERNAL_OPACITY_MAP_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/geometry.h>
+#include <dali/public-api/rendering/renderer.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class OpacityMap;
+typedef IntrusivePtr< OpacityMap > OpacityMapPtr;
+
+/**
+ * @brief The opacity of the tiles of an image.
+ *
+ * The image is split in a grid of tiles, each of them fully opaque, fully transparent or translucent.
+ * The map creates a geometry which draws the opaque tiles first, then the translucent ones, and skips
+ * the transparent ones.
+ *
+ * A tile is classified with the pixels around it as well, so the bilinear filtering doesn't blend
+ * the pixels of a neighbour tile into an opaque or transparent one.
+ *
+ * The map is built from the pixels, so it can be built in the image loading threads. The geometry
+ * must be created in the event thread.
+ */
+class OpacityMap : public RefObject
+{
+public:
+
+  /**
+   * @brief The opacity of a tile.
+   */
+  enum Opacity
+  {
+    TRANSPARENT, ///< All the pixels are fully transparent.
+    TRANSLUCENT, ///< Some pixels are blended with the background.
+    OPAQUE       ///< All the pixels are fully opaque.
+  };
+
+  /**
+   * @brief Analyses the pixels of an image split in square tiles.
+   *
+   * @param[in] pixelBuffer The pixels of the image.
+   * @param[in] tileSize The size of the tiles, in pixels.
+   * @return The opacity map or an empty pointer if splitting the image would not save any blending.
+   */
+  static OpacityMapPtr New( Devel::PixelBuffer pixelBuffer, uint32_t tileSize );
+
+  /**
+   * @brief Analyses the pixels of an image split in the given columns and rows.
+   *
+   * This is used by the n-patch images, whose cells are the fixed and stretched parts of the image.
+   *
+   * @param[in] pixelBuffer The pixels of the image.
+   * @param[in] columns The start of each column in pixels, the first one being 0.
+   * @param[in] rows The start of each row in pixels, the first one being 0.
+   * @return The opacity map or an empty pointer if splitting the image would not save any blending.
+   */
+  static OpacityMapPtr New( Devel::PixelBuffer pixelBuffer, const Dali::Vector< uint32_t >& columns, const Dali::Vector< uint32_t >& rows );
+
+  /**
+   * @brief Retrieves the number of columns of tiles.
+   *
+   * @return The number of columns.
+   */
+  uint32_t GetColumnCount() const;
+
+  /**
+   * @brief Retrieves the number of rows of tiles.
+   *
+   * @return The number of rows.
+   */
+  uint32_t GetRowCount() const;
+
+  /**
+   * @brief Retrieves the opacity of a tile.
+   *
+   * @param[in] column The column of the tile.
+   * @param[in] row The row of the tile.
+   * @return The opacity of the tile.
+   */
+  Opacity GetOpacity( uint32_t column, uint32_t row ) const;
+
+  /**
+   * @brief Creates the geometry of the image visual, whose positions are within [-0.5, 0.5].
+   *
+   * The indices of the opaque tiles are first, followed by the ones of the translucent tiles.
+   *
+   * @param[out] opaqueElements The number of indices of the opaque tiles.
+   * @param[out] translucentElements The number of indices of the translucent tiles.
+   * @return The geometry.
+   */
+  Geometry CreateGeometry( uint32_t& opaqueElements, uint32_t& translucentElements ) const;
+
+  /**
+   * @brief Creates the geometry of the n-patch visual, whose positions are the column and row of each vertex.
+   *
+   * @param[out] opaqueElements The number of indices of the opaque tiles.
+   * @param[out] translucentElements The number of indices of the translucent tiles.
+   * @return The geometry.
+   */
+  Geometry CreateGridGeometry( uint32_t& opaqueElements, uint32_t& translucentElements ) const;
+
+  /**
+   * @brief Draws the elements of a renderer's geometry, skipping the transparent regions.
+   *
+   * The opaque regions are only drawn without blending if the caller knows the renderer is drawn fully
+   * opaque. Otherwise the visual opacity, the mix color or the actor's opacity, which may be animated,
+   * would be ignored, so all the regions are drawn with the renderer's blending.
+   *
+   * Nothing is added if both counts are zero, so the renderer draws the whole geometry.
+   *
+   * @param[in] renderer The renderer.
+   * @param[in] opaqueElements The number of indices of the opaque regions, first in the geometry.
+   * @param[in] translucentElements The number of indices of the translucent regions.
+   * @param[in] opaqueWithoutBlending Whether the opaque regions are drawn without blending.
+   */
+  static void AddDrawCommands( Renderer& renderer, uint32_t opaqueElements, uint32_t translucentElements, bool opaqueWithoutBlending );
+
+protected:
+
+  /**
+   * @brief Destructor.
+   */
+  ~OpacityMap() override;
+
+private:
+
+  /**
+   * @brief Constructor.
+   */
+  OpacityMap();
+
+  /**
+   * @brief Classifies the tiles.
+   *
+   * @param[in] pixelBuffer The pixels of the image.
+   * @return True if splitting the image saves some blending.
+   */
+  bool Analyse( Devel::PixelBuffer& pixelBuffer );
+
+  /**
+   * @brief Creates a geometry with the given vertices and the indices of the opaque and translucent tiles.
+   *
+   * @param[in] vertices The vertices of the grid, row by row.
+   * @param[out] opaqueElements The number of indices of the opaque tiles.
+   * @param[out] translucentElements The number of indices of the translucent tiles.
+   * @return The geometry.
+   */
+  Geometry CreateGeometry( const Dali::Vector< Vector2 >& vertices, uint32_t& opaqueElements, uint32_t& translucentElements ) const;
+
+  // Undefined
+  OpacityMap( const OpacityMap& );
+
+  // Undefined
+  OpacityMap& operator=( const OpacityMap& );
+
+private:
+
+  Dali::Vector< uint32_t > mColumns;   ///< The start of each column and the width of the image, in pixels.
+  Dali::Vector< uint32_t > mRows;      ///< The start of each row and the height of the image, in pixels.
+  Dali::Vector< uint8_t >  mOpacities; ///< The opacity of each tile, row by row.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_OPACITY_MAP_H
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/rendering/texture-set.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/texture-manager-impl.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const size_t DEFAULT_MEMORY_BUDGET = 4u * 1024u * 1024u; ///< The default memory of the unused documents and textures kept in the cache, in bytes.
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_SVG_CACHE" );
+#endif
+
+std::string GetDocumentKey( const VisualUrl& url, float dpi )
+{
+  return url.GetUrl() + '|' + std::to_string( dpi );
+}
+
+} // namespace
+
+SvgDocument::SvgDocument( const VisualUrl& url, float dpi )
+: mVectorRenderer( VectorImageRenderer::New() ),
+  mUrl( url ),
+  mMutex(),
+  mDpi( dpi ),
+  mDefaultWidth( 0u ),
+  mDefaultHeight( 0u ),
+  mMemory( 0u ),
+  mLoaded( false )
+{
+}
+
+SvgDocument::~SvgDocument()
+{
+}
+
+bool SvgDocument::Load( bool allowDownload )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  if( mLoaded )
+  {
+    return true;
+  }
+
+  Dali::Vector<uint8_t> buffer;
+  if( mUrl.IsLocalResource() )
+  {
+    if( !Dali::FileLoader::ReadFile( mUrl.GetUrl(), buffer ) )
+    {
+      DALI_LOG_ERROR( "SvgDocument::Load: Failed to read file! [%s]\n", mUrl.GetUrl().c_str() );
+      return false;
+    }
+  }
+  else
+  {
+    if( !allowDownload )
+    {
+      return false;
+    }
+
+    if( !Dali::FileLoader::DownloadFileSynchronously( mUrl.GetUrl(), buffer ) )
+    {
+      DALI_LOG_ERROR( "SvgDocument::Load: Failed to download file! [%s]\n", mUrl.GetUrl().c_str() );
+      return false;
+    }
+  }
+
+  buffer.PushBack( '\0' );
+
+  if( !mVectorRenderer.Load( buffer, mDpi ) )
+  {
+    DALI_LOG_ERROR( "SvgDocument::Load: Failed to load data! [%s]\n", mUrl.GetUrl().c_str() );
+    return false;
+  }
+
+  mVectorRenderer.GetDefaultSize( mDefaultWidth, mDefaultHeight );
+  mMemory = buffer.Count();
+  mLoaded = true;
+
+  return true;
+}
+
+PixelData SvgDocument::Rasterize( unsigned int width, unsigned int height )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  if( !mLoaded )
+  {
+    return PixelData();
+  }
+
+  if( ( 0u == width ) || ( 0u == height ) )
+  {
+    DALI_LOG_ERROR( "SvgDocument::Rasterize: Size is zero!\n" );
+    return PixelData();
+  }
+
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New( width, height, Dali::Pixel::RGBA8888 );
+
+  float scaleX = static_cast<float>( width ) / static_cast<float>( mDefaultWidth );
+  float scaleY = static_cast<float>( height ) / static_cast<float>( mDefaultHeight );
+  float scale  = scaleX < scaleY ? scaleX : scaleY;
+
+  if( !mVectorRenderer.Rasterize( pixelBuffer, scale ) )
+  {
+    DALI_LOG_ERROR( "SvgDocument::Rasterize: Rasterize is failed! [%s]\n", mUrl.GetUrl().c_str() );
+    return PixelData();
+  }
+
+  return Devel::PixelBuffer::Convert( pixelBuffer );
+}
+
+bool SvgDocument::IsLoaded()
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mLoaded;
+}
+
+void SvgDocument::GetDefaultSize( uint32_t& width, uint32_t& height )
+{
+  Mutex::ScopedLock lock( mMutex );
+  width = mDefaultWidth;
+  height = mDefaultHeight;
+}
+
+size_t SvgDocument::GetMemory()
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mMemory;
+}
+
+SvgCache::SvgCache( TextureManager& textureManager )
+: mTextureManager( textureManager ),
+  mDocuments(),
+  mRasters(),
+  mUnusedDocumentKeys(),
+  mUnusedRasterKeys(),
+  mMemoryBudget( DEFAULT_MEMORY_BUDGET ),
+  mMetrics()
+{
+}
+
+SvgCache::~SvgCache()
+{
+}
+
+SvgDocumentPtr SvgCache::RequestDocument( const VisualUrl& url, float dpi )
+{
+  const std::string key = GetDocumentKey( url, dpi );
+
+  DocumentContainer::iterator it = mDocuments.find( key );
+  if( it != mDocuments.end() )
+  {
+    DocumentEntry& entry = it->second;
+    if( 0u == entry.referenceCount )
+    {
+      // The document is used again.
+      mUnusedDocumentKeys.erase( entry.unusedIt );
+      mMetrics.unusedMemory -= entry.memory;
+    }
+    ++entry.referenceCount;
+
+    // Retry to read a local file which failed.
+    entry.document->Load( false );
+
+    ++mMetrics.documentHits;
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "SvgCache::RequestDocument hit. hits:%d, misses:%d\n", mMetrics.documentHits, mMetrics.documentMisses );
+
+    return entry.document;
+  }
+
+  DocumentEntry& entry = mDocuments[key];
+  entry.document = new SvgDocument( url, dpi );
+  entry.referenceCount = 1u;
+
+  // Remote files are downloaded by the rasterize thread.
+  entry.document->Load( false );
+  entry.memory = entry.document->GetMemory();
+  mMetrics.memory += entry.memory;
+
+  ++mMetrics.documentMisses;
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "SvgCache::RequestDocument miss. hits:%d, misses:%d\n", mMetrics.documentHits, mMetrics.documentMisses );
+
+  return entry.document;
+}
+
+void SvgCache::ReleaseDocument( const VisualUrl& url, float dpi )
+{
+  DocumentContainer::iterator it = mDocuments.find( GetDocumentKey( url, dpi ) );
+  if( ( it == mDocuments.end() ) || ( 0u == it->second.referenceCount ) )
+  {
+    return;
+  }
+
+  DocumentEntry& entry = it->second;
+  --entry.referenceCount;
+
+  if( 0u == entry.referenceCount )
+  {
+    // A remote document may have been downloaded since it was added.
+    const size_t memory = entry.document->GetMemory();
+    mMetrics.memory = mMetrics.memory - entry.memory + memory;
+    entry.memory = memory;
+
+    // Keep the document as the most recently used one.
+    entry.unusedIt = mUnusedDocumentKeys.insert( mUnusedDocumentKeys.end(), it->first );
+    mMetrics.unusedMemory += entry.memory;
+
+    Evict();
+  }
+}
+
+SvgCache::RasterizationState SvgCache::RequestRasterization( const std::string& key, SvgVisual* visual, Texture& texture )
+{
+  RasterContainer::iterator it = mRasters.find( key );
+  if( it != mRasters.end() )
+  {
+    RasterEntry& entry = it->second;
+    if( 0u == entry.referenceCount )
+    {
+      // The texture is used again.
+      mUnusedRasterKeys.erase( entry.unusedIt );
+      mMetrics.unusedMemory -= entry.memory;
+    }
+    ++entry.referenceCount;
+
+    ++mMetrics.rasterHits;
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "SvgCache::RequestRasterization hit. hits:%d, misses:%d\n", mMetrics.rasterHits, mMetrics.rasterMisses );
+
+    if( entry.texture )
+    {
+      texture = entry.texture;
+      return RASTERIZED;
+    }
+
+    entry.observers.PushBack( visual );
+    return RASTERIZING;
+  }
+
+  RasterEntry& entry = mRasters[key];
+  entry.referenceCount = 1u;
+  entry.observers.PushBack( visual );
+
+  ++mMetrics.rasterMisses;
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "SvgCache::RequestRasterization miss. hits:%d, misses:%d\n", mMetrics.rasterHits, mMetrics.rasterMisses );
+
+  return NOT_RASTERIZED;
+}
+
+void SvgCache::RasterizationCompleted( const std::string& key, PixelData pixelData )
+{
+  RasterContainer::iterator it = mRasters.find( key );
+  if( ( it == mRasters.end() ) || it->second.texture )
+  {
+    // Either no visual needs the rasterization anymore or it has already been done synchronously.
+    return;
+  }
+
+  Texture texture;
+  if( pixelData )
+  {
+    RasterEntry& entry = it->second;
+
+    texture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, pixelData.GetWidth(), pixelData.GetHeight() );
+    texture.Upload( pixelData );
+
+    TextureSet textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, texture );
+
+    entry.texture = texture;
+    entry.textureUrl = mTextureManager.AddExternalTexture( textureSet );
+    entry.memory = pixelData.GetWidth() * pixelData.GetHeight() * Pixel::GetBytesPerPixel( Pixel::RGBA8888 );
+    mMetrics.memory += entry.memory;
+  }
+
+  // Notify the waiting visuals one by one, as a visual may release its rasterization or request another one when notified.
+  for( it = mRasters.find( key ); ( it != mRasters.end() ) && !it->second.observers.Empty(); it = mRasters.find( key ) )
+  {
+    SvgVisual* visual = *it->second.observers.Begin();
+    it->second.observers.Erase( it->second.observers.Begin() );
+
+    visual->ApplyRasterizedImage( texture, pixelData );
+  }
+
+  if( !texture )
+  {
+    // Forget the failed rasterization so it's retried by the next request.
+    mRasters.erase( key );
+  }
+}
+
+bool SvgCache::ReleaseRasterization( const std::string& key, SvgVisual* visual )
+{
+  RasterContainer::iterator it = mRasters.find( key );
+  if( ( it == mRasters.end() ) || ( 0u == it->second.referenceCount ) )
+  {
+    return false;
+  }
+
+  RasterEntry& entry = it->second;
+  for( Dali::Vector<SvgVisual*>::Iterator observerIt = entry.observers.Begin(), endIt = entry.observers.End(); observerIt != endIt; ++observerIt )
+  {
+    if( *observerIt == visual )
+    {
+      entry.observers.Erase( observerIt );
+      break;
+    }
+  }
+
+  --entry.referenceCount;
+
+  if( 0u == entry.referenceCount )
+  {
+    if( !entry.texture )
+    {
+      // Nobody waits for the rasterization anymore.
+      mRasters.erase( it );
+      return true;
+    }
+
+    // Keep the texture as the most recently used one.
+    entry.unusedIt = mUnusedRasterKeys.insert( mUnusedRasterKeys.end(), key );
+    mMetrics.unusedMemory += entry.memory;
+
+    Evict();
+  }
+
+  return false;
+}
+
+void SvgCache::SetMemoryBudget( size_t budget )
+{
+  mMemoryBudget = budget;
+  Evict();
+}
+
+const SvgCache::Metrics& SvgCache::GetMetrics() const
+{
+  return mMetrics;
+}
+
+std::string SvgCache::GetRasterizationKey( const VisualUrl& url, unsigned int width, unsigned int height, float dpi )
+{
+  return url.GetUrl() + '|' + std::to_string( width ) + 'x' + std::to_string( height ) + '|' + std::to_string( dpi );
+}
+
+void SvgCache::Evict()
+{
+  // The textures are cheaper to recreate than the documents.
+  while( ( mMetrics.unusedMemory > mMemoryBudget ) && !mUnusedRasterKeys.empty() )
+  {
+    RasterContainer::iterator it = mRasters.find( mUnusedRasterKeys.front() );
+    mUnusedRasterKeys.pop_front();
+
+    mTextureManager.RemoveExternalTexture( it->second.textureUrl );
+
+    mMetrics.memory -= it->second.memory;
+    mMetrics.unusedMemory -= it->second.memory;
+    ++mMetrics.evictions;
+
+    mRasters.erase( it );
+  }
+
+  while( ( mMetrics.unusedMemory > mMemoryBudget ) && !mUnusedDocumentKeys.empty() )
+  {
+    DocumentContainer::iterator it = mDocuments.find( mUnusedDocumentKeys.front() );
+    mUnusedDocumentKeys.pop_front();
+
+    mMetrics.memory -= it->second.memory;
+    mMetrics.unusedMemory -= it->second.memory;
+    ++mMetrics.evictions;
+
+    mDocuments.erase( it );
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "SvgCache::Evict memory:%zu, unused memory:%zu, evictions:%d\n", mMetrics.memory, mMetrics.unusedMemory, mMetrics.evictions );
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
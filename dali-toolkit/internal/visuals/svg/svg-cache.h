@@ -0,0 +1,332 @@
+#ifndef DALI_TOOLKIT_SVG_CACHE_H
+#define DALI_TOOLKIT_SVG_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/adaptor-framework/vector-image-renderer.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/rendering/texture.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class SvgVisual;
+class TextureManager;
+
+/**
+ * A parsed svg document, shared by all the svg visuals with the same url.
+ *
+ * Local files are parsed in the main thread when the document is requested. Remote files are downloaded
+ * and parsed in the rasterize thread. The document is locked while it's parsed or rasterized, so it can
+ * be used by several threads.
+ */
+class SvgDocument : public RefObject
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] url The URL to svg resource to use.
+   * @param[in] dpi The dpi used to parse the svg.
+   */
+  SvgDocument( const VisualUrl& url, float dpi );
+
+  /**
+   * Loads and parses the svg file, if not done yet.
+   *
+   * @param[in] allowDownload Whether remote files can be downloaded by this call.
+   * @return True if the document is parsed.
+   */
+  bool Load( bool allowDownload );
+
+  /**
+   * Rasterizes the document to fit the given size.
+   *
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @return The pixel data with the rasterized pixels or an empty handle if the rasterization failed.
+   */
+  PixelData Rasterize( unsigned int width, unsigned int height );
+
+  /**
+   * Whether the document is parsed.
+   * @return True if the document is parsed.
+   */
+  bool IsLoaded();
+
+  /**
+   * Retrieves the default size of the document.
+   * @param[out] width The default width.
+   * @param[out] height The default height.
+   */
+  void GetDefaultSize( uint32_t& width, uint32_t& height );
+
+  /**
+   * Retrieves the memory used by the svg file, in bytes.
+   * @return The size of the file.
+   */
+  size_t GetMemory();
+
+protected:
+
+  /**
+   * Destructor.
+   */
+  ~SvgDocument() override;
+
+private:
+
+  // Undefined
+  SvgDocument( const SvgDocument& document );
+
+  // Undefined
+  SvgDocument& operator=( const SvgDocument& document );
+
+private:
+
+  VectorImageRenderer mVectorRenderer;
+  VisualUrl           mUrl;
+  Dali::Mutex         mMutex;
+  float               mDpi;
+  uint32_t            mDefaultWidth;
+  uint32_t            mDefaultHeight;
+  size_t              mMemory;
+  bool                mLoaded;
+};
+
+typedef IntrusivePtr< SvgDocument > SvgDocumentPtr;
+
+/**
+ * The cache of the parsed svg documents and of their rasterized textures.
+ *
+ * The documents are found by their url and dpi. The textures are found by the url, the size and the dpi,
+ * so the svg visuals which show the same icon at the same size share one texture. The textures are
+ * registered in the texture manager as external textures.
+ *
+ * The documents and the textures are reference counted. The ones not used by any visual are kept in
+ * least recently used lists until their memory exceeds the cache's budget. The textures are evicted
+ * before the documents.
+ */
+class SvgCache
+{
+public:
+
+  /**
+   * The state of a rasterization requested to the cache.
+   */
+  enum RasterizationState
+  {
+    RASTERIZED,     ///< The texture is in the cache.
+    RASTERIZING,    ///< The texture is being rasterized by another request. The visual is notified once it's done.
+    NOT_RASTERIZED  ///< The caller must rasterize the svg and call RasterizationCompleted(). The visual is notified once it's done.
+  };
+
+  /**
+   * @brief Metrics of the cache.
+   */
+  struct Metrics
+  {
+    Metrics()
+    : documentHits( 0u ),
+      documentMisses( 0u ),
+      rasterHits( 0u ),
+      rasterMisses( 0u ),
+      evictions( 0u ),
+      memory( 0u ),
+      unusedMemory( 0u )
+    {}
+
+    uint32_t documentHits;   ///< The number of requests which found a parsed document.
+    uint32_t documentMisses; ///< The number of requests which parsed a document.
+    uint32_t rasterHits;     ///< The number of requests which found a texture or a rasterization in progress.
+    uint32_t rasterMisses;   ///< The number of requests which needed a new rasterization.
+    uint32_t evictions;      ///< The number of documents and textures removed to keep the cache within its budget.
+    size_t   memory;         ///< The memory of all the documents and textures in the cache, in bytes.
+    size_t   unusedMemory;   ///< The memory of the documents and textures not used by any visual, in bytes.
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] textureManager The texture manager which the rasterized textures are registered to.
+   */
+  SvgCache( TextureManager& textureManager );
+
+  /**
+   * @brief Destructor.
+   */
+  ~SvgCache();
+
+  /**
+   * @brief Retrieves the parsed document of a svg file and adds a reference to it.
+   *
+   * Local files are parsed when they are not in the cache.
+   *
+   * @param[in] url The URL to svg resource to use.
+   * @param[in] dpi The dpi used to parse the svg.
+   * @return The document.
+   */
+  SvgDocumentPtr RequestDocument( const VisualUrl& url, float dpi );
+
+  /**
+   * @brief Removes a reference of a document.
+   *
+   * @param[in] url The URL to svg resource.
+   * @param[in] dpi The dpi used to parse the svg.
+   */
+  void ReleaseDocument( const VisualUrl& url, float dpi );
+
+  /**
+   * @brief Requests the texture of a svg rasterized with the given size and adds a reference to it.
+   *
+   * @param[in] key The key of the rasterization, @see GetRasterizationKey().
+   * @param[in] visual The visual to notify once the texture is rasterized.
+   * @param[out] texture The texture, if it's in the cache.
+   * @return The state of the rasterization.
+   */
+  RasterizationState RequestRasterization( const std::string& key, SvgVisual* visual, Texture& texture );
+
+  /**
+   * @brief Adds the rasterized pixels to the cache and notifies the visuals waiting for them.
+   *
+   * @param[in] key The key of the rasterization.
+   * @param[in] pixelData The rasterized pixels or an empty handle if the rasterization failed.
+   */
+  void RasterizationCompleted( const std::string& key, PixelData pixelData );
+
+  /**
+   * @brief Removes a reference of a rasterized texture.
+   *
+   * @param[in] key The key of the rasterization.
+   * @param[in] visual The visual which doesn't need to be notified anymore.
+   * @return True if the texture was still being rasterized and no visual needs it anymore.
+   */
+  bool ReleaseRasterization( const std::string& key, SvgVisual* visual );
+
+  /**
+   * @brief Sets the maximum memory of the documents and textures kept in the cache when no visual uses them.
+   *
+   * @param[in] budget The memory budget, in bytes.
+   */
+  void SetMemoryBudget( size_t budget );
+
+  /**
+   * @brief Retrieves the metrics of the cache.
+   *
+   * @return The metrics.
+   */
+  const Metrics& GetMetrics() const;
+
+  /**
+   * @brief Builds the key of a rasterization.
+   *
+   * @param[in] url The URL to svg resource.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @param[in] dpi The dpi used to parse the svg.
+   * @return The key.
+   */
+  static std::string GetRasterizationKey( const VisualUrl& url, unsigned int width, unsigned int height, float dpi );
+
+private:
+
+  /**
+   * @brief Removes the least recently used textures, then documents, until the memory of the unused ones is within the budget.
+   */
+  void Evict();
+
+  // Undefined
+  SvgCache( const SvgCache& );
+
+  // Undefined
+  SvgCache& operator=( const SvgCache& );
+
+private:
+
+  typedef std::list<std::string> KeyList;
+
+  struct DocumentEntry
+  {
+    DocumentEntry()
+    : document(),
+      memory( 0u ),
+      referenceCount( 0u ),
+      unusedIt()
+    {}
+
+    SvgDocumentPtr    document;       ///< The parsed svg.
+    size_t            memory;         ///< The memory of the document when it became unused, in bytes.
+    uint32_t          referenceCount; ///< The number of visuals using the document.
+    KeyList::iterator unusedIt;       ///< The position in the list of unused documents. Only valid if there is no reference.
+  };
+
+  struct RasterEntry
+  {
+    RasterEntry()
+    : texture(),
+      textureUrl(),
+      observers(),
+      memory( 0u ),
+      referenceCount( 0u ),
+      unusedIt()
+    {}
+
+    Texture                  texture;        ///< The rasterized svg. Empty while it's being rasterized.
+    std::string              textureUrl;     ///< The url of the texture in the texture manager.
+    Dali::Vector<SvgVisual*> observers;      ///< The visuals waiting for the rasterization.
+    size_t                   memory;         ///< The memory of the texture, in bytes.
+    uint32_t                 referenceCount; ///< The number of visuals using the texture.
+    KeyList::iterator        unusedIt;       ///< The position in the list of unused textures. Only valid if there is no reference.
+  };
+
+  typedef std::unordered_map<std::string, DocumentEntry> DocumentContainer;
+  typedef std::unordered_map<std::string, RasterEntry> RasterContainer;
+
+  TextureManager&   mTextureManager;     ///< The texture manager which the textures are registered to.
+  DocumentContainer mDocuments;          ///< The cached documents.
+  RasterContainer   mRasters;            ///< The cached textures.
+  KeyList           mUnusedDocumentKeys; ///< The keys of the documents not used, the least recently used first.
+  KeyList           mUnusedRasterKeys;   ///< The keys of the textures not used, the least recently used first.
+  size_t            mMemoryBudget;       ///< The maximum memory of the unused documents and textures.
+  Metrics           mMetrics;            ///< The metrics of the cache.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SVG_CACHE_H
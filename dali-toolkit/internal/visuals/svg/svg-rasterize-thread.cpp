@@ -19,13 +19,11 @@
 #include "svg-rasterize-thread.h"
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/thread-settings.h>
-#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
-
-// INTERNAL INCLUDES
-#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <cstdlib>
 
 namespace Dali
 {
@@ -36,84 +34,54 @@ namespace Toolkit
 namespace Internal
 {
 
-RasterizingTask::RasterizingTask( SvgVisual* svgRenderer, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi, unsigned int width, unsigned int height, bool loaded)
-: mSvgVisual( svgRenderer ),
-  mVectorRenderer( vectorRenderer ),
-  mUrl( url ),
-  mDpi( dpi ),
-  mWidth( width ),
-  mHeight( height ),
-  mLoaded( loaded )
+namespace
 {
 
-}
+constexpr auto DEFAULT_NUMBER_OF_RASTERIZE_THREADS = size_t{ 4u };
+constexpr auto NUMBER_OF_RASTERIZE_THREADS_ENV = "DALI_SVG_RASTERIZE_THREADS";
 
-RasterizingTask::~RasterizingTask()
+size_t GetNumberOfThreads( const char* environmentVariable, size_t defaultValue )
 {
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto numberString = GetEnvironmentVariable( environmentVariable );
+  auto numberOfThreads = numberString ? std::strtoul( numberString, nullptr, 10 ) : 0;
+  constexpr auto MAX_NUMBER_OF_THREADS = 100u;
+  DALI_ASSERT_DEBUG( numberOfThreads < MAX_NUMBER_OF_THREADS );
+  return ( numberOfThreads > 0 && numberOfThreads < MAX_NUMBER_OF_THREADS ) ? numberOfThreads : defaultValue;
 }
 
-void RasterizingTask::Load()
-{
-  if(!mLoaded && !mUrl.IsLocalResource())
-  {
-    Dali::Vector<uint8_t> remoteBuffer;
-    if(!Dali::FileLoader::DownloadFileSynchronously(mUrl.GetUrl(), remoteBuffer))
-    {
-      DALI_LOG_ERROR("RasterizingTask::Load: Failed to download file! [%s]\n", mUrl.GetUrl().c_str());
-      return;
-    }
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gSvgRasterizeLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_SVG_RASTERIZE" );
+#endif
 
-    remoteBuffer.PushBack('\0');
+} // unnamed namespace
 
-    if(!mVectorRenderer.Load(remoteBuffer, mDpi))
-    {
-      DALI_LOG_ERROR("RasterizingTask::Load:Failed to load data! [%s]\n", mUrl.GetUrl().c_str());
-      return;
-    }
+RasterizingTask::RasterizingTask( SvgDocumentPtr document, const std::string& key, unsigned int width, unsigned int height )
+: mDocument( document ),
+  mKey( key ),
+  mWidth( width ),
+  mHeight( height )
+{
 
-    mLoaded = true;
-  }
 }
 
-void RasterizingTask::Rasterize()
+RasterizingTask::~RasterizingTask()
 {
-  if(mWidth <= 0u || mHeight <= 0u)
-  {
-    DALI_LOG_ERROR("RasterizingTask::Rasterize: Size is zero!\n");
-    return;
-  }
-
-  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New(mWidth, mHeight, Dali::Pixel::RGBA8888);
-
-  uint32_t defaultWidth, defaultHeight;
-  mVectorRenderer.GetDefaultSize(defaultWidth, defaultHeight);
-
-  float scaleX = static_cast<float>(mWidth) / static_cast<float>(defaultWidth);
-  float scaleY = static_cast<float>(mHeight) / static_cast<float>(defaultHeight);
-  float scale  = scaleX < scaleY ? scaleX : scaleY;
-
-  if(!mVectorRenderer.Rasterize(pixelBuffer, scale))
-  {
-    DALI_LOG_ERROR("RasterizingTask::Rasterize: Rasterize is failed! [%s]\n", mUrl.GetUrl().c_str());
-    return;
-  }
-
-  mPixelData = Devel::PixelBuffer::Convert(pixelBuffer);
 }
 
-VectorImageRenderer RasterizingTask::GetVectorRenderer() const
+void RasterizingTask::Load()
 {
-  return mVectorRenderer;
+  mDocument->Load( true );
 }
 
-bool RasterizingTask::IsLoaded() const
+void RasterizingTask::Rasterize()
 {
-  return mLoaded;
+  mPixelData = mDocument->Rasterize( mWidth, mHeight );
 }
 
-SvgVisual* RasterizingTask::GetSvgVisual() const
+const std::string& RasterizingTask::GetKey() const
 {
-  return mSvgVisual.Get();
+  return mKey;
 }
 
 PixelData RasterizingTask::GetPixelData() const
@@ -121,10 +89,9 @@ PixelData RasterizingTask::GetPixelData() const
   return mPixelData;
 }
 
-SvgRasterizeThread::SvgRasterizeThread( EventThreadCallback* trigger )
-: mTrigger( std::unique_ptr< EventThreadCallback >(trigger) ),
-  mLogFactory( Dali::Adaptor::Get().GetLogFactory() ),
-  mIsThreadWaiting( false )
+SvgRasterizeThread::SvgRasterizeThread( SvgRasterizeManager& manager )
+: mManager( manager ),
+  mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
 {
 }
 
@@ -132,128 +99,150 @@ SvgRasterizeThread::~SvgRasterizeThread()
 {
 }
 
-void SvgRasterizeThread::TerminateThread( SvgRasterizeThread*& thread )
+void SvgRasterizeThread::Run()
 {
-  if( thread )
+  SetThreadName( "SVGThread" );
+  mLogFactory.InstallLogFunction();
+
+  while( RasterizingTaskPtr task = mManager.NextTaskToProcess() )
   {
-    // add an empty task would stop the thread from conditional wait.
-    thread->AddTask( RasterizingTaskPtr() );
-    // stop the thread
-    thread->Join();
-    // delete the thread
-    delete thread;
-    thread = NULL;
+    task->Load( );
+    task->Rasterize( );
+    mManager.AddCompletedTask( task );
   }
 }
 
-void SvgRasterizeThread::AddTask( RasterizingTaskPtr task )
+SvgRasterizeManager::SvgRasterizeManager( EventThreadCallback* trigger )
+: mRasterizeTasks(),
+  mQueuedTasks(),
+  mCompletedTasks(),
+  mThreads(),
+  mTrigger( std::unique_ptr< EventThreadCallback >(trigger) ),
+  mMaxNumberOfThreads( GetNumberOfThreads( NUMBER_OF_RASTERIZE_THREADS_ENV, DEFAULT_NUMBER_OF_RASTERIZE_THREADS ) ),
+  mNumberOfWaitingThreads( 0u ),
+  mDestroyThreads( false )
 {
-  bool wasEmpty = false;
+}
 
+SvgRasterizeManager::~SvgRasterizeManager()
+{
   {
-    // Lock while adding task to the queue
     ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mRasterizeTasks.empty();
-    if( !wasEmpty && task != NULL)
-    {
-      // Remove the tasks with the same renderer.
-      // Older task which waiting to rasterize and apply the svg to the same renderer is expired.
-      for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
-      {
-        if( (*it) && (*it)->GetSvgVisual() == task->GetSvgVisual() )
-        {
-          mRasterizeTasks.erase( it );
-          break;
-        }
-      }
-    }
-    mRasterizeTasks.push_back( task );
+    mDestroyThreads = true;
+    mConditionalWait.Notify( lock );
   }
 
-  if( wasEmpty)
+  for( auto&& thread : mThreads )
   {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
+    thread->Join();
   }
 }
 
-RasterizingTaskPtr SvgRasterizeThread::NextCompletedTask()
+void SvgRasterizeManager::AddTask( RasterizingTaskPtr task, Priority priority )
 {
-  // Lock while popping task out from the queue
-  Mutex::ScopedLock lock( mMutex );
+  ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  if( mCompletedTasks.empty() )
+  QueuedTaskContainer::iterator it = mQueuedTasks.find( task->GetKey() );
+  if( it != mQueuedTasks.end() )
   {
-    return RasterizingTaskPtr();
+    // The SvgCache only requests a rasterization again once the older task has been removed, keep the queued one.
+    if( priority < it->second.priority )
+    {
+      mRasterizeTasks[priority].splice( mRasterizeTasks[priority].end(), mRasterizeTasks[it->second.priority], it->second.position );
+      it->second.priority = priority;
+    }
+    return;
   }
 
-  std::vector< RasterizingTaskPtr >::iterator next = mCompletedTasks.begin();
-  RasterizingTaskPtr nextTask = *next;
-  mCompletedTasks.erase( next );
+  QueuedTask& queuedTask = mQueuedTasks[task->GetKey()];
+  queuedTask.priority = priority;
+  queuedTask.position = mRasterizeTasks[priority].insert( mRasterizeTasks[priority].end(), task );
 
-  return nextTask;
+  if( mNumberOfWaitingThreads > 0u )
+  {
+    // wake up a waiting worker
+    mConditionalWait.Notify( lock );
+  }
+  else if( mThreads.size() < mMaxNumberOfThreads )
+  {
+    // All the workers are busy, start another one.
+    mThreads.push_back( std::unique_ptr< SvgRasterizeThread >( new SvgRasterizeThread( *this ) ) );
+    mThreads.back()->Start();
+
+    DALI_LOG_INFO( gSvgRasterizeLogFilter, Debug::General, "SvgRasterizeManager::AddTask: started worker %zu\n", mThreads.size() );
+  }
 }
 
-void SvgRasterizeThread::RemoveTask( SvgVisual* visual )
+void SvgRasterizeManager::SetTaskPriority( const std::string& key, Priority priority )
 {
-  // Lock while remove task from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
-  if( !mRasterizeTasks.empty() )
+
+  QueuedTaskContainer::iterator it = mQueuedTasks.find( key );
+  if( ( it != mQueuedTasks.end() ) && ( priority != it->second.priority ) )
   {
-    for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
-    {
-      if( (*it) &&  (*it)->GetSvgVisual() == visual )
-      {
-        mRasterizeTasks.erase( it );
-        break;
-      }
-    }
+    mRasterizeTasks[priority].splice( mRasterizeTasks[priority].end(), mRasterizeTasks[it->second.priority], it->second.position );
+    it->second.priority = priority;
   }
 }
 
-void SvgRasterizeThread::DeleteImage( VectorImageRenderer vectorRenderer )
+void SvgRasterizeManager::RemoveTask( const std::string& key )
 {
-  // Lock while adding image to the delete queue
+  // Lock while remove task from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  if( mIsThreadWaiting ) // no rasterization is ongoing, save to delete
+  QueuedTaskContainer::iterator it = mQueuedTasks.find( key );
+  if( it != mQueuedTasks.end() )
   {
-    // TODO: what?
+    mRasterizeTasks[it->second.priority].erase( it->second.position );
+    mQueuedTasks.erase( it );
   }
-  else // wait to delete until current rasterization completed.
+}
+
+RasterizingTaskPtr SvgRasterizeManager::NextCompletedTask()
+{
+  // Lock while popping task out from the queue
+  Mutex::ScopedLock lock( mMutex );
+
+  if( mCompletedTasks.empty() )
   {
-    mDeleteSvg.PushBack( &vectorRenderer );
+    return RasterizingTaskPtr();
   }
+
+  std::vector< RasterizingTaskPtr >::iterator next = mCompletedTasks.begin();
+  RasterizingTaskPtr nextTask = *next;
+  mCompletedTasks.erase( next );
+
+  return nextTask;
 }
 
-RasterizingTaskPtr SvgRasterizeThread::NextTaskToProcess()
+RasterizingTaskPtr SvgRasterizeManager::NextTaskToProcess()
 {
   // Lock while popping task out from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  // Delete the image here to make sure that it is not used in the nsvgRasterize()
-  if( !mDeleteSvg.Empty() )
+  // conditional wait
+  while( mQueuedTasks.empty() && !mDestroyThreads )
   {
-    mDeleteSvg.Clear();
+    ++mNumberOfWaitingThreads;
+    mConditionalWait.Wait( lock );
+    --mNumberOfWaitingThreads;
   }
 
-  // conditional wait
-  while( mRasterizeTasks.empty() )
+  if( mDestroyThreads )
   {
-    mIsThreadWaiting = true;
-    mConditionalWait.Wait( lock );
+    return RasterizingTaskPtr();
   }
-  mIsThreadWaiting = false;
 
-  // pop out the next task from the queue
-  std::vector< RasterizingTaskPtr >::iterator next = mRasterizeTasks.begin();
-  RasterizingTaskPtr nextTask = *next;
-  mRasterizeTasks.erase( next );
+  // pop out the next task from the queue with the highest priority
+  TaskQueue& queue = mRasterizeTasks[HIGH].empty() ? mRasterizeTasks[LOW] : mRasterizeTasks[HIGH];
+  RasterizingTaskPtr nextTask = queue.front();
+  queue.pop_front();
+  mQueuedTasks.erase( nextTask->GetKey() );
 
   return nextTask;
 }
 
-void SvgRasterizeThread::AddCompletedTask( RasterizingTaskPtr task )
+void SvgRasterizeManager::AddCompletedTask( RasterizingTaskPtr task )
 {
   // Lock while adding task to the queue
   Mutex::ScopedLock lock( mMutex );
@@ -263,19 +252,6 @@ void SvgRasterizeThread::AddCompletedTask( RasterizingTaskPtr task )
   mTrigger->Trigger();
 }
 
-void SvgRasterizeThread::Run()
-{
-  SetThreadName( "SVGThread" );
-  mLogFactory.InstallLogFunction();
-
-  while( RasterizingTaskPtr task = NextTaskToProcess() )
-  {
-    task->Load( );
-    task->Rasterize( );
-    AddCompletedTask( task );
-  }
-}
-
 } // namespace Internal
 
 } // namespace Toolkit
@@ -27,12 +27,14 @@
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
-#include <dali/devel-api/adaptor-framework/vector-image-renderer.h>
 #include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+#include <list>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
-#include <dali-toolkit/internal/visuals/visual-url.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 
 namespace Dali
 {
@@ -43,8 +45,6 @@ namespace Toolkit
 namespace Internal
 {
 
-class SvgVisual;
-typedef IntrusivePtr< SvgVisual > SvgVisualPtr;
 class RasterizingTask;
 typedef IntrusivePtr< RasterizingTask > RasterizingTaskPtr;
 
@@ -52,23 +52,23 @@ typedef IntrusivePtr< RasterizingTask > RasterizingTaskPtr;
  * The svg rasterizing tasks to be processed in the worker thread.
  *
  * Life cycle of a rasterizing task is as follows:
- * 1. Created by SvgVisual in the main thread
- * 2. Queued in the worked thread waiting to be processed.
- * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized image to material then been deleted in main thread call back
- *    Or if this task is been removed ( new image/size set to the visual or actor off stage) before its turn to be processed, it then been deleted in the worker thread.
+ * 1. Created by SvgVisual in the main thread, when the rasterization isn't in the SvgCache.
+ * 2. Queued in the SvgRasterizeManager waiting to be processed by one of its worker threads.
+ * 3. If this task gets its turn to do the rasterization, it triggers main thread to add the rasterized image to the cache, which applies it to the
+ *    visuals waiting for it, then been deleted in main thread call back.
+ *    Or if this task is been removed ( no visual waits for the rasterization anymore ) before its turn to be processed, it then been deleted in the worker thread.
  */
 class RasterizingTask : public RefObject
 {
 public:
   /**
    * Constructor
-   * @param[in] svgRenderer The renderer which the rasterized image to be applied.
-   * @param[in] url The URL to svg resource to use.
+   * @param[in] document The parsed svg to rasterize.
+   * @param[in] key The key of the rasterization in the SvgCache.
    * @param[in] width The rasterization width.
    * @param[in] height The rasterization height.
-   * @param[in] loaded The svg resource is loaded or not.
    */
-  RasterizingTask( SvgVisual* svgRenderer, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi, unsigned int width, unsigned int height, bool loaded );
+  RasterizingTask( SvgDocumentPtr document, const std::string& key, unsigned int width, unsigned int height );
 
   /**
    * Destructor.
@@ -76,14 +76,15 @@ public:
   ~RasterizingTask() override;
 
   /**
-   * Do the rasterization with the mRasterizer.
+   * Do the rasterization of the document.
    */
   void Rasterize();
 
   /**
-   * Get the svg visual
+   * Get the key of the rasterization in the SvgCache.
+   * @return The key.
    */
-  SvgVisual* GetSvgVisual() const;
+  const std::string& GetKey() const;
 
   /**
    * Get the rasterization result.
@@ -92,18 +93,7 @@ public:
   PixelData GetPixelData() const;
 
   /**
-   * Get the VectorRenderer.
-   * @return VectorRenderer.
-   */
-  VectorImageRenderer GetVectorRenderer() const;
-  /**
-   * Whether the resource is loaded.
-   * @return True if the resource is loaded.
-   */
-  bool IsLoaded() const;
-
-  /**
-   * Load svg file
+   * Load svg file, if it's a remote file not downloaded yet.
    */
   void Load();
 
@@ -115,18 +105,19 @@ private:
   RasterizingTask& operator=( const RasterizingTask& task );
 
 private:
-  SvgVisualPtr    mSvgVisual;
-  VectorImageRenderer mVectorRenderer;
-  VisualUrl       mUrl;
+  SvgDocumentPtr  mDocument;
+  std::string     mKey;
   PixelData       mPixelData;
-  float           mDpi;
   unsigned int    mWidth;
   unsigned int    mHeight;
-  bool            mLoaded;
 };
 
+class SvgRasterizeManager;
+
 /**
- * The worker thread for SVG rasterization.
+ * A worker thread for SVG rasterization.
+ *
+ * The workers of a SvgRasterizeManager share its queue of tasks.
  */
 class SvgRasterizeThread : public Thread
 {
@@ -135,96 +126,153 @@ public:
   /**
    * Constructor.
    *
-   * @param[in] trigger The trigger to wake up the main thread.
+   * @param[in] manager The manager which owns the queue of the tasks.
    */
-  SvgRasterizeThread( EventThreadCallback* trigger );
+  SvgRasterizeThread( SvgRasterizeManager& manager );
 
   /**
-   * Terminate the svg rasterize thread, join and delete.
+   * Destructor.
    */
-  static void TerminateThread( SvgRasterizeThread*& thread );
+  ~SvgRasterizeThread() override;
+
+protected:
 
   /**
-   * Add a rasterization task into the waiting queue, called by main thread.
-   *
-   * @param[in] task The task added to the queue.
+   * The entry function of the worker thread.
+   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
    */
-  void AddTask( RasterizingTaskPtr task );
+  void Run() override;
+
+private:
+
+  // Undefined
+  SvgRasterizeThread( const SvgRasterizeThread& thread );
+
+  // Undefined
+  SvgRasterizeThread& operator=( const SvgRasterizeThread& thread );
+
+private:
+
+  SvgRasterizeManager&             mManager;
+  const Dali::LogFactoryInterface& mLogFactory;
+};
+
+/**
+ * The pool of the worker threads for SVG rasterization.
+ *
+ * The tasks wait in two queues, one for the visuals on screen and one for the others, so the visible icons
+ * are rasterized first. The queued tasks are indexed by their key so they're cancelled or re-prioritised
+ * in constant time.
+ *
+ * The workers are started on demand, up to the number given by the DALI_SVG_RASTERIZE_THREADS environment
+ * variable or 4 by default.
+ */
+class SvgRasterizeManager
+{
+public:
 
   /**
-   * Pop the next task out from the completed queue, called by main thread.
-   *
-   * @return The next task in the completed queue.
+   * The priority of a rasterization.
    */
-  RasterizingTaskPtr NextCompletedTask();
+  enum Priority
+  {
+    HIGH, ///< The visual is visible on screen.
+    LOW   ///< The visual is on scene but not visible yet.
+  };
 
   /**
-   * Remove the task with the given visual from the waiting queue, called by main thread.
-   *
-   * Typically called when the actor is put off stage, so the renderer is not needed anymore.
+   * Constructor.
    *
-   * @param[in] visual The visual pointer.
+   * @param[in] trigger The trigger to wake up the main thread.
    */
-  void RemoveTask( SvgVisual* visual );
+  SvgRasterizeManager( EventThreadCallback* trigger );
 
   /**
-   * Delete the parsed SVG image, called by main thread.
+   * Destructor. Stops and joins the worker threads.
+   */
+  ~SvgRasterizeManager();
+
+  /**
+   * Add a rasterization task into the waiting queue, called by main thread.
    *
-   * The parsed svg should be deleted in worker thread, as the main thread does not know whether a rasterization of this svg is ongoing.
+   * If a task with the same key is already waiting, it's kept and only its priority is raised if needed.
    *
-   * @param[in] VectorImage The image to be deleted
+   * @param[in] task The task added to the queue.
+   * @param[in] priority The priority of the task.
    */
-  void DeleteImage( VectorImageRenderer vectorImage );
-
-private:
+  void AddTask( RasterizingTaskPtr task, Priority priority );
 
   /**
-   * Pop the next task out from the queue.
+   * Change the priority of a waiting task, called by main thread.
    *
-   * @return The next task to be processed.
+   * @param[in] key The key of the rasterization in the SvgCache.
+   * @param[in] priority The new priority.
    */
-  RasterizingTaskPtr NextTaskToProcess();
+  void SetTaskPriority( const std::string& key, Priority priority );
 
   /**
-   * Add a task in to the queue
+   * Remove the task with the given key from the waiting queue, called by main thread.
    *
-   * @param[in] task The task added to the queue.
+   * Typically called when the actors of all the visuals waiting for the rasterization are put off stage.
+   *
+   * @param[in] key The key of the rasterization in the SvgCache.
    */
-  void AddCompletedTask( RasterizingTaskPtr task );
-
-protected:
+  void RemoveTask( const std::string& key );
 
   /**
-   * Destructor.
+   * Pop the next task out from the completed queue, called by main thread.
+   *
+   * @return The next task in the completed queue.
    */
-  ~SvgRasterizeThread() override;
+  RasterizingTaskPtr NextCompletedTask();
 
+  /**
+   * Pop the next task out from the waiting queues, called by the worker threads.
+   *
+   * Waits until a task is added.
+   *
+   * @return The next task to be processed or an empty handle if the workers are stopped.
+   */
+  RasterizingTaskPtr NextTaskToProcess();
 
   /**
-   * The entry function of the worker thread.
-   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
+   * Add a task in to the completed queue and wake up the main thread, called by the worker threads.
+   *
+   * @param[in] task The completed task.
    */
-  void Run() override;
+  void AddCompletedTask( RasterizingTaskPtr task );
 
 private:
 
   // Undefined
-  SvgRasterizeThread( const SvgRasterizeThread& thread );
+  SvgRasterizeManager( const SvgRasterizeManager& manager );
 
   // Undefined
-  SvgRasterizeThread& operator=( const SvgRasterizeThread& thread );
+  SvgRasterizeManager& operator=( const SvgRasterizeManager& manager );
 
 private:
 
-  std::vector<RasterizingTaskPtr>  mRasterizeTasks;     //The queue of the tasks waiting to rasterize the SVG image
-  std::vector <RasterizingTaskPtr> mCompletedTasks;     //The queue of the tasks with the SVG rasterization completed
-  Vector <VectorImageRenderer*>    mDeleteSvg;          //The images that the event thread requested to delete
+  typedef std::list< RasterizingTaskPtr > TaskQueue;
+
+  struct QueuedTask
+  {
+    Priority            priority; ///< The queue of the task.
+    TaskQueue::iterator position; ///< The position of the task in its queue.
+  };
+
+  typedef std::unordered_map< std::string, QueuedTask > QueuedTaskContainer;
+
+  TaskQueue                                            mRasterizeTasks[LOW + 1]; ///< The queues of the tasks waiting to rasterize the SVG image, by priority
+  QueuedTaskContainer                                  mQueuedTasks;             ///< The waiting tasks, by key
+  std::vector< RasterizingTaskPtr >                    mCompletedTasks;          ///< The queue of the tasks with the SVG rasterization completed
+  std::vector< std::unique_ptr< SvgRasterizeThread > > mThreads;                 ///< The worker threads, started on demand
 
-  ConditionalWait            mConditionalWait;
-  Dali::Mutex                mMutex;
+  ConditionalWait                        mConditionalWait;
+  Dali::Mutex                            mMutex;
   std::unique_ptr< EventThreadCallback > mTrigger;
-  const Dali::LogFactoryInterface&       mLogFactory;
-  bool                       mIsThreadWaiting;
+  size_t                                 mMaxNumberOfThreads;
+  size_t                                 mNumberOfWaitingThreads;
+  bool                                   mDestroyThreads;
 };
 
 } // namespace Internal
@@ -25,10 +25,10 @@
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
 #include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/stage.h>
-#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -45,6 +45,32 @@ namespace
 // property name
 const Dali::Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 
+/**
+ * @brief Whether the actor and all its parents are visible and the actor is within the stage.
+ *
+ * @param[in] actor The actor to check
+ * @return True if the actor is visible on screen
+ */
+bool IsOnScreen( Actor actor )
+{
+  for( Actor parent = actor; parent; parent = parent.GetParent() )
+  {
+    if( !parent.GetProperty< bool >( Actor::Property::VISIBLE ) )
+    {
+      return false;
+    }
+  }
+
+  bool positionUsesAnchorPoint = actor.GetProperty< bool >( Actor::Property::POSITION_USES_ANCHOR_POINT );
+  Vector3 actorSize = actor.GetProperty< Vector3 >( Actor::Property::SIZE ) * actor.GetCurrentProperty< Vector3 >( Actor::Property::WORLD_SCALE );
+  Vector3 anchorPointOffSet = actorSize * ( positionUsesAnchorPoint ? actor.GetProperty< Vector3 >( Actor::Property::ANCHOR_POINT ) : AnchorPoint::TOP_LEFT );
+  Vector2 screenPosition = actor.GetProperty( Actor::Property::SCREEN_POSITION ).Get< Vector2 >() - Vector2( anchorPointOffSet );
+  Vector2 stageSize = Stage::GetCurrent().GetSize();
+
+  return ( screenPosition.x < stageSize.width ) && ( screenPosition.x + actorSize.x >= 0.f ) &&
+         ( screenPosition.y < stageSize.height ) && ( screenPosition.y + actorSize.y >= 0.f );
+}
+
 }
 
 SvgVisualPtr SvgVisual::New( VisualFactoryCache& factoryCache, ImageVisualShaderFactory& shaderFactory, const VisualUrl& imageUrl, const Property::Map& properties )
@@ -67,11 +93,14 @@ SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageVisualShaderFactory
   mImageVisualShaderFactory( shaderFactory ),
   mAtlasRect( FULL_TEXTURE_RECT ),
   mImageUrl( imageUrl ),
-  mVectorRenderer( VectorImageRenderer::New() ),
+  mDocument(),
+  mRasterizationKey(),
+  mDpi( 0.f ),
   mDefaultWidth( 0 ),
   mDefaultHeight( 0 ),
   mLoaded( false ),
   mPlacementActor(),
+  mSceneActor(),
   mVisualSize(Vector2::ZERO),
   mAttemptAtlasing( false )
 {
@@ -81,6 +110,15 @@ SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageVisualShaderFactory
 
 SvgVisual::~SvgVisual()
 {
+  if( Stage::IsInstalled() )
+  {
+    ReleaseRasterization();
+
+    if( mDocument )
+    {
+      mFactoryCache.GetSvgCache().ReleaseDocument( mImageUrl, mDpi );
+    }
+  }
 }
 
 void SvgVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -145,9 +183,10 @@ void SvgVisual::DoSetOnScene( Actor& actor )
   }
   else
   {
-    shader = Shader::New( mImpl->mCustomShader->mVertexShader.empty() ? mImageVisualShaderFactory.GetVertexShaderSource() : mImpl->mCustomShader->mVertexShader,
-                          mImpl->mCustomShader->mFragmentShader.empty() ? mImageVisualShaderFactory.GetFragmentShaderSource() : mImpl->mCustomShader->mFragmentShader,
-                          mImpl->mCustomShader->mHints );
+    shader = ShaderRegistry::Get().NewShader( "SvgVisual",
+                                              mImpl->mCustomShader->mVertexShader.empty() ? mImageVisualShaderFactory.GetVertexShaderSource() : mImpl->mCustomShader->mVertexShader,
+                                              mImpl->mCustomShader->mFragmentShader.empty() ? mImageVisualShaderFactory.GetFragmentShaderSource() : mImpl->mCustomShader->mFragmentShader,
+                                              mImpl->mCustomShader->mHints );
 
     shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
   }
@@ -164,6 +203,9 @@ void SvgVisual::DoSetOnScene( Actor& actor )
 
   // Hold the weak handle of the placement actor and delay the adding of renderer until the svg rasterization is finished.
   mPlacementActor = actor;
+  mSceneActor = actor;
+
+  DevelActor::VisibilityChangedSignal( actor ).Connect( this, &SvgVisual::OnControlVisibilityChanged );
 
   // SVG visual needs it's size set before it can be rasterized hence set ResourceReady once on stage
   ResourceReady( Toolkit::Visual::ResourceStatus::READY );
@@ -171,11 +213,14 @@ void SvgVisual::DoSetOnScene( Actor& actor )
 
 void SvgVisual::DoSetOffScene( Actor& actor )
 {
-  mFactoryCache.GetSVGRasterizationThread()->RemoveTask( this );
+  ReleaseRasterization();
+
+  DevelActor::VisibilityChangedSignal( actor ).Disconnect( this, &SvgVisual::OnControlVisibilityChanged );
 
   actor.RemoveRenderer( mImpl->mRenderer );
   mImpl->mRenderer.Reset();
   mPlacementActor.Reset();
+  mSceneActor.Reset();
 
   // Reset the visual size to zero so that when adding the actor back to stage the SVG rasterization is forced
   mVisualSize = Vector2::ZERO;
@@ -213,27 +258,17 @@ void SvgVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
 
 void SvgVisual::Load()
 {
-  // load remote resource on svg rasterize thread.
-  if(!mLoaded && mImageUrl.IsLocalResource())
+  // Local files are parsed by the svg cache, remote files on svg rasterize thread.
+  if( !mDocument )
   {
-    Dali::Vector<uint8_t> buffer;
-    if(Dali::FileLoader::ReadFile(mImageUrl.GetUrl(), buffer))
-    {
-      buffer.PushBack('\0');
+    Vector2 dpi = Stage::GetCurrent().GetDpi();
+    mDpi = ( dpi.height + dpi.width ) * 0.5f;
 
-      Vector2 dpi = Stage::GetCurrent().GetDpi();
-      float meanDpi = (dpi.height + dpi.width) * 0.5f;
-      if(!mVectorRenderer.Load(buffer, meanDpi))
-      {
-        DALI_LOG_ERROR("SvgVisual::Load: Failed to load file! [%s]\n", mImageUrl.GetUrl().c_str());
-        return;
-      }
-      mVectorRenderer.GetDefaultSize(mDefaultWidth, mDefaultHeight);
-      mLoaded = true;
-    }
-    else
+    mDocument = mFactoryCache.GetSvgCache().RequestDocument( mImageUrl, mDpi );
+    if( mDocument->IsLoaded() )
     {
-      DALI_LOG_ERROR("SvgVisual::Load: Failed to read file! [%s]\n", mImageUrl.GetUrl().c_str());
+      mDocument->GetDefaultSize( mDefaultWidth, mDefaultHeight );
+      mLoaded = true;
     }
   }
 }
@@ -245,28 +280,81 @@ void SvgVisual::AddRasterizationTask( const Vector2& size )
     unsigned int width = static_cast<unsigned int>(size.width);
     unsigned int height = static_cast<unsigned int>( size.height );
 
-    Vector2 dpi = Stage::GetCurrent().GetDpi();
-    float meanDpi = ( dpi.height + dpi.width ) * 0.5f;
+    SvgCache& svgCache = mFactoryCache.GetSvgCache();
+    const std::string key = SvgCache::GetRasterizationKey( mImageUrl, width, height, mDpi );
+    if( key == mRasterizationKey )
+    {
+      // The rasterization of this size is already applied or requested.
+      return;
+    }
+
+    ReleaseRasterization();
+    mRasterizationKey = key;
 
-    RasterizingTaskPtr newTask = new RasterizingTask(this, mVectorRenderer, mImageUrl, meanDpi, width, height, mLoaded);
-    if(IsSynchronousLoadingRequired())
+    Texture texture;
+    const SvgCache::RasterizationState state = svgCache.RequestRasterization( key, this, texture );
+    if( SvgCache::RASTERIZED == state )
     {
-      newTask->Load();
-      newTask->Rasterize();
-      ApplyRasterizedImage(newTask->GetVectorRenderer(), newTask->GetPixelData(), newTask->IsLoaded());
+      // Another visual has already rasterized the svg with the same size.
+      ApplyRasterizedImage( texture, PixelData() );
+    }
+    else if( IsSynchronousLoadingRequired() )
+    {
+      mDocument->Load( true );
+      svgCache.RasterizationCompleted( key, mDocument->Rasterize( width, height ) );
     }
     else
     {
-      mFactoryCache.GetSVGRasterizationThread()->AddTask( newTask );
+      // Rasterize the icons visible on screen before the ones scrolled out or hidden.
+      Actor actor = mSceneActor.GetHandle();
+      const SvgRasterizeManager::Priority priority = ( actor && IsOnScreen( actor ) ) ? SvgRasterizeManager::HIGH : SvgRasterizeManager::LOW;
+
+      if( SvgCache::NOT_RASTERIZED == state )
+      {
+        RasterizingTaskPtr newTask = new RasterizingTask( mDocument, key, width, height );
+        mFactoryCache.GetSvgRasterizeManager().AddTask( newTask, priority );
+      }
+      else if( SvgRasterizeManager::HIGH == priority )
+      {
+        // Another visual waits for the same rasterization, which may be still queued with a low priority.
+        mFactoryCache.GetSvgRasterizeManager().SetTaskPriority( key, priority );
+      }
     }
   }
 }
 
-void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelData rasterizedPixelData, bool isLoaded )
+void SvgVisual::ReleaseRasterization()
 {
-  mLoaded = isLoaded;
+  if( !mRasterizationKey.empty() )
+  {
+    if( mFactoryCache.GetSvgCache().ReleaseRasterization( mRasterizationKey, this ) )
+    {
+      // No other visual waits for the rasterization.
+      mFactoryCache.GetSvgRasterizeManager().RemoveTask( mRasterizationKey );
+    }
+    mRasterizationKey.clear();
+  }
+}
+
+void SvgVisual::OnControlVisibilityChanged( Actor actor, bool visible, DevelActor::VisibilityChange::Type type )
+{
+  // The priority is only raised: other visuals, which may be on screen, can wait for the same rasterization.
+  if( visible && !mRasterizationKey.empty() && IsOnScreen( actor ) )
+  {
+    mFactoryCache.GetSvgRasterizeManager().SetTaskPriority( mRasterizationKey, SvgRasterizeManager::HIGH );
+  }
+}
+
+void SvgVisual::ApplyRasterizedImage( Texture texture, PixelData rasterizedPixelData )
+{
+  if( texture && !mLoaded )
+  {
+    // The remote file has been downloaded by the rasterize thread.
+    mDocument->GetDefaultSize( mDefaultWidth, mDefaultHeight );
+    mLoaded = true;
+  }
 
-  if(isLoaded && rasterizedPixelData && IsOnScene())
+  if( texture && IsOnScene() )
   {
     TextureSet currentTextureSet = mImpl->mRenderer.GetTextures();
     if( mImpl->mFlags & Impl::IS_ATLASING_APPLIED )
@@ -276,7 +364,8 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
 
     TextureSet textureSet;
 
-    if( mAttemptAtlasing && !mImpl->mCustomShader )
+    // The pixels are only available to the visuals which waited for the rasterization. The others use the shared texture.
+    if( mAttemptAtlasing && !mImpl->mCustomShader && rasterizedPixelData )
     {
       Vector4 atlasRect;
       textureSet = mFactoryCache.GetAtlasManager()->Add(atlasRect, rasterizedPixelData );
@@ -294,9 +383,6 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
 
     if( !textureSet ) // no atlasing - mAttemptAtlasing is false or adding to atlas is failed
     {
-      Texture texture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888,
-                                      rasterizedPixelData.GetWidth(), rasterizedPixelData.GetHeight() );
-      texture.Upload( rasterizedPixelData );
       mImpl->mFlags &= ~Impl::IS_ATLASING_APPLIED;
 
       if( mAtlasRect == FULL_TEXTURE_RECT )
@@ -330,7 +416,7 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
     // Svg loaded and ready to display
     ResourceReady( Toolkit::Visual::ResourceStatus::READY );
   }
-  else if(!isLoaded || !rasterizedPixelData)
+  else if( !texture )
   {
     ResourceReady( Toolkit::Visual::ResourceStatus::FAILED );
   }
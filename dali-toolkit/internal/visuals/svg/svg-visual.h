@@ -21,8 +21,10 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/object/weak-handle.h>
+#include <dali/devel-api/actors/actor-devel.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 
@@ -49,7 +51,7 @@ typedef IntrusivePtr< SvgVisual > SvgVisualPtr;
  * | url                      | STRING           |
  *
  */
-class SvgVisual: public Visual::Base
+class SvgVisual: public Visual::Base, public ConnectionTracker
 {
 public:
 
@@ -143,11 +145,10 @@ public:
   /**
    * @bried Apply the rasterized image to the visual.
    *
-   * @param[in] vectorImage The data of vector image.
-   * @param[in] rasterizedPixelData The pixel buffer with the rasterized pixels
-   * @param[in] bool Whether the resource is loaded
+   * @param[in] texture The texture shared by the visuals with the same rasterization, or an empty handle if the rasterization failed
+   * @param[in] rasterizedPixelData The pixel buffer with the rasterized pixels, if the image has just been rasterized
    */
-  void ApplyRasterizedImage( VectorImageRenderer vectorImage, PixelData rasterizedPixelData, bool isLoaded );
+  void ApplyRasterizedImage( Texture texture, PixelData rasterizedPixelData );
 
 private:
   /**
@@ -162,6 +163,18 @@ private:
    */
   void AddRasterizationTask( const Vector2& size );
 
+  /**
+   * @brief Releases the rasterized image from the svg cache and cancels its rasterization if no other visual waits for it.
+   */
+  void ReleaseRasterization();
+
+  /**
+   * @brief Callback when the visibility of the actor is changed.
+   *
+   * Raises the priority of the rasterization still queued when the actor becomes visible on screen.
+   */
+  void OnControlVisibilityChanged( Actor actor, bool visible, DevelActor::VisibilityChange::Type type );
+
   /**
    * Helper method to set individual values by index key.
    * @param[in] index The index key of the value
@@ -179,11 +192,14 @@ private:
   ImageVisualShaderFactory& mImageVisualShaderFactory;
   Vector4                   mAtlasRect;
   VisualUrl                 mImageUrl;
-  VectorImageRenderer       mVectorRenderer;
+  SvgDocumentPtr            mDocument;         ///< The parsed svg, shared by the visuals with the same url
+  std::string               mRasterizationKey; ///< The key of the rasterized image in the svg cache
+  float                     mDpi;
   uint32_t                  mDefaultWidth;
   uint32_t                  mDefaultHeight;
   bool                      mLoaded;
   WeakHandle<Actor>         mPlacementActor;
+  WeakHandle<Actor>         mSceneActor;       ///< The actor while the visual is on scene, to rasterize the visible images first
   Vector2                   mVisualSize;
   bool                      mAttemptAtlasing;  ///< If true will attempt atlasing, otherwise create unique texture
 };
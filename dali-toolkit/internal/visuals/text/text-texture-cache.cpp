@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/text/text-texture-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const size_t DEFAULT_MEMORY_BUDGET = 4u * 1024u * 1024u; ///< The default memory of the unused textures kept in the cache, in bytes.
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, true, "LOG_TEXT_TEXTURE_CACHE" );
+#endif
+
+} // namespace
+
+TextTextureCache::TextTextureCache()
+: mEntries(),
+  mUnusedKeys(),
+  mMemoryBudget( DEFAULT_MEMORY_BUDGET ),
+  mMetrics()
+{
+}
+
+TextTextureCache::~TextTextureCache()
+{
+}
+
+TextureSet TextTextureCache::Request( const std::string& key )
+{
+  EntryContainer::iterator it = mEntries.find( key );
+  if( it == mEntries.end() )
+  {
+    ++mMetrics.misses;
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "TextTextureCache::Request miss. hits:%d, misses:%d\n", mMetrics.hits, mMetrics.misses );
+    return TextureSet();
+  }
+
+  Entry& entry = it->second;
+  if( 0u == entry.referenceCount )
+  {
+    // The texture is used again.
+    mUnusedKeys.erase( entry.unusedIt );
+    mMetrics.unusedMemory -= entry.memory;
+  }
+  ++entry.referenceCount;
+
+  ++mMetrics.hits;
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "TextTextureCache::Request hit. hits:%d, misses:%d\n", mMetrics.hits, mMetrics.misses );
+
+  return entry.textureSet;
+}
+
+void TextTextureCache::Add( const std::string& key, TextureSet textureSet, size_t memory )
+{
+  Entry& entry = mEntries[key];
+  if( entry.textureSet )
+  {
+    // Already added by another visual. Only add the reference.
+    if( 0u == entry.referenceCount )
+    {
+      mUnusedKeys.erase( entry.unusedIt );
+      mMetrics.unusedMemory -= entry.memory;
+    }
+    ++entry.referenceCount;
+    return;
+  }
+
+  entry.textureSet = textureSet;
+  entry.memory = memory;
+  entry.referenceCount = 1u;
+
+  mMetrics.memory += memory;
+}
+
+void TextTextureCache::Release( const std::string& key )
+{
+  EntryContainer::iterator it = mEntries.find( key );
+  if( ( it == mEntries.end() ) || ( 0u == it->second.referenceCount ) )
+  {
+    return;
+  }
+
+  Entry& entry = it->second;
+  --entry.referenceCount;
+
+  if( 0u == entry.referenceCount )
+  {
+    // Keep the texture as the most recently used one.
+    entry.unusedIt = mUnusedKeys.insert( mUnusedKeys.end(), key );
+    mMetrics.unusedMemory += entry.memory;
+
+    Evict();
+  }
+}
+
+void TextTextureCache::SetMemoryBudget( size_t budget )
+{
+  mMemoryBudget = budget;
+  Evict();
+}
+
+const TextTextureCache::Metrics& TextTextureCache::GetMetrics() const
+{
+  return mMetrics;
+}
+
+void TextTextureCache::Evict()
+{
+  while( ( mMetrics.unusedMemory > mMemoryBudget ) && !mUnusedKeys.empty() )
+  {
+    EntryContainer::iterator it = mEntries.find( mUnusedKeys.front() );
+    mUnusedKeys.pop_front();
+
+    mMetrics.memory -= it->second.memory;
+    mMetrics.unusedMemory -= it->second.memory;
+    ++mMetrics.evictions;
+
+    mEntries.erase( it );
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "TextTextureCache::Evict memory:%zu, unused memory:%zu, evictions:%d\n", mMetrics.memory, mMetrics.unusedMemory, mMetrics.evictions );
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
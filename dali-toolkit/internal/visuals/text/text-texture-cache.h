@@ -0,0 +1,166 @@
+#ifndef DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <dali/public-api/rendering/texture-set.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Cache of the textures rendered by the text visuals which share their texture.
+ *
+ * The textures are found by a key which describes everything that changes the rendered pixels,
+ * i.e. the text, its style properties, the layout size and the render behaviour.
+ *
+ * The textures are reference counted. The ones which are not used by any visual are kept
+ * in a least recently used list until their memory exceeds the cache's budget.
+ */
+class TextTextureCache
+{
+public:
+
+  /**
+   * @brief Metrics of the cache.
+   */
+  struct Metrics
+  {
+    Metrics()
+    : hits( 0u ),
+      misses( 0u ),
+      evictions( 0u ),
+      memory( 0u ),
+      unusedMemory( 0u )
+    {}
+
+    uint32_t hits;         ///< The number of requests which found a texture.
+    uint32_t misses;       ///< The number of requests which didn't find a texture.
+    uint32_t evictions;    ///< The number of textures removed to keep the cache within its budget.
+    size_t   memory;       ///< The memory of all the textures in the cache, in bytes.
+    size_t   unusedMemory; ///< The memory of the textures not used by any visual, in bytes.
+  };
+
+  /**
+   * @brief Constructor.
+   */
+  TextTextureCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~TextTextureCache();
+
+  /**
+   * @brief Retrieves the texture set rendered for the given key and adds a reference to it.
+   *
+   * @param[in] key The key of the rendered text.
+   *
+   * @return The texture set or an empty handle if it's not in the cache.
+   */
+  TextureSet Request( const std::string& key );
+
+  /**
+   * @brief Adds a texture set to the cache with one reference.
+   *
+   * @param[in] key The key of the rendered text.
+   * @param[in] textureSet The texture set.
+   * @param[in] memory The memory used by the textures of the set, in bytes.
+   */
+  void Add( const std::string& key, TextureSet textureSet, size_t memory );
+
+  /**
+   * @brief Removes a reference of a texture set.
+   *
+   * The texture set is kept in the cache while the memory of the unused textures is within the budget.
+   *
+   * @param[in] key The key of the rendered text.
+   */
+  void Release( const std::string& key );
+
+  /**
+   * @brief Sets the maximum memory of the textures kept in the cache when no visual uses them.
+   *
+   * @param[in] budget The memory budget, in bytes.
+   */
+  void SetMemoryBudget( size_t budget );
+
+  /**
+   * @brief Retrieves the metrics of the cache.
+   *
+   * @return The metrics.
+   */
+  const Metrics& GetMetrics() const;
+
+private:
+
+  /**
+   * @brief Removes the least recently used textures until the memory of the unused ones is within the budget.
+   */
+  void Evict();
+
+  // Undefined
+  TextTextureCache( const TextTextureCache& );
+
+  // Undefined
+  TextTextureCache& operator=( const TextTextureCache& );
+
+private:
+
+  typedef std::list<std::string> KeyList;
+
+  struct Entry
+  {
+    Entry()
+    : textureSet(),
+      memory( 0u ),
+      referenceCount( 0u ),
+      unusedIt()
+    {}
+
+    TextureSet        textureSet;     ///< The rendered text.
+    size_t            memory;         ///< The memory of the textures, in bytes.
+    uint32_t          referenceCount; ///< The number of visuals using the textures.
+    KeyList::iterator unusedIt;       ///< The position in the list of unused textures. Only valid if there is no reference.
+  };
+
+  typedef std::unordered_map<std::string, Entry> EntryContainer;
+
+  EntryContainer mEntries;      ///< The cached textures.
+  KeyList        mUnusedKeys;   ///< The keys of the textures not used, the least recently used first.
+  size_t         mMemoryBudget; ///< The maximum memory of the unused textures.
+  Metrics        mMetrics;      ///< The metrics of the cache.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_TEXT_TEXTURE_CACHE_H
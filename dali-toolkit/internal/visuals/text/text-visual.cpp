@@ -25,7 +25,9 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/window-devel.h>
 #include <dali/devel-api/images/pixel-data-devel.h>
+#include <dali/devel-api/common/stage.h>
 #include <string.h>
+#include <sstream>
 
 // INTERNAL HEADER
 #include <dali-toolkit/public-api/visuals/text-visual-properties.h>
@@ -41,6 +43,7 @@
 #include <dali-toolkit/internal/text/script-run.h>
 #include <dali-toolkit/internal/text/text-enumerations-impl.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -266,6 +269,10 @@ Dali::Property::Index StringKeyToIndexKey( const std::string& stringKey )
   {
     result = Toolkit::DevelTextVisual::Property::BACKGROUND;
   }
+  else if( stringKey == SHARE_TEXTURE_PROPERTY )
+  {
+    result = Toolkit::DevelTextVisual::Property::SHARE_TEXTURE;
+  }
 
   return result;
 }
@@ -301,6 +308,16 @@ TextVisualPtr TextVisual::New( VisualFactoryCache& factoryCache, const Property:
   return TextVisualPtr;
 }
 
+void TextVisual::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT );
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT );
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE );
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE );
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_EMOJI );
+  registry.AddVariant( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE_AND_EMOJI );
+}
+
 Property::Map TextVisual::ConvertStringKeysToIndexKeys( const Property::Map& propertyMap )
 {
   Property::Map outMap;
@@ -371,6 +388,8 @@ void TextVisual::DoCreatePropertyMap( Property::Map& map ) const
 
   GetBackgroundProperties( mController, value, Text::EffectStyle::DEFAULT );
   map.Insert( Toolkit::DevelTextVisual::Property::BACKGROUND, value );
+
+  map.Insert( Toolkit::DevelTextVisual::Property::SHARE_TEXTURE, mShareTexture );
 }
 
 void TextVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
@@ -388,12 +407,20 @@ TextVisual::TextVisual( VisualFactoryCache& factoryCache )
   mController( Text::Controller::New() ),
   mTypesetter( Text::Typesetter::New( mController->GetTextModel() ) ),
   mAnimatableTextColorPropertyIndex( Property::INVALID_INDEX ),
-  mRendererUpdateNeeded( false )
+  mRendererUpdateNeeded( false ),
+  mShareTexture( false ),
+  mRendererList(),
+  mTextureCacheKey()
 {
 }
 
 TextVisual::~TextVisual()
 {
+  // The factory cache could have been deleted before the visual (e.g. due to stage shutdown).
+  if( Stage::IsInstalled() )
+  {
+    ReleaseSharedTexture();
+  }
 }
 
 void TextVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -475,6 +502,34 @@ void TextVisual::RemoveRenderer( Actor& actor )
   }
   // Clear the renderer list
   mRendererList.clear();
+
+  // The renderer doesn't use the shared texture anymore.
+  ReleaseSharedTexture();
+}
+
+std::string TextVisual::GetTextureCacheKey( const Vector2& size, Dali::LayoutDirection::Type layoutDirection, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled ) const
+{
+  // The property map has the text and all its style properties.
+  Property::Map map;
+  DoCreatePropertyMap( map );
+
+  std::ostringstream key;
+  key << map
+      << size.width << 'x' << size.height
+      << ',' << static_cast<int>( layoutDirection )
+      << ',' << static_cast<int>( mController->GetTextDirection() )
+      << ',' << hasMultipleTextColors << containsColorGlyph << styleEnabled;
+
+  return key.str();
+}
+
+void TextVisual::ReleaseSharedTexture()
+{
+  if( !mTextureCacheKey.empty() )
+  {
+    mFactoryCache.GetTextTextureCache().Release( mTextureCacheKey );
+    mTextureCacheKey.clear();
+  }
 }
 
 void TextVisual::DoSetOffScene( Actor& actor )
@@ -585,6 +640,11 @@ void TextVisual::DoSetProperty( Dali::Property::Index index, const Dali::Propert
       SetBackgroundProperties( mController, propertyValue, Text::EffectStyle::DEFAULT );
       break;
     }
+    case Toolkit::DevelTextVisual::Property::SHARE_TEXTURE:
+    {
+      mShareTexture = propertyValue.Get<bool>();
+      break;
+    }
   }
 }
 
@@ -682,8 +742,13 @@ void TextVisual::UpdateRenderer()
 
       const bool styleEnabled = ( shadowEnabled || underlineEnabled || outlineEnabled || backgroundEnabled );
 
+      std::string textureCacheKey;
+      if( mShareTexture )
+      {
+        textureCacheKey = GetTextureCacheKey( relayoutSize, layoutDirection, hasMultipleTextColors, containsColorGlyph, styleEnabled );
+      }
 
-      AddRenderer( control, relayoutSize, hasMultipleTextColors, containsColorGlyph, styleEnabled );
+      AddRenderer( control, relayoutSize, hasMultipleTextColors, containsColorGlyph, styleEnabled, textureCacheKey );
 
       // Text rendered and ready to display
       ResourceReady( Toolkit::Visual::ResourceStatus::READY );
@@ -764,7 +829,7 @@ void TextVisual::CreateTextureSet( TilingInfo& info, Renderer& renderer, Sampler
 }
 
 
-void TextVisual::AddRenderer( Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled )
+void TextVisual::AddRenderer( Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, const std::string& textureCacheKey )
 {
   Shader shader = GetTextShader( mFactoryCache, hasMultipleTextColors, containsColorGlyph, styleEnabled );
   mImpl->mRenderer.SetShader( shader );
@@ -775,7 +840,33 @@ void TextVisual::AddRenderer( Actor& actor, const Vector2& size, bool hasMultipl
   // No tiling required. Use the default renderer.
   if( size.height < maxTextureSize )
   {
-    TextureSet textureSet = GetTextTexture( size, hasMultipleTextColors, containsColorGlyph, styleEnabled );
+    TextureSet textureSet;
+
+    if( !textureCacheKey.empty() )
+    {
+      // Use the texture rendered by another visual with the same text, style and size if there is one.
+      TextTextureCache& textureCache = mFactoryCache.GetTextTextureCache();
+      textureSet = textureCache.Request( textureCacheKey );
+
+      if( !textureSet )
+      {
+        textureSet = GetTextTexture( size, hasMultipleTextColors, containsColorGlyph, styleEnabled );
+
+        // The text texture, the style texture and the mask texture.
+        const size_t numberOfPixels = static_cast<size_t>( size.width ) * static_cast<size_t>( size.height );
+        const size_t bytesPerPixel = ( ( containsColorGlyph || hasMultipleTextColors ) ? 4u : 1u ) +
+                                     ( styleEnabled ? 4u : 0u ) +
+                                     ( ( containsColorGlyph && !hasMultipleTextColors ) ? 1u : 0u );
+
+        textureCache.Add( textureCacheKey, textureSet, numberOfPixels * bytesPerPixel );
+      }
+
+      mTextureCacheKey = textureCacheKey;
+    }
+    else
+    {
+      textureSet = GetTextTexture( size, hasMultipleTextColors, containsColorGlyph, styleEnabled );
+    }
 
     mImpl->mRenderer.SetTextures( textureSet );
     //Register transform properties
@@ -929,7 +1020,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_MULTI_COLOR_TEXT );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_MULTI_COLOR_TEXT, shader );
     }
@@ -940,7 +1031,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_MULTI_COLOR_TEXT_WITH_STYLE, shader );
     }
@@ -950,7 +1041,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT, shader );
     }
@@ -960,7 +1051,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE, shader );
     }
@@ -970,7 +1061,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_EMOJI );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_EMOJI );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_EMOJI );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_EMOJI, shader );
     }
@@ -980,7 +1071,7 @@ Shader TextVisual::GetTextShader( VisualFactoryCache& factoryCache, bool hasMult
     shader = factoryCache.GetShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE_AND_EMOJI );
     if( !shader )
     {
-      shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE_AND_EMOJI );
+      shader = ShaderRegistry::Get().GetShader( "TextVisual", VERTEX_SHADER, FRAGMENT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE_AND_EMOJI );
       shader.RegisterProperty( PIXEL_AREA_UNIFORM_NAME, FULL_TEXTURE_RECT );
       factoryCache.SaveShader( VisualFactoryCache::TEXT_SHADER_SINGLE_COLOR_TEXT_WITH_STYLE_AND_EMOJI, shader );
     }
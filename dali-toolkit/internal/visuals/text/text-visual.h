@@ -36,6 +36,7 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
 class TextVisual;
 typedef IntrusivePtr< TextVisual > TextVisualPtr;
 
@@ -64,6 +65,7 @@ typedef IntrusivePtr< TextVisual > TextVisualPtr;
  * | underline           | STRING  |
  * | shadow              | STRING  |
  * | outline             | STRING  |
+ * | shareTexture        | BOOLEAN |
  *
  */
 class TextVisual : public Visual::Base
@@ -79,6 +81,13 @@ public:
    */
   static TextVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
   /**
    * @brief Converts all strings keys in property map to index keys.  Property Map can then be merged correctly.
    * @param[in] propertyMap containing string keys or a mix of strings and indexes.
@@ -244,6 +253,24 @@ private:
    */
   void RemoveRenderer( Actor& actor );
 
+  /**
+   * @brief Builds the key used to share the text's texture with the other text visuals which render the same text.
+   *
+   * @param[in] size The texture size.
+   * @param[in] layoutDirection The layout direction used to relayout the text.
+   * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
+   * @param[in] containsColorGlyph Whether the text contains color glyph.
+   * @param[in] styleEnabled Whether the text contains any styles (e.g. shadow, underline, etc.).
+   *
+   * @return The key.
+   */
+  std::string GetTextureCacheKey( const Vector2& size, Dali::LayoutDirection::Type layoutDirection, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled ) const;
+
+  /**
+   * @brief Releases the shared texture used by the visual, if any.
+   */
+  void ReleaseSharedTexture();
+
   /**
    * @brief Create a texture in textureSet and add it.
    * @param[in] textureSet The textureSet to which the texture will be added.
@@ -281,8 +308,9 @@ private:
    * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
    * @param[in] containsColorGlyph Whether the text contains color glyph.
    * @param[in] styleEnabled Whether the text contains any styles (e.g. shadow, underline, etc.).
+   * @param[in] textureCacheKey The key of the shared texture. Empty if the texture is not shared.
    */
-  void AddRenderer( Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled );
+  void AddRenderer( Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, const std::string& textureCacheKey );
 
 
   /**
@@ -340,7 +368,9 @@ private:
   WeakHandle<Actor>   mControl;                           ///< The control where the renderer is added.
   Property::Index     mAnimatableTextColorPropertyIndex;  ///< The index of animatable text color property registered by the control.
   bool                mRendererUpdateNeeded:1;            ///< The flag to indicate whether the renderer needs to be updated.
+  bool                mShareTexture:1;                    ///< Whether the texture is shared with the other text visuals which render the same text.
   RendererContainer   mRendererList;
+  std::string         mTextureCacheKey;                   ///< The key of the shared texture used by the visual. Empty if it doesn't use one.
 };
 
 } // namespace Internal
@@ -212,6 +212,15 @@ TextureSet TextureManager::LoadAnimatedImageTexture(
   return textureSet;
 }
 
+void TextureManager::LoadAnimatedImagePixelBuffer(
+  Dali::AnimatedImageLoading animatedImageLoading, uint32_t frameIndex, TextureUploadObserver* textureObserver )
+{
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+  RequestLoadInternal( animatedImageLoading.GetUrl(), INVALID_TEXTURE_ID, 1.0f, ImageDimensions(), FittingMode::SCALE_TO_FILL,
+                       SamplingMode::BOX_THEN_LINEAR, TextureManager::NO_ATLAS, false, RETURN_PIXEL_BUFFER, textureObserver,
+                       true, TextureManager::ReloadPolicy::FORCED, preMultiply, animatedImageLoading, frameIndex );
+}
+
 Devel::PixelBuffer TextureManager::LoadPixelBuffer(
   const VisualUrl& url, Dali::ImageDimensions desiredSize, Dali::FittingMode::Type fittingMode, Dali::SamplingMode::Type samplingMode, bool synchronousLoading, TextureUploadObserver* textureObserver, bool orientationCorrection, TextureManager::MultiplyOnLoad& preMultiplyOnLoad )
 {
@@ -252,6 +261,14 @@ TextureSet TextureManager::LoadTexture(
   loadingStatus = false;
   textureRect = FULL_ATLAS_RECT;
 
+  // The GPU compressed textures are uploaded without being decoded, unless they are masked.
+  CompressedImagePtr compressedImage;
+  if( synchronousLoading && url.GetType() == VisualUrl::KTX && url.IsLocalResource() &&
+      ( !maskInfo || !maskInfo->mAlphaMaskUrl.IsValid() ) )
+  {
+    compressedImage = CompressedImage::New( url.GetUrl(), desiredSize );
+  }
+
   if( VisualUrl::TEXTURE == url.GetProtocolType())
   {
     std::string location = url.GetLocation();
@@ -269,6 +286,13 @@ TextureSet TextureManager::LoadTexture(
       }
     }
   }
+  else if( compressedImage )
+  {
+    atlasingStatus = false;
+    preMultiplyOnLoad = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+    textureSet = TextureSet::New();
+    textureSet.SetTexture( 0u, compressedImage->CreateTexture() );
+  }
   else if( synchronousLoading )
   {
     PixelData data;
@@ -840,10 +864,15 @@ void TextureManager::LoadTexture( TextureInfo& textureInfo, TextureUploadObserve
     }
     else
     {
+      // The GPU compressed textures are uploaded without being decoded, when their pixels aren't needed.
+      const bool loadCompressed = textureInfo.storageType == UPLOAD_TO_TEXTURE &&
+                                  textureInfo.useAtlas != USE_ATLAS && textureInfo.maskTextureId == INVALID_TEXTURE_ID;
+      // Without the rendering add-on, the opaque and transparent regions of the textures are found in the loading thread.
+      const bool analyseOpacity = loadCompressed && !RenderingAddOn::Get().IsValid();
       loadingHelperIt->Load(textureInfo.textureId, textureInfo.url,
                             textureInfo.desiredSize, textureInfo.fittingMode,
                             textureInfo.samplingMode, textureInfo.orientationCorrection,
-                            premultiplyOnLoad );
+                            premultiplyOnLoad, analyseOpacity, loadCompressed );
     }
   }
   ObserveTexture( textureInfo, observer );
@@ -889,16 +918,15 @@ void TextureManager::ObserveTexture( TextureInfo& textureInfo,
   }
 }
 
-void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingContainer, uint32_t id,
-                                        Devel::PixelBuffer pixelBuffer )
+void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingContainer, const LoadingTask& task )
 {
-  DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::AsyncLoadComplete( id:%d )\n", id );
+  DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::AsyncLoadComplete( id:%d )\n", task.id );
 
   if( loadingContainer.size() >= 1u )
   {
     AsyncLoadingInfo loadingInfo = loadingContainer.front();
 
-    if( loadingInfo.loadId == id )
+    if( loadingInfo.loadId == task.id )
     {
       int cacheIndex = GetCacheIndexFromId( loadingInfo.textureId );
       if( cacheIndex != INVALID_CACHE_INDEX )
@@ -911,8 +939,21 @@ void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingCo
 
         if( textureInfo.loadState != CANCELLED )
         {
-          // textureInfo can be invalidated after this call (as the mTextureInfoContainer may be modified)
-          PostLoad( textureInfo, pixelBuffer );
+          // The geometry of a reloaded texture is built again from the new regions.
+          textureInfo.opacityMap = task.opacityMap;
+          textureInfo.geometry.Reset();
+
+          if( task.compressedImage )
+          {
+            UploadCompressedTexture( *task.compressedImage, textureInfo );
+            NotifyObservers( textureInfo, true );
+          }
+          else
+          {
+            // textureInfo can be invalidated after this call (as the mTextureInfoContainer may be modified)
+            Devel::PixelBuffer pixelBuffer = task.pixelBuffer;
+            PostLoad( textureInfo, pixelBuffer );
+          }
         }
         else
         {
@@ -1077,6 +1118,24 @@ void TextureManager::UploadTexture( Devel::PixelBuffer& pixelBuffer, TextureInfo
   textureInfo.loadState = UPLOADED;
 }
 
+void TextureManager::UploadCompressedTexture( const CompressedImage& compressedImage, TextureInfo& textureInfo )
+{
+  DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "  TextureManager::UploadCompressedTexture() New Texture for textureId:%d, %u mip levels\n",
+                 textureInfo.textureId, compressedImage.GetLevelCount() );
+
+  // The compressed pixels can't be multiplied by their alpha.
+  textureInfo.useAtlas = NO_ATLAS;
+  textureInfo.preMultiplied = false;
+
+  if( ! textureInfo.textureSet )
+  {
+    textureInfo.textureSet = TextureSet::New();
+  }
+  textureInfo.textureSet.SetTexture( 0u, compressedImage.CreateTexture() );
+
+  textureInfo.loadState = UPLOADED;
+}
+
 void TextureManager::NotifyObservers( TextureInfo& textureInfo, bool success )
 {
   TextureId textureId = textureInfo.textureId;
@@ -1336,10 +1395,13 @@ void TextureManager::AsyncLoadingHelper::Load( TextureId
                                                FittingMode::Type                        fittingMode,
                                                SamplingMode::Type                       samplingMode,
                                                bool                                     orientationCorrection,
-                                               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
+                                               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                               bool                                     analyseOpacity,
+                                               bool                                     loadCompressed )
 {
   mLoadingInfoContainer.push_back( AsyncLoadingInfo( textureId ) );
-  auto id = DevelAsyncImageLoader::Load( mLoader, url.GetUrl(), desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad );
+  auto id = GetImplementation( mLoader ).Load( url, desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad,
+                                               analyseOpacity, loadCompressed );
   mLoadingInfoContainer.back().loadId = id;
 }
 
@@ -1368,14 +1430,13 @@ TextureManager::AsyncLoadingHelper::AsyncLoadingHelper(
   mTextureManager(textureManager),
   mLoadingInfoContainer(std::move(loadingInfoContainer))
 {
-  DevelAsyncImageLoader::PixelBufferLoadedSignal(mLoader).Connect(
+  GetImplementation( mLoader ).LoadingTaskCompletedSignal().Connect(
       this, &AsyncLoadingHelper::AsyncLoadComplete);
 }
 
-void TextureManager::AsyncLoadingHelper::AsyncLoadComplete(uint32_t           id,
-                                                           Devel::PixelBuffer pixelBuffer )
+void TextureManager::AsyncLoadingHelper::AsyncLoadComplete( const LoadingTask& task )
 {
-  mTextureManager.AsyncLoadComplete( mLoadingInfoContainer, id, pixelBuffer );
+  mTextureManager.AsyncLoadComplete( mLoadingInfoContainer, task );
 }
 
 void TextureManager::SetBrokenImageUrl(const std::string& brokenImageUrl)
@@ -1385,9 +1446,29 @@ void TextureManager::SetBrokenImageUrl(const std::string& brokenImageUrl)
 
 Geometry TextureManager::GetRenderGeometry(TextureId textureId, uint32_t& frontElements, uint32_t& backElements )
 {
-  return RenderingAddOn::Get().IsValid() ?
-         RenderingAddOn::Get().GetGeometry( textureId, frontElements, backElements) :
-         Geometry();
+  if( RenderingAddOn::Get().IsValid() )
+  {
+    return RenderingAddOn::Get().GetGeometry( textureId, frontElements, backElements );
+  }
+
+  Geometry geometry;
+  int cacheIndex = GetCacheIndexFromId( textureId );
+  if( cacheIndex != INVALID_CACHE_INDEX )
+  {
+    TextureInfo& textureInfo( mTextureInfoContainer[cacheIndex] );
+    if( textureInfo.opacityMap && textureInfo.loadState == UPLOADED )
+    {
+      // The geometry is created once and shared by all the visuals of the texture.
+      if( !textureInfo.geometry )
+      {
+        textureInfo.geometry = textureInfo.opacityMap->CreateGeometry( textureInfo.opaqueElements, textureInfo.translucentElements );
+      }
+      geometry = textureInfo.geometry;
+      frontElements = textureInfo.opaqueElements;
+      backElements = textureInfo.translucentElements;
+    }
+  }
+  return geometry;
 }
 
 } // namespace Internal
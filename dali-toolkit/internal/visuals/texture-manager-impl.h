@@ -37,6 +37,8 @@
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/internal/helpers/round-robin-container-view.h>
 #include <dali-toolkit/internal/image-loader/async-image-loader-impl.h>
+#include <dali-toolkit/internal/image-loader/compressed-image.h>
+#include <dali-toolkit/internal/visuals/opacity-map.h>
 
 
 namespace Dali
@@ -191,6 +193,21 @@ public:
                                        Dali::WrapMode::Type wrapModeU, Dali::WrapMode::Type wrapModeV,
                                        TextureUploadObserver* textureObserver );
 
+  /**
+   * @brief Requests a frame of animated image load to get PixelBuffer.
+   *
+   * The observer has the LoadComplete method called when the load is ready. The requests of the same frame
+   * made while it is loading share the load.
+   *
+   * @param[in] animatedImageLoading  The AnimatedImageLoading that contain the animated image information
+   * @param[in] frameIndex            The frame index to load.
+   * @param[in] textureObserver       The client object should inherit from this and provide the "LoadComplete" virtual.
+   *                                  This is called when the frame load completes (or fails).
+   */
+  void LoadAnimatedImagePixelBuffer( Dali::AnimatedImageLoading animatedImageLoading,
+                                     uint32_t frameIndex,
+                                     TextureUploadObserver* textureObserver );
+
   /**
    * @brief Requests an image load of the given URL to get PixelBuffer.
    *
@@ -429,6 +446,9 @@ public:
 
   /**
    * @brief Returns the geometry associated with texture.
+   *
+   * The geometry is provided by the rendering add-on if it's available, otherwise it's built from the
+   * opaque and transparent regions found when the image was loaded.
    * @param[in] textureId Id of the texture
    * @param[out] frontElements number of front elements
    * @param[out] backElements number of back elements
@@ -521,7 +541,11 @@ private:
                  bool preMultiplyOnLoad,
                  Dali::AnimatedImageLoading animatedImageLoading,
                  uint32_t frameIndex )
-    : url( url ),
+    : opacityMap(),
+      geometry(),
+      opaqueElements( 0u ),
+      translucentElements( 0u ),
+      url( url ),
       desiredSize( desiredSize ),
       useSize( desiredSize ),
       atlasRect( 0.0f, 0.0f, 1.0f, 1.0f ), // Full atlas rectangle
@@ -554,6 +578,10 @@ private:
     Toolkit::ImageAtlas atlas;     ///< The atlas this Texture lays within (if any)
     Devel::PixelBuffer pixelBuffer;///< The PixelBuffer holding the image data (May be empty after upload)
     TextureSet textureSet;         ///< The TextureSet holding the Texture
+    OpacityMapPtr opacityMap;      ///< The opaque and transparent regions found when the image was loaded (if any)
+    Geometry geometry;             ///< The geometry created from the opacity map (if any)
+    uint32_t opaqueElements;       ///< The number of indices of the opaque regions in the geometry
+    uint32_t translucentElements;  ///< The number of indices of the translucent regions in the geometry
     VisualUrl url;                 ///< The URL of the image
     ImageDimensions desiredSize;   ///< The size requested
     ImageDimensions useSize;       ///< The size used
@@ -664,10 +692,9 @@ private:
   /**
    * Common method to handle loading completion
    * @param[in] container The Async loading container
-   * @param[in] id        This is the async image loaders Id
-   * @param[in] pixelBuffer The loaded image data
+   * @param[in] task      The completed loading task, with the loaded image data
    */
-  void AsyncLoadComplete( AsyncLoadingInfoContainerType& container, uint32_t id, Devel::PixelBuffer pixelBuffer );
+  void AsyncLoadComplete( AsyncLoadingInfoContainerType& container, const LoadingTask& task );
 
   /**
    * @brief Performs Post-Load steps including atlasing.
@@ -699,6 +726,13 @@ private:
    */
   void UploadTexture( Devel::PixelBuffer& pixelBuffer, TextureInfo& textureInfo );
 
+  /**
+   * @brief Uploads the GPU compressed pixels of an image to a new texture, without decoding them.
+   * @param[in] compressedImage The compressed pixels
+   * @param[in] textureInfo The texture info containing the location to store the data to.
+   */
+  void UploadCompressedTexture( const CompressedImage& compressedImage, TextureInfo& textureInfo );
+
   /**
    * Creates tiled geometry of for the texture which separates fully-opaque
    * tiles from ones which use transparency.
@@ -819,6 +853,8 @@ private:
      * @param[in] orientationCorrection Whether to use image metadata to rotate or flip the image,
      *                                  e.g., from portrait to landscape
      * @param[in] preMultiplyOnLoad     if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
+     * @param[in] analyseOpacity        Whether to find the opaque and transparent regions of the image in the loading thread
+     * @param[in] loadCompressed        Whether to keep the GPU compressed pixels of a KTX file instead of decoding them
      */
     void Load(TextureId textureId,
               const VisualUrl& url,
@@ -826,7 +862,9 @@ private:
               FittingMode::Type fittingMode,
               SamplingMode::Type samplingMode,
               bool orientationCorrection,
-              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
+              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+              bool analyseOpacity,
+              bool loadCompressed);
 
     /**
      * @brief Apply mask
@@ -860,11 +898,10 @@ private:
                         AsyncLoadingInfoContainerType&& loadingInfoContainer );
 
     /**
-     * @brief Callback to be called when texture loading is complete, it passes the pixel buffer on to texture manager.
-     * @param[in] id          Loader id
-     * @param[in] pixelBuffer Image data
+     * @brief Callback to be called when texture loading is complete, it passes the loaded data on to texture manager.
+     * @param[in] task The completed loading task
      */
-    void AsyncLoadComplete( uint32_t id, Devel::PixelBuffer pixelBuffer );
+    void AsyncLoadComplete( const LoadingTask& task );
 
   private:
     Toolkit::AsyncImageLoader     mLoader;
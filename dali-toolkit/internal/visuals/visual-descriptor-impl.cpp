@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/scripting/scripting.h>
+#include <dali/public-api/object/property-array.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+
+namespace
+{
+
+/**
+ * The index key of a string key.
+ */
+struct KeyIndex
+{
+  const char* const name;
+  Property::Index index;
+};
+
+/**
+ * The string keys known by the base of every visual.
+ */
+const KeyIndex VISUAL_KEYS[] =
+{
+  { VISUAL_TYPE,          Toolkit::Visual::Property::TYPE },
+  { CUSTOM_SHADER,        Toolkit::Visual::Property::SHADER },
+  { TRANSFORM,            Toolkit::Visual::Property::TRANSFORM },
+  { PREMULTIPLIED_ALPHA,  Toolkit::Visual::Property::PREMULTIPLIED_ALPHA },
+  { MIX_COLOR,            Toolkit::Visual::Property::MIX_COLOR },
+  { OPACITY,              Toolkit::Visual::Property::OPACITY },
+  { VISUAL_FITTING_MODE,  Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE },
+  { CORNER_RADIUS,        Toolkit::DevelVisual::Property::CORNER_RADIUS },
+  { CORNER_RADIUS_POLICY, Toolkit::DevelVisual::Property::CORNER_RADIUS_POLICY }
+};
+const unsigned int VISUAL_KEYS_COUNT = sizeof( VISUAL_KEYS ) / sizeof( VISUAL_KEYS[0] );
+
+/**
+ * The string keys known by the image visual of a regular image.
+ */
+const KeyIndex IMAGE_VISUAL_KEYS[] =
+{
+  { IMAGE_URL_NAME,              Toolkit::ImageVisual::Property::URL },
+  { IMAGE_FITTING_MODE,          Toolkit::ImageVisual::Property::FITTING_MODE },
+  { IMAGE_SAMPLING_MODE,         Toolkit::ImageVisual::Property::SAMPLING_MODE },
+  { IMAGE_DESIRED_WIDTH,         Toolkit::ImageVisual::Property::DESIRED_WIDTH },
+  { IMAGE_DESIRED_HEIGHT,        Toolkit::ImageVisual::Property::DESIRED_HEIGHT },
+  { PIXEL_AREA_UNIFORM_NAME,     Toolkit::ImageVisual::Property::PIXEL_AREA },
+  { IMAGE_WRAP_MODE_U,           Toolkit::ImageVisual::Property::WRAP_MODE_U },
+  { IMAGE_WRAP_MODE_V,           Toolkit::ImageVisual::Property::WRAP_MODE_V },
+  { SYNCHRONOUS_LOADING,         Toolkit::ImageVisual::Property::SYNCHRONOUS_LOADING },
+  { IMAGE_ATLASING,              Toolkit::ImageVisual::Property::ATLASING },
+  { ALPHA_MASK_URL,              Toolkit::ImageVisual::Property::ALPHA_MASK_URL },
+  { MASK_CONTENT_SCALE_NAME,     Toolkit::ImageVisual::Property::MASK_CONTENT_SCALE },
+  { CROP_TO_MASK_NAME,           Toolkit::ImageVisual::Property::CROP_TO_MASK },
+  { LOAD_POLICY_NAME,            Toolkit::ImageVisual::Property::LOAD_POLICY },
+  { RELEASE_POLICY_NAME,         Toolkit::ImageVisual::Property::RELEASE_POLICY },
+  { ORIENTATION_CORRECTION_NAME, Toolkit::ImageVisual::Property::ORIENTATION_CORRECTION }
+};
+const unsigned int IMAGE_VISUAL_KEYS_COUNT = sizeof( IMAGE_VISUAL_KEYS ) / sizeof( IMAGE_VISUAL_KEYS[0] );
+
+/**
+ * Finds the index key of a string key in a table, returning true if found.
+ */
+bool FindKeyIndex( const std::string& name, const KeyIndex* table, unsigned int count, Property::Index& index )
+{
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    if( name == table[i].name )
+    {
+      index = table[i].index;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+VisualDescriptorPtr VisualDescriptor::New( const Property::Map& propertyMap )
+{
+  VisualDescriptorPtr visualDescriptor( new VisualDescriptor() );
+  visualDescriptor->Initialize( propertyMap );
+  return visualDescriptor;
+}
+
+VisualDescriptorPtr VisualDescriptor::New( const VisualDescriptor& source, const VisualUrl& visualUrl )
+{
+  DALI_ASSERT_DEBUG( source.mUrlType == URL_STRING && source.mVisualUrl.GetType() == visualUrl.GetType() );
+
+  VisualDescriptorPtr visualDescriptor( new VisualDescriptor() );
+  visualDescriptor->mPropertyMap = source.mPropertyMap;
+  visualDescriptor->mVisualUrl = visualUrl;
+  visualDescriptor->mType = source.mType;
+  visualDescriptor->mUrlType = URL_STRING;
+
+  Property::Value* imageURLValue = visualDescriptor->mPropertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
+  if( imageURLValue )
+  {
+    *imageURLValue = visualUrl.GetUrl();
+  }
+  return visualDescriptor;
+}
+
+VisualDescriptor::VisualDescriptor()
+: mPropertyMap(),
+  mVisualUrl(),
+  mType( Toolkit::DevelVisual::IMAGE ), // Default to IMAGE type.
+  mUrlType( NO_URL )
+{
+}
+
+VisualDescriptor::~VisualDescriptor()
+{
+}
+
+void VisualDescriptor::Initialize( const Property::Map& propertyMap )
+{
+  Property::Value* typeValue = propertyMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
+  if( typeValue )
+  {
+    Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, mType );
+  }
+
+  Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
+  if( imageURLValue )
+  {
+    std::string imageUrl;
+    if( imageURLValue->Get( imageUrl ) )
+    {
+      mVisualUrl = VisualUrl( imageUrl );
+      mUrlType = URL_STRING;
+    }
+    else if( imageURLValue->GetArray() )
+    {
+      mUrlType = URL_ARRAY;
+    }
+  }
+
+  // The other visuals use the same indices for other properties, or look up some keys by name, so their keys are kept
+  const bool regularImage = ( mType == Toolkit::DevelVisual::IMAGE ) && ( mUrlType == URL_STRING ) &&
+                            ( mVisualUrl.GetType() == VisualUrl::REGULAR_IMAGE || mVisualUrl.GetType() == VisualUrl::KTX );
+  if( !regularImage )
+  {
+    mPropertyMap = propertyMap;
+    return;
+  }
+
+  for( Property::Map::SizeType i = 0; i < propertyMap.Count(); ++i )
+  {
+    const KeyValuePair keyValue = propertyMap.GetKeyValue( i );
+    Property::Index index = Property::INVALID_INDEX;
+    if( keyValue.first.type == Property::Key::INDEX )
+    {
+      index = keyValue.first.indexKey;
+    }
+    else if( !FindKeyIndex( keyValue.first.stringKey, VISUAL_KEYS, VISUAL_KEYS_COUNT, index ) &&
+             !FindKeyIndex( keyValue.first.stringKey, IMAGE_VISUAL_KEYS, IMAGE_VISUAL_KEYS_COUNT, index ) )
+    {
+      mPropertyMap.Insert( keyValue.first.stringKey, keyValue.second );
+      continue;
+    }
+
+    if( index == Toolkit::Visual::Property::TYPE )
+    {
+      mPropertyMap.Insert( index, static_cast< int >( mType ) );
+    }
+    else
+    {
+      mPropertyMap.Insert( index, keyValue.second );
+    }
+  }
+}
+
+bool VisualDescriptor::IsValid() const
+{
+  switch( mType )
+  {
+    case Toolkit::DevelVisual::IMAGE:
+    {
+      return ( mUrlType == URL_STRING && !mVisualUrl.GetUrl().empty() ) || ( mUrlType == URL_ARRAY );
+    }
+    case Toolkit::DevelVisual::ANIMATED_IMAGE:
+    {
+      return ( mUrlType != NO_URL );
+    }
+    case Toolkit::DevelVisual::N_PATCH:
+    case Toolkit::DevelVisual::SVG:
+    case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
+    {
+      return ( mUrlType == URL_STRING );
+    }
+    case Toolkit::DevelVisual::BORDER:
+    case Toolkit::DevelVisual::COLOR:
+    case Toolkit::DevelVisual::GRADIENT:
+    case Toolkit::DevelVisual::MESH:
+    case Toolkit::DevelVisual::PRIMITIVE:
+    case Toolkit::DevelVisual::WIREFRAME:
+    case Toolkit::DevelVisual::TEXT:
+    case Toolkit::DevelVisual::ANIMATED_GRADIENT:
+    case Toolkit::DevelVisual::ARC:
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+const Property::Map& VisualDescriptor::GetPropertyMap() const
+{
+  return mPropertyMap;
+}
+
+Toolkit::DevelVisual::Type VisualDescriptor::GetType() const
+{
+  return mType;
+}
+
+VisualDescriptor::UrlType VisualDescriptor::GetUrlType() const
+{
+  return mUrlType;
+}
+
+const VisualUrl& VisualDescriptor::GetVisualUrl() const
+{
+  return mVisualUrl;
+}
+
+const Property::Array* VisualDescriptor::GetUrlArray() const
+{
+  if( mUrlType == URL_ARRAY )
+  {
+    Property::Value* imageURLValue = mPropertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
+    if( imageURLValue )
+    {
+      return imageURLValue->GetArray();
+    }
+  }
+  return NULL;
+}
+
+} // namespace Internal
+} // namespace Toolkit
+} // namespace Dali
@@ -0,0 +1,153 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+
+class VisualDescriptor;
+typedef IntrusivePtr<VisualDescriptor> VisualDescriptorPtr;
+
+/**
+ * VisualDescriptor holds a visual property map whose visual type and URL are resolved,
+ * and whose keys are normalized to index keys.
+ */
+class VisualDescriptor : public BaseObject
+{
+public:
+
+  /**
+   * @brief How the URL is given in the property map.
+   */
+  enum UrlType
+  {
+    NO_URL,     ///< There is no URL
+    URL_STRING, ///< The URL is a string, resolved by GetVisualUrl()
+    URL_ARRAY   ///< The URLs are an array of strings
+  };
+
+  /**
+   * @copydoc Dali::Toolkit::VisualDescriptor::New()
+   */
+  static VisualDescriptorPtr New( const Property::Map& propertyMap );
+
+  /**
+   * @brief Creates a descriptor of the same property map as another, with another URL of the same type.
+   * @param[in] source The descriptor whose URL is given as a string
+   * @param[in] visualUrl The URL replacing the URL of the source
+   * @return The new descriptor
+   */
+  static VisualDescriptorPtr New( const VisualDescriptor& source, const VisualUrl& visualUrl );
+
+  /**
+   * @copydoc Dali::Toolkit::VisualDescriptor::IsValid()
+   */
+  bool IsValid() const;
+
+  /**
+   * @copydoc Dali::Toolkit::VisualDescriptor::GetPropertyMap()
+   */
+  const Property::Map& GetPropertyMap() const;
+
+  /**
+   * @brief Retrieves the type of the visual, IMAGE if not given.
+   * @return The type of the visual
+   */
+  Toolkit::DevelVisual::Type GetType() const;
+
+  /**
+   * @brief Retrieves how the URL is given in the property map.
+   * @return The type of the URL
+   */
+  UrlType GetUrlType() const;
+
+  /**
+   * @brief Retrieves the URL, when given as a string.
+   * @return The resolved URL
+   */
+  const VisualUrl& GetVisualUrl() const;
+
+  /**
+   * @brief Retrieves the URLs, when given as an array.
+   * @return The URLs, or NULL if they are not given as an array
+   */
+  const Property::Array* GetUrlArray() const;
+
+private: // Implementation
+  /**
+   * Ref counted object - Only allow construction via New().
+   */
+  VisualDescriptor();
+
+  /**
+   * Second stage initialiazation
+   */
+  void Initialize( const Property::Map& propertyMap );
+
+protected:
+  /**
+   *  A ref counted object may only be deleted by calling Unreference
+   */
+  ~VisualDescriptor() override;
+
+private: // Unimplemented methods
+  VisualDescriptor( const VisualDescriptor& );
+  VisualDescriptor& operator=( const VisualDescriptor& );
+
+private: // Data members
+  Property::Map              mPropertyMap; ///< The normalized property map
+  VisualUrl                  mVisualUrl;   ///< The URL, when given as a string
+  Toolkit::DevelVisual::Type mType;        ///< The type of the visual
+  UrlType                    mUrlType;     ///< How the URL is given
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::VisualDescriptor& GetImplementation( Dali::Toolkit::VisualDescriptor& handle )
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::VisualDescriptor&>(object);
+}
+
+inline const Internal::VisualDescriptor& GetImplementation( const Dali::Toolkit::VisualDescriptor& handle )
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::VisualDescriptor&>(object);
+}
+
+} // namespace Toolkit
+} // namespace Dali
+
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
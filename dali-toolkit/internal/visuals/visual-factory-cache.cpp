@@ -37,7 +37,8 @@ namespace Internal
 {
 
 VisualFactoryCache::VisualFactoryCache( bool preMultiplyOnLoad )
-: mSvgRasterizeThread( NULL ),
+: mSvgCache( mTextureManager ),
+  mSvgRasterizeManager(),
   mVectorAnimationManager(),
   mBrokenImageUrl(""),
   mPreMultiplyOnLoad( preMultiplyOnLoad )
@@ -46,7 +47,6 @@ VisualFactoryCache::VisualFactoryCache( bool preMultiplyOnLoad )
 
 VisualFactoryCache::~VisualFactoryCache()
 {
-  SvgRasterizeThread::TerminateThread( mSvgRasterizeThread );
 }
 
 Geometry VisualFactoryCache::GetGeometry( GeometryType type )
@@ -121,14 +121,28 @@ NPatchLoader& VisualFactoryCache::GetNPatchLoader()
   return mNPatchLoader;
 }
 
-SvgRasterizeThread* VisualFactoryCache::GetSVGRasterizationThread()
+TextTextureCache& VisualFactoryCache::GetTextTextureCache()
 {
-  if( !mSvgRasterizeThread )
+  return mTextTextureCache;
+}
+
+AnimatedImageFrameCache& VisualFactoryCache::GetAnimatedImageFrameCache()
+{
+  return mAnimatedImageFrameCache;
+}
+
+SvgCache& VisualFactoryCache::GetSvgCache()
+{
+  return mSvgCache;
+}
+
+SvgRasterizeManager& VisualFactoryCache::GetSvgRasterizeManager()
+{
+  if( !mSvgRasterizeManager )
   {
-    mSvgRasterizeThread = new SvgRasterizeThread( new EventThreadCallback( MakeCallback( this, &VisualFactoryCache::ApplyRasterizedSVGToSampler ) ) );
-    mSvgRasterizeThread->Start();
+    mSvgRasterizeManager = std::unique_ptr< SvgRasterizeManager >( new SvgRasterizeManager( new EventThreadCallback( MakeCallback( this, &VisualFactoryCache::ApplyRasterizedSVGToSampler ) ) ) );
   }
-  return mSvgRasterizeThread;
+  return *mSvgRasterizeManager;
 }
 
 VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
@@ -142,9 +156,9 @@ VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
 
 void VisualFactoryCache::ApplyRasterizedSVGToSampler()
 {
-  while( RasterizingTaskPtr task = mSvgRasterizeThread->NextCompletedTask() )
+  while( RasterizingTaskPtr task = mSvgRasterizeManager->NextCompletedTask() )
   {
-    task->GetSvgVisual()->ApplyRasterizedImage(task->GetVectorRenderer(), task->GetPixelData(), task->IsLoaded());
+    mSvgCache.RasterizationCompleted( task->GetKey(), task->GetPixelData() );
   }
 }
 
@@ -25,8 +25,11 @@
 #include <dali/devel-api/common/owner-container.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/animated-image/animated-image-frame-cache.h>
 #include <dali-toolkit/internal/visuals/npatch-loader.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/text/text-texture-cache.h>
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
 namespace Dali
@@ -209,10 +212,28 @@ public:
   NPatchLoader& GetNPatchLoader();
 
   /**
-   * Get the SVG rasterization thread.
-   * @return A raw pointer pointing to the SVG rasterization thread.
+   * Get the cache of the textures shared by the text visuals.
+   * @return A reference to the text texture cache
    */
-  SvgRasterizeThread* GetSVGRasterizationThread();
+  TextTextureCache& GetTextTextureCache();
+
+  /**
+   * Get the cache of the decoded frames of the animated images.
+   * @return A reference to the animated image frame cache
+   */
+  AnimatedImageFrameCache& GetAnimatedImageFrameCache();
+
+  /**
+   * Get the cache of the parsed and rasterized SVG images.
+   * @return A reference to the SVG cache
+   */
+  SvgCache& GetSvgCache();
+
+  /**
+   * Get the pool of the SVG rasterization threads.
+   * @return A reference to the SVG rasterize manager
+   */
+  SvgRasterizeManager& GetSvgRasterizeManager();
 
   /**
    * Get the vector animation manager.
@@ -244,10 +265,13 @@ private:
   Shader mShader[SHADER_TYPE_MAX+1];
 
   ImageAtlasManagerPtr                      mAtlasManager;
+  AnimatedImageFrameCache                   mAnimatedImageFrameCache; ///< Destroyed after the texture manager, which the image caches observe
   TextureManager                            mTextureManager;
   NPatchLoader                              mNPatchLoader;
+  TextTextureCache                          mTextTextureCache;
+  SvgCache                                  mSvgCache;
   Texture                                   mBrokenImageTexture;
-  SvgRasterizeThread*                       mSvgRasterizeThread;
+  std::unique_ptr< SvgRasterizeManager >    mSvgRasterizeManager;
   std::unique_ptr< VectorAnimationManager > mVectorAnimationManager;
   std::string                               mBrokenImageUrl;
   bool                                      mPreMultiplyOnLoad;
@@ -18,6 +18,8 @@
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 
 // EXTERNAL INCLUDES
+#include <functional>
+#include <iterator>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/object/type-registry.h>
@@ -48,6 +50,13 @@
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
+#include <dali-toolkit/internal/controls/bubble-effect/bubble-emitter-impl.h>
+#include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/controls/page-turn-view/page-turn-view-impl.h>
+#include <dali-toolkit/internal/controls/scrollable/bouncing-effect-actor.h>
+#include <dali-toolkit/internal/text/rendering/atlas/text-atlas-renderer.h>
+#include <dali-toolkit/internal/transition-effects/cube-transition-effect-impl.h>
 
 namespace Dali
 {
@@ -76,14 +85,220 @@ DALI_TYPE_REGISTRATION_BEGIN_CREATE( Toolkit::VisualFactory, Dali::BaseHandle, C
 DALI_TYPE_REGISTRATION_END()
 const char* const BROKEN_IMAGE_FILE_NAME = "broken.png"; ///< The file name of the broken image.
 
+const std::size_t DESCRIPTOR_CACHE_SIZE = 128u; ///< The number of property maps whose descriptors are kept
+const std::size_t MISSED_HASH_COUNT = 128u;     ///< The number of maps not cached which are remembered, to cache them when seen again
+
+/**
+ * Combines a value into a hash.
+ */
+void CombineHash( std::size_t& hash, std::size_t value )
+{
+  hash ^= value + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+}
+
+/**
+ * Whether a key and its value are the URL string of a visual, as found by the visual descriptor.
+ */
+bool IsUrl( const Property::Key& key, const Property::Value& value )
+{
+  return value.GetType() == Property::STRING &&
+         ( key.type == Property::Key::INDEX ? ( key.indexKey == Toolkit::ImageVisual::Property::URL ) : ( key.stringKey == IMAGE_URL_NAME ) );
+}
+
+/**
+ * Computes the hash of a property map without its URL, returning false if the map holds values which are not compared.
+ */
+bool GetPropertyMapHash( const Property::Map& propertyMap, std::size_t& hash, const Property::Value*& urlValue )
+{
+  hash = propertyMap.Count();
+  urlValue = nullptr;
+  for( Property::Map::SizeType i = 0; i < propertyMap.Count(); ++i )
+  {
+    const Property::Key key = propertyMap.GetKeyAt( i );
+    if( key.type == Property::Key::INDEX )
+    {
+      CombineHash( hash, std::hash< Property::Index >()( key.indexKey ) );
+    }
+    else
+    {
+      CombineHash( hash, std::hash< std::string >()( key.stringKey ) );
+    }
+
+    const Property::Value& value = propertyMap.GetValue( i );
+    CombineHash( hash, static_cast< std::size_t >( value.GetType() ) );
+    if( IsUrl( key, value ) )
+    {
+      if( urlValue )
+      {
+        // Which URL is used is decided by the visual descriptor
+        return false;
+      }
+
+      // The maps differing only by their URL share the same checks
+      urlValue = &value;
+      continue;
+    }
+
+    switch( value.GetType() )
+    {
+      case Property::BOOLEAN:
+      {
+        CombineHash( hash, value.Get< bool >() ? 1u : 0u );
+        break;
+      }
+      case Property::INTEGER:
+      {
+        CombineHash( hash, std::hash< int >()( value.Get< int >() ) );
+        break;
+      }
+      case Property::FLOAT:
+      {
+        CombineHash( hash, std::hash< float >()( value.Get< float >() ) );
+        break;
+      }
+      case Property::VECTOR2:
+      {
+        const Vector2 vector = value.Get< Vector2 >();
+        CombineHash( hash, std::hash< float >()( vector.x ) );
+        CombineHash( hash, std::hash< float >()( vector.y ) );
+        break;
+      }
+      case Property::VECTOR3:
+      {
+        const Vector3 vector = value.Get< Vector3 >();
+        CombineHash( hash, std::hash< float >()( vector.x ) );
+        CombineHash( hash, std::hash< float >()( vector.y ) );
+        CombineHash( hash, std::hash< float >()( vector.z ) );
+        break;
+      }
+      case Property::VECTOR4:
+      {
+        const Vector4 vector = value.Get< Vector4 >();
+        CombineHash( hash, std::hash< float >()( vector.x ) );
+        CombineHash( hash, std::hash< float >()( vector.y ) );
+        CombineHash( hash, std::hash< float >()( vector.z ) );
+        CombineHash( hash, std::hash< float >()( vector.w ) );
+        break;
+      }
+      case Property::STRING:
+      {
+        CombineHash( hash, std::hash< std::string >()( value.Get< std::string >() ) );
+        break;
+      }
+      default:
+      {
+        // Maps, arrays and the other values are not compared
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Whether two property maps with a hash hold the same keys and values in the same order, except their URLs.
+ */
+bool IsSamePropertyMap( const Property::Map& lhs, const Property::Map& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( Property::Map::SizeType i = 0; i < lhs.Count(); ++i )
+  {
+    const Property::Key lhsKey = lhs.GetKeyAt( i );
+    const Property::Key rhsKey = rhs.GetKeyAt( i );
+    if( lhsKey.type != rhsKey.type ||
+        ( lhsKey.type == Property::Key::INDEX ? ( lhsKey.indexKey != rhsKey.indexKey ) : ( lhsKey.stringKey != rhsKey.stringKey ) ) )
+    {
+      return false;
+    }
+
+    const Property::Value& lhsValue = lhs.GetValue( i );
+    const Property::Value& rhsValue = rhs.GetValue( i );
+    if( lhsValue.GetType() != rhsValue.GetType() )
+    {
+      return false;
+    }
+
+    if( IsUrl( lhsKey, lhsValue ) )
+    {
+      continue;
+    }
+
+    bool same = false;
+    switch( lhsValue.GetType() )
+    {
+      case Property::BOOLEAN:
+      {
+        same = ( lhsValue.Get< bool >() == rhsValue.Get< bool >() );
+        break;
+      }
+      case Property::INTEGER:
+      {
+        same = ( lhsValue.Get< int >() == rhsValue.Get< int >() );
+        break;
+      }
+      case Property::FLOAT:
+      {
+        same = ( lhsValue.Get< float >() == rhsValue.Get< float >() );
+        break;
+      }
+      case Property::VECTOR2:
+      {
+        const Vector2 lhsVector = lhsValue.Get< Vector2 >();
+        const Vector2 rhsVector = rhsValue.Get< Vector2 >();
+        same = ( lhsVector.x == rhsVector.x ) && ( lhsVector.y == rhsVector.y );
+        break;
+      }
+      case Property::VECTOR3:
+      {
+        const Vector3 lhsVector = lhsValue.Get< Vector3 >();
+        const Vector3 rhsVector = rhsValue.Get< Vector3 >();
+        same = ( lhsVector.x == rhsVector.x ) && ( lhsVector.y == rhsVector.y ) && ( lhsVector.z == rhsVector.z );
+        break;
+      }
+      case Property::VECTOR4:
+      {
+        const Vector4 lhsVector = lhsValue.Get< Vector4 >();
+        const Vector4 rhsVector = rhsValue.Get< Vector4 >();
+        same = ( lhsVector.x == rhsVector.x ) && ( lhsVector.y == rhsVector.y ) && ( lhsVector.z == rhsVector.z ) && ( lhsVector.w == rhsVector.w );
+        break;
+      }
+      case Property::STRING:
+      {
+        same = ( lhsValue.Get< std::string >() == rhsValue.Get< std::string >() );
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+
+    if( !same )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 } // namespace
 
 VisualFactory::VisualFactory( bool debugEnabled )
 : mFactoryCache(),
   mImageVisualShaderFactory(),
   mSlotDelegate(this),
+  mDescriptorCache(),
+  mDescriptorIds(),
+  mMissedHashes(),
+  mMissedHashQueue(),
+  mMissedHashIndex( 0u ),
   mDebugEnabled( debugEnabled ),
-  mPreMultiplyOnLoad( true )
+  mPreMultiplyOnLoad( true ),
+  mShaderVariantsAdded( false )
 {
 }
 
@@ -109,15 +324,18 @@ void VisualFactory::OnStyleChangedSignal( Toolkit::StyleManager styleManager, St
 }
 
 Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& propertyMap )
+{
+  return CreateVisual( *GetVisualDescriptor( propertyMap ) );
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual( const VisualDescriptor& descriptor )
 {
   Visual::BasePtr visualPtr;
 
-  Property::Value* typeValue = propertyMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
-  Toolkit::DevelVisual::Type visualType = Toolkit::DevelVisual::IMAGE; // Default to IMAGE type.
-  if( typeValue )
-  {
-    Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType );
-  }
+  const Property::Map& propertyMap = descriptor.GetPropertyMap();
+  const Toolkit::DevelVisual::Type visualType = descriptor.GetType();
+  const VisualUrl& visualUrl = descriptor.GetVisualUrl();
+  const bool hasUrlString = ( descriptor.GetUrlType() == VisualDescriptor::URL_STRING );
 
   switch( visualType )
   {
@@ -141,54 +359,48 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::Visual::IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue )
+      if( hasUrlString )
       {
-        if( imageURLValue->Get( imageUrl ) )
+        if( !visualUrl.GetUrl().empty() )
         {
-          if( !imageUrl.empty() )
+          switch( visualUrl.GetType() )
           {
-            VisualUrl visualUrl( imageUrl );
-
-            switch( visualUrl.GetType() )
+            case VisualUrl::N_PATCH:
             {
-              case VisualUrl::N_PATCH:
-              {
-                visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::SVG:
-              {
-                visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::GIF:
-              case VisualUrl::WEBP:
-              {
-                visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::JSON:
-              {
-                visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), imageUrl, propertyMap );
-                break;
-              }
-              case VisualUrl::REGULAR_IMAGE:
-              {
-                visualPtr = ImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
-                break;
-              }
+              visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::SVG:
+            {
+              visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::GIF:
+            case VisualUrl::WEBP:
+            {
+              visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::JSON:
+            {
+              visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), visualUrl, propertyMap );
+              break;
+            }
+            case VisualUrl::REGULAR_IMAGE:
+            case VisualUrl::KTX:
+            {
+              visualPtr = ImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
+              break;
             }
           }
         }
-        else
+      }
+      else
+      {
+        const Property::Array* array = descriptor.GetUrlArray();
+        if( array )
         {
-          Property::Array* array = imageURLValue->GetArray();
-          if( array )
-          {
-            visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
-          }
+          visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
         }
       }
       break;
@@ -220,43 +432,34 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::Visual::N_PATCH:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( hasUrlString )
       {
-        visualPtr = NPatchVisual::New( GetFactoryCache(), imageUrl, propertyMap );
+        visualPtr = NPatchVisual::New( GetFactoryCache(), visualUrl, propertyMap );
       }
       break;
     }
 
     case Toolkit::Visual::SVG:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( hasUrlString )
       {
-        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap );
+        visualPtr = SvgVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
       }
       break;
     }
 
     case Toolkit::Visual::ANIMATED_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue )
+      if( hasUrlString )
+      {
+        visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap );
+      }
+      else
       {
-        if( imageURLValue->Get( imageUrl ) )
+        const Property::Array* array = descriptor.GetUrlArray();
+        if( array )
         {
-          visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap );
-        }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if( array )
-          {
-            visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
-          }
+          visualPtr = AnimatedImageVisual::New( GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap );
         }
       }
       break;
@@ -270,11 +473,9 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
 
     case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-      std::string imageUrl;
-      if( imageURLValue && imageURLValue->Get( imageUrl ) )
+      if( hasUrlString )
       {
-        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), imageUrl, propertyMap );
+        visualPtr = AnimatedVectorImageVisual::New( GetFactoryCache(),  GetImageVisualShaderFactory(), visualUrl, propertyMap );
       }
       break;
     }
@@ -292,12 +493,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const Property::Map& property
                                                                             VISUAL_TYPE_TABLE_COUNT ),
                  ( visualType == Toolkit::DevelVisual::IMAGE ) ? "url:" : "",
                  ( visualType == Toolkit::DevelVisual::IMAGE ) ?
-                             ( ([&] (){
-                                        // Return URL if present in PropertyMap else return "not found message"
-                                        Property::Value* imageURLValue = propertyMap.Find( Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME );
-                                        return ( imageURLValue ) ? imageURLValue->Get<std::string>().c_str() : "url not found in PropertyMap";
-                                      })()
-                             )
+                             ( hasUrlString ? visualUrl.GetUrl().c_str() : "url not found in PropertyMap" )
                              : "" );
 
   if( !visualPtr )
@@ -346,6 +542,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual( const std::string& url, Image
         break;
       }
       case VisualUrl::REGULAR_IMAGE:
+      case VisualUrl::KTX:
       {
         visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, size );
         break;
@@ -376,6 +573,31 @@ bool VisualFactory::GetPreMultiplyOnLoad() const
   return mPreMultiplyOnLoad;
 }
 
+void VisualFactory::GetShaderVariantNames( std::vector< std::string >& names )
+{
+  AddShaderVariants();
+  ShaderRegistry::Get().GetVariantNames( names );
+}
+
+uint32_t VisualFactory::WarmUpShaders( const std::vector< std::string >& names )
+{
+  AddShaderVariants();
+  return ShaderRegistry::Get().WarmUp( names );
+}
+
+Property::Map VisualFactory::GetShaderMetrics() const
+{
+  const ShaderRegistry::Metrics& metrics = ShaderRegistry::Get().GetMetrics();
+
+  Property::Map map;
+  map.Insert( "variants", static_cast< int >( metrics.variants ) );
+  map.Insert( "requests", static_cast< int >( metrics.requests ) );
+  map.Insert( "creations", static_cast< int >( metrics.creations ) );
+  map.Insert( "lastFrameCreations", static_cast< int >( metrics.lastFrameCreations ) );
+  map.Insert( "maxFrameCreations", static_cast< int >( metrics.maxFrameCreations ) );
+  return map;
+}
+
 Internal::TextureManager& VisualFactory::GetTextureManager()
 {
   return GetFactoryCache().GetTextureManager();
@@ -403,6 +625,111 @@ Internal::VisualFactoryCache& VisualFactory::GetFactoryCache()
   return *mFactoryCache;
 }
 
+void VisualFactory::AddShaderVariants()
+{
+  if( !mShaderVariantsAdded )
+  {
+    ShaderRegistry registry = ShaderRegistry::Get();
+    BorderVisual::AddShaderVariants( registry );
+    ColorVisual::AddShaderVariants( registry );
+    GradientVisual::AddShaderVariants( registry );
+    ImageVisualShaderFactory::AddShaderVariants( registry );
+    TextVisual::AddShaderVariants( registry );
+    ArcVisual::AddShaderVariants( registry );
+    WireframeVisual::AddShaderVariants( registry );
+
+    // The fixed sources of the controls and effects
+    AddBouncingEffectShaderVariants( registry );
+    AddControlRendererShaderVariants( registry );
+    BubbleEmitter::AddShaderVariants( registry );
+    CubeTransitionEffect::AddShaderVariants( registry );
+    PageTurnView::AddShaderVariants( registry );
+    Text::AtlasRenderer::AddShaderVariants( registry );
+    mShaderVariantsAdded = true;
+  }
+}
+
+VisualDescriptorPtr VisualFactory::GetVisualDescriptor( const Property::Map& propertyMap )
+{
+  std::size_t hash = 0u;
+  const Property::Value* urlValue = nullptr;
+  if( !GetPropertyMapHash( propertyMap, hash, urlValue ) )
+  {
+    // Nested maps and arrays are not compared, so the map is checked every time
+    return VisualDescriptor::New( propertyMap );
+  }
+
+  const auto range = mDescriptorIds.equal_range( hash );
+  for( auto iter = range.first; iter != range.second; ++iter )
+  {
+    const DescriptorCache::iterator cached = iter->second;
+    if( IsSamePropertyMap( cached->propertyMap, propertyMap ) )
+    {
+      mDescriptorCache.splice( mDescriptorCache.begin(), mDescriptorCache, cached );
+
+      const VisualDescriptorPtr& descriptor = cached->descriptor;
+      if( !urlValue || descriptor->GetUrlType() != VisualDescriptor::URL_STRING )
+      {
+        return descriptor;
+      }
+
+      const std::string url = urlValue->Get< std::string >();
+      if( url == descriptor->GetVisualUrl().GetUrl() )
+      {
+        return descriptor;
+      }
+
+      // The keys of the map are normalized according to the type of the URL
+      const VisualUrl visualUrl( url );
+      if( visualUrl.GetType() == descriptor->GetVisualUrl().GetType() )
+      {
+        return VisualDescriptor::New( *descriptor, visualUrl );
+      }
+      return VisualDescriptor::New( propertyMap );
+    }
+  }
+
+  VisualDescriptorPtr descriptor = VisualDescriptor::New( propertyMap );
+
+  // A map is only copied in the cache the second time it's seen, so a stream of different maps only costs their hash
+  if( mMissedHashes.find( hash ) == mMissedHashes.end() )
+  {
+    if( mMissedHashQueue.size() < MISSED_HASH_COUNT )
+    {
+      mMissedHashQueue.push_back( hash );
+    }
+    else
+    {
+      mMissedHashes.erase( mMissedHashQueue[ mMissedHashIndex ] );
+      mMissedHashQueue[ mMissedHashIndex ] = hash;
+      mMissedHashIndex = ( mMissedHashIndex + 1u ) % MISSED_HASH_COUNT;
+    }
+    mMissedHashes.insert( hash );
+    return descriptor;
+  }
+
+  mDescriptorCache.push_front( CachedDescriptor{ hash, propertyMap, descriptor } );
+  mDescriptorIds.insert( std::make_pair( hash, mDescriptorCache.begin() ) );
+
+  if( mDescriptorCache.size() > DESCRIPTOR_CACHE_SIZE )
+  {
+    // Forget the least recently used map
+    const DescriptorCache::iterator oldest = std::prev( mDescriptorCache.end() );
+    const auto oldestRange = mDescriptorIds.equal_range( oldest->hash );
+    for( auto iter = oldestRange.first; iter != oldestRange.second; ++iter )
+    {
+      if( iter->second == oldest )
+      {
+        mDescriptorIds.erase( iter );
+        break;
+      }
+    }
+    mDescriptorCache.pop_back();
+  }
+
+  return descriptor;
+}
+
 ImageVisualShaderFactory& VisualFactory::GetImageVisualShaderFactory()
 {
   if( !mImageVisualShaderFactory )
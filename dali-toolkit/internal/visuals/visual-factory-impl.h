@@ -18,12 +18,16 @@
  */
 
 // EXTERNAL INCLUDES
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
 #include <dali/public-api/object/base-object.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
 #include <dali-toolkit/devel-api/styling/style-manager-devel.h>
 
@@ -66,6 +70,11 @@ public:
    */
   Toolkit::Visual::Base CreateVisual( const Property::Map& propertyMap );
 
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const VisualDescriptor& )
+   */
+  Toolkit::Visual::Base CreateVisual( const VisualDescriptor& descriptor );
+
   /**
    * @copydoc Toolkit::VisualFactory::CreateVisual( const std::string&, ImageDimensions )
    */
@@ -81,6 +90,21 @@ public:
    */
   bool GetPreMultiplyOnLoad() const;
 
+  /**
+   * @copydoc Toolkit::VisualFactory::GetShaderVariantNames()
+   */
+  void GetShaderVariantNames( std::vector< std::string >& names );
+
+  /**
+   * @copydoc Toolkit::VisualFactory::WarmUpShaders()
+   */
+  uint32_t WarmUpShaders( const std::vector< std::string >& names );
+
+  /**
+   * @copydoc Toolkit::VisualFactory::GetShaderMetrics()
+   */
+  Property::Map GetShaderMetrics() const;
+
   /**
    * @return the reference to texture manager
    */
@@ -104,6 +128,29 @@ private:
    */
   ImageVisualShaderFactory& GetImageVisualShaderFactory();
 
+  /**
+   * Get the descriptor of a property map, from the cache if the same map, perhaps with another URL, was used recently.
+   */
+  VisualDescriptorPtr GetVisualDescriptor( const Property::Map& propertyMap );
+
+  /**
+   * Record the shader variants of the visuals in the shader registry, the first time only.
+   */
+  void AddShaderVariants();
+
+  /**
+   * @brief A property map and its descriptor.
+   */
+  struct CachedDescriptor
+  {
+    std::size_t         hash;        ///< The hash of the map, without its URL
+    Property::Map       propertyMap;
+    VisualDescriptorPtr descriptor;
+  };
+
+  typedef std::list< CachedDescriptor >                                     DescriptorCache; ///< The most recently used first
+  typedef std::unordered_multimap< std::size_t, DescriptorCache::iterator > DescriptorIds;
+
   VisualFactory(const VisualFactory&) = delete;
 
   VisualFactory& operator=(const VisualFactory& rhs) = delete;
@@ -112,8 +159,14 @@ private:
   std::unique_ptr< VisualFactoryCache >       mFactoryCache;
   std::unique_ptr< ImageVisualShaderFactory > mImageVisualShaderFactory;
   SlotDelegate< VisualFactory >               mSlotDelegate;
+  DescriptorCache                             mDescriptorCache; ///< The descriptors of the recent property maps
+  DescriptorIds                               mDescriptorIds;   ///< The cached descriptors by hash of their map
+  std::unordered_set< std::size_t >           mMissedHashes;    ///< The hashes of the recent maps which were not cached
+  std::vector< std::size_t >                  mMissedHashQueue; ///< The hashes of mMissedHashes, oldest first
+  std::size_t                                 mMissedHashIndex; ///< The oldest hash in mMissedHashQueue, once it's full
   bool                                        mDebugEnabled:1;
   bool                                        mPreMultiplyOnLoad:1; ///< Local store for this flag
+  bool                                        mShaderVariantsAdded:1; ///< Whether the shader variants of the visuals were recorded
 };
 
 /**
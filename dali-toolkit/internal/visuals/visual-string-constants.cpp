@@ -113,6 +113,8 @@ const char * const CURRENT_FRAME_NUMBER_NAME( "currentFrameNumber" );
 const char * const TOTAL_FRAME_NUMBER_NAME( "totalFrameNumber" );
 const char * const STOP_BEHAVIOR_NAME( "stopBehavior" );
 const char * const LOOPING_MODE_NAME( "loopingMode" );
+const char * const SHARE_ANIMATION_NAME( "shareAnimation" );
+const char * const FRAME_DROP_POLICY_NAME( "frameDropPolicy" );
 const char * const IMAGE_ATLASING( "atlasing" );
 const char * const SYNCHRONOUS_LOADING( "synchronousLoading" );
 const char * const IMAGE_FITTING_MODE( "fittingMode" );
@@ -135,6 +137,7 @@ const char * const SHADOW_PROPERTY( "shadow" );
 const char * const UNDERLINE_PROPERTY( "underline" );
 const char * const OUTLINE_PROPERTY( "outline" );
 const char * const BACKGROUND_PROPERTY( "textBackground" );
+const char * const SHARE_TEXTURE_PROPERTY( "shareTexture" );
 
 
 //NPatch visual
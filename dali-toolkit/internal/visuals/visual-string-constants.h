@@ -97,6 +97,8 @@ extern const char * const CURRENT_FRAME_NUMBER_NAME;
 extern const char * const TOTAL_FRAME_NUMBER_NAME;
 extern const char * const STOP_BEHAVIOR_NAME;
 extern const char * const LOOPING_MODE_NAME;
+extern const char * const SHARE_ANIMATION_NAME;
+extern const char * const FRAME_DROP_POLICY_NAME;
 extern const char * const IMAGE_ATLASING;
 extern const char * const SYNCHRONOUS_LOADING;
 extern const char * const IMAGE_FITTING_MODE;
@@ -119,6 +121,7 @@ extern const char * const SHADOW_PROPERTY;
 extern const char * const UNDERLINE_PROPERTY;
 extern const char * const OUTLINE_PROPERTY;
 extern const char * const BACKGROUND_PROPERTY;
+extern const char * const SHARE_TEXTURE_PROPERTY;
 
 //NPatch visual
 extern const char * const BORDER_ONLY;
@@ -101,10 +101,12 @@ VisualUrl::Type ResolveType( const std::string& url )
     char GIF[ 4 ] = { 'f', 'i', 'g', '.' };
     char WEBP[ 5 ] = { 'p', 'b', 'e', 'w', '.' };
     char JSON[ 5 ] = { 'n', 'o', 's', 'j', '.' };
+    char KTX[ 4 ] = { 'x', 't', 'k', '.' };
     unsigned int svgScore = 0;
     unsigned int gifScore = 0;
     unsigned int webpScore = 0;
     unsigned int jsonScore = 0;
+    unsigned int ktxScore = 0;
     int index = count;
     while( --index >= 0 )
     {
@@ -142,6 +144,14 @@ VisualUrl::Type ResolveType( const std::string& url )
           return VisualUrl::JSON;
         }
       }
+      if( ( offsetFromEnd < sizeof(KTX) )&&( currentChar == KTX[ offsetFromEnd ] ) )
+      {
+        // early out if KTX as can't be used in N patch for now
+        if( ++ktxScore == sizeof(KTX) )
+        {
+          return VisualUrl::KTX;
+        }
+      }
       switch( state )
       {
         case SUFFIX:
@@ -42,7 +42,8 @@ public:
     SVG,
     GIF,
     WEBP,
-    JSON
+    JSON,
+    KTX
   };
 
   enum ProtocolType
@@ -25,6 +25,7 @@
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
+#include <dali-toolkit/internal/helpers/shader-registry.h>
 
 namespace Dali
 {
@@ -85,6 +86,11 @@ WireframeVisualPtr WireframeVisual::New( VisualFactoryCache& factoryCache, const
   return New(factoryCache, emtptyVisual, properties);
 }
 
+void WireframeVisual::AddShaderVariants( ShaderRegistry& registry )
+{
+  registry.AddVariant( "WireframeVisual", VERTEX_SHADER, FRAGMENT_SHADER );
+}
+
 WireframeVisualPtr WireframeVisual::New( VisualFactoryCache& factoryCache, Visual::BasePtr actualVisual )
 {
   return new WireframeVisual( factoryCache, actualVisual );
@@ -183,7 +189,7 @@ void WireframeVisual::InitializeRenderer()
   Shader shader = mFactoryCache.GetShader( VisualFactoryCache::WIREFRAME_SHADER );
   if( !shader )
   {
-    shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+    shader = ShaderRegistry::Get().GetShader( "WireframeVisual", VERTEX_SHADER, FRAGMENT_SHADER );
     mFactoryCache.SaveShader( VisualFactoryCache::WIREFRAME_SHADER, shader );
   }
 
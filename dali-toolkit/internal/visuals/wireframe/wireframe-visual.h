@@ -33,6 +33,7 @@ namespace Toolkit
 namespace Internal
 {
 
+class ShaderRegistry;
 class WireframeVisual;
 typedef IntrusivePtr< WireframeVisual > WireframeVisualPtr;
 
@@ -52,6 +53,13 @@ public:
    */
   static WireframeVisualPtr New( VisualFactoryCache& factoryCache, const Property::Map& properties );
 
+  /**
+   * @brief Records the shader variants of the visual, so they may be warmed up before their first use.
+   *
+   * @param[in] registry The shader registry
+   */
+  static void AddShaderVariants( ShaderRegistry& registry );
+
   /**
    * @brief Create a new wireframe visual with an encapsulated actual visual.
    *